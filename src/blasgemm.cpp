@@ -0,0 +1,155 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(USE_CBLAS)
+    #include <cblas.h>
+#elif defined(USE_DLBLAS)
+    #if defined(_WIN32) || defined(WIN32)
+        #include <windows.h>
+    #else
+        #include <dlfcn.h>
+    #endif
+#endif
+
+#include "blasgemm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace libsrcnn {
+
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined(USE_CBLAS)
+
+void cblasSgemm( unsigned m, unsigned n, unsigned k,
+                 const float* a, unsigned lda,
+                 const float* b, unsigned ldb,
+                 float* c, unsigned ldc )
+{
+    cblas_sgemm( CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                 m, n, k, 1.f, a, lda, b, ldb, 0.f, c, ldc );
+}
+
+SgemmFunc systemSgemm()
+{
+    return cblasSgemm;
+}
+
+const char* systemSgemmName()
+{
+    return "cblas";
+}
+
+#elif defined(USE_DLBLAS)
+
+// values of CBLAS enumerations, same for every implementation.
+#define CBLAS_ROW_MAJOR     101
+#define CBLAS_NO_TRANS      111
+
+typedef void (*CblasSgemmFunc)( int, int, int, int, int, int,
+                                float, const float*, int,
+                                const float*, int,
+                                float, float*, int );
+
+static const char* blas_libraries[] = \
+{
+#if defined(_WIN32) || defined(WIN32)
+    "libopenblas.dll",
+    "libblis.dll",
+    "mkl_rt.dll",
+#elif defined(__APPLE__)
+    "/System/Library/Frameworks/Accelerate.framework/Accelerate",
+    "libopenblas.dylib",
+    "libblis.dylib",
+#else
+    "libopenblas.so.0",
+    "libopenblas.so",
+    "libblis.so.4",
+    "libblis.so",
+    "libmkl_rt.so",
+    "libcblas.so.3",
+    "libblas.so.3",
+#endif
+    NULL
+};
+
+static CblasSgemmFunc   dl_sgemm   = NULL;
+static const char*      dl_library = NULL;
+
+bool loadBlas()
+{
+    for ( unsigned cnt=0; blas_libraries[cnt] != NULL; cnt++ )
+    {
+#if defined(_WIN32) || defined(WIN32)
+        HMODULE hlib = LoadLibraryA( blas_libraries[cnt] );
+
+        if ( hlib == NULL )
+            continue;
+
+        dl_sgemm = (CblasSgemmFunc)GetProcAddress( hlib, "cblas_sgemm" );
+
+        if ( dl_sgemm == NULL )
+        {
+            FreeLibrary( hlib );
+            continue;
+        }
+#else
+        void* hlib = dlopen( blas_libraries[cnt], RTLD_NOW | RTLD_LOCAL );
+
+        if ( hlib == NULL )
+            continue;
+
+        dl_sgemm = (CblasSgemmFunc)dlsym( hlib, "cblas_sgemm" );
+
+        if ( dl_sgemm == NULL )
+        {
+            dlclose( hlib );
+            continue;
+        }
+#endif
+        // library stays loaded until process ends.
+        dl_library = blas_libraries[cnt];
+        return true;
+    }
+
+    return false;
+}
+
+void dlblasSgemm( unsigned m, unsigned n, unsigned k,
+                  const float* a, unsigned lda,
+                  const float* b, unsigned ldb,
+                  float* c, unsigned ldc )
+{
+    dl_sgemm( CBLAS_ROW_MAJOR, CBLAS_NO_TRANS, CBLAS_NO_TRANS,
+              m, n, k, 1.f, a, lda, b, ldb, 0.f, c, ldc );
+}
+
+SgemmFunc systemSgemm()
+{
+    // looked up once, initialization of local static is thread safe.
+    static const bool loaded = loadBlas();
+
+    return ( loaded == true ) ? dlblasSgemm : NULL;
+}
+
+const char* systemSgemmName()
+{
+    return ( systemSgemm() != NULL ) ? dl_library : "internal";
+}
+
+#else
+
+SgemmFunc systemSgemm()
+{
+    return NULL;
+}
+
+const char* systemSgemmName()
+{
+    return "internal";
+}
+
+#endif /// of USE_CBLAS, USE_DLBLAS
+
+}; /// of namespace libsrcnn
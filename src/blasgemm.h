@@ -0,0 +1,31 @@
+#ifndef __BLASGEMM_H__
+#define __BLASGEMM_H__
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Single precision GEMM of system BLAS, for layers of channels last.
+//
+// * USE_CBLAS  : cblas_sgemm() of CBLAS library linked at build time
+//                ( OpenBLAS, BLIS, MKL ... ).
+// * USE_DLBLAS : cblas_sgemm() looked up in known libraries at runtime.
+//
+// None of these, or nothing found, then internal kernels run the layers.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+namespace libsrcnn {
+
+// C[m][n] = A[m][k] x B[k][n], row major with leading dimensions.
+typedef void (*SgemmFunc)( unsigned m, unsigned n, unsigned k,
+                           const float* a, unsigned lda,
+                           const float* b, unsigned ldb,
+                           float* c, unsigned ldc );
+
+// GEMM of system BLAS, NULL if there is none.
+SgemmFunc systemSgemm();
+// name of library of systemSgemm(), "internal" if there is none.
+const char* systemSgemmName();
+
+}; /// of namespace libsrcnn
+
+#endif /// of __BLASGEMM_H__
@@ -16,7 +16,7 @@ typedef float ConvKernel2[CONV2_FILTERS];
 typedef float ConvKernel21[CONV2_FILTERS][CONV1_FILTERS];
 
 /* The 64 cell bias in the first layer */
-const ConvKernel1 biases_conv1 = \
+constexpr ConvKernel1 biases_conv1 = \
 {
     -4.2348,  -2.8324,  -1.2319, -12.4118, -7.6604,  -18.6080, -4.9620, -2.4832,
     177.2564, -18.7921, -3.4532,  2.6357,  -7.5383,   4.7663,  -5.5272,  1.0427,
@@ -29,7 +29,7 @@ const ConvKernel1 biases_conv1 = \
 };
 
 /* The 64 convolutional kernel(9*9) in the first layer */
-const ConvKernel64_99 weights_conv1_data = \
+constexpr ConvKernel64_99 weights_conv1_data = \
 {
     //01
     -0.0887, +0.0384, -0.0732, -0.1688, -0.0296, +0.0975, +0.0168, -0.0665, +0.0474,
@@ -674,7 +674,7 @@ const ConvKernel64_99 weights_conv1_data = \
 };
 
 /* The 32 cell bias in the second layer */
-const ConvKernel2 biases_conv2 = \
+constexpr ConvKernel2 biases_conv2 = \
 {
     31.4415, 33.8385, 18.0540, 13.1325, 14.8920, 33.5325, 20.6550, 25.8825,
     14.2545, 13.3365, -28.5855, 19.0230, -26.2650, 27.5910, 40.0095, 46.4865,
@@ -683,7 +683,7 @@ const ConvKernel2 biases_conv2 = \
 };
 
 /* The 32 convolutional kernel(64*1) in the first layer */
-const ConvKernel32x64 weights_conv2_data = \
+constexpr ConvKernel32x64 weights_conv2_data = \
 {
     //01
     -0.2400, +0.1037, +0.1117, +0.0435, -0.2373, +0.1215, -0.2368, -0.2855,
@@ -976,10 +976,10 @@ const ConvKernel32x64 weights_conv2_data = \
 };
 
 /* The last cell bias in the third layer */
-const float biases_conv3 = 12.8460f;
+constexpr float biases_conv3 = 12.8460f;
 
 /* The 32 convolutional kernel(5*5) in the third layer */
-const ConvKernel32_55 weights_conv3_data = \
+constexpr ConvKernel32_55 weights_conv3_data = \
 {
     //01
     -0.0173, -0.0067, +0.0284, +0.0179, -0.0081,
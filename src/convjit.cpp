@@ -0,0 +1,699 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+
+#include "convjit.h"
+
+#if defined(USE_JIT) && defined(__x86_64__) && !defined(_WIN32)
+    #define JIT_X64_SYSV
+#endif
+
+#ifdef JIT_X64_SYSV
+    #include <mutex>
+    #include <cpuid.h>
+    #include <sys/mman.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace libsrcnn {
+
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef JIT_X64_SYSV
+
+// kernels kept for shapes, others run by reference kernels.
+#define JIT_MAX_KERNELS     64
+
+// registers of general purpose.
+#define JIT_RAX     0
+#define JIT_RCX     1
+#define JIT_RDX     2
+#define JIT_RSI     6
+#define JIT_RDI     7
+#define JIT_R8      8
+
+// opcode maps and prefixes of VEX.
+#define VEX_0F      1
+#define VEX_0F38    2
+#define VEX_0F3A    3
+#define VEX_NP      0
+#define VEX_66      1
+#define VEX_F3      2
+#define VEX_F2      3
+
+typedef enum
+{
+    JITK_Conv99 = 0,
+    JITK_Conv11,
+    JITK_Conv55
+}JitKernelType;
+
+typedef struct
+{
+    JitKernelType           type;
+    unsigned                shape[4];
+    std::vector<unsigned>   actf;
+    void*                   code;
+    size_t                  codesz;
+}JitKernel;
+
+typedef struct
+{
+    int         inoff;      /// input offset in floats.
+    unsigned    row;        /// row of panel.
+}JitTap;
+
+////////////////////////////////////////////////////////////////////////////////
+
+class JitEmitter
+{
+    public:
+        void byte( uint8_t b )
+        {
+            code.push_back( b );
+        }
+
+        void dword( uint32_t d )
+        {
+            for ( unsigned cnt=0; cnt<4; cnt++ )
+            {
+                byte( ( d >> ( cnt * 8 ) ) & 0xFF );
+            }
+        }
+
+        size_t position()
+        {
+            return code.size();
+        }
+
+        const std::vector<uint8_t>& buffer()
+        {
+            return code;
+        }
+
+    public:
+        // ymm / xmm op with register rm.
+        void vexRR( uint8_t opc, unsigned map, unsigned pp, bool l256,
+                    unsigned reg, unsigned vvvv, unsigned rm )
+        {
+            vexPrefix( map, pp, l256, reg, vvvv, rm );
+            byte( opc );
+            byte( 0xC0 | ( ( reg & 7 ) << 3 ) | ( rm & 7 ) );
+        }
+
+        // ymm / xmm op with memory of [base + disp].
+        void vexRM( uint8_t opc, unsigned map, unsigned pp, bool l256,
+                    unsigned reg, unsigned vvvv, unsigned base, int disp )
+        {
+            vexPrefix( map, pp, l256, reg, vvvv, base );
+            byte( opc );
+            modrmMem( reg, base, disp );
+        }
+
+        void vxorps( unsigned dst )
+        {
+            vexRR( 0x57, VEX_0F, VEX_NP, true, dst, dst, dst );
+        }
+
+        void vmovupsLoad( unsigned dst, unsigned base, int disp )
+        {
+            vexRM( 0x10, VEX_0F, VEX_NP, true, dst, 0, base, disp );
+        }
+
+        void vmovupsStore( unsigned base, int disp, unsigned src )
+        {
+            vexRM( 0x11, VEX_0F, VEX_NP, true, src, 0, base, disp );
+        }
+
+        void vbroadcastss( unsigned dst, unsigned base, int disp )
+        {
+            vexRM( 0x18, VEX_0F38, VEX_66, true, dst, 0, base, disp );
+        }
+
+        void vfmadd231ps( unsigned dst, unsigned src1, unsigned src2 )
+        {
+            vexRR( 0xB8, VEX_0F38, VEX_66, true, dst, src1, src2 );
+        }
+
+        void vfmadd231psMem( unsigned dst, unsigned src1, unsigned base, int disp )
+        {
+            vexRM( 0xB8, VEX_0F38, VEX_66, true, dst, src1, base, disp );
+        }
+
+        void vaddpsMem( unsigned dst, unsigned base, int disp )
+        {
+            vexRM( 0x58, VEX_0F, VEX_NP, true, dst, dst, base, disp );
+        }
+
+        void vandpsMem( unsigned dst, unsigned base, int disp )
+        {
+            vexRM( 0x54, VEX_0F, VEX_NP, true, dst, dst, base, disp );
+        }
+
+        void vmaxps( unsigned dst, unsigned src )
+        {
+            vexRR( 0x5F, VEX_0F, VEX_NP, true, dst, dst, src );
+        }
+
+        // horizontal sum of ymm into low float of its xmm, tmp is broken.
+        void hsum( unsigned dst, unsigned tmp )
+        {
+            // vextractf128 xmm(tmp), ymm(dst), 1
+            vexRR( 0x19, VEX_0F3A, VEX_66, true, dst, 0, tmp );
+            byte( 1 );
+            // vaddps xmm, xmm, xmm
+            vexRR( 0x58, VEX_0F, VEX_NP, false, dst, dst, tmp );
+            // vhaddps xmm, xmm, xmm twice
+            vexRR( 0x7C, VEX_0F, VEX_F2, false, dst, dst, dst );
+            vexRR( 0x7C, VEX_0F, VEX_F2, false, dst, dst, dst );
+        }
+
+        void vaddssMem( unsigned dst, unsigned base, int disp )
+        {
+            vexRM( 0x58, VEX_0F, VEX_F3, false, dst, dst, base, disp );
+        }
+
+        void vmaxssMem( unsigned dst, unsigned base, int disp )
+        {
+            vexRM( 0x5F, VEX_0F, VEX_F3, false, dst, dst, base, disp );
+        }
+
+        void vminssMem( unsigned dst, unsigned base, int disp )
+        {
+            vexRM( 0x5D, VEX_0F, VEX_F3, false, dst, dst, base, disp );
+        }
+
+        void vmovssStore( unsigned base, int disp, unsigned src )
+        {
+            vexRM( 0x11, VEX_0F, VEX_F3, false, src, 0, base, disp );
+        }
+
+        void vaddps( unsigned dst, unsigned src )
+        {
+            vexRR( 0x58, VEX_0F, VEX_NP, true, dst, dst, src );
+        }
+
+        void movImm( unsigned reg, uint32_t imm )
+        {
+            byte( 0x48 | ( reg >> 3 ) );
+            byte( 0xC7 );
+            byte( 0xC0 | ( reg & 7 ) );
+            dword( imm );
+        }
+
+        void addImm( unsigned reg, uint32_t imm )
+        {
+            byte( 0x48 | ( reg >> 3 ) );
+            byte( 0x81 );
+            byte( 0xC0 | ( reg & 7 ) );
+            dword( imm );
+        }
+
+        void dec( unsigned reg )
+        {
+            byte( 0x48 | ( reg >> 3 ) );
+            byte( 0xFF );
+            byte( 0xC8 | ( reg & 7 ) );
+        }
+
+        void jnz( size_t target )
+        {
+            byte( 0x0F );
+            byte( 0x85 );
+            dword( (uint32_t)( (int64_t)target - (int64_t)( position() + 4 ) ) );
+        }
+
+        void vzeroupperRet()
+        {
+            byte( 0xC5 );
+            byte( 0xF8 );
+            byte( 0x77 );
+            byte( 0xC3 );
+        }
+
+    private:
+        // always 3 bytes VEX, no index register.
+        void vexPrefix( unsigned map, unsigned pp, bool l256,
+                        unsigned reg, unsigned vvvv, unsigned rm )
+        {
+            byte( 0xC4 );
+            byte( ( ( ~reg >> 3 ) & 1 ) << 7 | 1 << 6 | ( ( ~rm >> 3 ) & 1 ) << 5 | map );
+            byte( ( ( ~vvvv ) & 15 ) << 3 | ( l256 ? 1 : 0 ) << 2 | pp );
+        }
+
+        void modrmMem( unsigned reg, unsigned base, int disp )
+        {
+            unsigned mod = 2;
+
+            if ( ( disp == 0 ) && ( ( base & 7 ) != 5 ) )
+            {
+                mod = 0;
+            }
+            else
+            if ( ( disp >= -128 ) && ( disp <= 127 ) )
+            {
+                mod = 1;
+            }
+
+            byte( mod << 6 | ( reg & 7 ) << 3 | ( base & 7 ) );
+
+            // rsp, r12 need SIB.
+            if ( ( base & 7 ) == 4 )
+            {
+                byte( 0x24 );
+            }
+
+            if ( mod == 1 )
+            {
+                byte( (uint8_t)disp );
+            }
+            else
+            if ( mod == 2 )
+            {
+                dword( (uint32_t)disp );
+            }
+        }
+
+    private:
+        std::vector<uint8_t> code;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+static std::mutex               jit_lock;
+static std::vector<JitKernel>   jit_kernels;
+static bool                     jit_disabled = false;
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool checkCPU()
+{
+    unsigned a = 0, b = 0, c = 0, d = 0;
+
+    if ( __get_cpuid( 1, &a, &b, &c, &d ) == 0 )
+        return false;
+
+    // FMA, OSXSAVE and AVX.
+    if ( ( c & ( 1U << 12 ) ) == 0 || ( c & ( 1U << 27 ) ) == 0
+         || ( c & ( 1U << 28 ) ) == 0 )
+        return false;
+
+    // registers of ymm saved by system.
+    unsigned lo = 0, hi = 0;
+    __asm__ __volatile__ ( "xgetbv" : "=a"( lo ), "=d"( hi ) : "c"( 0 ) );
+
+    if ( ( lo & 6 ) != 6 )
+        return false;
+
+    if ( __get_cpuid_count( 7, 0, &a, &b, &c, &d ) == 0 )
+        return false;
+
+    // AVX2.
+    return ( b & ( 1U << 5 ) ) != 0;
+}
+
+/* --
+ * Broadcast of an input times a row of panel, for P pixels and G chunks
+ * of 8 filters at once : accumulators are ymm0 ~ ymm(P*G-1), broadcasts
+ * follow them, and last one is a chunk of panel.
+ *  rdi = input, rsi = output, rdx = panel, rcx = bias, r8 = mask.
+ */
+void emitBroadcastBlock( JitEmitter &e, const JitTap* taps, unsigned tapsz,
+                         unsigned P, unsigned G, unsigned instep,
+                         unsigned cout, bool masked )
+{
+    unsigned chunks = cout / 8;
+    unsigned bc     = P * G;
+    unsigned w      = bc + P;
+
+    for ( unsigned g=0; g<chunks; g+=G )
+    {
+        for ( unsigned r=0; r<P * G; r++ )
+        {
+            e.vxorps( r );
+        }
+
+        for ( unsigned t=0; t<tapsz; t++ )
+        {
+            for ( unsigned p=0; p<P; p++ )
+            {
+                e.vbroadcastss( bc + p, JIT_RDI, ( p * instep + taps[t].inoff ) * 4 );
+            }
+
+            for ( unsigned c=0; c<G; c++ )
+            {
+                e.vmovupsLoad( w, JIT_RDX, ( taps[t].row * cout + ( g + c ) * 8 ) * 4 );
+
+                for ( unsigned p=0; p<P; p++ )
+                {
+                    e.vfmadd231ps( p * G + c, bc + p, w );
+                }
+            }
+        }
+
+        // threshold with zero, after bias.
+        e.vxorps( bc );
+
+        for ( unsigned p=0; p<P; p++ )
+        {
+            for ( unsigned c=0; c<G; c++ )
+            {
+                int off = ( g + c ) * 8 * 4;
+
+                e.vaddpsMem( p * G + c, JIT_RCX, off );
+                e.vmaxps( p * G + c, bc );
+
+                if ( masked == true )
+                {
+                    e.vandpsMem( p * G + c, JIT_R8, off );
+                }
+
+                e.vmovupsStore( JIT_RSI, p * cout * 4 + off, p * G + c );
+            }
+        }
+    }
+}
+
+void emitBroadcastConv( JitEmitter &e, const JitTap* taps, unsigned tapsz,
+                        unsigned width, unsigned instep, unsigned cout,
+                        bool masked )
+{
+    unsigned chunks = cout / 8;
+    unsigned G      = ( chunks % 4 == 0 ) ? 4 : ( ( chunks % 2 == 0 ) ? 2 : 1 );
+    unsigned P      = ( G == 4 ) ? 3 : ( ( G == 2 ) ? 4 : 7 );
+    unsigned blocks = width / P;
+    unsigned tail   = width % P;
+
+    if ( blocks > 0 )
+    {
+        e.movImm( JIT_RAX, blocks );
+
+        size_t loop = e.position();
+
+        emitBroadcastBlock( e, taps, tapsz, P, G, instep, cout, masked );
+
+        e.addImm( JIT_RDI, P * instep * 4 );
+        e.addImm( JIT_RSI, P * cout * 4 );
+        e.dec( JIT_RAX );
+        e.jnz( loop );
+    }
+
+    if ( tail > 0 )
+    {
+        emitBroadcastBlock( e, taps, tapsz, tail, G, instep, cout, masked );
+    }
+
+    e.vzeroupperRet();
+}
+
+/* --
+ * P pixels of last layer at once, two accumulators of a pixel,
+ * ymm8 has a chunk of panel.
+ *  rdi = input, rsi = output, rdx = panel, rcx = consts.
+ */
+void emitConv55Block( JitEmitter &e, unsigned P, unsigned rowstride,
+                      unsigned ksz, unsigned cin )
+{
+    const unsigned w = 8;
+
+    for ( unsigned r=0; r<P * 2; r++ )
+    {
+        e.vxorps( r );
+    }
+
+    for ( unsigned y=0; y<ksz; y++ )
+    {
+        for ( unsigned x=0; x<ksz; x++ )
+        {
+            for ( unsigned c=0; c<cin / 8; c++ )
+            {
+                e.vmovupsLoad( w, JIT_RDX, ( ( y * ksz + x ) * cin + c * 8 ) * 4 );
+
+                for ( unsigned p=0; p<P; p++ )
+                {
+                    e.vfmadd231psMem( p * 2 + ( c & 1 ), w, JIT_RDI,
+                                      ( y * rowstride + ( x + p ) * cin + c * 8 ) * 4 );
+                }
+            }
+        }
+    }
+
+    for ( unsigned p=0; p<P; p++ )
+    {
+        e.vaddps( p * 2, p * 2 + 1 );
+        e.hsum( p * 2, p * 2 + 1 );
+        e.vaddssMem( p * 2, JIT_RCX, 0 );
+        e.vmaxssMem( p * 2, JIT_RCX, 4 );
+        e.vminssMem( p * 2, JIT_RCX, 8 );
+        e.vmovssStore( JIT_RSI, p * 4, p * 2 );
+    }
+}
+
+void emitConv55( JitEmitter &e, unsigned count, unsigned rowstride,
+                 unsigned ksz, unsigned cin )
+{
+    const unsigned P = 4;
+    unsigned blocks  = count / P;
+    unsigned tail    = count % P;
+
+    if ( blocks > 0 )
+    {
+        e.movImm( JIT_RAX, blocks );
+
+        size_t loop = e.position();
+
+        emitConv55Block( e, P, rowstride, ksz, cin );
+
+        e.addImm( JIT_RDI, P * cin * 4 );
+        e.addImm( JIT_RSI, P * 4 );
+        e.dec( JIT_RAX );
+        e.jnz( loop );
+    }
+
+    if ( tail > 0 )
+    {
+        emitConv55Block( e, tail, rowstride, ksz, cin );
+    }
+
+    e.vzeroupperRet();
+}
+
+void* installCode( JitEmitter &e, size_t &codesz )
+{
+    const std::vector<uint8_t> &code = e.buffer();
+
+    codesz = code.size();
+
+    void* mem = mmap( NULL, codesz, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+    if ( mem == MAP_FAILED )
+        return NULL;
+
+    memcpy( mem, code.data(), codesz );
+
+    // never writable and executable at once.
+    if ( mprotect( mem, codesz, PROT_READ | PROT_EXEC ) != 0 )
+    {
+        munmap( mem, codesz );
+        return NULL;
+    }
+
+    return mem;
+}
+
+void* findKernel( JitKernelType type, const unsigned* shape,
+                  const unsigned* actf, unsigned actfsz )
+{
+    for ( size_t cnt=0; cnt<jit_kernels.size(); cnt++ )
+    {
+        JitKernel &k = jit_kernels[cnt];
+
+        if ( ( k.type == type ) && ( memcmp( k.shape, shape, sizeof( k.shape ) ) == 0 )
+             && ( k.actf.size() == actfsz )
+             && ( ( actfsz == 0 )
+                  || ( memcmp( k.actf.data(), actf, actfsz * sizeof( unsigned ) ) == 0 ) ) )
+        {
+            return k.code;
+        }
+    }
+
+    return NULL;
+}
+
+void* makeKernel( JitKernelType type, const unsigned* shape,
+                  const unsigned* actf, unsigned actfsz, bool* generated )
+{
+    if ( generated != NULL )
+        *generated = false;
+
+    if ( jitAvailable() == false )
+        return NULL;
+
+    std::lock_guard<std::mutex> guard( jit_lock );
+
+    if ( jit_disabled == true )
+        return NULL;
+
+    void* code = findKernel( type, shape, actf, actfsz );
+
+    if ( ( code != NULL ) || ( jit_kernels.size() >= JIT_MAX_KERNELS ) )
+        return code;
+
+    JitEmitter e;
+
+    switch( type )
+    {
+        case JITK_Conv99:
+            {
+                // width, stride, ksz, cout
+                std::vector<JitTap> taps( shape[2] * shape[2] );
+
+                for ( unsigned y=0; y<shape[2]; y++ )
+                {
+                    for ( unsigned x=0; x<shape[2]; x++ )
+                    {
+                        taps[ y * shape[2] + x ].inoff = y * shape[1] + x;
+                        taps[ y * shape[2] + x ].row   = y * shape[2] + x;
+                    }
+                }
+
+                emitBroadcastConv( e, taps.data(), taps.size(),
+                                   shape[0], 1, shape[3], true );
+            }
+            break;
+
+        case JITK_Conv11:
+            {
+                // width, cin, cout
+                std::vector<JitTap> taps( actfsz );
+
+                for ( unsigned n=0; n<actfsz; n++ )
+                {
+                    taps[n].inoff = actf[n];
+                    taps[n].row   = actf[n];
+                }
+
+                emitBroadcastConv( e, taps.data(), taps.size(),
+                                   shape[0], shape[1], shape[2], false );
+            }
+            break;
+
+        case JITK_Conv55:
+            // count, width, ksz, cin
+            emitConv55( e, shape[0], shape[1] * shape[3], shape[2], shape[3] );
+            break;
+    }
+
+    JitKernel k;
+    k.type = type;
+    memcpy( k.shape, shape, sizeof( k.shape ) );
+    k.actf.assign( actf, actf + actfsz );
+    k.code = installCode( e, k.codesz );
+
+    if ( k.code == NULL )
+        return NULL;
+
+    jit_kernels.push_back( k );
+
+    if ( generated != NULL )
+        *generated = true;
+
+    return k.code;
+}
+
+bool jitAvailable()
+{
+    // asked once, initialization of local static is thread safe.
+    static const bool cpuok = checkCPU();
+
+    return cpuok;
+}
+
+JitConv99Row jitConv99Row( unsigned width, unsigned stride,
+                           unsigned ksz, unsigned cout, bool* generated )
+{
+    if ( ( width == 0 ) || ( cout % 8 != 0 ) )
+        return NULL;
+
+    unsigned shape[4] = { width, stride, ksz, cout };
+
+    return (JitConv99Row)makeKernel( JITK_Conv99, shape, NULL, 0, generated );
+}
+
+JitConv11Row jitConv11Row( unsigned width, unsigned cin, unsigned cout,
+                           const unsigned* actf, unsigned actfsz,
+                           bool* generated )
+{
+    if ( ( width == 0 ) || ( cout % 8 != 0 ) )
+        return NULL;
+
+    unsigned shape[4] = { width, cin, cout, 0 };
+
+    return (JitConv11Row)makeKernel( JITK_Conv11, shape, actf, actfsz, generated );
+}
+
+JitConv55Row jitConv55Row( unsigned count, unsigned width,
+                           unsigned ksz, unsigned cin, bool* generated )
+{
+    if ( ( count == 0 ) || ( cin % 8 != 0 ) )
+        return NULL;
+
+    unsigned shape[4] = { count, width, ksz, cin };
+
+    return (JitConv55Row)makeKernel( JITK_Conv55, shape, NULL, 0, generated );
+}
+
+void disableJit()
+{
+    std::lock_guard<std::mutex> guard( jit_lock );
+
+    // kernels may be running in other threads, kept mapped.
+    jit_disabled = true;
+}
+
+#else
+
+bool jitAvailable()
+{
+    return false;
+}
+
+JitConv99Row jitConv99Row( unsigned width, unsigned stride,
+                           unsigned ksz, unsigned cout, bool* generated )
+{
+    if ( generated != NULL )
+        *generated = false;
+
+    return NULL;
+}
+
+JitConv11Row jitConv11Row( unsigned width, unsigned cin, unsigned cout,
+                           const unsigned* actf, unsigned actfsz,
+                           bool* generated )
+{
+    if ( generated != NULL )
+        *generated = false;
+
+    return NULL;
+}
+
+JitConv55Row jitConv55Row( unsigned count, unsigned width,
+                           unsigned ksz, unsigned cin, bool* generated )
+{
+    if ( generated != NULL )
+        *generated = false;
+
+    return NULL;
+}
+
+void disableJit()
+{
+}
+
+#endif /// of JIT_X64_SYSV
+
+}; /// of namespace libsrcnn
@@ -0,0 +1,46 @@
+#ifndef __CONVJIT_H__
+#define __CONVJIT_H__
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Convolution kernels of channels last layers generated at runtime.
+//
+// Code is emitted for AVX2 and FMA of x86-64 ( System V calling ),
+// specialized to width of image, row stride, kernel size and channels,
+// so register blocks, loop counts and offsets are immediates.
+// Built with USE_JIT only, kernels are NULL for other CPU or system,
+// then reference kernels of libsrcnn.cpp run.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+namespace libsrcnn {
+
+// a row of layer I, window of first pixel at img ( haloed plane ),
+// masked filters of pruning are zero.
+typedef void (*JitConv99Row)( const float* img, float* out,
+                              const float* panel, const float* bias,
+                              const float* mask );
+// a row of 1x1 layer, only active input channels multiplied.
+typedef void (*JitConv11Row)( const float* in, float* out,
+                              const float* panel, const float* bias );
+// inner pixels of a row of last layer, window of first pixel at in,
+// consts are bias, 0 and 255.
+typedef void (*JitConv55Row)( const float* in, float* out,
+                              const float* panel, const float* consts );
+
+// CPU and system can run generated kernels.
+bool jitAvailable();
+// kernels, cached by its shape, generated is set for new one.
+JitConv99Row jitConv99Row( unsigned width, unsigned stride,
+                           unsigned ksz, unsigned cout, bool* generated );
+JitConv11Row jitConv11Row( unsigned width, unsigned cin, unsigned cout,
+                           const unsigned* actf, unsigned actfsz,
+                           bool* generated );
+JitConv55Row jitConv55Row( unsigned count, unsigned width,
+                           unsigned ksz, unsigned cin, bool* generated );
+// stops handing out kernels ( eg. failed validation ).
+void disableJit();
+
+}; /// of namespace libsrcnn
+
+#endif /// of __CONVJIT_H__
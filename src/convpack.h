@@ -0,0 +1,112 @@
+#ifndef __CONVPACK_H__
+#define __CONVPACK_H__
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Weight panels packed at compile time.
+//
+// Kernels run over many filters at once need weights of a tap ( or an
+// input channel ) next to each other, not [filter][row][column] order
+// of convdata.h. These constexpr transforms make the panels while
+// compiling, so they are placed in read only data as it is, nothing
+// repacked at start-up and pages are shared by processes.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// alignment of panels, a cache line.
+#define CONV_PANEL_ALIGN        64
+
+namespace libsrcnn {
+
+template <unsigned N, unsigned K>
+struct alignas(CONV_PANEL_ALIGN) ConvPanel
+{
+    float   data[ K * K * N ];  /// [row][column][filter]
+};
+
+template <unsigned R, unsigned C>
+struct alignas(CONV_PANEL_ALIGN) ConvMatrix
+{
+    float   data[ R * C ];      /// [row][column]
+};
+
+// [filter][row][column] to [row][column][filter].
+template <unsigned N, unsigned K>
+constexpr ConvPanel<N,K> packFilterPanel( const float (&w)[N][K][K] )
+{
+    ConvPanel<N,K> panel = {};
+
+    for ( unsigned k=0; k<N; k++ )
+    {
+        for ( unsigned y=0; y<K; y++ )
+        {
+            for ( unsigned x=0; x<K; x++ )
+            {
+                panel.data[ ( y * K + x ) * N + k ] = w[k][y][x];
+            }
+        }
+    }
+
+    return panel;
+}
+
+// [filter][column][row] to [row][column][filter].
+template <unsigned N, unsigned K>
+constexpr ConvPanel<N,K> packFilterPanelCM( const float (&w)[N][K][K] )
+{
+    ConvPanel<N,K> panel = {};
+
+    for ( unsigned k=0; k<N; k++ )
+    {
+        for ( unsigned y=0; y<K; y++ )
+        {
+            for ( unsigned x=0; x<K; x++ )
+            {
+                panel.data[ ( y * K + x ) * N + k ] = w[k][x][y];
+            }
+        }
+    }
+
+    return panel;
+}
+
+// [output][input] of 1x1 layer to [input][output].
+template <unsigned R, unsigned C>
+constexpr ConvMatrix<C,R> packTransposed( const float (&w)[R][C] )
+{
+    ConvMatrix<C,R> mat = {};
+
+    for ( unsigned r=0; r<R; r++ )
+    {
+        for ( unsigned c=0; c<C; c++ )
+        {
+            mat.data[ c * R + r ] = w[r][c];
+        }
+    }
+
+    return mat;
+}
+
+// [filter][column][row] to [filter][row][column].
+template <unsigned N, unsigned K>
+constexpr ConvMatrix<N,K*K> packKernelsRowMajor( const float (&w)[N][K][K] )
+{
+    ConvMatrix<N,K*K> mat = {};
+
+    for ( unsigned k=0; k<N; k++ )
+    {
+        for ( unsigned y=0; y<K; y++ )
+        {
+            for ( unsigned x=0; x<K; x++ )
+            {
+                mat.data[ ( k * K + y ) * K + x ] = w[k][x][y];
+            }
+        }
+    }
+
+    return mat;
+}
+
+}; /// of namespace libsrcnn
+
+#endif /// of __CONVPACK_H__
@@ -47,6 +47,8 @@ typedef struct
     unsigned height;
     unsigned depth;
     float *buff;
+    unsigned stride;
+    unsigned halo;
 } ImgF32;
 
 typedef struct
@@ -147,13 +149,35 @@ void saveImgF32(void *img, const char *fname)
 
     ImgF32 *refimg = (ImgF32 *)img;
     ImgU8 imgTmp = {0, 0, 1, NULL};
+    ImgF32 imgPlain = *refimg;
 
-    if (convertF32toU8(refimg, imgTmp) == true)
+    // planes with halo saved without it.
+    if (refimg->halo > 0)
+    {
+        imgPlain.buff = new float[refimg->width * refimg->height];
+        imgPlain.stride = refimg->width;
+        imgPlain.halo = 0;
+
+        const float *org = &refimg->buff[refimg->halo * refimg->stride + refimg->halo];
+
+        for (unsigned row = 0; row < refimg->height; row++)
+        {
+            memcpy(&imgPlain.buff[row * refimg->width], &org[row * refimg->stride],
+                   refimg->width * sizeof(float));
+        }
+    }
+
+    if (convertF32toU8(&imgPlain, imgTmp) == true)
     {
         saveImgU8(&imgTmp, fname);
 
         delete[] imgTmp.buff;
     }
+
+    if (imgPlain.buff != refimg->buff)
+    {
+        delete[] imgPlain.buff;
+    }
 }
 
 void saveImgYCbCr(void *img, const char *fnameprefix)
@@ -0,0 +1,2814 @@
+#ifndef __ESPCNDATA_H__
+#define __ESPCNDATA_H__
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Weights of LR space engine, ESPCN style 5-3-3 network.
+//
+// Layers run at source size, the last layer makes scale x scale phases
+// of residual to bicubic resized Y, shuffled into output pixels.
+// Trained with Y of Pictures/castle.jpg ( 8 flips and rotations ),
+// low resolution made by bicubic of frawscale, Adam for 40000 steps of
+// 16 x 16 patches, mean squared error.
+//
+// Demonstration weights : trained on one image only, they show the engine
+// rather than make a general model. Generated by tools/espcntrain.cpp and
+// tools/espcnexport.py, commands to reproduce are in espcntrain.cpp.
+//
+// Kernels are ordered [row][column], for Y in range of 0 ~ 255.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// the first convolutional layer size
+#define ESPCN_CONV1_FILTERS     32
+#define ESPCN_CONV1_SIZE        5
+
+// the second convolutional layer size
+#define ESPCN_CONV2_FILTERS     16
+#define ESPCN_CONV2_SIZE        3
+
+// the sub-pixel layer, scale x scale filters
+#define ESPCN_CONV3_SIZE        3
+
+typedef float ESPCNKernel1[ESPCN_CONV1_FILTERS][ESPCN_CONV1_SIZE][ESPCN_CONV1_SIZE];
+typedef float ESPCNKernel2[ESPCN_CONV2_FILTERS][ESPCN_CONV1_FILTERS][ESPCN_CONV2_SIZE][ESPCN_CONV2_SIZE];
+typedef float ESPCNBias1[ESPCN_CONV1_FILTERS];
+typedef float ESPCNBias2[ESPCN_CONV2_FILTERS];
+
+/* --------------------------------- x2 --------------------------------- */
+
+/* The 32 cell bias in the first layer */
+const ESPCNBias1 espcn_x2_biases1 = \
+{
+    -8.306103e-03, +1.429783e-01, +2.021447e-01, +4.037806e-03, +1.487536e-01, +5.324279e-02, +8.855860e-02, +4.656030e-02,
+    +5.143862e-02, +1.171909e-01, +3.939138e-03, -2.005022e-03, +1.454441e-02, +1.923703e-01, -3.484179e-02, +8.161119e-02,
+    -6.843107e-02, +2.966444e-01, -4.952191e-02, +5.998585e-01, +2.067628e-01, +3.111371e-01, +1.918679e-01, +1.305154e-01,
+    +2.202885e-01, +1.654938e-02, +2.042230e-01, +1.122240e-01, +4.663050e-01, -1.064258e-02, +1.513714e-01, +3.821871e-01,
+};
+
+/* The 32 convolutional kernel(5*5) in the first layer */
+const ESPCNKernel1 espcn_x2_weights1 = \
+{
+    //01
+    +1.248360e-03, -7.125569e-04, -4.272386e-04, +4.125159e-04, -1.283116e-04,
+    -4.378742e-04, -1.039446e-03, +6.916988e-04, -1.122211e-03, +9.281341e-04,
+    +2.846348e-03, -2.234287e-03, +1.268825e-03, -9.287641e-04, -7.787972e-04,
+    +9.824074e-04, -2.776037e-03, -2.564428e-04, -5.307934e-05, +1.337906e-03,
+    +1.388328e-03, -1.046285e-03, +1.070722e-03, -7.003605e-04, -3.365804e-04,
+    //02
+    -6.852698e-04, +1.002261e-03, +8.134748e-04, -1.642418e-03, +7.590249e-04,
+    +6.377873e-04, -2.525845e-03, -2.453105e-04, +7.237362e-04, +1.204166e-05,
+    +5.827156e-04, +4.905195e-04, +2.827437e-03, +4.805209e-04, -1.052301e-03,
+    -2.484169e-04, -6.432399e-04, -1.062284e-03, +1.192102e-04, +4.704699e-04,
+    +4.648190e-04, +3.293981e-04, -3.789320e-04, -1.082795e-04, +4.996644e-05,
+    //03
+    +3.111892e-04, +4.154382e-05, -1.942734e-04, -4.186762e-04, +9.195278e-04,
+    -4.178944e-04, +1.087858e-03, -6.010634e-04, +1.475740e-03, -9.773296e-04,
+    +2.015340e-04, -2.469137e-03, +1.321969e-03, -9.146691e-05, -9.963202e-04,
+    -8.789611e-04, +5.662596e-04, -4.956315e-04, -1.898791e-05, +3.429117e-04,
+    +8.810404e-04, +1.951455e-04, -4.331511e-04, +6.587832e-04, -1.645816e-04,
+    //04
+    +4.715549e-04, +7.991367e-04, -2.018313e-04, -6.965322e-04, +3.635800e-04,
+    +6.432173e-05, -4.647066e-04, +1.329398e-03, -1.082557e-03, +7.819026e-04,
+    +2.560879e-04, -1.544233e-05, -1.477400e-04, +9.948493e-04, +9.831295e-05,
+    +9.511508e-04, -1.675134e-03, +2.730907e-04, -9.181726e-05, -1.358943e-03,
+    -1.382509e-03, +1.472952e-03, +4.141503e-04, -3.519718e-04, +1.008797e-04,
+    //05
+    -1.222157e-03, +2.482398e-03, -1.877959e-03, +1.467791e-03, -4.943461e-04,
+    +5.908095e-04, -1.881038e-03, +7.053608e-04, -1.170273e-03, +1.149870e-04,
+    +1.239920e-03, -1.004170e-03, +1.717750e-03, +1.847265e-04, -2.396015e-04,
+    -5.184613e-04, +1.209923e-03, -5.228467e-04, -9.581489e-04, +2.188258e-04,
+    -5.130560e-04, +9.238725e-04, -5.438890e-04, +2.338765e-04, +6.000168e-04,
+    //06
+    +1.367609e-04, -1.165134e-03, -1.488325e-03, +1.063579e-03, -3.555940e-04,
+    +1.019452e-03, +1.645760e-03, +1.885708e-03, +2.509200e-03, -2.631962e-04,
+    -9.535286e-04, +7.724574e-06, -1.753808e-03, -5.296823e-04, -1.192452e-03,
+    +5.338542e-04, -3.127657e-03, -1.309178e-03, +3.719329e-04, +5.539280e-04,
+    +5.411240e-04, -6.880157e-04, +5.687485e-04, -2.117715e-04, +6.319295e-05,
+    //07
+    -1.884426e-04, -1.936713e-04, +3.739759e-04, +9.591796e-04, -7.185750e-04,
+    -3.637584e-04, +4.849914e-04, -1.755808e-03, +1.353636e-03, -1.587113e-03,
+    -1.618192e-03, +1.162324e-03, +4.017627e-04, -2.086577e-03, +8.973743e-04,
+    +4.493619e-05, +8.677446e-04, +9.104285e-04, -1.527184e-03, +2.855751e-03,
+    +6.641627e-04, -3.604434e-04, -1.263578e-03, -8.622084e-05, +5.728472e-04,
+    //08
+    -2.645908e-04, +5.217961e-04, +1.366082e-04, -6.076156e-04, +3.813447e-04,
+    -3.976982e-06, +6.515311e-04, -2.914274e-04, +7.854148e-04, -7.438169e-04,
+    +4.744974e-04, -8.925120e-04, +1.756762e-04, -1.930990e-04, +4.535956e-04,
+    -3.584098e-04, +4.269872e-04, -6.822294e-04, -2.415437e-03, -4.667417e-04,
+    -3.188676e-05, -1.067536e-03, +1.704448e-03, +1.354179e-03, +1.602588e-03,
+    //09
+    -3.670369e-04, +6.311089e-04, +1.858205e-03, +3.384963e-05, +7.620782e-04,
+    +6.409399e-04, -1.896488e-03, -1.813534e-03, -9.965909e-04, +9.527713e-05,
+    +2.561156e-04, +5.484427e-04, +1.356830e-03, -1.315708e-04, -3.292864e-04,
+    +3.725607e-05, -1.059899e-03, -6.698060e-04, +1.496589e-04, +2.432467e-04,
+    -4.597077e-04, +1.841357e-03, -1.145829e-03, +9.471973e-04, -2.936872e-04,
+    //10
+    +1.213164e-05, -9.431872e-04, -8.811476e-04, -1.909714e-04, +2.641841e-05,
+    +8.524324e-04, -8.599397e-04, +3.061869e-03, -5.440181e-04, +2.337737e-05,
+    +1.989112e-04, +5.444689e-04, -1.522517e-03, -4.142318e-05, +1.582482e-04,
+    -7.328454e-04, -1.922408e-04, +7.138010e-06, +1.614886e-05, -6.525986e-04,
+    +6.396933e-04, +3.323076e-04, +1.822949e-04, -8.156667e-06, +8.130814e-04,
+    //11
+    -2.410192e-04, -1.535427e-03, +4.899135e-04, +9.782439e-04, +2.408965e-04,
+    +8.422412e-04, +1.354344e-03, +3.267604e-03, -1.632620e-03, -1.726296e-03,
+    +1.694244e-04, -1.457206e-03, -3.007800e-05, -2.417022e-03, +1.192450e-03,
+    -3.011460e-04, +1.092445e-03, +1.675892e-05, +1.010942e-03, -1.845907e-04,
+    +4.025057e-04, -1.174788e-03, +5.555502e-04, -6.755266e-04, +2.252493e-04,
+    //12
+    -1.250580e-04, +4.561104e-04, +5.038869e-04, +2.320688e-04, -4.713611e-04,
+    -1.613419e-03, +1.540763e-03, -3.750628e-04, +3.225522e-04, -2.150384e-04,
+    -1.259056e-03, -5.457200e-04, +8.098149e-04, -6.953678e-06, -2.456901e-04,
+    +1.349901e-03, -5.766127e-04, +1.276594e-03, +1.240405e-05, +6.430096e-04,
+    -1.519037e-03, +1.196253e-03, -1.163835e-04, -6.240577e-04, +1.113241e-04,
+    //13
+    +2.613833e-04, +2.332819e-04, -4.807188e-04, -7.288691e-04, +9.209925e-05,
+    -5.687107e-04, -3.403436e-04, +1.148929e-03, +1.497777e-03, -2.154903e-04,
+    +1.180819e-03, +7.763870e-04, -1.507849e-03, -1.789800e-03, +4.216608e-04,
+    +7.130881e-05, +1.201003e-03, +2.074418e-03, -1.682051e-03, +7.091552e-04,
+    -8.498178e-04, +5.075490e-04, +5.498076e-04, -1.787116e-03, +4.596695e-04,
+    //14
+    -3.892688e-04, +1.312113e-03, +5.790577e-04, -1.403880e-03, -1.757372e-04,
+    +1.345595e-03, -2.401058e-03, +8.417913e-05, +1.793885e-03, +1.436237e-03,
+    -7.222908e-04, +1.110448e-04, +9.130985e-04, -2.461101e-03, -1.314125e-03,
+    +4.362178e-04, -1.370127e-03, +2.724826e-03, -1.037559e-03, +1.318391e-04,
+    +2.742067e-04, -3.426448e-04, +2.874970e-04, -6.999368e-04, -9.545305e-05,
+    //15
+    -5.418364e-04, -1.170013e-03, +3.496442e-04, -4.034138e-04, -3.588712e-04,
+    +7.968758e-05, -4.491044e-04, +1.455052e-03, +5.767054e-04, -3.867450e-04,
+    -9.298057e-05, +2.662885e-03, -6.994179e-04, +2.418676e-04, -1.625109e-04,
+    +6.237240e-04, +1.515995e-03, -2.084900e-04, +1.628767e-03, -1.658435e-03,
+    -1.313302e-03, +5.681794e-04, +7.649648e-04, -1.043595e-03, +3.269213e-05,
+    //16
+    -1.058861e-04, +6.862348e-04, -1.454808e-05, -1.072265e-03, +1.369551e-04,
+    +3.212365e-04, -1.080524e-03, -9.052486e-04, +1.191538e-03, +5.460557e-04,
+    -7.222049e-04, +1.770847e-05, +1.316212e-03, -7.471704e-05, -3.847240e-04,
+    +2.887411e-04, +5.500629e-04, -4.876904e-04, -3.831502e-04, +2.391080e-04,
+    -6.639571e-04, +9.526614e-04, -7.011886e-04, +6.955956e-04, -4.183916e-04,
+    //17
+    +1.066416e-03, -1.379750e-03, -1.622416e-04, -2.054511e-04, +8.023527e-04,
+    -8.014993e-05, -3.098543e-05, +4.844170e-04, -6.034217e-05, +5.862654e-04,
+    +9.315831e-04, -1.579287e-04, -9.845261e-04, -1.039959e-03, +1.086761e-03,
+    +3.569876e-04, -1.682176e-03, +1.676638e-03, +1.675451e-03, +1.001876e-04,
+    +1.026464e-03, -6.767494e-04, -1.399297e-03, -1.358083e-03, +9.413605e-04,
+    //18
+    +2.577466e-04, -1.165971e-03, +4.086713e-04, -2.297084e-04, +9.273762e-05,
+    +4.161793e-04, +6.479830e-04, -4.381129e-04, +3.393042e-04, -7.336148e-05,
+    -2.483302e-03, -7.084513e-04, +4.322743e-04, -1.452852e-03, -2.530769e-04,
+    +8.442935e-04, -1.602724e-03, +2.597688e-03, -1.625843e-03, +1.086881e-03,
+    -7.387311e-05, -3.525615e-04, -4.273830e-05, -1.237731e-04, +2.053061e-04,
+    //19
+    -3.985264e-04, -2.899331e-05, -9.333612e-04, +8.907756e-04, -6.237114e-04,
+    +5.504437e-04, -5.257932e-05, +5.361784e-04, +1.875626e-04, +5.237147e-04,
+    -2.165239e-04, +1.469283e-03, +2.016020e-03, +1.212137e-04, -1.709604e-04,
+    -8.297331e-04, -4.485802e-04, -1.604437e-03, +2.050925e-03, +1.400930e-04,
+    -1.343126e-04, -7.318576e-05, +4.133102e-04, -1.730184e-03, +5.106074e-06,
+    //20
+    +1.741052e-04, -3.142178e-04, -8.177913e-04, -4.449621e-04, +2.819612e-04,
+    -3.255122e-04, +4.360333e-04, +2.034422e-03, +2.831180e-04, +3.134758e-04,
+    -2.813169e-04, +1.667335e-03, -5.902737e-03, -1.736086e-03, +6.381991e-04,
+    -2.758218e-04, -2.345530e-04, -1.346406e-04, -8.384864e-06, -8.627166e-04,
+    +1.159533e-04, +1.263717e-04, +2.260413e-04, +8.337545e-05, +8.833507e-05,
+    //21
+    -7.203606e-04, +1.274665e-03, -1.197778e-03, -1.191596e-04, +7.601558e-04,
+    -6.703817e-04, +4.069273e-04, -1.342244e-03, -1.217840e-03, -5.287220e-05,
+    +6.412864e-04, +7.387592e-05, +1.202016e-03, -3.808062e-04, -6.281861e-05,
+    +4.699742e-05, -3.396949e-04, +1.238985e-03, -1.946992e-03, -1.699963e-04,
+    -1.204010e-03, +1.118199e-03, +5.464855e-04, +1.064980e-03, -7.852952e-04,
+    //22
+    +2.370416e-04, -3.178269e-04, +2.920198e-04, +9.022539e-04, -4.957630e-04,
+    -1.950784e-04, +1.410874e-04, -8.483972e-04, -6.072326e-04, +2.416426e-04,
+    +8.358296e-05, +7.242196e-04, -1.774529e-04, -3.249159e-04, +1.216786e-03,
+    -4.280496e-04, -3.513247e-04, -3.179015e-03, -2.386244e-03, +3.672025e-04,
+    -4.580502e-04, +1.610075e-03, +1.578156e-03, +1.982943e-03, -7.616248e-04,
+    //23
+    -1.957066e-04, +2.439187e-04, -4.412924e-04, +2.740201e-04, -3.182756e-04,
+    +4.902806e-04, +1.284775e-03, +2.285311e-03, -2.351471e-04, +6.148105e-04,
+    -4.150256e-04, -2.285562e-03, -1.206165e-03, +3.333747e-05, +2.386572e-05,
+    +5.793126e-05, -1.326761e-03, -1.079436e-04, -7.907239e-05, -2.951479e-05,
+    +8.124529e-05, +6.804455e-04, -8.393651e-04, +6.921516e-04, -4.744771e-05,
+    //24
+    -5.844107e-04, +1.055742e-03, -1.124131e-03, +3.606077e-04, -1.343257e-04,
+    +8.326052e-04, -1.729864e-03, +1.074598e-03, +1.135658e-03, -8.439623e-04,
+    +3.250326e-04, +1.655410e-04, -5.047297e-04, -1.211678e-03, +1.594180e-03,
+    -1.307573e-04, -8.478043e-04, +2.392358e-04, +1.334855e-03, -1.088453e-03,
+    +2.037810e-04, +2.809632e-04, -2.781338e-04, -8.088910e-04, +5.962720e-04,
+    //25
+    +2.949302e-04, +3.919603e-04, -2.332733e-04, -8.414557e-04, +2.936285e-04,
+    +7.564478e-04, -2.448539e-03, +1.386272e-03, -4.505668e-05, +3.741300e-04,
+    -2.739051e-04, +1.409240e-03, -1.003529e-04, -7.334302e-04, -7.508772e-04,
+    -4.219154e-04, -8.852863e-04, +2.427643e-03, -1.533093e-03, +1.193259e-03,
+    +1.628786e-04, +3.325548e-04, -1.131510e-03, +6.181656e-04, -3.497211e-04,
+    //26
+    +1.259057e-03, -1.257603e-03, +3.730352e-04, +6.259458e-04, -7.287733e-04,
+    +9.820702e-06, -1.109479e-03, -1.023783e-03, -3.170587e-04, +1.444496e-03,
+    +9.588863e-04, +2.224639e-03, -2.138415e-03, +6.782989e-04, -7.924977e-04,
+    -1.516915e-03, +1.826665e-03, -3.894439e-04, +2.776727e-04, -1.516582e-04,
+    -3.538429e-04, +9.789760e-04, -8.293876e-04, +4.433275e-04, -5.656932e-05,
+    //27
+    -4.774967e-04, +6.955610e-04, +2.856277e-04, +1.650409e-04, -2.737526e-04,
+    -1.580576e-05, +9.394762e-04, -3.723855e-04, +3.324504e-04, -1.052643e-03,
+    +7.463670e-04, +1.985964e-03, -2.610105e-03, -1.736454e-03, +6.886717e-04,
+    -2.706838e-04, -9.168577e-04, +1.972183e-04, -2.025257e-04, +1.000008e-03,
+    -1.867592e-04, +3.990018e-04, +7.004977e-05, -8.154762e-04, +1.013293e-03,
+    //28
+    +4.082867e-04, -3.915536e-04, +5.035603e-04, -4.048234e-04, -4.705736e-04,
+    -5.551807e-04, +1.064427e-03, -9.029901e-04, +1.324574e-03, +1.780543e-05,
+    -5.510430e-04, +3.750140e-04, -3.789414e-03, +1.011415e-03, +1.774478e-03,
+    +1.687276e-04, +1.810463e-03, -2.599534e-03, +1.101436e-03, +1.809310e-04,
+    -3.360332e-04, -4.110165e-05, -1.660756e-04, +5.856323e-04, -2.625466e-04,
+    //29
+    +4.595312e-04, -7.841733e-04, +8.838630e-04, +3.787059e-04, +2.664269e-04,
+    +4.985978e-04, -7.249760e-04, +4.672592e-05, -9.747318e-04, +1.872823e-04,
+    +6.029165e-04, +5.448785e-04, +1.535703e-03, -2.286045e-03, +8.139289e-06,
+    -1.294893e-03, -1.396851e-03, -4.046491e-05, +7.741154e-04, -2.304074e-03,
+    +4.976617e-04, -4.994272e-06, -9.027595e-06, +7.083123e-04, -2.259764e-03,
+    //30
+    +7.541554e-04, -2.890206e-03, +7.520504e-04, +4.701445e-05, +6.651724e-05,
+    +7.742726e-04, +8.230263e-04, +1.812653e-03, -1.103243e-03, +3.550406e-04,
+    -3.476455e-03, -2.478871e-03, -1.146792e-03, +1.429579e-06, -5.429836e-04,
+    +1.858010e-03, +3.644375e-03, -1.396863e-04, +9.670076e-04, +2.535964e-04,
+    -4.655568e-04, +1.062483e-04, -5.828472e-04, -6.506908e-05, -2.392349e-04,
+    //31
+    +2.446816e-04, -8.832622e-04, +1.496186e-04, -7.454098e-04, -2.602592e-04,
+    +3.209127e-04, +1.347137e-04, +9.102993e-04, +2.359490e-03, +2.655645e-04,
+    -1.181975e-03, +1.698099e-03, +8.383579e-04, +1.931383e-04, -3.563662e-04,
+    +5.653959e-04, -1.069429e-03, -2.211769e-03, -1.864704e-03, -5.479177e-04,
+    +1.320139e-04, +1.801602e-04, +2.646474e-04, +1.708979e-04, +4.316620e-04,
+    //32
+    -1.336733e-03, +4.303954e-04, +2.433636e-04, -1.128123e-04, +5.250938e-04,
+    +7.322363e-04, +1.419103e-04, +3.027724e-04, -1.065979e-03, +5.576209e-04,
+    +2.514868e-04, -7.410065e-04, -1.980882e-03, +8.111216e-05, +2.345037e-04,
+    +6.485385e-04, +7.198332e-04, +9.503594e-04, -1.629104e-03, +1.519844e-03,
+    -9.566705e-05, +3.166905e-04, -9.177247e-04, +5.801975e-04, -1.424862e-03,
+};
+
+/* The 16 cell bias in the second layer */
+const ESPCNBias2 espcn_x2_biases2 = \
+{
+    -8.344557e-02, -1.060722e-02, -1.200216e-01, +1.583316e-01, +1.315569e-01, +3.461325e-02, +4.621855e-02, +1.732981e-01,
+    +3.784785e-02, +1.232585e-01, +1.389645e-01, -2.484385e-02, -3.584276e-02, -1.397461e-02, -1.220488e-01, -7.563266e-03,
+};
+
+/* The 16 x 32 convolutional kernel(3*3) in the second layer */
+const ESPCNKernel2 espcn_x2_weights2 = \
+{
+    //01
+    +2.796196e-02, -3.871283e-01, +3.521503e-01, -6.278738e-02, -3.021811e-01, -1.935289e-01, +1.950453e-01, -1.211663e-01, +5.406796e-01,
+    -8.842081e-02, +5.347707e-03, +5.308123e-02, -1.859120e-01, +2.087368e-02, +2.004688e-01, -1.071490e-01, -4.248419e-02, +1.418308e-01,
+    -1.304169e-02, -4.799066e-02, -9.237537e-02, -1.270203e-03, +4.956137e-02, +1.522896e-01, +4.909758e-03, -2.902431e-02, -1.917070e-02,
+    -3.695572e-02, -1.153394e-01, +6.134939e-02, +6.665299e-02, -9.567728e-02, +3.073342e-02, +5.412782e-02, -1.358265e-01, +1.164765e-01,
+    +2.294643e-01, -1.217335e-01, +2.081313e-02, -1.600601e-01, +2.314419e-02, +9.473469e-02, +1.337820e-01, -7.179189e-02, -1.468100e-01,
+    -7.389224e-02, -5.297044e-02, +2.045983e-01, -2.734002e-02, -2.703576e-01, +1.879358e-01, -3.387859e-01, -1.032482e-01, +4.341136e-01,
+    +1.451539e-01, -3.129847e-01, +2.026827e-01, +2.933410e-01, -5.794553e-01, +2.773271e-02, +7.753629e-02, -1.928997e-01, -9.951391e-02,
+    +6.510213e-02, -2.965755e-01, +2.141400e-02, -1.544345e-01, +4.534146e-02, +1.725793e-01, -7.259551e-02, +6.205475e-02, +4.412200e-02,
+    -3.172893e-02, -1.218552e-01, +1.702475e-01, +7.203586e-02, -8.086482e-02, -6.745064e-02, +6.797415e-02, -1.139063e-01, +4.958462e-02,
+    +5.513895e-02, +9.044109e-02, -9.144470e-02, +8.172590e-02, +1.117757e-01, -2.115987e-02, -1.360644e-01, -6.045178e-02, +7.499174e-02,
+    +3.872571e-01, -1.578356e-02, -9.532327e-02, +8.610254e-02, +2.657359e-01, -8.208489e-02, +3.521490e-01, -3.580588e-01, -1.285696e-01,
+    +3.798108e-02, -2.244537e-01, +1.426475e-01, +9.196178e-02, -7.056738e-02, +1.532285e-02, +2.624258e-03, -8.722825e-02, -6.063805e-02,
+    +5.785323e-02, -5.136660e-02, -5.213668e-02, +5.982836e-02, -9.326050e-02, -1.682056e-01, -6.722327e-02, +3.907170e-02, +8.185710e-02,
+    -2.743430e-01, +8.083098e-02, -7.950760e-02, -2.226319e-01, +8.772718e-03, -2.113597e-02, -9.601852e-02, -1.521942e-01, +4.069601e-02,
+    -3.489397e-02, +1.526892e-01, +3.886556e-02, -1.451639e-01, +6.157755e-02, -7.010581e-02, -6.434451e-02, -8.640765e-02, +7.866605e-02,
+    +1.244285e-01, -9.139437e-02, +5.220427e-02, -3.701231e-02, +4.005933e-02, -2.957529e-02, -6.727855e-02, +1.250482e-01, -3.662651e-02,
+    -1.090071e-01, +1.329618e-01, +1.776021e-01, -2.156681e-02, -6.903806e-02, -2.318609e-02, +8.174353e-02, -7.811528e-02, +1.444637e-01,
+    -1.905895e-01, +1.344816e-02, -3.799753e-01, +1.521771e-01, +3.348705e-01, +4.775557e-01, +4.621322e-01, -4.500879e-02, -6.430800e-02,
+    -1.521995e-01, +2.112915e-01, -1.202240e-01, +2.357278e-02, -1.282952e-01, +3.364823e-02, +4.082989e-02, +9.291640e-02, +1.417830e-01,
+    +2.285999e-01, -3.622964e-01, +3.160772e-01, +1.823275e-02, -1.749746e+00, +1.025445e+00, +2.362699e-01, -2.884707e-01, +2.809704e-01,
+    +2.977491e-01, -3.249910e-01, -2.665791e-01, +1.295276e-01, -1.260710e-01, -3.323579e-01, +2.985007e-01, -5.230184e-02, +1.400461e-01,
+    +1.337482e-01, -3.293528e-01, -5.911662e-02, +1.237688e-01, -3.521296e-01, +3.257645e-02, +5.394495e-02, -9.148016e-02, +3.008629e-02,
+    -5.692919e-02, -1.107576e-01, +1.031712e-03, +2.768099e-02, +3.048295e-02, -4.149082e-02, +1.812629e-02, -5.210550e-02, +2.035294e-02,
+    -3.049309e-02, +1.586076e-01, +1.502849e-02, -4.073546e-03, +4.029086e-02, -3.798703e-02, -1.564507e-01, +2.728817e-02, -3.453023e-02,
+    +1.203004e-01, -1.148147e-01, +2.318897e-01, -1.104460e-01, -5.142289e-02, -1.746284e-03, +5.887281e-02, -5.646951e-02, -9.619973e-04,
+    +4.168849e-02, -1.952638e-01, -1.927105e-01, +8.344106e-02, -7.882580e-02, +2.998099e-01, -6.605675e-02, -4.492997e-02, +5.191266e-01,
+    +1.140437e-01, -1.537255e-01, +1.030792e-01, +1.296360e-02, -1.641151e-01, -6.873509e-02, +1.640123e-02, -1.883212e-01, -6.002064e-02,
+    +1.492666e-01, +4.973514e-02, -4.094980e-01, +1.356186e-02, +9.721612e-03, -3.965656e-01, +1.510069e-01, +1.612792e-01, +1.674831e-02,
+    -1.814361e-01, +6.897432e-01, -9.505583e-02, +1.398247e-02, -2.282901e-01, +1.094785e-02, -4.131919e-01, +2.693776e-01, -3.630466e-02,
+    +1.666339e-01, +2.067864e-01, -3.731692e-01, +1.700933e-01, -1.258030e-01, +5.100349e-01, -6.321352e-02, -2.374470e-01, +8.049882e-01,
+    -1.473074e-01, +1.685683e-01, +2.062098e-01, -6.037359e-02, -9.978753e-02, -5.548793e-02, -1.466018e-01, -9.675771e-02, +1.644883e-01,
+    +1.992826e-01, -2.824630e-01, -1.528298e-01, +8.763099e-02, -1.034449e-01, -7.098789e-02, +9.195251e-02, -2.628417e-02, +7.039765e-02,
+    //02
+    +9.488858e-03, -7.341691e-02, +5.181161e-02, +7.566792e-02, -7.996183e-03, +5.746083e-02, +7.812615e-02, -5.909167e-02, +5.384316e-03,
+    +2.305851e-02, +4.427028e-02, -2.175684e-02, -1.484043e-01, +6.384489e-02, +7.202648e-02, -8.341847e-02, +2.080425e-02, -1.838712e-01,
+    -1.368607e-01, -1.308552e-02, -4.574929e-02, -1.705575e-02, +2.394638e-02, +1.135566e-01, +3.297467e-02, -7.014829e-02, +4.345049e-03,
+    -1.096550e-01, -4.017762e-02, -4.768725e-02, -1.594404e-03, -2.160763e-02, -1.245209e-01, -1.171691e-01, -3.940860e-02, -1.688806e-01,
+    +7.735279e-03, +2.901269e-02, +5.832316e-02, +1.313531e-02, -1.762000e-02, +5.562642e-02, -1.406633e-02, +5.642227e-02, +2.571158e-02,
+    +4.874245e-03, -1.349065e-01, +3.033266e-02, -5.195881e-02, +5.872213e-04, +5.385669e-02, +2.043362e-03, -1.061304e-01, +2.396023e-02,
+    -3.536886e-02, -4.140326e-02, +1.025941e-01, +9.899485e-02, +3.298699e-02, +2.180149e-02, +6.913009e-02, -1.105716e-01, -1.071929e-02,
+    +2.365270e-01, -1.711669e-02, +1.293737e-02, +2.298773e-03, +3.493086e-02, -2.736209e-02, -4.904139e-02, -2.601041e-02, -9.149130e-03,
+    +8.762413e-02, -1.162110e-02, -1.006105e-01, -2.957553e-02, -7.093536e-02, -4.763675e-02, +1.317782e-02, -8.860844e-02, -9.769863e-02,
+    +1.910818e-02, -6.014076e-02, -1.481871e-02, +3.792889e-02, -1.004720e-01, -2.496867e-02, +9.998591e-02, -2.233536e-01, -7.080528e-02,
+    -6.854558e-02, -1.000329e-01, -3.037533e-02, +6.115600e-02, -1.513675e-01, -7.487038e-03, +7.612339e-03, +7.701807e-02, -2.585823e-02,
+    -8.396936e-02, +1.509786e-01, -3.331335e-02, -6.972248e-02, +1.348471e-01, +6.481412e-02, +8.606718e-02, +2.707401e-02, -7.483082e-02,
+    +7.687724e-02, +6.731769e-02, +1.268524e-01, -1.198501e-01, +2.118552e-02, +4.900717e-02, +8.299324e-03, -2.498189e-02, +2.128220e-01,
+    -1.156959e-01, +6.462163e-02, +2.953654e-02, -7.882007e-03, -4.255639e-02, -2.191318e-01, +4.256027e-02, +8.622014e-02, -6.920078e-02,
+    -2.699585e-02, -4.863387e-06, -4.212742e-02, +6.265409e-02, +1.781880e-02, -1.632402e-02, -9.155685e-02, -7.801531e-02, -1.611830e-01,
+    +6.953640e-02, +3.278524e-02, +2.942642e-02, +5.621056e-02, -8.997562e-02, -1.245174e-01, -1.161864e-01, +7.767748e-03, -3.254205e-02,
+    -6.268100e-02, +1.144107e-01, -6.219850e-02, -2.559789e-02, -2.732766e-02, -8.455231e-02, +1.473126e-01, -1.403699e-02, +1.267786e-01,
+    -3.952135e-03, -1.059794e-01, -1.049432e-01, +4.452093e-02, +4.289823e-02, +1.196650e-02, -1.008333e-01, +4.542309e-02, -2.199690e-02,
+    -7.576746e-02, -2.471397e-01, +1.230506e-01, -1.298357e-01, +7.826859e-02, +5.344010e-02, +3.573097e-02, +6.732877e-02, -1.370701e-01,
+    +2.621991e-03, +9.555268e-02, +5.834319e-02, -7.516503e-02, -4.437781e-03, -1.263948e-01, +4.390859e-02, +5.232156e-02, -1.332603e-01,
+    -9.866312e-02, -1.349956e-01, -4.061437e-03, +1.247357e-01, -6.827673e-02, -3.535385e-02, -2.114558e-02, -2.446495e-02, -1.137398e-01,
+    +2.689720e-02, -1.083342e-01, +7.497273e-02, -1.613998e-02, -1.496338e-01, -2.304539e-01, -4.143043e-02, -6.018655e-03, +6.556640e-02,
+    +8.717071e-02, -2.115525e-02, -8.896041e-02, -7.817026e-02, +1.191612e-01, +2.577074e-02, +1.954282e-02, -2.669789e-02, -9.449129e-02,
+    -6.282443e-03, -2.758984e-02, +5.239939e-02, +1.796209e-01, -1.191740e-01, +3.236100e-02, -2.237805e-02, +3.549897e-02, +1.402814e-02,
+    +4.904297e-02, -6.064181e-02, -5.072017e-02, -5.663074e-02, -1.282059e-02, +2.980356e-02, +2.596784e-02, -1.074281e-01, +5.717569e-03,
+    +1.308165e-02, -4.745238e-02, -2.091528e-02, +2.269946e-02, +3.335213e-03, -9.193130e-03, -1.280046e-01, +3.856112e-02, +4.847724e-02,
+    -5.210930e-02, -1.704532e-02, -1.886732e-02, -4.417592e-02, -1.273094e-01, -7.930271e-02, +3.090990e-02, -9.948279e-02, -1.459021e-01,
+    -7.579265e-02, +4.254837e-02, +1.028317e-02, -1.359468e-01, -7.584418e-02, +6.095491e-02, +9.589998e-02, -1.602897e-01, -9.769962e-03,
+    -7.045866e-02, -1.647665e-01, -4.723143e-02, -5.976428e-02, -8.678296e-02, -1.088804e-01, -1.543627e-02, -6.534366e-02, -9.857790e-02,
+    +5.085392e-02, -1.658698e-01, +1.214205e-01, +5.630743e-02, -9.949835e-02, -8.689789e-02, -1.756761e-02, -1.391470e-01, -3.040789e-02,
+    +2.005240e-04, +1.949166e-01, +4.790642e-02, -6.003496e-02, -6.194703e-02, -9.127751e-02, +4.144503e-02, +8.310249e-02, -8.544115e-02,
+    -8.754293e-02, -6.434615e-02, +2.593989e-02, -1.912380e-01, -1.174352e-01, -6.598083e-02, +1.217923e-01, -6.085669e-02, +8.719649e-03,
+    //03
+    +2.702063e-01, -6.460699e-02, +3.110681e-01, +7.615406e-02, -2.924472e-01, +2.682215e-01, -1.493813e-01, -2.827672e-01, +2.573056e-01,
+    -4.974824e-02, +1.844510e-02, +1.320181e-01, -8.618871e-03, +1.771183e-01, +4.806736e-02, -1.340034e-01, -2.008040e-04, -1.547413e-01,
+    -2.631282e-02, -1.976440e-01, -9.921719e-02, +1.930378e-01, +5.352284e-02, +2.039144e-02, -7.879847e-02, +1.197628e-01, -5.904381e-02,
+    +5.286386e-02, -5.791451e-02, +1.437339e-01, +3.640825e-02, +1.608566e-01, -7.010344e-02, -1.132051e-01, -1.902640e-03, -7.876148e-02,
+    -1.290365e-01, +4.269329e-02, +1.903519e-01, +7.794116e-03, -9.022368e-02, +7.611334e-02, -6.714392e-02, +2.726979e-02, -6.475947e-02,
+    -3.412763e-01, -5.061975e-01, +8.606607e-02, +3.646728e-01, +2.542391e-01, -2.503266e-02, +1.384821e-01, -1.054303e-01, +3.137538e-02,
+    -4.660723e-02, +1.165535e-02, +8.984689e-02, +1.549863e-01, +1.074806e-01, -1.688544e-02, -1.432611e-01, +3.415602e-02, -3.876606e-02,
+    -8.276977e-02, +1.239521e-01, -1.909634e-01, +1.354757e-01, -1.066282e-01, -2.076036e-01, +3.108374e-01, -3.065235e-03, +2.148633e-02,
+    +7.607845e-02, -3.859295e-02, +8.249557e-02, +5.029007e-02, +1.839989e-02, -7.314985e-02, -2.187898e-01, -1.158698e-01, +8.105039e-02,
+    -1.192493e-01, -2.568929e-01, -2.386365e-01, +1.480039e-01, +2.399274e-01, +1.745743e-01, +1.057986e-01, +1.395179e-01, -4.209676e-02,
+    -1.072150e-01, +3.750077e-02, +2.016044e-01, +1.609941e-01, +2.839557e-01, +1.105547e-01, -2.993305e-01, +1.388852e-01, +2.044224e-01,
+    -1.651517e-01, -1.119926e-03, -7.608104e-02, -9.829172e-02, +1.701565e-03, -6.805313e-02, +7.217379e-02, +8.111007e-02, +1.945744e-01,
+    -5.257141e-02, +1.913400e-01, -1.833924e-01, -7.210245e-02, +9.053647e-02, +3.428523e-02, +1.646799e-01, +4.683183e-02, -4.638883e-02,
+    -2.854795e-01, -6.352330e-03, +2.604275e-02, -1.930530e-01, -1.148662e-01, +1.303910e-01, -3.132441e-01, +1.219716e-01, +2.022507e-01,
+    +2.773425e-02, -1.527865e-01, +9.488692e-02, +4.723777e-02, +1.641771e-02, +1.808886e-02, -2.610431e-02, +1.615259e-02, +5.624028e-02,
+    +8.260578e-02, -3.530055e-02, +1.299519e-02, +4.945719e-02, -7.174303e-02, +4.920038e-02, +1.476012e-01, -1.435829e-01, -3.404289e-02,
+    -2.545709e-01, +4.756500e-02, +8.905081e-03, -2.707402e-01, +8.447784e-02, -7.001672e-03, +7.630794e-02, +1.633538e-01, +5.120328e-02,
+    +3.251637e-01, -3.952582e-01, -1.270783e-02, +4.825052e-01, -4.630372e-01, -4.042192e-01, +1.312051e-01, -1.131035e-01, +1.024265e-01,
+    -7.202235e-02, +6.735104e-02, +2.057113e-03, +1.935859e-02, -3.430433e-02, +1.566987e-01, +2.413991e-03, -1.705035e-02, -4.996894e-03,
+    -2.500097e-01, +1.565615e-01, +1.231891e-01, -6.115336e-01, +6.356013e-01, +1.431544e-01, +2.067468e-02, -1.141085e-01, -9.994540e-03,
+    -2.449531e-01, +1.296173e-01, +5.583597e-02, +6.074345e-02, -6.060237e-02, -1.608130e-01, -1.915022e-01, +1.256857e-02, -9.174676e-03,
+    -1.984802e-01, -3.407360e-01, -1.299195e-02, +1.981986e-01, -1.372408e-01, +3.467470e-03, -8.797445e-02, -1.865932e-01, -4.782561e-02,
+    +1.275891e-01, -2.322883e-01, +6.338643e-02, -9.151192e-04, +1.814013e-01, +4.139189e-01, -8.310508e-02, -4.221609e-01, +1.682291e-02,
+    +1.381558e-01, -9.308300e-02, +3.089129e-02, -6.187838e-02, +3.131832e-02, -7.654195e-02, -2.091276e-02, +9.420906e-02, -3.616145e-02,
+    +1.264464e-02, -1.338644e-01, +6.695066e-02, -1.039509e-01, +8.572058e-02, -3.218482e-02, -7.832121e-03, +2.105795e-01, -1.265916e-01,
+    +1.039158e-01, -1.132133e-01, +9.571979e-03, -3.688902e-02, +5.981340e-02, +1.222004e-01, -5.827723e-02, -1.840849e-01, +2.419944e-01,
+    -2.254858e-03, -3.671605e-02, -2.269292e-02, +1.210146e-01, -1.576350e-01, +1.032391e-01, +2.112089e-01, -1.393704e-01, -7.354765e-02,
+    +1.086393e-02, +1.363703e-01, +6.774662e-02, -5.133044e-01, +4.170484e-01, -6.713540e-02, -2.237647e-01, +2.597104e-01, -1.883885e-02,
+    -3.355877e-01, +2.474431e-01, -6.833029e-02, +1.121015e-01, -1.730467e-01, -2.104999e-02, +2.051465e-01, +7.863239e-03, -2.985907e-02,
+    +1.979171e-01, +3.405297e-01, +3.985507e-01, +1.448798e-01, +2.254739e-01, +3.794701e-01, +1.913318e-02, -1.676107e-02, -7.109592e-01,
+    +2.478442e-01, +2.177334e-01, +4.395803e-03, -3.373286e-01, -1.826502e-01, -1.176875e-01, +4.529047e-01, +6.393014e-02, -2.999331e-02,
+    +1.231591e-01, -3.361337e-02, +1.079201e-01, +1.767497e-03, -2.878322e-01, -1.188374e-01, +7.901286e-02, -6.194469e-02, +6.573629e-02,
+    //04
+    +1.259816e-01, -6.183607e-02, +1.073750e-01, -6.226227e-02, -2.548646e-01, +8.917738e-02, -1.221809e-01, -3.539340e-02, +9.101880e-02,
+    -2.070515e-01, +9.932447e-02, -2.328324e-01, -8.686924e-02, -7.669908e-02, +6.544690e-03, +1.752966e-01, +1.837109e-01, +5.076334e-02,
+    +1.501527e-02, +1.859217e-01, +4.203951e-03, -1.103428e-01, -9.890569e-02, +1.844912e-01, +7.556470e-02, -2.215432e-02, -1.376570e-01,
+    +3.276080e-02, -3.991424e-02, +2.071019e-02, -9.448040e-02, -6.349642e-02, +6.662748e-02, +1.175425e-02, -1.691055e-01, +1.182035e-02,
+    -8.131913e-02, -2.461175e-01, +8.878400e-02, -1.592640e-01, +5.409089e-02, +6.684349e-02, +2.520068e-02, +1.267127e-01, +1.937425e-01,
+    +2.093848e-02, +6.379043e-02, -1.743705e-02, -2.052105e-02, +1.251830e-01, +1.326382e-01, -5.878548e-02, +2.262203e-01, +2.983222e-01,
+    +1.018980e-01, +5.377614e-02, +1.447683e-01, -3.853666e-02, -4.637938e-02, +6.478675e-02, -5.363227e-02, +2.675701e-01, +8.970606e-02,
+    -3.688303e-02, +1.403974e-01, -8.814855e-02, -1.995901e-01, -1.238909e-01, +7.126184e-03, +1.075918e-01, +1.384698e-01, +8.044221e-03,
+    -3.029544e-03, -1.767916e-01, +8.840141e-02, +4.700047e-02, +1.413470e-01, +3.226051e-02, +5.544659e-02, -7.582968e-03, +6.715734e-02,
+    +9.673336e-02, +7.334848e-02, +7.228316e-02, +2.632856e-02, -1.423633e-01, +3.789905e-02, -4.700612e-02, -1.912166e-01, +2.048762e-01,
+    -8.420590e-02, -1.577877e-02, +3.335988e-02, +2.223268e-02, +1.156876e-01, +1.206691e-01, +2.382319e-01, +3.167067e-02, +2.642931e-02,
+    -8.243770e-03, +3.014371e-03, +3.419303e-02, -6.755293e-02, +1.965585e-03, +1.209623e-01, +6.708861e-02, -1.590397e-01, +7.843371e-02,
+    -2.192382e-01, +9.388921e-03, +1.224457e-01, -6.555922e-02, -3.173143e-02, -1.650884e-02, -8.798158e-02, -5.061514e-02, +6.472767e-02,
+    -4.736229e-02, -7.371761e-03, +5.062053e-03, -3.580833e-02, +1.681101e-02, +1.710835e-01, +8.516425e-02, -1.402521e-01, +1.100410e-01,
+    -1.120459e-01, -1.258951e-02, -1.429003e-01, +4.192302e-03, +2.650890e-02, +2.666626e-02, +2.263774e-02, -3.704413e-02, +4.725551e-02,
+    -2.346711e-03, -1.861249e-01, -2.746879e-02, -1.784593e-01, +9.493657e-02, +1.046948e-02, -8.880453e-02, +6.561693e-02, +5.378477e-01,
+    -6.149167e-02, -6.803333e-02, +5.268810e-02, +8.358323e-03, -2.353854e-02, -7.992934e-02, -8.488534e-02, -3.630206e-02, -1.568177e-02,
+    +3.874236e-02, -8.463510e-02, +1.915156e-02, -1.066311e-01, -1.916604e-02, +1.024872e-01, +2.314683e-02, +1.973510e-01, -6.641413e-02,
+    -1.013278e-01, -3.592248e-02, -1.049880e-02, +1.037483e-01, -2.364000e-01, -3.262993e-02, -1.788698e-01, +6.335339e-02, -3.484977e-02,
+    -3.008434e-02, -1.158956e-01, -9.060302e-02, +1.011963e-01, -2.655244e-01, +2.038096e-01, +3.692210e-02, -1.248588e-01, +3.268912e-01,
+    -4.980522e-03, +6.600764e-02, +1.327255e-01, +2.885920e-02, -1.912976e-01, +4.825651e-02, +1.727335e-02, +1.223487e-01, +2.154332e-02,
+    +2.667208e-01, +1.558871e-01, +1.080011e-01, -6.693212e-02, -3.919062e-01, -4.199253e-02, +1.346518e-01, +5.981406e-02, -8.417615e-02,
+    -3.334155e-02, -1.237410e-01, +7.029352e-02, +7.056320e-02, +1.112222e-01, +2.315714e-01, +3.137993e-02, +1.334159e-01, +1.198761e-03,
+    -7.402324e-02, +2.291305e-01, +1.324425e-01, +9.711921e-02, -1.443179e-01, +5.251173e-02, -5.118666e-01, +4.799014e-02, +5.680165e-02,
+    -3.737031e-03, -3.590782e-02, +6.953254e-02, -7.648317e-02, +2.798799e-01, -3.670214e-01, +3.005102e-02, -1.318655e-01, +3.234352e-01,
+    +1.669129e-02, +6.116445e-02, +5.000307e-03, +1.632355e-01, +1.132765e-01, +1.559754e-01, +2.189451e-02, +1.434540e-01, +1.899973e-01,
+    +9.065859e-02, -4.130585e-02, -9.965039e-02, +2.700202e-01, -1.685447e-01, +6.001488e-02, -5.048026e-02, +1.408900e-01, -2.698474e-01,
+    -7.646478e-02, +2.093030e-01, -7.843395e-02, -1.919211e-01, +2.773360e-01, -4.971299e-02, -1.096730e-01, +8.061273e-02, +1.935058e-01,
+    -1.118757e-01, -9.963045e-02, +1.087178e-02, +2.585288e-02, +8.335996e-02, +5.874064e-02, -1.084504e-01, +1.394655e-01, -4.032479e-02,
+    -1.585287e-02, -5.099845e-03, -7.207366e-02, -1.775752e-02, -7.099164e-02, +1.629394e-01, +1.909550e-01, -2.020814e-02, +3.976689e-01,
+    -6.890664e-02, -8.329683e-02, -7.014129e-02, +2.512009e-01, +1.162871e-01, +9.043799e-02, -2.049078e-01, -5.209232e-02, -1.907735e-02,
+    +3.069135e-01, -3.456116e-01, +2.598847e-01, -9.368250e-02, +2.543102e-01, -5.483167e-02, +1.074926e-01, -1.091944e-01, +3.283980e-02,
+    //05
+    +5.701251e-02, -2.628692e-01, +2.959663e-01, +4.522641e-02, -9.018325e-02, -1.824094e-02, -1.539369e-01, +1.721052e-01, +1.109230e-01,
+    -7.247069e-02, -1.048780e-01, -2.184864e-02, -8.845133e-02, +3.195671e-01, -1.152184e-01, +1.296348e-01, +2.528728e-03, -3.787876e-02,
+    +2.181215e-01, -2.575420e-02, -1.047303e-01, +1.109320e-01, -1.564551e-01, -2.183921e-01, +1.415694e-02, +1.298871e-02, +1.215024e-01,
+    -9.977264e-02, +9.729049e-02, -1.449656e-01, +1.604588e-01, +1.294038e-01, -5.337144e-02, -8.765063e-02, +8.229764e-02, -2.745883e-02,
+    +1.915962e-02, +3.731578e-01, -2.800851e-01, -8.177628e-02, -7.686992e-02, -6.379388e-02, -3.850887e-02, -1.576860e-02, +1.132523e-01,
+    +4.339013e-02, +1.232955e-02, +1.102696e-02, -4.968583e-02, -1.745049e-01, +1.250870e-01, -4.586022e-02, -5.591379e-02, -3.217789e-01,
+    -1.087721e-01, -5.024860e-02, +1.030992e-01, -3.897808e-02, +1.332866e-02, -2.029647e-01, -1.173905e-01, -8.304362e-02, +1.968785e-01,
+    +1.118606e-01, -1.045324e-01, +1.990124e-01, +8.093167e-02, -9.650872e-02, -4.263826e-02, -1.950671e-01, -1.622152e-03, +6.991166e-02,
+    -2.918098e-02, +1.825371e-02, +1.199881e-01, -7.787886e-02, +1.732456e-01, +1.621650e-02, -1.810649e-01, +8.240525e-02, -1.063845e-01,
+    -4.924896e-02, +3.714861e-02, -1.183578e-01, +6.189478e-02, +1.846826e-02, +4.104652e-03, -1.291017e-01, +7.417805e-02, +9.712309e-02,
+    -4.217557e-02, +8.335441e-02, +1.246404e-01, +1.759754e-01, +1.755778e-01, +9.256123e-03, -2.871686e-01, -3.135187e-01, +9.055668e-02,
+    -1.452624e-01, +1.685180e-01, -2.213988e-01, +6.936350e-02, -9.003266e-02, +9.320427e-02, +2.272099e-01, -2.940710e-01, +1.031085e-01,
+    -1.314684e-01, +1.144558e-01, +1.467353e-01, -1.392308e-01, -5.726097e-02, -4.464650e-02, -8.087292e-02, +1.516082e-01, -4.911562e-02,
+    +1.027602e-01, +5.421392e-02, +2.068134e-01, -1.285004e-01, -3.489295e-02, +5.484071e-02, -5.272496e-02, -8.785943e-02, -1.114785e-01,
+    -1.184262e-01, +7.981645e-02, -2.321229e-01, +5.107847e-02, -1.273103e-01, -1.226077e-01, -2.030037e-02, +2.211870e-02, -2.978535e-01,
+    -1.129524e-01, +1.902217e-01, -2.693119e-03, -6.088648e-02, -4.487300e-02, +6.207409e-02, -8.821056e-03, +1.441226e-01, -1.550121e-01,
+    -1.678226e-01, +2.065922e-01, +2.038676e-02, -3.837890e-02, +1.163763e-02, -1.157715e-01, +2.129821e-02, +7.883862e-02, +4.978295e-02,
+    -4.243309e-02, -7.856157e-02, -2.742523e-01, +1.599519e-01, -2.756096e-01, +3.163529e-01, +4.727675e-02, +1.023680e-01, -1.707981e-02,
+    +5.008481e-02, -3.070600e-01, -1.800602e-01, -5.460600e-02, +8.338915e-03, +1.939465e-01, +9.628853e-02, -2.213488e-02, +7.405587e-02,
+    -1.287006e-01, -4.396058e-01, -4.509858e-01, +3.228366e-01, +4.438933e-02, -6.372976e-02, +1.439334e-01, +7.658523e-03, +2.008123e-01,
+    -1.594037e-01, +1.792841e-01, +3.420016e-01, -6.882368e-02, -8.011048e-02, -1.791910e-03, -8.786818e-02, -8.617767e-02, +1.937711e-01,
+    -1.388366e-01, -2.884551e-03, +1.231726e-01, +1.114031e-01, +1.167735e-01, +1.086100e-01, -1.044054e-01, +7.073439e-03, +2.994485e-03,
+    +1.905088e-01, -3.062968e-02, +4.107695e-01, -2.836436e-01, -2.794363e-01, -9.409027e-02, -2.739950e-01, +4.964121e-02, -6.799080e-02,
+    +6.207009e-02, -2.203875e-02, +1.854318e-02, +1.723732e-01, +6.139549e-02, -1.806734e-01, +8.412872e-02, -5.026244e-02, -7.695204e-02,
+    -4.752759e-02, +4.136226e-02, +9.539554e-02, -1.288433e-01, +2.205000e-01, -6.278809e-02, -8.079632e-02, +1.141424e-01, -8.585572e-02,
+    +1.669739e-01, +2.895925e-02, -4.542787e-02, +1.472781e-02, -9.840623e-02, +3.060574e-01, -1.331373e-02, -1.167198e-01, +8.521180e-02,
+    +9.357041e-02, -8.212245e-02, -5.679950e-02, +2.029193e-01, +3.909439e-02, -1.257387e-01, +8.548003e-02, +5.313055e-02, +1.469493e-01,
+    -1.357150e-01, +3.542536e-01, -1.836599e-01, -5.077156e-02, +2.070091e-01, +1.736253e-02, +3.102935e-02, +1.655920e-01, -2.856700e-02,
+    -1.089375e-01, -1.685848e-01, -2.766979e-01, +2.110625e-01, -9.693331e-02, +1.706169e-01, +2.556940e-01, +8.145827e-02, +6.563929e-02,
+    +5.982918e-02, +8.840670e-02, +3.042720e-01, -6.475180e-02, -1.335169e-01, +5.857708e-01, -1.686424e-01, +2.497180e-01, -1.140951e-01,
+    +2.390633e-01, +1.043450e-01, +3.167519e-02, +1.069783e-01, -2.392739e-01, -4.949076e-02, +4.945591e-02, -7.187001e-02, -2.360383e-01,
+    +4.350218e-03, -1.976021e-02, +1.208744e-01, -1.999048e-03, +8.615132e-02, +1.476046e-01, +2.395159e-02, +5.271903e-02, +8.587839e-02,
+    //06
+    -1.754399e-01, +3.857950e-01, +1.654348e-01, +8.853589e-02, +2.888246e-01, +7.150193e-01, +1.302828e-03, -4.709357e-02, -1.341935e-01,
+    -7.399916e-02, +2.460198e-01, -9.629577e-03, -9.960318e-02, -1.465850e-01, -8.682332e-02, -9.463330e-02, +1.870704e-02, +8.995198e-02,
+    -2.030794e-01, +4.002570e-02, +1.572409e-02, +4.755884e-02, -5.840096e-04, +5.826958e-02, -1.860925e-01, +1.733972e-01, -5.449153e-02,
+    +4.761393e-02, -1.680094e-02, +1.507897e-01, -1.989810e-02, -4.760464e-02, -1.096304e-01, +5.326524e-02, -1.374865e-01, -6.264385e-02,
+    +6.592637e-02, -3.541641e-02, -2.734210e-02, +5.454797e-02, -1.790746e-01, -4.206414e-02, +1.574663e-01, -8.205829e-02, +1.015248e-01,
+    -1.397412e-01, -9.306620e-02, +3.026981e-01, -1.512394e-01, +1.101078e-01, +1.831844e-01, +1.270149e-02, -3.621245e-01, -2.267363e-01,
+    -1.778632e-01, -5.288373e-02, -1.945018e-01, +9.610467e-02, -1.917574e-01, -2.249456e-01, -4.176170e-02, +1.344214e-01, -1.864436e-01,
+    -2.915983e-01, -1.543291e-01, +3.881308e-02, +3.218264e-01, +1.419312e-01, +2.458495e-01, -1.073700e-01, +2.897478e-02, -6.758764e-02,
+    +5.517824e-03, -9.543266e-02, +5.220648e-02, +1.586860e-01, +1.313707e-01, +1.496973e-01, -7.311280e-02, +7.082689e-02, +9.492191e-02,
+    +1.635812e-02, +4.822077e-03, +3.151889e-02, +2.491322e-02, +3.617127e-02, +3.708152e-02, +2.565004e-02, -3.240807e-01, -1.834674e-01,
+    +1.321488e-01, +4.691645e-01, +9.770501e-02, +1.926115e-01, +4.712277e-02, +4.279258e-04, -1.138195e-01, -7.060922e-01, -5.350436e-02,
+    -1.064716e-01, -1.627453e-01, -1.018891e-01, -2.370167e-02, +2.813979e-02, +1.228868e-01, -1.428895e-01, +2.781192e-02, -1.492945e-01,
+    +5.663136e-02, -1.396425e-01, +3.663547e-01, -2.189813e-02, +1.347826e-02, +1.333364e-01, -1.321948e-01, -1.211276e-01, -1.156824e-01,
+    -1.137579e-01, -2.666565e-01, +7.833549e-02, -9.797162e-03, -8.034555e-02, +1.242910e-01, -1.529825e-01, +1.653953e-02, +5.037135e-02,
+    +2.350592e-03, -5.264042e-02, -1.749090e-01, -5.242486e-02, +3.161896e-02, +2.573109e-02, -1.150264e-01, -3.994990e-02, -3.063736e-01,
+    +6.732573e-02, -2.651936e-03, +1.137075e-01, +4.747754e-02, +1.531672e-02, -5.589108e-02, -2.203501e-01, -3.816473e-02, -8.468126e-03,
+    -2.806552e-02, +4.315992e-02, +2.000065e-02, +1.759384e-01, +7.852466e-02, -8.728457e-02, -3.403154e-02, +1.940572e-01, +9.644171e-02,
+    +3.883446e-01, -1.180542e-01, +5.994464e-01, +3.527637e-01, +3.579781e-01, +2.674490e-01, -2.259816e-01, +3.133911e-01, -1.715527e-02,
+    -1.533869e-01, -1.154703e-01, -1.009317e-01, +2.226095e-01, -9.778536e-02, -1.327767e-02, -3.789864e-01, -8.731316e-02, -1.227854e-01,
+    -2.442039e-01, -8.736133e-01, +9.760709e-02, -1.352224e-01, +8.060000e-01, +5.582012e-02, -3.473119e-01, -2.076731e-01, -1.696298e-01,
+    +2.695300e-01, +5.175109e-02, +3.108547e-01, +2.559060e-01, +1.046375e-01, -1.908690e-01, +5.036491e-02, +9.048925e-02, +5.340875e-02,
+    -9.661967e-02, -8.013338e-02, -5.560714e-02, +1.015604e-01, +1.032175e-01, -8.229902e-02, -7.376169e-02, +1.242218e-01, -9.394169e-03,
+    +1.846845e-01, -7.633889e-03, +9.709927e-02, -2.013432e-01, -8.668143e-02, +6.413536e-02, +5.322931e-02, +1.998995e-01, +2.766354e-01,
+    -7.633825e-02, -1.206357e-01, +2.352569e-01, +1.497366e-01, -8.751620e-02, +1.057403e-01, -1.487953e-01, -1.805379e-01, +2.113846e-02,
+    +9.573519e-02, -2.307376e-01, +9.335341e-02, +4.565744e-02, +3.978542e-02, -1.888587e-01, +3.344119e-02, -5.334999e-02, +1.031810e-01,
+    +1.097332e-01, -1.497905e-01, -1.876225e-02, -2.269072e-01, -3.128903e-01, -8.183838e-02, +2.312949e-01, +1.027027e-02, -2.408567e-01,
+    -2.620369e-02, +1.310256e-01, -8.895552e-02, +1.075405e-01, -5.414807e-02, +4.563125e-02, -1.972758e-01, -5.380094e-02, +8.641971e-02,
+    -2.248555e-01, -6.486457e-03, -8.928359e-03, -1.906346e-01, +2.148429e-01, +2.455465e-01, +6.074137e-02, -6.316019e-02, -7.086578e-02,
+    +2.230399e-04, -1.946432e-01, +1.500996e-01, +1.030161e-01, -1.346576e-01, -1.454037e-01, +1.495257e-01, +1.495622e-01, +7.945345e-02,
+    +5.614009e-01, +2.353336e-01, -7.914165e-01, -4.418459e-02, +3.383512e-01, -1.657440e-01, +5.596830e-02, +9.568221e-03, +1.678588e-01,
+    +2.642486e-02, +5.989322e-02, +3.825635e-02, -2.077309e-02, +3.263539e-04, -3.405742e-02, +1.721419e-02, +2.625737e-01, +7.200370e-02,
+    +1.359507e-02, -2.537940e-01, -2.311744e-01, +1.321651e-01, +4.411696e-01, +2.360506e-01, -1.767278e-01, -1.550795e-01, -2.145236e-01,
+    //07
+    -2.710752e-01, +3.672940e-01, -2.573172e-01, +1.864392e-01, -6.649081e-01, -5.475792e-01, +8.236974e-02, +7.718095e-01, +2.336335e-01,
+    -1.517087e-01, -3.740840e-02, +2.094317e-01, +1.596861e-02, -1.127700e-02, -5.513479e-02, -1.022428e-01, -1.295227e-02, -2.600766e-02,
+    +3.278672e-03, -6.611070e-02, -1.697310e-01, +9.155986e-02, +1.131982e-01, +2.414661e-01, +6.245977e-04, +7.889690e-02, -2.360869e-01,
+    -1.705302e-01, -2.226279e-01, -3.808669e-02, +1.739597e-01, -1.165358e-01, +2.016542e-02, +2.787035e-02, +2.357563e-01, +1.742281e-02,
+    -1.179010e-01, +8.103845e-02, -3.097150e-02, -7.290306e-02, +6.730943e-02, -1.960558e-02, +9.331463e-02, -1.374094e-01, +7.458641e-02,
+    -6.938092e-01, +2.485774e-02, -2.412269e-01, +6.469787e-01, -1.250655e+00, +5.651378e-01, -3.661778e-01, +9.845600e-02, +1.791273e-01,
+    -9.017645e-02, -4.265311e-02, +6.186963e-02, -3.130213e-02, -2.730544e-02, -1.716012e-01, -2.084099e-01, +1.322676e-01, +2.087386e-01,
+    +5.819758e-02, +3.945743e-02, -2.673274e-01, -1.045246e-06, +6.905879e-02, +2.506304e-01, +1.653350e-01, -1.678393e-01, -1.385684e-01,
+    -1.783324e-01, -2.300501e-01, -2.276649e-02, +1.068000e-01, +2.179548e-02, -8.439306e-03, +2.071559e-01, -2.755558e-02, +1.557942e-01,
+    +8.063433e-02, +1.128715e-02, +2.031226e-01, -2.135587e-01, -4.548058e-02, -1.425138e-01, -8.636990e-02, +2.282285e-02, -1.912913e-02,
+    -2.182598e-01, -2.168876e-02, -2.660620e-01, +1.998739e-01, -1.425138e-01, +5.415674e-02, +3.776724e-01, +3.242221e-01, -6.654990e-02,
+    -2.590221e-01, -4.342568e-02, -9.533948e-02, +1.131462e-01, +1.976273e-01, -8.348354e-02, +1.892848e-02, -5.413431e-02, -5.607715e-02,
+    -2.605906e-03, -4.925741e-03, -2.085164e-01, +7.518816e-02, -1.014519e-01, +1.542556e-01, -1.701942e-02, +1.311884e-02, +1.269940e-02,
+    -1.176759e-02, -1.181607e-01, +5.466675e-02, +4.281585e-02, +2.378687e-01, -2.786247e-01, +2.094364e-01, +1.253163e-01, +1.760411e-01,
+    +2.291410e-01, +8.136413e-02, +1.917680e-01, -1.394777e-01, +3.075342e-02, -8.661982e-02, -2.330195e-01, -2.202960e-01, -1.412799e-01,
+    +4.135455e-02, +5.107543e-02, -1.260048e-01, +3.729438e-02, +7.623203e-02, -5.114002e-02, -1.062409e-01, -7.985906e-03, +5.198350e-02,
+    -2.052195e-01, -1.011377e-01, -5.518082e-02, -8.939702e-02, +8.615245e-02, -1.292738e-01, -8.167814e-02, -1.712333e-01, -2.395200e-01,
+    +2.786986e-01, +4.515798e-03, +4.958743e-01, -3.158197e-01, -5.363953e-01, -7.078454e-01, -2.625560e-01, +6.329768e-02, -2.003303e-01,
+    -2.933385e-01, +6.276470e-02, -1.232016e-02, -1.009229e-01, -1.381699e-01, -9.460142e-02, +5.140937e-02, +3.120943e-04, -4.838686e-02,
+    +1.456430e-01, -8.885185e-02, +1.847127e-01, -9.779278e-01, -7.091741e-01, -2.703340e-01, +4.340885e-01, +4.494547e-01, +3.628428e-01,
+    -1.766068e-02, +2.444979e-01, +2.693915e-01, -2.089251e-01, -1.173768e-01, +5.271061e-02, +5.577785e-02, -1.383032e-01, +3.457951e-02,
+    -3.602569e-02, +6.991623e-02, +1.613525e-01, -2.828588e-01, -1.901006e-01, -2.973155e-01, -8.600195e-02, +7.209887e-02, +1.366531e-01,
+    +1.738641e-01, -4.406611e-03, +6.355406e-02, -1.894481e-01, +3.107904e-03, +9.508606e-02, +1.246051e-01, +3.649475e-01, +3.469903e-01,
+    +1.740977e-01, +2.196573e-01, +1.653777e-02, -1.628769e-01, -9.248164e-02, +2.246456e-02, -2.256824e-02, -5.807807e-02, -5.848870e-02,
+    +3.530325e-02, -1.279837e-01, -9.945087e-02, +9.829719e-02, +1.550471e-01, -4.405361e-02, +7.767912e-02, -1.307246e-02, -3.242305e-02,
+    -2.084485e-01, -1.569630e-01, -4.101702e-01, +5.452181e-02, +6.120604e-02, -5.235356e-02, -1.952978e-01, +1.876897e-01, +1.228919e-01,
+    +7.245670e-02, -6.576318e-02, +2.238490e-02, +4.555200e-02, +1.204291e-01, +6.779172e-02, +1.321243e-01, -3.100123e-01, -1.674522e-02,
+    +8.903056e-02, +8.805695e-02, +9.388001e-02, -6.667432e-02, -8.119727e-03, -6.973952e-02, +1.369125e-01, +2.565062e-02, -4.611409e-02,
+    +3.509522e-01, -6.858092e-02, -2.668047e-01, -4.925105e-01, -3.697691e-01, -3.995274e-01, +1.838647e-01, -9.459957e-02, +2.120164e-01,
+    +1.041152e-01, +1.940422e-01, +1.497884e-01, +2.602737e-01, +1.317586e-01, +3.518198e-01, +3.971608e-01, +6.792200e-01, -5.005045e-01,
+    +1.192154e-01, +3.295535e-02, +3.298636e-01, -9.124047e-01, -6.130866e-01, -3.350494e-01, -1.551884e-01, -9.610718e-04, +6.414758e-03,
+    +1.140369e-01, +7.756143e-02, +2.952059e-02, -2.781156e-02, -1.788323e-02, +1.589796e-01, -1.115371e-01, +5.981451e-02, -5.102956e-02,
+    //08
+    +7.364886e-02, +2.600649e-01, -3.642577e-02, -1.233459e-01, -1.324623e-01, +1.105011e-01, +4.826559e-02, -5.907561e-02, -4.699682e-02,
+    +7.345836e-02, -4.326091e-03, +5.984183e-02, -8.996083e-02, +5.186995e-01, +4.164480e-03, -1.938276e-01, +1.196200e-01, -3.082023e-01,
+    +2.948429e-01, +1.335802e-01, -3.859311e-03, -1.109888e-01, +1.588754e-01, -1.726537e-01, +2.053444e-01, -7.771057e-02, +1.292046e-01,
+    -1.168143e-01, +7.854339e-02, -1.207797e-01, +1.930452e-01, -2.690308e-02, +1.216096e-01, -1.665554e-01, -3.988995e-03, -3.109228e-03,
+    -9.825002e-02, -1.591233e-01, +8.464416e-02, -6.742682e-02, -1.777592e-02, -1.626782e-01, -1.399610e-02, -1.511953e-01, +1.016360e-01,
+    +6.126685e-02, +5.558118e-02, +3.230792e-02, +9.914584e-03, +5.253054e-03, -3.937483e-02, +4.417006e-02, +2.925468e-03, +5.668532e-02,
+    +7.695418e-02, +1.136158e-01, -7.991208e-03, -2.545500e-02, -2.561411e-02, +7.653612e-02, +1.117681e-02, -2.181053e-02, +1.197609e-02,
+    -1.039357e-02, -9.561068e-02, +5.007091e-03, -4.702336e-02, -1.691536e-02, -1.025440e-01, +8.989341e-02, +5.140057e-02, +5.105369e-02,
+    -1.653391e-02, -1.732861e-02, -1.239324e-02, -1.974698e-03, -3.365243e-02, -1.208409e-03, -4.133569e-02, +5.677881e-02, -1.733094e-02,
+    -2.605234e-02, -1.067707e-02, +2.661564e-02, +3.734701e-02, +2.580754e-02, -8.444624e-02, -2.049685e-01, +2.333276e-01, -1.849764e-01,
+    +2.928942e-02, +5.791656e-02, -5.997987e-02, +8.873304e-02, +1.087456e-01, +3.762976e-03, -4.655421e-02, +2.102214e-02, +2.994114e-02,
+    -4.609990e-02, +1.307414e-01, +8.213796e-02, +6.499582e-02, +7.178270e-02, +3.644116e-02, -1.252097e-02, +6.136432e-02, +1.443952e-01,
+    -2.022048e-02, -9.409450e-02, -1.825919e-03, -4.551550e-02, +6.093744e-02, +7.026301e-04, -2.071162e-02, -5.970758e-02, +8.345156e-03,
+    +5.469854e-02, +6.532671e-02, -1.815205e-02, +1.826731e-02, +4.206125e-02, +6.884338e-02, +2.707611e-02, +1.170544e-02, +1.559809e-02,
+    -6.323145e-02, -2.276216e-02, +1.110859e-02, -2.320496e-02, +1.425843e-03, -7.796893e-03, +9.973280e-02, +1.929718e-02, +4.461639e-02,
+    +1.114986e-01, +1.946925e-01, -1.174280e-01, -4.962114e-03, +3.595810e-02, +1.280566e-01, +1.347459e-01, -9.794153e-02, -9.733369e-02,
+    +8.933762e-02, +1.334533e-02, +3.417664e-02, +5.593981e-02, -9.080683e-03, +1.616060e-02, -2.504725e-02, +4.086139e-02, -7.365893e-03,
+    -5.620136e-02, +1.262561e-01, -2.281039e-02, +7.633162e-02, -2.515382e-02, +7.094096e-02, -3.854814e-02, -8.990827e-05, +1.401391e-02,
+    +3.886298e-02, -2.322644e-01, +7.418320e-02, -1.366629e-01, +1.654940e-01, -1.740440e-01, +7.743786e-02, -7.194200e-02, -2.220636e-03,
+    -8.882923e-02, +2.331735e-02, +4.672530e-02, -2.606275e-02, +6.763463e-02, -2.820110e-02, +4.056893e-02, -6.734930e-02, +8.495891e-02,
+    -1.225948e-01, +4.494254e-02, -3.130714e-02, -9.501105e-03, +1.385912e-02, -1.750649e-02, +1.991329e-02, -1.822468e-02, +6.766376e-02,
+    +7.629273e-02, -2.401936e-02, -1.363895e-02, -5.151441e-02, -5.579863e-04, -1.166612e-02, -4.533071e-03, -1.431668e-02, -8.171262e-02,
+    +1.740990e-01, +5.980242e-02, -2.098998e-02, +8.842683e-02, +1.190726e-01, +5.715274e-02, -9.359267e-02, +4.317484e-02, -2.456527e-02,
+    +1.637812e-01, +2.549113e-01, -2.053223e-01, -9.810461e-02, +5.340773e-02, -1.122041e-01, +8.824871e-02, +3.446094e-01, -1.461318e-01,
+    -2.326436e-01, +3.530079e-01, +2.674518e-01, -1.685199e-01, +1.936258e-01, +4.825393e-02, -1.938043e-01, +8.707824e-02, -1.551565e-01,
+    +9.393498e-02, +1.410847e-01, +2.974208e-02, +5.957354e-02, +1.395263e-01, +1.507885e-02, -3.210427e-02, +6.462820e-02, +1.220554e-01,
+    -9.521578e-03, +3.211838e-02, +1.505610e-02, +1.191624e-01, -2.955412e-02, -2.386190e-02, -1.235275e-01, +1.189054e-01, -1.300329e-02,
+    +1.667336e-01, +3.480192e-02, +9.516664e-02, -1.131463e-02, +1.235975e-01, -1.280131e-02, -5.343131e-02, -6.429543e-03, +1.590751e-02,
+    -6.293605e-02, +1.056197e-01, +2.793782e-02, +9.735077e-02, -2.298819e-01, +3.807104e-02, -2.782466e-02, +1.061653e-01, -8.287168e-02,
+    +1.877717e-02, +5.975511e-02, +7.603483e-02, +3.970388e-02, -1.481920e-01, -4.086686e-02, -4.826195e-02, +4.510889e-02, -9.646910e-02,
+    +5.854620e-02, -2.184822e-03, -4.260672e-02, -1.516261e-01, +1.848372e-01, +2.833859e-02, +1.065657e-01, -9.218857e-02, +5.646219e-02,
+    +1.593768e-01, +9.215692e-02, +3.279290e-02, +1.256933e-02, -7.463106e-02, -1.924614e-01, -1.338677e-01, +8.975228e-02, +1.279112e-01,
+    //09
+    -4.386758e-02, +4.502616e-01, +4.134591e-01, -5.667285e-02, -1.059189e-01, +1.065672e-01, +1.429938e-01, +2.877319e-01, +1.194435e-01,
+    -8.678460e-03, -3.143105e-02, +3.456017e-02, -1.090753e-01, -4.165336e-02, +1.061582e-01, -1.623533e-02, -6.710934e-02, +1.380072e-01,
+    +4.807307e-02, +3.826576e-02, +2.805511e-02, -6.408584e-03, -3.343029e-02, +1.893405e-02, -1.471345e-01, +9.667995e-02, -8.439396e-02,
+    +2.405021e-02, +7.880655e-02, +1.507072e-01, -8.357199e-02, +8.048655e-03, -4.457375e-03, +5.351298e-02, -3.480629e-01, +8.642275e-02,
+    -4.479294e-02, +4.109560e-02, -1.348639e-01, +3.834239e-02, -4.177377e-02, +2.208648e-01, +2.890879e-02, -2.153484e-01, +1.243154e-01,
+    -2.205919e-01, -1.710413e-01, +2.781979e-01, +1.778288e-01, -2.971836e-01, -1.472645e-01, +4.995069e-02, -7.021701e-02, -1.596856e-01,
+    +1.211115e-01, -3.037938e-02, +1.149413e-01, -1.233966e-01, -1.190250e-01, -1.053412e-01, -1.788749e-02, -5.224693e-02, -1.324909e-01,
+    +7.114612e-02, +6.978167e-02, +3.407039e-02, +1.569031e-02, +2.597786e-02, +1.610662e-01, -1.992367e-03, -3.281845e-02, -9.154472e-02,
+    -6.259414e-02, -2.628868e-02, -6.898492e-02, +4.805031e-02, -3.876526e-02, -8.419512e-02, +8.427881e-02, +1.471714e-01, +9.098636e-02,
+    -7.332228e-02, +5.966920e-02, -7.414738e-02, -1.006388e-01, +8.224642e-03, +9.763903e-02, +2.199519e-02, -1.332747e-01, +1.831774e-01,
+    +6.704811e-02, -2.912589e-03, -7.884726e-02, +1.676587e-01, -3.767069e-01, -1.562379e-01, +5.537356e-02, -6.828908e-01, +2.891253e-02,
+    +4.265040e-02, +7.078458e-02, -4.381443e-02, +1.476350e-02, +1.439292e-01, -1.268789e-01, -1.069217e-01, +1.336864e-01, -4.805705e-02,
+    +9.719262e-03, -6.875179e-02, +1.672994e-01, -1.040027e-01, +1.457312e-02, -7.513709e-02, -3.754341e-03, -9.482957e-02, +6.787837e-02,
+    +9.894325e-02, -3.454502e-01, -5.305237e-02, +1.004960e-01, -4.847664e-02, -1.932827e-01, +2.103177e-01, -8.283751e-02, -5.378826e-02,
+    -1.044791e-01, +1.192612e-02, +3.506518e-02, -5.762473e-03, +1.912466e-01, -5.334004e-02, -3.598608e-02, +7.794353e-02, -3.667203e-02,
+    -4.366000e-02, +8.904117e-02, -8.190631e-02, +5.809951e-03, -3.734280e-03, +4.852644e-02, -1.188012e-01, +3.633852e-02, +2.047489e-02,
+    +1.023140e-01, -2.247516e-02, +1.417246e-01, -8.512292e-02, +1.019625e-03, -3.069024e-02, -7.963210e-02, +7.884214e-02, +1.503345e-01,
+    +1.822923e-01, +2.032490e-02, -8.884142e-02, +1.077592e-01, +2.306602e-01, -3.556523e-01, -1.043638e-01, +2.241244e-01, +2.668099e-01,
+    +2.501287e-02, -4.338723e-02, -9.850028e-02, -1.162755e-01, -6.428386e-03, +3.739665e-01, +2.149168e-02, -8.350840e-02, -7.886955e-03,
+    -9.173273e-02, +1.435573e-01, +3.651637e-02, -6.712617e-01, +5.780856e-01, +2.233998e-02, -5.646163e-02, -9.908400e-02, -1.120535e-01,
+    +1.921839e-01, -7.964136e-02, -1.061360e-01, +1.567890e-01, -1.223125e-01, -1.226623e-01, +1.283124e-01, +3.282278e-02, -1.239898e-01,
+    -4.813256e-02, +1.708227e-01, +5.862041e-03, -1.626782e-01, -1.071216e-01, +8.025438e-02, -1.124215e-01, +1.732065e-02, +1.131556e-01,
+    +2.322321e-01, -4.313069e-01, +1.730975e-01, +5.882067e-04, +2.107136e-02, -8.072241e-02, +4.578486e-02, +1.853894e-01, +4.877141e-02,
+    -1.914313e-01, +2.213339e-01, +6.367218e-02, +1.282967e-01, -1.648678e-01, -1.414167e-01, +7.053677e-02, +3.079155e-02, -2.257107e-03,
+    +7.075211e-02, -2.830115e-01, +1.144438e-01, -7.835096e-02, +4.430379e-02, -1.952233e-02, +1.007493e-01, -5.787206e-02, +3.793745e-02,
+    +2.501619e-01, -2.833000e-02, -2.485633e-01, +2.808217e-01, +3.053489e-03, -1.370728e-01, +2.020396e-01, +7.087544e-02, +1.268998e-02,
+    +1.718713e-02, -4.310490e-03, +9.773447e-02, -4.939768e-02, +2.905964e-01, +1.377622e-01, -1.536624e-01, +5.602085e-02, -8.817130e-02,
+    -2.302172e-02, -2.753879e-01, -2.214920e-01, +1.299858e-01, -1.584375e-01, -1.982085e-01, +6.460635e-02, -5.131670e-02, -2.098009e-01,
+    +5.352925e-03, -6.307258e-02, +2.454486e-02, +1.679090e-01, +1.955415e-02, -3.301236e-03, -6.650062e-02, -5.715268e-02, +1.179363e-01,
+    +1.377077e-01, -5.377773e-02, -3.509004e-01, +6.973919e-02, +1.863262e-01, +1.161754e-01, +2.166181e-01, -9.496664e-02, +1.886207e-02,
+    -9.470658e-02, +6.730453e-02, +2.067957e-01, +1.361747e-02, +1.492244e-01, -6.661335e-02, -1.282373e-01, +8.976660e-02, +6.675692e-02,
+    +1.937805e-01, -1.414334e-01, +3.010526e-02, +6.038003e-02, -3.950360e-02, -2.978953e-02, +3.280688e-02, -5.916556e-02, -8.591639e-02,
+    //10
+    +8.757694e-02, +1.776257e-01, +1.583755e-02, -1.625248e-01, +2.470319e-01, +8.027124e-02, -7.272597e-02, -6.060995e-02, +6.455809e-03,
+    -5.966249e-03, +8.676150e-02, +2.266163e-01, -2.682371e-02, -1.366608e-01, -1.522204e-01, -6.861050e-02, -2.785256e-02, +9.292919e-02,
+    -4.950073e-02, +1.100198e-01, -8.954129e-02, +8.518801e-03, -3.547190e-03, +9.808406e-02, -1.254608e-02, -8.573265e-02, +2.201972e-02,
+    +1.507855e-01, +1.892610e-02, +7.754711e-02, -1.063412e-01, +4.938506e-02, -3.029430e-02, +4.364969e-02, -1.275177e-01, -2.250303e-02,
+    -1.755181e-02, +8.468336e-02, -1.337761e-01, +1.359676e-01, -1.505271e-01, +5.978284e-02, +1.069084e-01, +1.385139e-02, -5.937932e-02,
+    +1.286593e-01, +1.001836e-01, +1.901989e-01, +1.724241e-01, -1.305443e-01, +1.526599e-01, +4.834286e-02, -1.593799e-01, -1.169300e-01,
+    +4.164170e-02, -1.363161e-01, -1.501737e-02, +1.660359e-01, -8.157642e-02, +6.874124e-02, -1.397649e-01, +1.109160e-01, -6.884986e-02,
+    +1.447508e-01, -2.801364e-01, +1.986113e-01, -3.166058e-02, +1.098793e-01, +1.845145e-01, -5.817377e-02, -6.022310e-02, -8.201064e-02,
+    -4.591562e-02, +1.446797e-01, -3.277515e-02, -6.502865e-02, -2.405540e-01, -3.086730e-01, +1.973789e-01, +1.029435e-01, +1.382094e-01,
+    -1.183047e-01, -7.568711e-02, -1.020679e-02, -3.057368e-02, +8.342075e-02, +4.272094e-02, +2.024141e-01, -2.605771e-01, +1.800385e-01,
+    -6.502201e-02, -9.107746e-02, -1.627245e-01, -7.370731e-02, +1.850002e-01, -6.164861e-02, +2.180011e-01, +6.987102e-02, -4.201713e-02,
+    -5.053387e-02, +1.834788e-03, -1.306607e-01, -7.611800e-03, -8.954784e-02, +1.362244e-01, +1.400804e-03, +1.422061e-01, -4.786149e-02,
+    +1.160322e-01, +2.042801e-02, -3.171027e-01, +1.605404e-01, +1.229072e-01, -1.230090e-02, +6.458061e-02, -7.660443e-02, -4.320301e-02,
+    -3.312920e-01, -7.375437e-02, -2.234407e-01, +2.568912e-03, +7.288679e-02, +5.539678e-02, +1.361089e-01, +6.206603e-02, +2.115862e-01,
+    -2.052209e-02, +3.124064e-02, -1.698176e-01, +1.299872e-02, -4.347039e-03, -2.037209e-02, +4.004201e-02, +3.525072e-02, -1.193139e-01,
+    -1.240106e-01, +1.656525e-01, -5.890657e-02, -4.001500e-03, -1.906136e-01, +6.653067e-02, +4.380196e-02, +5.491839e-02, +1.358525e-01,
+    +4.852734e-02, -9.106820e-02, -5.123680e-03, +9.699045e-02, -4.761085e-02, +1.409311e-02, +1.398446e-01, -3.768717e-02, -1.275537e-01,
+    +1.471432e-02, +1.485812e-01, -1.247496e-01, -7.949652e-02, +3.020925e-01, -1.040507e-01, +3.526157e-02, +1.541793e-01, +3.279360e-01,
+    -1.523598e-02, -5.313121e-02, +1.023904e-01, -1.414827e-01, -8.338045e-02, -8.343206e-03, -2.432153e-02, -8.350634e-02, +4.989843e-02,
+    -7.775412e-02, +1.566091e-01, -5.601244e-03, -2.908713e-01, -1.542084e-01, +5.740827e-02, -1.314791e-01, -5.778431e-03, +2.464240e-01,
+    -4.906398e-02, -8.768465e-02, -5.954431e-02, -1.032019e-01, +2.368332e-02, -1.643863e-01, -1.025483e-01, +1.942117e-01, -5.621586e-02,
+    -1.183945e-02, +8.126080e-02, +1.167310e-01, +1.151642e-02, +1.550025e-01, -4.453599e-02, +2.521743e-02, +1.358345e-01, -1.135350e-02,
+    -1.125701e-01, -2.544039e-01, -2.180541e-01, -7.543561e-02, -4.334355e-02, -1.989298e-01, +1.260452e-01, +3.638688e-01, +3.246047e-01,
+    +1.033557e-01, -2.104497e-01, +1.626131e-01, -5.105743e-02, +1.742861e-02, +1.313595e-01, +1.450248e-02, -1.330248e-01, -5.862679e-02,
+    +3.124262e-02, -9.742616e-02, -3.615013e-02, +2.089030e-01, -1.135871e-01, -4.967351e-02, +3.633286e-02, -1.683751e-01, +2.372660e-01,
+    -9.036987e-02, -6.721927e-02, +1.769023e-02, -2.140231e-03, -2.580476e-02, -7.329682e-02, -3.768934e-02, +1.841949e-01, +3.827468e-02,
+    -9.471671e-02, +1.625651e-01, +9.797443e-02, -1.275433e-01, +6.584347e-02, +2.492964e-02, -3.244016e-01, +2.289258e-01, +2.699776e-02,
+    +9.170450e-02, -4.768981e-03, -1.135876e-02, +6.014005e-02, -2.236416e-01, -1.380133e-02, +1.132273e-01, +9.560275e-02, +2.856380e-02,
+    +9.335867e-02, -1.181026e-01, +6.025082e-02, -7.847855e-02, -3.270870e-02, +1.265648e-01, -3.037287e-02, -1.378245e-01, -2.776607e-02,
+    +5.777451e-02, +6.922435e-02, -3.284972e-02, +1.138090e-01, +6.988763e-02, +5.166687e-01, +1.046148e-01, +2.849068e-01, -7.904661e-02,
+    +1.434630e-01, +1.383009e-01, +2.776230e-03, -9.893435e-03, +1.747850e-02, -7.469866e-02, -1.008097e-01, +1.856887e-01, +4.453210e-02,
+    +4.136989e-02, -7.224359e-02, -1.711674e-02, +7.265449e-02, +4.852230e-02, +8.370975e-02, +3.243168e-02, -6.158489e-02, -2.053664e-02,
+    //11
+    -1.574619e-02, -1.058900e-02, +9.898391e-02, +8.768624e-02, -7.225676e-02, +7.211264e-02, +4.340547e-02, -1.882869e-02, -1.857659e-02,
+    +2.545300e-01, -8.358378e-02, -7.277279e-02, +6.756818e-02, +2.032422e-01, +1.213877e-01, +2.106038e-01, -2.584068e-01, -3.867661e-01,
+    -1.864514e-02, -1.164084e-01, +6.530897e-02, -1.071171e-01, +1.688159e-01, -1.991862e-01, +1.144952e-01, -6.327146e-02, +2.747692e-01,
+    +9.963500e-02, -8.691006e-02, +6.860056e-02, -4.379608e-02, -3.045151e-02, +1.053075e-01, +8.009311e-02, +5.944912e-02, +7.200385e-02,
+    -1.320863e-01, +5.416628e-02, +1.303210e-01, +1.850111e-01, +7.223601e-02, +2.108519e-01, -3.575783e-01, +1.020028e-01, -6.509294e-01,
+    -4.298177e-03, -2.140823e-02, +2.614548e-03, -3.653275e-03, -4.536911e-02, -2.582051e-02, -3.205812e-02, +1.465147e-02, +3.283871e-02,
+    -3.206258e-02, -1.028187e-02, +7.154933e-02, +4.431788e-02, -1.139798e-01, +5.412347e-02, -3.417244e-02, +1.159557e-02, +3.273852e-02,
+    +9.826154e-02, +8.037557e-02, -4.638601e-02, -1.035070e-01, -7.219105e-02, -8.943956e-03, +6.690694e-02, +1.607707e-02, +6.781680e-03,
+    +2.986668e-02, -9.683827e-02, -3.569027e-02, +3.574668e-02, +3.752493e-02, -2.161813e-02, +7.292177e-02, -4.309539e-02, +5.899316e-02,
+    +3.661517e-02, +4.880600e-02, -2.622411e-02, -4.042599e-02, -1.448358e-01, +1.078766e-01, -9.981066e-02, +5.484872e-02, +1.360521e-01,
+    +8.350823e-03, -2.572766e-02, +4.636969e-02, -1.279631e-01, +2.849801e-02, +1.617513e-01, -1.469307e-03, +6.653101e-02, +5.754205e-02,
+    +1.394539e-02, -4.819001e-02, +2.559558e-02, -9.875780e-02, -2.627135e-03, +1.442990e-01, -2.508938e-02, -1.539947e-02, +5.760508e-02,
+    -4.665410e-02, +6.957454e-02, +9.769124e-02, -3.470571e-02, +1.193610e-02, -9.026497e-03, +6.532067e-03, -4.463910e-02, +2.010477e-02,
+    +2.330015e-02, +1.479915e-02, -2.358089e-02, -1.743371e-02, +7.868079e-02, +4.526132e-02, -4.177936e-02, -1.889626e-02, +2.153245e-02,
+    +4.743627e-02, -6.210545e-02, -4.549656e-02, +6.643730e-02, -5.601561e-02, +1.211163e-02, +3.408690e-02, -7.252881e-02, +4.883964e-02,
+    -9.501471e-03, -2.585179e-01, +1.317506e-01, +1.771442e-01, -1.823997e-02, -1.017803e-01, +1.183151e-01, -8.113878e-03, +1.903247e-01,
+    -6.347188e-02, +1.615474e-02, +5.960138e-02, -4.495117e-02, +1.042417e-01, -1.068867e-02, +8.577769e-03, +5.257969e-02, -2.085358e-02,
+    +3.624995e-02, -9.454418e-02, -4.124963e-03, -1.688512e-02, -5.283187e-02, +1.394797e-01, +2.271299e-02, +6.259976e-02, +4.615962e-03,
+    -4.062646e-02, +2.835126e-01, -1.276632e-01, +1.630809e-01, +3.623589e-02, -1.624231e-01, +2.608569e-02, -6.648665e-02, -1.147339e-02,
+    -1.325237e-02, -2.785786e-03, -8.825211e-02, +4.219571e-02, -5.874965e-03, +1.871255e-03, +1.453311e-02, +4.343374e-04, +7.969954e-02,
+    -1.039216e-02, +1.059516e-02, +1.524225e-02, +1.104982e-02, -1.653977e-01, +6.641930e-02, +1.391627e-02, +2.778263e-05, +4.845395e-02,
+    +1.129424e-02, +2.185382e-01, +5.342843e-02, +1.131614e-03, -4.399526e-03, -6.536973e-02, +1.517164e-02, -6.464706e-02, -5.915658e-02,
+    -1.625313e-01, +5.695738e-02, -1.867042e-02, -1.189893e-01, +1.586997e-01, +6.352294e-02, +2.595844e-02, +1.128684e-01, +3.645442e-02,
+    -1.117591e-01, +2.410851e-01, +8.011156e-02, -6.638560e-02, -9.874291e-02, +1.894261e-01, -2.329118e-01, +1.766179e-01, -1.638410e-01,
+    -3.256580e-03, +3.405728e-01, +6.305701e-02, +2.099546e-02, -7.326502e-02, +2.520362e-01, +4.807984e-02, +8.066767e-02, -1.404262e-02,
+    -9.955325e-02, +3.639505e-02, +1.817162e-02, -6.775781e-02, +9.363949e-02, +8.988263e-02, -6.116371e-03, +6.956381e-02, +5.610261e-02,
+    -7.612693e-02, +1.075316e-01, -8.626178e-02, -1.187798e-02, +3.824230e-02, +5.324345e-02, -1.912576e-02, +1.030112e-01, -2.321540e-02,
+    -1.439409e-02, -4.973659e-02, -4.030738e-02, -7.901102e-02, +6.946486e-02, -2.338143e-02, -4.355123e-03, +6.801801e-02, +5.266419e-02,
+    -5.202464e-02, -7.730883e-02, +2.267973e-02, +7.193462e-02, +5.723485e-02, -2.180257e-03, -3.829091e-02, +7.370378e-02, -1.023000e-01,
+    -2.231980e-02, +3.424681e-02, +3.480963e-02, -5.951493e-02, +1.578873e-01, -1.397412e-01, +7.236134e-02, +9.935228e-02, -4.464353e-02,
+    -1.113811e-01, -5.247317e-02, -1.665520e-02, +1.194995e-01, -3.421925e-02, +5.906799e-02, +6.441892e-03, -6.807005e-02, +5.948419e-02,
+    -1.778530e-01, +1.644491e-01, +2.477438e-01, +8.168893e-04, +1.313246e-03, -5.331519e-02, -1.674722e-02, +8.833455e-02, -1.515438e-01,
+    //12
+    -7.445271e-02, +6.462863e-02, -4.612919e-02, +3.711158e-02, +1.342841e-01, +1.428898e-02, -1.364753e-02, -7.786502e-02, +1.972433e-01,
+    +1.683337e-02, -9.695571e-02, -8.256327e-03, -6.585408e-02, +9.684241e-02, -6.804184e-02, -1.234508e-02, -2.444022e-03, -3.244046e-03,
+    +3.724571e-02, +3.148145e-02, -2.221035e-02, -1.572967e-01, -1.834673e-01, -1.367199e-01, -1.363253e-01, +1.523452e-02, -1.222450e-01,
+    -1.061888e-01, +2.766578e-03, +9.305738e-02, -4.783523e-02, -1.022515e-01, -1.179848e-01, -2.010241e-03, -2.270393e-02, +6.757916e-02,
+    -9.121460e-03, +4.523245e-02, -2.263620e-01, -5.595886e-02, +2.881364e-02, +5.699217e-02, +5.304295e-02, -3.437463e-02, -7.810016e-02,
+    -5.960917e-02, -9.275053e-02, +1.084758e-01, -2.675806e-04, +8.208876e-02, +5.683570e-02, -6.567568e-02, +2.982929e-02, -8.686784e-02,
+    -2.656353e-02, +2.874524e-02, -7.660729e-02, +9.065486e-03, +3.364633e-02, -7.078606e-02, +1.129820e-01, -7.396327e-02, -1.142325e-01,
+    -7.275951e-03, -5.981616e-02, -1.369766e-02, -2.365713e-02, +1.290546e-01, -8.337552e-02, +8.717159e-02, -1.232302e-01, -1.954675e-02,
+    +1.701483e-03, -6.049809e-02, +1.134098e-01, -1.424190e-02, -1.621317e-01, -9.464789e-02, +9.082627e-02, -3.128123e-02, -1.878548e-02,
+    +7.696844e-02, -5.371589e-02, -2.068893e-01, -5.498390e-02, +1.090841e-01, -3.171646e-02, +2.385676e-01, -1.163130e-01, -2.343996e-02,
+    -3.005667e-02, -6.718642e-02, +8.687776e-02, +6.129543e-02, -1.821874e-02, +4.503048e-02, -5.369955e-02, -7.197064e-03, -9.139603e-02,
+    -3.034610e-02, -1.024165e-01, +1.415952e-02, -1.028321e-01, +8.592672e-02, -5.006418e-02, +3.814422e-02, -1.113876e-01, +3.455780e-02,
+    -4.386575e-02, -2.479229e-02, +8.079412e-02, +1.312439e-01, +1.330364e-02, +5.961163e-03, +2.903163e-02, +4.251510e-02, -1.366106e-02,
+    +4.681372e-03, +6.389487e-02, -1.053906e-01, +9.352977e-03, +4.501758e-02, -4.434794e-02, -1.332747e-01, +4.007706e-02, +6.734907e-03,
+    -8.900432e-02, +7.508251e-02, -5.317910e-02, -8.906909e-02, -9.985201e-02, -8.031429e-02, -3.037853e-02, +5.347683e-02, +1.203379e-01,
+    +1.349341e-01, -3.878411e-02, -4.593933e-02, +8.865022e-02, -1.653173e-01, -5.372472e-02, -1.216865e-01, -1.224260e-01, +1.503740e-01,
+    -6.945691e-02, -4.154653e-02, -5.489518e-02, +4.128344e-02, -2.662240e-02, -4.564271e-02, -1.060234e-01, -2.591222e-02, +5.229116e-04,
+    -1.054552e-01, +4.073640e-02, +3.296494e-02, -1.372615e-01, -3.253345e-02, -8.341620e-02, -1.324563e-02, +6.204344e-02, +3.094500e-02,
+    +1.182271e-01, +2.151745e-02, +6.112522e-02, -1.061536e-01, -3.934317e-02, +1.819025e-01, +4.606451e-02, -4.830566e-02, +7.884607e-02,
+    +9.785334e-02, +1.225409e-02, -1.148665e-01, -9.049079e-02, +8.575302e-02, +3.683375e-02, -9.524352e-02, -6.654125e-03, +5.368807e-02,
+    -5.633022e-02, -8.316969e-02, +1.262389e-03, -3.955773e-02, -7.310855e-02, +4.382910e-02, +5.796142e-02, +4.086667e-02, +2.695350e-02,
+    -2.895481e-02, +7.022046e-02, +5.238315e-02, -1.300010e-01, +2.468490e-02, -1.230555e-01, -1.084077e-02, +1.014091e-02, -2.678704e-02,
+    -4.472039e-02, -2.278745e-02, -6.066871e-02, +9.703824e-02, +1.778075e-02, +3.262718e-02, +3.193503e-02, -1.578295e-02, +1.080038e-01,
+    +6.141040e-02, +6.659327e-02, -9.250566e-02, -4.913556e-03, -4.606943e-02, -2.173950e-02, -2.134065e-02, -5.434878e-02, -6.188989e-02,
+    -1.471592e-01, -1.237005e-01, -1.279518e-01, -1.634812e-01, -8.129497e-04, -1.495544e-01, -1.894816e-02, +1.781831e-02, -1.467729e-01,
+    +7.765013e-03, -1.075526e-01, +1.997991e-02, -3.881645e-02, -8.232905e-02, -8.614118e-02, -2.282905e-03, -7.317440e-03, -2.416405e-02,
+    +5.818601e-02, -7.466315e-02, -3.621661e-02, -1.188697e-01, +1.228085e-02, +1.005747e-01, +1.405519e-01, +2.792506e-02, -8.798517e-02,
+    -1.642503e-01, +2.281358e-02, -1.246925e-01, -2.586205e-01, +3.674606e-02, +4.803373e-02, -5.820602e-02, -4.360122e-02, +8.042919e-02,
+    -2.653696e-02, +2.040933e-02, -1.264705e-01, -5.452579e-02, -1.489950e-01, -1.169810e-02, +1.268520e-02, +1.420680e-03, +2.325643e-01,
+    -8.300658e-02, +9.770033e-02, -2.197637e-02, -9.711663e-02, +5.391515e-02, -7.390375e-02, -6.024101e-02, -6.014161e-02, -4.103366e-03,
+    -1.081521e-02, -3.251661e-02, -4.975108e-02, -1.705550e-01, -6.005883e-02, +2.351869e-02, +4.089835e-02, +4.446108e-02, -7.854690e-02,
+    -6.714682e-02, +9.794513e-02, -2.433297e-02, +8.734829e-02, +8.491895e-02, -1.754921e-01, -9.732258e-02, +7.596688e-02, -5.245246e-02,
+    //13
+    +1.875492e-02, +3.576464e-01, +3.393918e-01, +1.910353e-02, +1.376808e-01, +1.687177e-01, +9.874257e-02, +2.008051e-02, +1.614365e-01,
+    -6.762575e-02, +2.659946e-02, +7.610726e-02, -1.240078e-01, -9.381886e-02, -5.859656e-02, -1.402429e-01, +2.957630e-02, +1.388094e-01,
+    +6.753293e-02, +2.501946e-02, +8.726575e-02, -3.185894e-01, +3.035951e-02, +1.958815e-01, -4.706683e-02, +2.404102e-02, -1.179886e-01,
+    -1.798786e-01, +1.136566e-01, +1.006751e-01, +1.156947e-01, +5.756541e-02, -1.206939e-02, -1.309973e-03, -3.156491e-01, +1.254197e-01,
+    +1.725180e-02, -1.111923e-02, -8.261950e-02, -2.901542e-02, -2.445905e-01, +5.077476e-02, +1.462969e-02, +9.667999e-02, +1.178702e-01,
+    -2.256002e-01, +2.169832e-01, +1.927799e-01, +3.552390e-03, +3.491580e-02, -3.235179e-02, -3.221725e-01, -1.611268e-01, +3.155527e-03,
+    -1.825738e-01, +1.805441e-02, -5.878723e-02, +3.601571e-02, +1.696680e-01, -1.003165e-01, -1.749193e-02, +8.121073e-02, +2.621742e-02,
+    +5.672057e-02, -2.518950e-01, +4.518514e-03, +6.756078e-02, +3.088996e-02, +2.171307e-01, +2.032244e-01, -3.284661e-02, -3.695232e-02,
+    -9.609663e-03, +1.477483e-01, -1.005217e-01, +1.814554e-01, -1.578561e-01, -9.716535e-02, +9.034738e-02, -1.493655e-02, +9.666954e-02,
+    +5.028583e-02, +1.101889e-01, -1.148742e-01, +1.021919e-02, -8.050450e-02, -2.066495e-01, +1.258750e-01, -3.801937e-01, +2.189679e-01,
+    -2.727969e-02, +1.544032e-01, +5.354075e-02, -3.683712e-01, -2.520154e-01, +1.760928e-01, -5.376416e-01, -3.005105e-01, +7.183821e-02,
+    -2.808041e-01, -3.054732e-01, +2.912809e-02, -6.397378e-02, -1.344691e-01, -6.210504e-02, -2.302313e-01, +3.923187e-02, +1.196884e-01,
+    -5.760145e-02, -1.946718e-02, -6.652844e-03, -2.924622e-03, +1.341156e-01, +3.473733e-02, -1.969646e-02, -7.584159e-02, +3.158879e-02,
+    +8.462439e-02, -1.979329e-01, +2.047124e-02, -8.745212e-02, -4.236544e-02, +1.250234e-01, +7.961376e-02, -2.051668e-01, +9.184991e-02,
+    -2.589757e-01, +1.800239e-02, -2.175157e-01, -6.768905e-04, +7.082649e-02, -2.051497e-01, -6.631128e-03, -1.332883e-01, -5.174189e-02,
+    -7.033059e-02, -7.805748e-02, +1.404341e-02, -1.232972e-01, +6.697893e-02, +1.129311e-01, -4.742191e-03, +3.237473e-02, +2.058712e-02,
+    +1.024185e-01, +6.622158e-02, +1.442758e-01, -2.207033e-02, +4.107915e-02, +5.540650e-02, -1.753552e-02, -9.434056e-03, -3.350055e-02,
+    +3.528349e-01, -6.491472e-01, +2.502360e-01, +1.231663e-01, -9.560057e-02, -9.215090e-03, +1.433772e-01, +3.131502e-01, -2.492796e-02,
+    -7.176322e-02, -2.297418e-01, -3.563755e-01, +1.802807e-01, +1.106836e-01, +6.821736e-02, +7.520346e-02, -2.227638e-01, +1.350906e-01,
+    +2.128158e-02, -2.880797e-01, +2.758556e-01, +1.404429e-01, -2.662451e-01, +1.345337e-01, -1.573596e-01, -2.207584e-01, +2.292393e-01,
+    +1.680019e-01, +2.736067e-01, +3.623443e-01, -2.939307e-01, -1.664496e-01, -1.307011e-01, +1.604772e-01, +1.048378e-01, +1.981240e-01,
+    +3.252505e-01, +6.110576e-04, -6.816724e-02, +6.182543e-02, -8.093381e-02, -1.966220e-01, +3.771037e-02, -7.039838e-02, -1.160358e-01,
+    -5.855796e-02, -3.595416e-02, +3.306584e-01, +4.672688e-03, -1.209957e-01, +6.475542e-02, +2.368173e-01, +1.162285e-01, -1.769320e-01,
+    -2.715515e-01, +1.016375e-02, +8.959486e-02, +1.856499e-01, -1.536194e-01, +1.422291e-01, -2.129394e-01, +1.079263e-01, -9.784067e-03,
+    +3.033736e-01, -4.259288e-01, +8.099527e-02, +2.275046e-02, -2.282852e-01, -9.178985e-02, +2.594182e-02, -1.522248e-01, +2.107701e-01,
+    -1.354505e-01, -1.854523e-01, +8.299670e-02, -7.416492e-03, -1.176699e-01, -2.017595e-01, +5.754856e-02, -6.057230e-02, +2.743065e-01,
+    +7.052734e-02, -2.857996e-02, +2.063664e-02, +6.790408e-02, +4.519643e-03, +4.822289e-02, +3.375651e-02, +1.634308e-02, +5.443243e-02,
+    -2.377549e-01, +1.508649e-01, +1.293809e-01, -9.806407e-02, +2.953060e-01, +2.228277e-01, -2.762128e-01, -2.775746e-02, +5.428589e-02,
+    -4.209523e-01, +2.843781e-01, -7.434174e-02, +3.265181e-01, -2.832244e-01, -1.997421e-01, -1.152070e-02, +9.141304e-02, +2.189347e-01,
+    +2.441456e-01, -6.740279e-02, -1.069509e+00, +9.807003e-02, -3.590874e-02, +6.967848e-01, +3.024780e-01, -9.124000e-03, +2.072251e-01,
+    +1.985718e-03, -2.923576e-03, +6.664895e-02, +1.493945e-01, +9.486970e-02, -1.319137e-02, -9.989785e-02, -4.961726e-03, +1.648749e-01,
+    +2.974191e-01, -3.727849e-02, -1.671603e-01, +7.090761e-02, +1.438799e-01, -1.487963e-01, +4.390797e-02, -2.682672e-01, -9.215923e-02,
+    //14
+    -1.553686e-01, -3.858725e-03, -5.288060e-02, +7.988568e-02, -2.017736e-02, -3.598062e-02, +5.250948e-02, +6.765670e-02, -1.341101e-01,
+    -1.906307e-01, +8.088088e-02, -8.830458e-02, -9.464943e-02, -4.300747e-02, +8.105221e-02, +8.772264e-02, +1.864097e-02, -2.111360e-02,
+    -1.016897e-02, -1.064832e-01, +4.470833e-02, +1.958620e-01, +4.500080e-02, +3.140238e-02, -9.260044e-02, -9.049896e-02, -2.237776e-02,
+    +4.528421e-02, +4.778613e-02, +6.810740e-02, +6.054763e-02, -1.420980e-02, +1.607162e-02, -1.834022e-01, -4.933174e-02, +6.941706e-02,
+    +1.139237e-02, -2.533433e-04, +4.585012e-03, +3.450216e-03, +4.046915e-02, -3.773239e-02, -7.562254e-02, +5.976986e-02, -1.485578e-01,
+    -5.634148e-02, -3.394315e-02, -1.644779e-01, +1.074913e-01, +1.075945e-01, -1.393961e-01, +3.789871e-02, -2.820118e-02, -2.892458e-02,
+    +6.748705e-02, -4.231573e-02, -1.541224e-01, +1.184824e-02, -1.368511e-01, -2.759093e-02, -6.098022e-02, -1.041971e-01, -8.303276e-03,
+    -6.530677e-02, +4.225539e-03, +1.302351e-02, -6.187547e-02, -2.726829e-02, -7.985895e-02, -3.756125e-03, +1.989824e-01, +3.895083e-04,
+    -3.871041e-02, -1.188904e-01, +9.554462e-02, +1.290356e-02, +2.753260e-02, -1.141236e-01, -1.568844e-02, -1.464184e-02, -1.231308e-01,
+    +5.508200e-02, -1.296575e-01, +1.067683e-01, -2.305860e-02, -8.908234e-02, -9.714573e-02, -5.599604e-02, +2.166743e-02, -8.490623e-02,
+    +7.472133e-02, +6.833971e-02, +3.125183e-04, +1.782575e-02, +4.544162e-02, -1.162277e-01, +1.892221e-02, -1.291921e-01, -4.781258e-02,
+    -1.642718e-01, +6.555913e-02, +8.891418e-03, -2.474279e-02, -1.820334e-01, +1.473290e-01, +5.326980e-02, +5.837735e-02, -4.503362e-02,
+    +2.371241e-01, -3.733778e-02, -1.593387e-01, -4.010393e-02, +2.544451e-02, -4.494878e-02, +2.794648e-02, -6.249344e-02, -1.048278e-01,
+    +1.594576e-01, -1.843496e-01, +2.405295e-02, -8.524790e-02, +9.642895e-02, -2.974698e-02, -9.545838e-03, -1.768351e-01, -2.236452e-02,
+    -6.461956e-02, -6.187899e-02, -1.104797e-02, +1.065059e-01, +9.502061e-02, +2.059536e-02, -6.708311e-02, +7.446180e-02, +7.065578e-02,
+    +3.090922e-02, -1.125338e-01, +2.137368e-02, +7.910073e-02, -1.247942e-01, -8.936146e-02, +1.270371e-01, -7.658502e-02, +5.361740e-02,
+    -2.437421e-02, +3.861938e-02, +1.196084e-01, -1.721338e-01, +1.192162e-01, -1.109352e-01, -4.933776e-02, -3.720032e-02, -1.335347e-01,
+    -1.132215e-01, +9.156928e-02, -3.040341e-02, +1.347911e-01, +1.371191e-01, -4.026586e-02, +2.997355e-02, +7.657013e-02, +1.774474e-02,
+    +7.662299e-02, -1.223029e-01, +5.158692e-02, -9.406839e-03, +1.013610e-01, +5.642490e-02, +2.937012e-02, +3.008332e-02, +1.265240e-01,
+    +7.291226e-03, +1.089682e-01, -1.118886e-01, -1.521021e-02, -4.495689e-02, -1.188242e-01, +1.184345e-01, -3.889539e-02, +1.015256e-02,
+    -1.896845e-01, -2.495929e-01, -1.338997e-02, -8.244766e-02, -1.014228e-01, -6.130255e-02, -1.201806e-01, +1.109590e-01, -8.615946e-02,
+    -4.705784e-02, -6.252213e-02, -1.912807e-02, +7.159909e-02, -8.877608e-03, -6.878815e-02, -1.235316e-01, -6.854875e-02, -9.430780e-02,
+    +2.835133e-02, -4.762266e-02, +5.098976e-02, +2.705692e-02, -4.994671e-02, +8.777224e-02, -1.298090e-02, +3.735687e-02, +1.952111e-02,
+    -1.176192e-02, -8.707565e-03, -1.329851e-01, -8.801688e-02, -1.786158e-01, +1.532310e-01, -1.619400e-02, -8.348987e-02, -1.019521e-01,
+    -1.945390e-02, +6.824136e-02, -6.904316e-02, +2.537629e-02, -2.734311e-02, -4.458952e-02, +1.767226e-02, -7.443991e-02, +2.845225e-02,
+    -3.298651e-02, -1.620883e-01, +1.177273e-01, -6.273257e-02, -7.064202e-02, +1.295087e-01, -8.586165e-03, +7.588542e-02, -9.512857e-02,
+    -2.104135e-02, -1.415043e-01, +5.549010e-02, +4.831836e-02, +8.462914e-02, -4.215306e-02, -2.825746e-02, -7.515885e-02, -2.379311e-02,
+    -1.617473e-01, +2.862292e-02, +8.183726e-02, -1.515823e-01, -9.984056e-02, -1.773007e-02, -5.241902e-02, -1.827324e-01, -7.826129e-02,
+    -1.177765e-01, +5.834660e-02, -6.012182e-02, -7.794434e-02, -2.964297e-02, -5.841248e-02, +6.723627e-02, -1.087777e-01, -8.923206e-02,
+    +9.335840e-02, -1.738234e-01, -1.330308e-02, +1.128323e-01, +8.699205e-02, +5.109470e-02, -1.233671e-01, -4.887281e-03, -6.821368e-03,
+    +9.289785e-02, +1.432365e-02, +2.307597e-02, +5.819748e-02, -2.480585e-02, -5.288936e-03, -1.243047e-01, -3.752588e-03, -7.614364e-02,
+    -7.116138e-02, -9.928385e-02, -7.269178e-02, +1.357497e-01, -3.409087e-03, -9.912408e-03, -1.849282e-01, +1.741137e-02, +1.204088e-01,
+    //15
+    +3.129754e-01, -3.754277e-01, -4.578039e-01, +4.113672e-02, +7.260318e-01, +7.674675e-01, -1.080291e-02, -2.996339e-01, -1.611283e-01,
+    +1.305230e-01, +1.805686e-01, -2.917839e-02, -2.132778e-01, -4.106257e-02, -3.972425e-02, -6.372157e-03, +7.004413e-02, -6.997887e-02,
+    +5.425669e-02, +9.511179e-02, -6.897420e-02, -1.421613e-01, +1.307235e-01, +1.627710e-01, -1.735414e-01, -1.503237e-01, +6.252912e-02,
+    -1.890587e-02, +7.118036e-02, -4.254940e-02, -2.439630e-02, +6.717436e-02, +2.892310e-01, -1.684827e-01, -1.840704e-01, -1.040827e-01,
+    +6.298916e-02, +6.752205e-02, -2.081786e-02, -2.503417e-02, +4.739634e-02, -1.955450e-01, -1.152506e-01, +1.498949e-02, +1.413741e-01,
+    +5.149630e-02, -7.849614e-02, +2.969441e-01, -3.675168e-02, -2.718355e-01, +9.847380e-02, -1.367999e-01, +2.516825e-01, -2.654595e-01,
+    -6.750029e-02, -1.196339e-01, -1.460516e-01, -2.680022e-02, -9.914999e-02, +1.178782e-01, +1.814932e-01, +1.254579e-01, -6.104262e-02,
+    -2.327014e-01, -4.206071e-02, +3.112844e-02, -2.413296e-03, +1.107072e-02, +9.674178e-02, -1.115988e-01, -5.633368e-02, +2.016206e-02,
+    +4.114998e-02, +1.144208e-01, -7.862902e-02, -1.623951e-01, -3.104508e-01, +5.533227e-02, -5.769323e-03, +1.058570e-01, -1.299463e-01,
+    -9.020384e-02, -2.000105e-01, -8.737524e-02, +8.515587e-02, +1.373334e-01, -1.149883e-03, -1.488188e-01, +9.925257e-02, +1.337177e-01,
+    -1.383777e-01, -4.258919e-01, -2.808226e-02, +1.068946e-01, +6.395936e-02, +2.060247e-03, +6.931517e-02, -5.006613e-01, -1.059230e-01,
+    -3.063604e-01, +1.627564e-01, +1.532801e-01, +1.463915e-01, -6.033864e-02, +1.227795e-01, +5.705287e-02, +1.155586e-01, -1.771752e-01,
+    -1.693804e-01, -1.761864e-01, +1.887736e-01, -1.899072e-02, -7.816298e-02, -1.159932e-01, +6.676613e-02, +4.534454e-02, +1.957207e-01,
+    -3.642186e-01, -4.157198e-01, -1.169790e-01, -4.087576e-02, -1.391249e-01, -2.450958e-02, +9.959547e-02, +2.974104e-01, +2.132521e-01,
+    -1.119024e-01, +1.032822e-01, -1.463943e-01, -8.183292e-02, +6.585883e-02, -4.585122e-03, +2.737453e-02, -8.534782e-02, -1.088630e-02,
+    -2.418232e-01, +1.849585e-01, -6.120271e-02, +1.213331e-01, -1.555183e-01, +3.331764e-02, -1.346561e-01, +8.193817e-02, -9.047437e-02,
+    -1.246086e-01, +5.899384e-02, -6.165569e-02, -1.464446e-01, -1.141804e-01, +2.492741e-02, -1.268398e-02, -1.584839e-02, +3.300258e-02,
+    -8.179951e-02, +3.852921e-01, -6.759801e-02, -2.702433e-01, -4.594468e-01, +1.688128e-02, +6.071791e-02, -8.905151e-02, +4.093682e-02,
+    +1.684267e-01, +8.339326e-02, +1.606597e-01, -1.884019e-01, -2.306070e-02, -1.189236e-01, +1.448270e-01, -2.089768e-01, -4.494970e-03,
+    +6.809883e-02, +1.330305e-01, -5.871495e-02, -2.892780e-01, -9.475560e-01, +3.666586e-01, +3.006092e-01, +2.832207e-01, -1.411869e-01,
+    +2.694634e-01, +2.224507e-01, +4.920106e-02, +1.985951e-01, +2.574801e-01, +1.405114e-01, -1.751779e-01, -3.758274e-01, -8.015091e-02,
+    -1.239328e-01, +1.219034e-02, -3.148346e-02, +3.852955e-02, +1.131177e-01, +1.007708e-01, +1.152922e-01, -7.964151e-02, +6.893941e-02,
+    -3.710797e-02, -2.000902e-01, -2.356202e-01, +9.058195e-02, +1.712910e-01, -9.189661e-02, +7.974458e-02, -3.826962e-02, +1.312260e-01,
+    -1.760501e-01, +1.693068e-01, -4.110262e-02, -7.038740e-02, -4.908390e-02, +1.062570e-01, -7.294638e-02, +1.010026e-01, +2.555395e-02,
+    -9.682380e-02, +1.630616e-01, +3.086808e-01, +1.644960e-01, -3.450730e-01, -1.421002e-01, -3.062423e-01, +2.422273e-01, -2.857748e-02,
+    +4.163249e-02, +1.519657e-01, +7.577305e-02, -1.656396e-01, +2.559175e-01, -1.461011e-01, +6.787781e-02, -1.150008e-01, +2.916356e-01,
+    +7.307266e-02, +3.144694e-01, +2.322076e-01, -3.583981e-03, -4.173829e-01, -6.307185e-02, -1.421919e-01, +1.393197e-01, -2.050111e-01,
+    +1.019199e-01, -1.289439e-01, -1.489213e-02, +3.726039e-02, +2.288536e-01, -3.784785e-02, +3.515330e-02, +3.568839e-02, +1.494793e-01,
+    +6.443231e-01, -2.575196e-01, -3.106265e-01, +8.788728e-02, +1.542240e-01, +1.866715e-01, +1.201244e-01, +6.332367e-02, -9.889986e-02,
+    +1.976629e-02, +1.694510e-01, -5.161494e-02, +4.528698e-02, -7.998645e-02, +2.927929e-01, -2.883281e-01, -4.540571e-02, -4.731158e-01,
+    +1.817188e-01, +2.170799e-01, +2.911617e-02, +1.287177e-03, +1.499103e-02, +6.414379e-02, +3.536526e-02, +2.085697e-01, -1.982549e-01,
+    -8.236866e-02, -8.360009e-02, -2.459835e-01, +1.498611e-01, +6.838822e-02, -3.317260e-01, +4.017183e-02, +2.724653e-01, +7.575490e-02,
+    //16
+    +9.942463e-02, -1.260560e-01, +6.250520e-02, +3.304629e-02, +4.545874e-02, -3.777527e-02, +1.019210e-01, +4.019343e-02, +4.163173e-03,
+    -1.217447e-01, -4.412472e-02, +7.652669e-02, -5.061805e-02, -1.215640e-01, +3.041708e-02, -1.350220e-01, -1.346822e-01, -6.356554e-02,
+    -1.474446e-01, +1.872462e-02, -1.152966e-01, -6.957196e-02, +4.133280e-02, +7.912686e-02, -1.637029e-01, -6.205615e-03, -1.977476e-02,
+    -1.004128e-01, -5.239667e-02, +1.003426e-01, -1.749900e-01, -5.167889e-03, -2.033352e-02, -6.609532e-02, +1.100007e-01, -1.122595e-02,
+    -2.792254e-02, +8.563093e-02, +6.850687e-02, +7.848030e-02, -5.480049e-02, -5.137328e-02, +2.701844e-02, +2.834556e-02, +2.072810e-02,
+    -2.260686e-02, -1.782341e-01, +1.185520e-02, -1.015303e-01, -4.779950e-02, +9.716918e-02, +6.638875e-03, -2.252590e-02, -9.777295e-02,
+    +5.495967e-02, -1.495911e-02, +5.991737e-03, +7.834345e-02, -7.894042e-03, +1.833000e-01, +6.557720e-02, -8.648988e-02, -7.592714e-02,
+    -3.963808e-02, +4.356834e-02, +5.332633e-02, +1.085971e-01, -2.011022e-01, -5.354482e-02, -3.525595e-02, +5.069163e-02, +1.028384e-01,
+    -1.139644e-02, -1.333052e-01, -3.367865e-02, -5.067335e-02, +7.305592e-02, +2.991743e-02, +6.585843e-03, -1.090267e-02, -3.787629e-02,
+    -5.407102e-02, -9.264079e-02, -8.505993e-02, -8.961320e-02, +2.496399e-03, +3.205160e-02, -9.708826e-02, -8.464769e-03, -5.588335e-03,
+    +1.764923e-02, -1.789468e-02, +2.007180e-01, -9.551612e-02, -6.007441e-02, +2.004112e-02, -8.576313e-02, +8.946868e-03, +1.005903e-01,
+    +1.821792e-02, -1.270139e-02, -1.616465e-01, +7.293057e-02, +1.332776e-01, -5.833247e-02, -1.361527e-01, +1.939550e-01, -5.285796e-03,
+    -1.244138e-02, +6.353240e-02, -2.189666e-02, -1.567031e-01, +2.127014e-02, +5.019592e-03, -2.213660e-02, -6.884192e-02, +6.131987e-02,
+    -1.992763e-02, -3.325179e-02, -2.009127e-01, +6.337563e-02, -1.905679e-01, +2.615443e-02, +2.375856e-02, +7.447892e-02, +5.891164e-02,
+    +5.909485e-02, +4.777274e-02, -2.803559e-02, -2.857134e-02, -1.181720e-01, -2.879200e-02, +4.776420e-02, +5.700340e-02, -1.834321e-01,
+    -2.118936e-02, -3.756679e-02, -3.667744e-02, -4.631846e-02, +6.926871e-02, -4.136149e-02, +4.600763e-02, -4.033597e-02, -3.022913e-02,
+    +3.639059e-02, -2.392543e-03, +4.594345e-02, -1.016128e-01, +2.732425e-03, +9.685171e-02, -1.939670e-01, +2.045107e-02, +4.753535e-02,
+    +4.622221e-03, -3.386720e-02, -9.955554e-02, -1.105495e-01, +3.295895e-02, -1.460319e-02, +5.767853e-02, -1.073094e-02, +4.497263e-02,
+    -8.359506e-02, +7.612695e-02, +5.613060e-02, -1.880444e-02, -5.232689e-02, -3.074475e-02, -1.551609e-02, +3.297277e-02, -1.320958e-02,
+    -1.209588e-01, +1.334562e-01, -1.685785e-02, -2.175431e-02, -3.529460e-02, -4.599934e-02, -1.200463e-01, -3.284881e-02, -3.747088e-02,
+    +4.701427e-02, +1.278457e-01, +1.029002e-01, -2.303940e-02, -3.435041e-02, -1.788287e-01, -4.040135e-02, -8.841101e-03, +2.406780e-02,
+    -5.278948e-02, -4.315333e-02, -1.863763e-01, -8.898406e-02, +1.061926e-02, +3.937088e-02, -1.472138e-01, -1.080355e-01, +2.214061e-01,
+    +2.258755e-03, +1.346117e-01, +1.432390e-02, +8.511590e-03, -1.207950e-01, -2.320794e-02, -8.484124e-02, -1.150037e-02, -3.346200e-02,
+    +7.984772e-02, +3.416951e-03, +9.684099e-02, +8.706350e-03, +6.682488e-02, -7.112950e-02, +1.569708e-03, -1.816305e-01, -8.474066e-02,
+    -9.507366e-02, -3.147553e-02, -9.008866e-03, -5.047838e-04, -2.414277e-02, +1.665365e-02, -1.501935e-02, -1.785546e-01, +7.380556e-02,
+    +5.447063e-03, -1.688636e-02, +3.534374e-02, -1.657036e-02, +1.246549e-01, -1.263945e-01, -7.072645e-04, -1.392433e-01, -6.302541e-02,
+    -2.564971e-02, -4.228147e-02, -8.118532e-02, +3.521897e-02, -8.615430e-03, -1.640190e-03, -5.786541e-02, +4.515425e-02, +4.260289e-02,
+    +9.388591e-02, -2.201232e-02, +5.166752e-02, +1.422405e-01, -9.052271e-02, +4.002739e-02, +2.099203e-02, -1.352731e-01, -3.634872e-02,
+    -1.970100e-01, +5.000808e-02, -1.165271e-01, +1.473319e-02, -8.752078e-02, -7.905250e-02, -2.638391e-02, -1.570596e-01, -9.797192e-02,
+    +7.036297e-02, -2.104448e-01, +1.664352e-01, +1.133112e-01, +1.994740e-01, +4.201631e-02, -1.077800e-01, +6.627147e-02, +7.981812e-02,
+    +1.390573e-01, +1.862559e-02, -9.524741e-02, -8.207478e-03, +1.651737e-02, +2.299869e-03, -6.031530e-02, -6.195006e-02, -4.907386e-02,
+    -1.897967e-01, -1.753984e-01, +8.086286e-02, -1.079239e-01, -1.326108e-01, +1.621390e-02, -3.402793e-02, -1.935088e-01, -2.694777e-01,
+};
+
+/* The 4 phases bias in the sub-pixel layer */
+const float espcn_x2_biases3[4] = \
+{
+    +5.245709e-01, +7.731844e-01,
+    +6.567694e-02, +3.494265e-01,
+};
+
+/* The 4 phases x 16 convolutional kernel(3*3) in the sub-pixel layer */
+const float espcn_x2_weights3[4][ESPCN_CONV2_FILTERS][ESPCN_CONV3_SIZE][ESPCN_CONV3_SIZE] = \
+{
+    //01
+    +5.597994e+00, -1.178001e+01, +7.205237e+00, +1.186303e+01, -2.344588e+01, +1.063353e+01, +6.572134e-02, -3.469802e+00, +2.443140e+00,
+    -3.438834e+00, -5.138949e+00, -1.462002e+00, +2.013984e+00, +2.794450e+00, +1.108678e+00, +5.631471e+00, -7.454784e-01, -1.008919e-01,
+    +9.279435e+00, -1.716195e+01, +5.021071e+00, +5.325989e+00, +3.376937e+00, +1.528947e+01, -1.539091e+00, -1.553940e+01, -6.035257e+00,
+    +1.437561e+00, +1.497452e+01, +2.316918e+00, -2.553615e+00, -3.552414e+01, +3.716760e+00, +4.790540e+00, +1.228068e+01, +2.596022e-01,
+    -5.196870e+00, -4.094396e+00, -2.102043e-01, +1.252008e+01, -1.548176e+00, +6.874083e+00, -3.646111e+00, -6.788568e+00, +1.863974e+00,
+    -3.430023e+00, -2.379419e+00, +4.659457e+00, -1.169658e+01, -1.801586e+01, +2.581946e+00, +7.837345e+00, +1.743228e+01, +3.215643e+00,
+    +8.050442e+00, +1.514278e+01, +1.631869e+00, -6.678589e+00, -2.543667e+01, -1.547832e+01, +2.801953e+00, +1.142860e+01, +1.110967e+01,
+    -4.817697e+00, +5.450091e+00, -6.579371e+00, +3.400415e+00, +2.259151e+01, -6.682698e+00, -1.194952e-02, -3.624754e+00, -1.380197e+01,
+    -5.610377e-01, -4.794302e+00, +4.887590e+00, +4.316645e+00, -1.336590e+01, +1.465848e+01, -1.460470e+00, -2.999593e+00, +1.895477e+00,
+    -7.384895e+00, +1.127194e+00, -7.520002e+00, +1.027962e+01, +1.733158e+01, +5.484227e-01, -6.823533e+00, -5.129478e+00, -3.846884e+00,
+    -7.512130e+00, +1.790715e+00, -1.448837e+01, +3.042940e+00, +1.782438e+01, +4.722102e+00, -6.223089e+00, -9.303344e+00, +1.280668e+01,
+    -3.464314e+00, -9.979603e-01, +3.527560e+00, +8.195971e-01, +6.285105e-01, -1.853803e+00, -6.951999e-01, -1.369955e+00, -7.147051e-02,
+    -5.020947e+00, -4.541414e+00, -3.831126e+00, -1.730573e+00, +3.091146e+01, -4.720378e+00, -2.722628e+00, -3.727058e+00, -2.535434e+00,
+    +4.077447e+00, +9.178565e+00, -4.822037e+00, -3.709432e+00, -2.674903e+00, -2.149121e+00, -2.229791e+00, -5.395297e+00, +2.155123e+00,
+    -3.962636e+00, -8.049862e+00, +6.663918e+00, +1.309390e+01, +8.705679e+00, +3.976537e+00, -3.341679e+00, -1.118972e+01, -6.931045e+00,
+    -1.172989e+01, -1.161022e+01, -2.947874e+00, +6.352101e+00, -7.944877e+00, +1.262639e+01, -3.066385e+00, -8.844203e-02, +1.338298e+00,
+    //02
+    -8.085329e+00, +1.410082e+01, -4.134983e+00, -1.851728e+01, +1.776131e+01, +4.236534e-01, -3.387003e+00, +2.529578e+00, -1.280295e+00,
+    +4.180902e+00, +2.914329e+00, -3.257546e+00, -5.950978e-01, -2.973477e-01, -1.874448e+00, -4.152069e+00, +2.332300e+00, -5.317728e-02,
+    -9.919962e+00, +1.473869e+01, -8.731652e+00, -5.903894e+00, +1.100116e+01, +2.033868e+01, -2.582356e+00, -6.776491e+00, -1.340181e+01,
+    -7.617416e+00, +1.730884e+01, +9.494179e+00, -8.626268e+00, -1.584073e+01, -1.150555e+01, -7.782184e-01, +1.600576e+01, +2.308406e+00,
+    -2.016880e+00, -4.459552e+00, -3.582962e+00, -9.540895e-01, +1.907672e+01, -1.281755e+00, -4.224132e+00, -1.718335e+00, -3.834626e+00,
+    -8.516452e-01, +5.183182e+00, -5.178044e+00, -3.061989e+00, -8.348381e+00, -1.544497e+01, +5.474900e+00, +1.658655e+01, +6.765642e+00,
+    +8.862589e+00, +9.893558e+00, +8.969851e+00, -5.168436e+00, -1.673991e+01, -2.634424e+01, +1.740268e+00, +3.954194e+00, +2.015441e+01,
+    -3.610453e+00, +4.160074e+00, -6.380843e+00, -1.089333e+01, +4.302342e+01, -1.725600e+01, +3.520872e+00, +3.805081e+00, -1.460714e+01,
+    -6.616865e-02, +3.541606e+00, -2.599441e+00, -1.078706e+01, +2.253512e+01, -1.031626e+01, -1.062744e+00, -2.791352e-01, -1.242188e+00,
+    +3.534427e+00, -1.741842e+01, +6.085934e-01, +9.120547e+00, +8.391726e+00, +1.010362e+01, -7.866089e-01, -1.206579e+01, -1.373628e+00,
+    -1.223663e+01, +1.409293e+00, -1.100824e+01, -2.179102e+00, +1.240662e+01, +1.482825e+01, +6.644621e+00, -2.546130e+01, +1.247312e+01,
+    -1.378635e+00, -2.014217e+00, -1.818631e+00, -1.810257e+00, -2.606813e+00, -1.711867e+00, +1.837963e+00, -3.692534e+00, -6.092230e-01,
+    +1.755829e+00, -1.091957e+01, -5.198967e+00, +1.569542e+01, -3.565771e+00, +1.198382e+01, +2.517065e+00, -8.539289e+00, -4.679468e+00,
+    -1.693292e+00, +3.681031e-01, -3.655947e+00, +4.736129e-01, -4.821878e+00, +4.452127e+00, +1.441508e-01, -6.030838e+00, +1.133212e+00,
+    -6.650824e+00, -4.238765e+00, +1.385582e+00, -2.497022e+00, +2.443135e+01, +1.674297e+00, +4.227287e+00, -1.397345e+01, -8.595106e+00,
+    -1.721327e+00, +9.109020e+00, -4.953812e+00, -2.344073e+00, +1.045176e+01, +1.209581e+00, -5.209667e+00, +3.013616e+00, +1.174455e+00,
+    //03
+    -1.890094e+00, -2.998419e+00, +4.258327e+00, +1.105038e+01, -2.514457e+01, +1.188887e+01, +7.460602e+00, -1.064601e+01, +4.367039e+00,
+    +3.657417e+00, -1.429323e+00, -2.647579e+00, +5.970247e+00, +5.443798e+00, -3.325662e+00, +1.009101e+00, -2.759864e+00, -1.285130e+00,
+    +4.596232e+00, +8.263179e-01, +1.081290e+01, +5.015514e+00, -3.396275e+01, -2.391943e-01, +4.642275e+00, +6.707517e+00, +1.861245e+00,
+    -7.861883e+00, +2.916907e+00, -3.833296e+00, +1.097939e+01, -5.873344e+00, +8.119938e+00, +4.962233e-01, -8.893279e+00, +2.325805e+00,
+    +7.698056e+00, +3.877791e+00, +2.277546e+00, -9.328781e+00, -8.959771e+00, +4.505596e-01, +7.876121e+00, -6.283549e+00, +5.918000e+00,
+    -5.867037e+00, -8.202332e+00, +1.330089e+00, +7.301509e+00, +1.449036e+01, +1.235343e+01, -9.956837e+00, -8.086215e+00, +1.003226e+00,
+    -1.422714e+01, -2.051433e+01, -1.004442e+01, +1.716049e+00, +2.554468e+01, +1.334703e+01, +2.871158e+00, -3.093853e+00, -7.181022e+00,
+    -1.578607e+01, +7.340561e+00, -6.615619e+00, +1.284456e+01, +7.826229e+00, -2.241835e+00, +5.422560e-01, +1.057849e+01, -1.663524e+01,
+    -1.419392e+00, +3.307623e+00, -1.302942e+00, +1.533950e+00, -1.771962e+01, +1.513189e+01, +1.234086e+00, -6.331242e+00, +6.150286e+00,
+    +5.370337e+00, +1.549700e+01, -4.357290e-01, -1.167419e+01, -8.579596e+00, -7.836227e+00, +3.709725e+00, +6.724696e+00, -2.039292e+00,
+    -1.478526e+01, -1.429158e+01, -5.778247e+00, +1.813496e+00, +3.693759e+01, -4.003377e+00, +4.660659e-01, -1.360648e+01, +1.492773e+01,
+    -3.419762e-01, -2.423829e+00, -5.288610e-01, +4.077103e+00, -9.391872e-01, +3.774908e-01, -1.302802e+00, +4.728396e+00, +4.710207e-01,
+    +3.111073e+00, +1.416994e+01, +2.955710e+00, -8.799207e+00, -7.479593e-01, -9.865468e+00, -4.180013e+00, +1.056625e+01, -6.715174e+00,
+    -6.181863e+00, +6.004942e-01, -4.456537e-01, +2.144429e+00, +5.429729e+00, +3.985207e+00, +1.265346e+00, +4.440930e+00, +1.559565e+00,
+    +9.214950e+00, +8.379613e+00, -2.310222e+00, +1.541447e+00, -2.685170e+01, +2.218297e+00, -4.180075e+00, +1.127952e+01, +3.387653e+00,
+    -6.699090e+00, -5.106975e+00, +6.212074e+00, -3.012071e+00, -5.395243e+00, +7.941899e-01, +5.073181e+00, -4.880428e+00, +1.013662e+01,
+    //04
+    -1.066610e+00, +2.727697e+00, -8.313076e-01, -2.034154e+01, +2.093163e+01, -4.005301e+00, -8.126461e+00, +9.515433e+00, -7.245439e-01,
+    +1.015562e+00, +3.006805e-01, +2.573064e+00, -2.355594e+00, +1.039300e+00, -1.885598e-01, -3.226749e-01, -5.859666e-01, -3.229370e+00,
+    -6.498738e+00, +1.086507e+01, +9.116407e+00, -1.114686e+01, +2.078308e+00, -1.905508e+01, -1.835883e+00, +8.152588e+00, +8.358495e+00,
+    -6.724572e+00, -5.269406e-01, -7.894969e-01, -3.744509e+00, +1.201547e+01, +2.659857e+00, -2.317862e+00, -1.065504e+00, -1.850983e+00,
+    +5.369401e+00, +5.680741e+00, +2.241086e+00, -8.760496e+00, -3.733870e+00, -5.680813e+00, -2.248524e+00, +1.180930e+01, -4.292657e+00,
+    -5.728991e-01, -4.375807e+00, -6.776155e+00, +3.702869e+00, +2.701126e+01, +2.217798e+00, -1.024244e+00, -9.293764e+00, -5.937378e+00,
+    -4.804467e+00, -1.682912e+01, -1.967387e+01, +6.618224e+00, +4.151494e+00, +3.003548e+01, -2.431149e+00, +5.938689e+00, -1.087801e+01,
+    -6.946374e+00, -6.740711e+00, +2.435838e+00, -2.703673e+00, +3.006401e+01, -1.927504e+01, -2.042182e+00, +2.370048e+01, -1.633729e+01,
+    +1.209658e+00, +1.084935e+00, -6.656873e-02, -9.828084e+00, +1.415929e+01, -8.948336e+00, -4.046761e+00, +9.459536e+00, -4.706481e+00,
+    +7.351616e+00, +3.369562e+00, +1.149443e+01, +4.036817e-01, -2.614539e+01, -3.843188e+00, +6.168665e+00, -2.564023e-01, +4.354223e+00,
+    -8.257423e+00, -1.879152e+01, -9.470227e+00, -1.167335e+01, +3.345936e+01, +1.364949e+01, +1.174865e+01, -2.577292e+01, +1.235973e+01,
+    +4.322405e+00, -1.809860e+00, +3.309517e+00, -1.646136e+00, -3.133252e+00, -4.510610e+00, -4.140710e+00, +1.794639e+00, -2.755109e+00,
+    +3.243140e+00, +8.493792e+00, +8.494404e+00, +8.324288e+00, -2.195426e+01, -7.317227e+00, +9.093954e+00, -1.061075e+01, +1.047457e+00,
+    -2.050118e+00, -6.455069e+00, -1.127228e+00, +9.300684e-01, +5.615511e-01, +1.837190e+00, -4.052578e+00, +1.805544e+00, -5.585794e+00,
+    +1.744602e+00, +1.461012e+01, +1.615566e+00, -6.667794e+00, -6.889730e+00, -1.507997e+01, -2.571180e+00, +4.182217e+00, +1.017070e+01,
+    +3.087302e-01, +7.841324e+00, +7.588163e+00, -3.029181e+00, +3.685261e+00, +3.689950e+00, -6.061546e+00, +7.845928e+00, +1.828385e+00,
+};
+
+/* --------------------------------- x3 --------------------------------- */
+
+/* The 32 cell bias in the first layer */
+const ESPCNBias1 espcn_x3_biases1 = \
+{
+    +1.719859e-01, +1.193553e-01, +1.981321e-01, -3.701787e-02, +8.156335e-02, +8.411352e-02, -4.240787e-02, +2.067662e-01,
+    +6.132228e-05, -6.932886e-02, +2.192127e-01, +4.046644e-02, +1.166506e-03, +1.262387e-01, +1.502476e-01, -4.725262e-03,
+    -6.361858e-03, +2.148526e-01, +1.375850e-01, +5.018312e-01, -8.236658e-02, -4.829292e-03, -2.244435e-02, +1.505058e-02,
+    +4.266049e-02, +2.183750e-01, +2.148508e-02, -6.440648e-02, +4.639201e-01, -2.291743e-01, +1.002774e-01, +7.014231e-02,
+};
+
+/* The 32 convolutional kernel(5*5) in the first layer */
+const ESPCNKernel1 espcn_x3_weights1 = \
+{
+    //01
+    -7.567182e-04, +3.678721e-04, +8.725030e-04, +2.572609e-04, -3.636199e-04,
+    +7.413121e-04, -1.155055e-04, -2.897147e-03, +1.614683e-03, -1.114932e-03,
+    -1.784841e-04, +3.434500e-04, +1.590379e-03, -8.476908e-05, +6.773006e-04,
+    +4.580963e-04, +5.819287e-05, -1.478380e-03, -2.873676e-04, -2.459532e-04,
+    -5.130406e-04, +3.493539e-04, +2.709526e-04, +1.520441e-04, +3.290688e-04,
+    //02
+    +5.725525e-04, +1.007445e-04, -7.813118e-04, +6.342259e-04, -1.673199e-04,
+    -5.638868e-04, -1.378041e-03, +6.158991e-04, +3.365815e-04, -1.268784e-04,
+    +2.755340e-04, +1.223083e-03, -1.680565e-03, +2.746450e-03, -1.090158e-03,
+    +1.510846e-04, +6.561325e-04, -5.910682e-04, -2.079216e-04, -3.567983e-04,
+    -3.271435e-04, -6.242886e-04, +2.983722e-04, +3.664678e-04, -1.487530e-05,
+    //03
+    +5.994532e-05, -3.009503e-04, -5.684269e-04, -6.588850e-04, -8.599685e-04,
+    -3.373283e-04, +6.675928e-04, -2.785511e-04, -3.700589e-04, +9.752494e-04,
+    -2.044760e-04, +8.616872e-04, +1.150547e-04, +3.140207e-03, -3.108106e-04,
+    -9.366246e-04, +1.461215e-03, -1.666907e-03, -1.617526e-03, +4.447863e-04,
+    +9.361771e-04, -1.194403e-03, -4.364239e-04, +3.406668e-04, -8.621415e-05,
+    //04
+    +7.318235e-04, -7.304879e-04, +9.237389e-04, -7.046150e-04, -5.484329e-04,
+    -7.571501e-04, -1.379819e-03, +6.233231e-04, -1.235233e-03, +7.236383e-04,
+    -8.485679e-04, -9.980026e-04, -1.847235e-04, -5.571812e-05, -4.889062e-04,
+    -9.891055e-04, +2.897789e-04, -3.817984e-04, +4.556754e-04, +2.871247e-04,
+    +1.813943e-04, +7.548640e-04, -8.012901e-05, -3.547008e-04, -1.317963e-03,
+    //05
+    -2.307710e-04, +1.448145e-04, -4.171066e-04, +1.199449e-04, -6.694244e-04,
+    +4.825395e-04, -3.085946e-04, +1.585131e-03, -1.038852e-03, +1.219799e-03,
+    -7.889699e-04, -6.087748e-04, -4.539272e-04, +1.483142e-03, -5.565424e-04,
+    +1.631097e-03, -5.656190e-04, +4.039284e-05, -1.583489e-03, +5.462970e-04,
+    -1.921467e-04, -8.249563e-04, +1.318060e-03, +4.610645e-04, -2.774722e-04,
+    //06
+    -5.441892e-04, -9.432108e-05, -7.277156e-04, +1.666008e-03, +3.239198e-04,
+    +1.657670e-04, +2.315535e-03, -7.479258e-04, -5.025950e-03, +7.227635e-04,
+    +4.284444e-04, -3.233155e-03, +2.420567e-03, +2.001264e-03, -6.740349e-04,
+    -5.350423e-04, +5.089910e-04, +1.751185e-04, -1.460067e-03, +3.733923e-04,
+    +2.152411e-04, +2.532432e-04, -4.779836e-04, +4.807444e-04, +3.013448e-04,
+    //07
+    +4.894605e-04, +9.141514e-04, -1.791490e-03, +6.953525e-04, +4.146749e-06,
+    -5.929592e-04, +1.495459e-03, +3.216342e-04, -5.677343e-05, +5.869611e-04,
+    +6.602178e-04, -1.071561e-03, +8.865576e-04, -5.775803e-04, -4.433220e-04,
+    -1.634900e-03, -2.257399e-03, +5.172619e-04, +2.611469e-04, +5.801706e-04,
+    +6.995182e-04, +2.167866e-03, -3.606885e-05, -1.426349e-03, -3.461044e-04,
+    //08
+    -3.453929e-04, -4.946750e-06, +3.285797e-05, -5.041145e-04, +4.230747e-04,
+    +9.585107e-04, +7.821972e-04, -1.288826e-03, -7.613814e-04, +7.839809e-04,
+    -1.413221e-03, -2.445003e-04, +1.373070e-03, -3.103709e-04, -8.354342e-04,
+    +2.165189e-03, -5.930005e-04, -8.132664e-04, +2.693384e-05, +6.534802e-04,
+    +1.993927e-04, -5.588145e-04, -1.027791e-03, +4.509869e-04, +1.856059e-04,
+    //09
+    -5.933826e-04, -2.139572e-04, -1.432409e-05, +3.562935e-04, -3.404400e-04,
+    -2.067918e-05, +7.712722e-04, -1.161986e-03, +9.125222e-05, +1.422213e-03,
+    +6.590506e-04, -8.105840e-04, +9.351552e-04, +3.351275e-03, -2.748135e-03,
+    -2.717573e-04, +1.829190e-03, -7.481404e-04, -1.715922e-03, -1.775890e-05,
+    -2.695053e-04, -5.941212e-04, +1.483128e-04, +3.979314e-04, -6.048605e-05,
+    //10
+    -1.693223e-04, +3.559536e-04, -2.680042e-04, +1.114514e-04, +2.551105e-04,
+    -3.443158e-04, +5.085299e-04, +2.592784e-03, -3.345190e-03, +2.347543e-04,
+    -2.494102e-04, +7.981799e-04, +2.326487e-03, -5.029070e-03, +1.067197e-03,
+    -2.304383e-04, -3.776758e-04, +6.653903e-04, +1.256271e-03, -1.854878e-05,
+    +2.896387e-04, +2.164601e-04, -5.045479e-04, -1.106483e-04, -3.131996e-04,
+    //11
+    -8.144534e-04, +2.256494e-04, +4.370224e-04, +6.181376e-04, +5.751170e-04,
+    +7.635949e-04, -2.994887e-04, +4.195263e-05, -2.430682e-03, -3.841258e-04,
+    +3.283907e-04, +1.857229e-03, -2.045013e-03, +1.660377e-03, +8.643947e-05,
+    +6.628427e-04, +8.364746e-05, -1.161257e-03, -1.611448e-03, +2.022899e-05,
+    -8.373990e-04, -1.068819e-03, +2.447286e-03, -6.834096e-04, +3.936773e-04,
+    //12
+    -2.232376e-04, -1.731516e-04, -2.003978e-03, +4.748127e-04, -8.400738e-04,
+    -3.442623e-05, +1.900026e-03, +5.265758e-04, -2.379529e-04, +3.193238e-04,
+    -1.015986e-03, +1.570356e-03, -1.427414e-03, +2.408269e-03, -9.832110e-04,
+    +9.998499e-04, -1.270631e-03, +7.438260e-04, -1.814201e-04, +6.096892e-04,
+    -7.324176e-04, -1.506861e-04, +8.167440e-04, -1.199104e-03, +9.019778e-04,
+    //13
+    +4.543616e-04, +6.321780e-04, -2.211895e-04, -1.313504e-03, +4.713861e-04,
+    -4.027309e-04, +2.694783e-04, -1.867284e-03, +1.118002e-03, +5.537928e-04,
+    -1.238347e-03, +6.795532e-04, +2.218641e-04, +1.545447e-03, -8.758855e-04,
+    +6.368396e-04, -1.010365e-03, +3.069481e-04, -5.298017e-04, +7.206311e-04,
+    -2.420461e-04, +9.391524e-04, +3.486949e-04, +2.077021e-05, -1.385636e-04,
+    //14
+    -1.039310e-03, +1.392332e-03, +6.602954e-06, -9.649508e-05, -4.454479e-05,
+    -4.248995e-04, +3.190426e-03, -1.039081e-03, -2.341627e-03, -1.034439e-03,
+    -2.024087e-03, +1.302875e-04, -2.685347e-03, +6.056262e-04, +2.694388e-03,
+    -4.248760e-05, +2.662134e-03, -1.464484e-03, -1.469841e-04, -6.459919e-04,
+    +1.276277e-04, +1.830308e-04, -4.805141e-04, -2.975041e-05, -1.943444e-04,
+    //15
+    -4.058611e-04, +1.810688e-04, +9.568521e-05, +1.080791e-03, -5.042551e-04,
+    +1.640346e-04, -5.072792e-04, +1.318874e-03, -3.631427e-03, +1.732580e-03,
+    +1.953269e-04, +8.960364e-04, -1.753805e-04, +2.062022e-03, -1.299368e-03,
+    -5.958964e-04, +1.163416e-06, -4.461617e-04, -2.758455e-04, +6.454696e-04,
+    -3.591357e-04, +5.261259e-04, -3.775367e-04, +7.610857e-04, -6.592837e-04,
+    //16
+    +6.499073e-04, +5.344955e-04, -1.199178e-03, -1.967113e-04, -1.878307e-03,
+    +9.538502e-04, +3.663003e-04, -4.333993e-05, +8.229650e-04, -1.036024e-04,
+    +1.526765e-03, +1.157229e-03, +1.189942e-03, -3.055555e-04, -1.219630e-03,
+    -5.605987e-04, -1.173803e-03, +9.015790e-04, -4.429784e-04, +1.393610e-04,
+    -3.374485e-04, +1.351290e-03, -1.531804e-03, -3.911968e-04, +4.858307e-04,
+    //17
+    +5.409487e-04, -1.111647e-04, +5.903884e-04, -1.247207e-03, +4.253041e-04,
+    -1.118059e-03, +1.310874e-03, -1.275912e-03, +1.201968e-03, -4.671074e-04,
+    +5.259801e-04, +1.299053e-03, +1.476734e-03, -3.865812e-04, +3.676405e-04,
+    -5.661835e-04, -1.104258e-03, -4.665559e-04, +6.304226e-04, -1.898286e-04,
+    -4.395590e-04, +4.580309e-05, -8.349344e-04, +1.184389e-03, -7.036126e-04,
+    //18
+    +1.239027e-04, -5.358571e-04, -5.875887e-04, -9.950336e-05, +2.519190e-04,
+    -1.023067e-04, -2.047220e-04, +7.767707e-04, -4.293325e-04, -2.798448e-04,
+    +3.504108e-04, -2.422969e-04, +3.904131e-05, -1.171215e-03, +8.255933e-04,
+    +5.861161e-04, +5.919753e-04, -1.281424e-03, +2.909992e-03, -8.356992e-04,
+    -5.679714e-04, +1.111354e-04, +3.125838e-04, -8.386575e-04, -3.371030e-04,
+    //19
+    -5.639148e-04, +3.427589e-04, -1.256035e-05, -6.844069e-04, +5.406322e-05,
+    +1.767509e-04, +8.148973e-04, +6.638861e-04, +3.761801e-04, +4.394101e-04,
+    +1.148808e-03, -1.815188e-03, -1.057278e-03, +7.674605e-04, -1.155838e-03,
+    +1.009350e-03, -7.316360e-04, +1.143249e-03, +5.605813e-04, +4.948632e-04,
+    +7.971118e-04, -1.946031e-03, +3.111361e-05, -1.213717e-03, -4.084035e-04,
+    //20
+    +4.545452e-05, -3.237959e-04, -2.571954e-03, +1.346958e-03, -1.638011e-03,
+    -3.119166e-04, +1.120425e-03, +2.122257e-04, -1.597427e-04, +1.008212e-03,
+    +1.341617e-03, -9.226682e-04, -5.672474e-04, -9.361131e-04, +9.495817e-04,
+    -4.027551e-04, +7.207672e-04, -1.874002e-03, -5.369211e-05, -2.378621e-04,
+    -2.754805e-04, +4.600007e-05, -2.324455e-03, +7.368143e-04, -5.303460e-05,
+    //21
+    +5.469127e-04, -6.358684e-04, +1.235473e-03, +7.092294e-04, +1.336442e-04,
+    +2.893760e-05, -1.837052e-03, -2.264642e-03, -9.468617e-04, -1.973214e-03,
+    +1.393210e-03, +1.415721e-03, +1.033039e-04, -1.843876e-03, +1.624468e-03,
+    -1.538924e-03, +8.350334e-04, +2.570379e-03, +2.011742e-03, +4.518016e-04,
+    -1.920176e-04, -3.294351e-05, -5.951537e-04, -1.160296e-03, -6.089834e-05,
+    //22
+    -9.241669e-05, -1.875085e-04, +8.117736e-04, -6.997636e-04, +3.607558e-04,
+    +4.567229e-04, +4.361001e-04, -8.428572e-04, -2.698908e-03, +6.359800e-04,
+    -7.328484e-04, -1.131597e-03, +5.699205e-05, +3.277155e-03, -6.399454e-04,
+    -3.563411e-04, +2.103432e-03, -7.647818e-04, +6.739365e-04, -2.641297e-05,
+    +1.586580e-04, -5.350413e-04, +4.760918e-05, -1.047415e-04, +4.718806e-05,
+    //23
+    +6.644911e-04, +5.276291e-04, -1.218391e-03, +1.113735e-03, -9.202528e-05,
+    -2.072396e-03, +1.026571e-03, +1.438080e-03, -5.493644e-04, -9.136994e-04,
+    +1.081543e-03, +6.128904e-04, -3.578353e-04, -6.775849e-04, +2.578287e-03,
+    +7.389059e-05, -1.672508e-03, -1.268831e-03, -1.424988e-03, -1.567670e-03,
+    +4.390449e-04, +8.952662e-04, +1.165315e-03, +1.123250e-04, +8.019694e-04,
+    //24
+    +7.691117e-04, -1.890108e-04, +4.253680e-04, -6.372022e-04, +9.204505e-04,
+    -5.496580e-04, -1.170616e-04, -1.872401e-03, -6.942230e-04, +4.556782e-05,
+    -8.949949e-05, +1.705764e-03, +4.011612e-04, +1.571792e-04, -1.802396e-03,
+    +2.301771e-04, +5.035309e-04, -4.271263e-04, +8.240626e-04, +1.788484e-03,
+    +1.822567e-05, -5.867103e-04, +6.103104e-04, -1.048808e-03, +1.293434e-04,
+    //25
+    +2.872119e-04, +1.630442e-03, +1.979316e-03, -4.187411e-04, -5.336567e-04,
+    -3.979778e-04, -2.542413e-03, -1.806082e-03, +3.430455e-04, +5.172417e-04,
+    +8.825207e-04, +1.392156e-03, -2.107374e-03, +8.755384e-04, +1.137094e-03,
+    -1.673428e-03, +2.063785e-03, -3.276367e-03, +1.393031e-03, +1.153492e-04,
+    +1.182265e-04, +2.369880e-04, -1.449275e-03, +1.517146e-03, +5.619994e-05,
+    //26
+    -5.548472e-05, +4.569460e-04, -5.096992e-04, +5.001002e-04, +3.502700e-04,
+    +4.446397e-04, -4.706124e-04, +1.970283e-04, +5.835157e-04, -9.523542e-04,
+    +3.305449e-04, +2.000534e-03, -3.395122e-03, +3.977041e-04, -1.714921e-03,
+    +5.335361e-04, +1.705152e-04, -1.624405e-03, +2.081914e-04, +2.004665e-03,
+    +3.384394e-04, -2.859152e-04, +4.743933e-04, +4.107271e-04, -1.095963e-03,
+    //27
+    -9.675735e-04, +3.609497e-05, -1.343159e-03, +2.258536e-03, -1.952059e-04,
+    -4.344628e-04, +9.033102e-05, +2.690559e-04, +1.450019e-03, -9.383644e-04,
+    +1.134590e-03, -1.914575e-03, -2.751149e-03, +1.033292e-03, +4.109674e-04,
+    -4.959496e-05, -1.345565e-03, -2.499616e-04, +1.366029e-03, +6.067609e-04,
+    -3.717173e-05, -4.127041e-04, +4.830277e-04, +8.712532e-04, -5.773337e-04,
+    //28
+    -3.263126e-04, +1.939987e-03, -2.441003e-03, +1.122805e-04, +1.375552e-04,
+    +1.284885e-03, -1.197741e-03, +1.675130e-03, -3.629893e-05, -1.600784e-04,
+    -1.341982e-03, -9.315608e-04, +1.784018e-03, +7.415527e-04, -1.368157e-03,
+    -5.118892e-04, +6.462258e-04, +4.989715e-04, -4.507062e-04, +8.953306e-04,
+    -1.271329e-03, +1.856664e-03, -9.579262e-04, +9.830519e-04, -6.899494e-04,
+    //29
+    -8.238994e-05, +1.388723e-04, -4.248127e-04, +2.040558e-04, -2.901342e-04,
+    +2.714201e-04, -2.281901e-04, +9.803909e-04, -7.087627e-04, +1.018873e-03,
+    -6.773788e-05, -1.763057e-04, -1.032799e-03, -4.481711e-03, +8.470139e-04,
+    +5.861989e-06, +9.069027e-04, -1.480308e-03, -2.709459e-04, +3.656502e-04,
+    -4.485566e-04, +9.504110e-05, +5.555192e-04, +3.125302e-04, +2.783331e-04,
+    //30
+    -3.629905e-05, +9.055482e-04, -1.636016e-03, +8.467021e-05, -3.351554e-04,
+    +2.612887e-03, -2.114237e-03, -1.324759e-03, +1.680516e-03, -3.031306e-04,
+    +2.247896e-03, -5.209185e-04, -8.379126e-04, +9.096144e-04, +7.255874e-04,
+    +4.269094e-04, -8.359523e-04, -4.912368e-04, -1.146598e-04, -2.532425e-04,
+    -1.404469e-03, +1.352472e-03, -6.550862e-04, +2.498375e-04, +5.144461e-05,
+    //31
+    +3.212019e-04, -2.595776e-06, +1.149744e-03, -5.230734e-04, -1.401689e-04,
+    +7.535903e-04, +5.637118e-04, +5.150575e-04, +1.196403e-03, -1.737051e-04,
+    -1.911043e-03, -3.742901e-04, -3.135170e-03, +1.606459e-04, +8.803615e-05,
+    +3.265302e-04, -8.192820e-04, +1.828113e-03, +4.961804e-04, +1.098925e-04,
+    +1.877686e-04, -4.317454e-04, -9.930660e-05, -1.116879e-04, -2.416202e-04,
+    //32
+    -3.525804e-04, -3.928633e-05, +2.735139e-05, -1.884017e-03, +6.027927e-04,
+    +1.917348e-04, +7.444705e-04, +1.448682e-05, +1.648449e-03, +6.307599e-05,
+    +5.078226e-04, -1.024763e-03, -8.070753e-04, +1.289375e-04, -3.884868e-04,
+    +9.025906e-04, -8.090876e-05, +1.411183e-03, -1.034329e-03, +1.740587e-04,
+    -1.045381e-03, +1.942093e-04, +5.131862e-04, -7.712106e-04, +4.316952e-04,
+};
+
+/* The 16 cell bias in the second layer */
+const ESPCNBias2 espcn_x3_biases2 = \
+{
+    -1.205363e-02, +8.506332e-02, -1.483593e-01, -4.698091e-02, -2.654317e-02, +4.427447e-02, -4.792689e-02, -2.918068e-02,
+    -1.043637e-01, -4.097241e-03, +1.255535e-02, +2.588619e-01, +1.890384e-02, +7.762890e-02, +1.388805e-01, -2.379749e-02,
+};
+
+/* The 16 x 32 convolutional kernel(3*3) in the second layer */
+const ESPCNKernel2 espcn_x3_weights2 = \
+{
+    //01
+    +1.264996e-03, -7.869269e-02, +2.190534e-02, -7.066206e-02, -1.315842e-01, +4.287497e-02, -1.850872e-02, +7.384315e-03, +1.932595e-01,
+    +1.102725e-01, +1.215152e-01, -9.926803e-02, -1.496528e-01, -2.465920e-01, +1.084708e-01, +6.428188e-02, -3.432139e-02, +8.883431e-02,
+    -4.604254e-02, +7.629214e-02, -1.150115e-01, -1.287892e-01, -2.711915e-02, +4.174687e-01, -7.047854e-02, -1.797318e-02, -3.383378e-02,
+    +1.583363e-02, -2.064669e-02, -2.259778e-01, +3.657830e-02, -2.347650e-01, -5.057032e-03, -2.682307e-02, -7.169081e-02, +1.938430e-01,
+    +1.708134e-01, +7.981537e-02, -1.028632e-01, -1.226819e-01, -2.217889e-01, -4.633826e-02, +1.933636e-02, +6.693675e-02, +6.946775e-02,
+    +2.989787e-01, +4.562735e-01, -3.397703e-01, -6.475016e-01, +2.578742e-01, +6.020293e-01, +3.041546e-02, -1.374189e-01, -1.981253e-01,
+    -1.005031e-01, -1.626998e-02, +1.181792e-01, -7.192600e-02, -2.903175e-02, +2.279008e-01, -4.238211e-01, -3.504503e-02, -3.124326e-01,
+    -5.247858e-02, -9.965832e-02, +4.029218e-02, +5.718674e-02, -1.160863e-01, -9.951425e-02, -5.860859e-02, +1.007759e-01, +7.625165e-03,
+    +1.115188e-01, +1.622593e-01, -1.699142e-01, -1.405877e-01, -1.293605e-01, -1.205705e-01, -4.285865e-01, +1.158303e-01, -2.452208e-02,
+    -2.087297e-01, +6.182367e-02, -1.342771e-02, -1.166204e-01, -1.875164e-01, -2.024858e-01, +2.830705e-01, +7.182112e-02, -7.789229e-01,
+    +2.577549e-01, +6.498839e-02, -2.187188e-01, -1.361034e-01, -7.170918e-02, -5.793870e-02, +1.562793e-01, +4.011455e-02, -7.900237e-02,
+    -3.068976e-02, +4.619705e-02, -2.787600e-02, -3.139265e-02, -7.129414e-02, -4.053662e-01, +5.507524e-03, -2.199180e-01, +3.750115e-02,
+    -2.032782e-01, -1.792875e-01, +1.342213e-02, -1.255410e-02, +1.780747e-02, +5.427044e-02, +2.060062e-01, -7.603268e-02, +5.676614e-02,
+    -2.137785e-02, +1.441889e-01, -2.883547e-02, +2.614287e-01, +8.257096e-02, +2.271352e-01, -7.843916e-02, +6.292883e-02, -4.021553e-01,
+    -6.488157e-02, -6.112182e-02, +1.712328e-01, -2.282454e-01, -2.652693e-02, -7.882397e-02, +2.310034e-01, +7.052188e-02, -3.889041e-02,
+    +1.592259e-01, +1.436465e-01, -1.380879e-01, -1.504792e-01, +2.110469e-02, -2.483610e-01, +7.878178e-02, -4.456546e-02, +1.614622e-01,
+    -8.413943e-02, +2.153721e-02, +5.793846e-02, +1.659226e-01, -1.264646e-03, -2.372368e-01, -5.445187e-02, +3.878815e-02, +4.062827e-02,
+    -2.262207e-01, -1.824309e-01, -1.831951e-01, +2.606260e-01, +2.118931e-01, +8.339223e-02, -1.351918e-01, -3.138196e-02, -1.409335e-01,
+    +7.272266e-02, +8.674473e-02, +1.167523e-02, -1.094511e-01, +1.852160e-02, +8.739991e-02, -8.924177e-02, -6.795508e-02, -3.067990e-01,
+    +1.710255e-02, -8.437242e-02, -2.326968e-01, +3.864692e-01, +3.302812e-01, +5.547851e-01, +9.007538e-02, -2.523512e-01, -1.610978e-01,
+    +9.308787e-02, +2.010591e-01, -1.914272e-01, -8.153503e-02, +3.074282e-02, +7.935148e-03, -8.511665e-02, -3.738989e-03, -1.823684e-01,
+    +7.404145e-02, +1.999740e-01, +4.914802e-01, -5.276940e-01, +4.343152e-01, +5.101299e-02, -2.747493e-01, -6.331713e-02, -3.505628e-01,
+    +2.667978e-01, +1.353565e-01, +1.170055e-01, -5.938426e-02, -1.301135e-01, -6.106245e-02, -5.340214e-02, -2.498658e-02, -1.502249e-01,
+    +1.722070e-01, +2.687061e-01, -1.534486e-01, -1.030302e-01, +6.980421e-02, -2.923272e-02, +7.705926e-02, +8.577764e-02, +5.571398e-02,
+    -8.278636e-02, -3.226495e-02, -2.051523e-01, -2.135535e-02, +1.554223e-01, -4.092322e-03, +1.456037e-01, -5.536148e-02, +1.876337e-02,
+    -4.581403e-01, -4.367318e-01, -9.221167e-02, +2.448590e-01, +2.894109e-01, +1.521188e-01, +1.912573e-02, +1.263860e-01, +1.790733e-01,
+    +1.919744e-01, +1.209970e-01, -4.288798e-02, -1.222667e-01, +2.284403e-01, +4.151956e-01, -2.155146e-01, -2.366350e-01, -1.563449e-01,
+    +9.524430e-02, +8.109158e-02, -1.055452e-01, -6.280464e-02, -1.522681e-01, -1.407610e-01, -2.227557e-01, +4.742566e-01, +1.878532e-01,
+    -2.255502e-01, -6.224564e-01, +1.488185e-02, -8.577906e-02, +3.118105e-01, +2.231375e-01, -1.245192e-01, -4.041292e-01, +4.019888e-02,
+    -5.240998e-03, +1.120321e-02, -3.628980e-01, -1.625960e-01, -2.046211e-01, -1.128498e-01, +1.007797e-01, +2.296762e-01, +7.087092e-02,
+    +3.340788e-01, -1.276297e-01, -1.889090e-01, -1.367860e-01, +1.468489e-01, +1.188614e-01, +8.636959e-02, -4.854565e-02, +3.746328e-01,
+    +1.223819e-01, +1.521688e-01, +1.347340e-02, +1.574906e-01, -1.690882e-01, +1.488527e-02, -1.185241e-01, -8.030477e-02, -1.896194e-01,
+    //02
+    -1.547557e-01, -7.834847e-02, -4.161931e-02, +5.211211e-02, +2.257043e-01, +1.890891e-01, -3.089107e-03, -9.735786e-02, -1.322370e-01,
+    -3.197570e-01, -2.264534e-01, -3.877606e-02, +2.588569e-01, -6.903488e-02, +1.745980e-01, -1.504345e-01, -7.990337e-03, +1.784297e-01,
+    -8.098156e-02, +2.390174e-01, -1.328549e-01, +1.318205e-01, +7.640990e-02, +7.703030e-04, -2.363201e-01, -1.368562e-01, +8.774237e-02,
+    -6.574489e-03, +6.882981e-02, -9.571250e-02, -4.639311e-02, -1.772385e-01, +9.432780e-02, -1.498271e-02, -7.173165e-02, +1.279873e-01,
+    -4.910661e-02, +1.221141e-01, +1.303697e-01, +6.454885e-02, -5.464239e-02, -9.691887e-02, -1.864191e-01, +7.197878e-02, -1.464687e-02,
+    +2.084246e-01, +2.835446e-01, -3.094684e-01, -1.677888e-01, +3.370447e-01, +2.157451e-01, -4.203354e-02, -1.592715e-01, -3.061551e-01,
+    +3.072282e-02, -5.041623e-02, +9.260293e-02, -1.023490e-01, -5.295426e-02, -8.920692e-02, -9.401730e-02, -1.130800e-01, -2.697331e-01,
+    +1.246207e-01, -1.839247e-01, +1.032122e-01, -1.763016e-02, +7.803801e-02, -7.408199e-02, +1.881614e-03, +6.021222e-02, +3.758349e-03,
+    +1.298592e-01, -3.388764e-02, +5.264502e-02, -2.299030e-01, +1.549171e-01, -1.020079e-01, -7.519111e-02, -4.531685e-02, -4.526133e-02,
+    -1.200878e-01, +5.193799e-02, -8.138740e-02, -2.118023e-01, -4.096581e-02, +1.796958e-01, -9.232391e-02, -1.175811e-01, -3.130413e-02,
+    +1.409011e-01, -3.988738e-02, +5.196112e-02, -1.836403e-01, +1.576085e-01, +4.197333e-02, -2.048322e-03, -1.139373e-01, -6.716812e-02,
+    +4.766515e-02, -1.396288e-01, -2.895479e-03, -1.767915e-02, -1.413159e-01, -6.971715e-02, +3.482182e-02, +8.134252e-02, -3.514500e-02,
+    -2.907377e-01, -4.627147e-02, +1.092641e-01, +3.648886e-02, +2.539415e-02, +2.991335e-02, +2.846415e-02, +9.781063e-02, -8.140184e-02,
+    +1.371125e-01, +3.095981e-02, +4.634258e-02, -1.265936e-01, -4.968463e-02, -6.006928e-03, +4.265933e-02, +1.278555e-01, +5.022931e-02,
+    -1.907723e-01, -9.092795e-02, -1.624846e-01, +4.106328e-01, +1.729134e-01, +1.535525e-01, -5.321298e-01, +1.568351e-01, -6.459393e-03,
+    +7.309218e-02, +1.338726e-01, -2.046560e-02, -9.315962e-02, -1.261732e-01, +1.033562e-02, +2.183256e-02, -2.075091e-03, +1.393824e-02,
+    +1.304569e-01, -8.537475e-02, -9.863525e-02, -5.818042e-02, +3.303964e-02, +8.280655e-02, -3.902606e-02, -1.097477e-01, -3.733543e-01,
+    +1.581737e-01, +6.919537e-02, +1.606766e-01, -5.802220e-02, +1.960113e-02, -1.293213e-01, -2.502905e-02, +8.278574e-03, -1.335162e-01,
+    -1.075413e-01, -1.719099e-02, +2.225638e-02, +4.701971e-02, -1.735008e-01, +3.114867e-01, +8.684228e-02, +3.157953e-02, +6.077088e-02,
+    -1.341905e-01, -6.762712e-02, +3.400871e-02, +2.071605e-01, +1.978656e-01, +9.809489e-02, -1.732346e-02, -1.815819e-01, -6.728213e-02,
+    +1.517163e-01, +3.401734e-01, +6.462257e-02, -1.602080e-02, -5.860533e-02, +2.484027e-01, +9.235758e-02, +5.259495e-02, -2.736503e-02,
+    +2.868864e-01, +5.015608e-02, +1.121033e-02, +4.779394e-01, +2.541923e-01, +5.030508e-02, -2.572870e-01, -2.724386e-01, -2.575584e-01,
+    +2.555785e-01, +2.059288e-01, +3.559690e-01, +1.251540e-02, -1.352193e-01, +9.761308e-02, -2.319942e-01, -1.390624e-01, -1.760416e-01,
+    +2.121416e-01, -8.859061e-02, -2.072539e-01, +1.715666e-01, +2.241046e-01, +1.805363e-01, -1.950123e-01, -3.048923e-01, -7.434841e-02,
+    +1.017660e-01, -1.612538e-01, -6.907324e-02, -6.836463e-02, +1.865712e-01, -4.438527e-02, +2.109610e-01, +1.164272e-01, +2.267385e-01,
+    -1.437986e-02, +6.432214e-02, -4.493526e-02, -1.614968e-02, -8.173914e-02, -1.035848e-01, +3.917350e-02, +7.469071e-02, +3.603640e-02,
+    +1.596174e-01, -3.956261e-02, +9.816623e-03, +1.088285e-03, +5.761022e-02, +7.548489e-02, -6.069641e-02, -5.112153e-02, -1.288455e-01,
+    -5.428394e-02, -6.144048e-02, +3.116176e-03, +2.346605e-02, -1.483842e-01, -1.013836e-01, +8.005943e-02, +1.971779e-01, -1.573383e-01,
+    -3.805057e-01, -3.255085e-01, -7.456037e-02, +2.829216e-01, +1.040190e-01, +4.053991e-02, +1.202554e-01, -6.892967e-02, +1.064827e-01,
+    -2.649531e-02, -2.066946e-01, -1.885074e-01, -2.633631e-01, -1.140154e-01, +8.960198e-02, +8.175786e-02, +1.634254e-01, +3.516762e-01,
+    +1.717395e-01, -5.067165e-02, -3.568874e-01, -9.803429e-02, +2.218549e-02, +2.144199e-01, -3.111542e-02, -8.623439e-02, -2.798402e-01,
+    -1.847730e-02, +1.078560e-01, +5.834857e-02, -4.521897e-02, -1.242739e-01, -1.402435e-01, -3.353380e-02, +4.088894e-02, -3.777641e-02,
+    //03
+    -1.909279e-01, +1.412100e-01, -3.022622e-02, +3.512337e-02, +7.421390e-02, +8.447402e-02, -3.298837e-01, +1.254137e-01, +3.142401e-02,
+    +5.362909e-02, +2.114267e-01, +4.816091e-02, -2.344642e-01, -8.519502e-02, +1.112308e-01, +2.187473e-02, -2.342015e-01, +8.370788e-02,
+    -1.135693e-01, +1.672658e-01, -4.065435e-01, -1.542752e-01, +2.630700e-01, -4.385770e-01, -2.139191e-01, +2.094044e-01, -5.679002e-01,
+    -1.310964e-01, -1.461889e-01, -1.890330e-01, +3.610278e-03, +2.419630e-02, +3.157201e-02, +8.502594e-02, -5.209350e-02, +5.431329e-04,
+    +7.661566e-02, -4.036815e-01, +2.463714e-01, -1.930952e-02, -1.278587e-02, -1.228918e-01, +2.836765e-01, -2.181273e-01, +1.412284e-01,
+    -6.317408e-02, +3.179551e-01, -1.686454e-01, -1.481421e-01, -1.824208e-01, +3.776170e-01, -1.002668e+00, +2.904523e-01, -1.455621e-01,
+    -3.759631e-01, -1.037877e-01, +7.146879e-02, -2.276195e-02, +3.539356e-02, +8.774100e-02, -2.672423e-02, +1.384058e-01, -2.959342e-01,
+    +2.568795e-01, -1.406568e-01, -1.702759e-02, +1.950769e-01, +1.225157e-02, -2.853392e-01, +8.937024e-02, +1.669041e-02, -2.568718e-01,
+    +4.636441e-02, +1.097700e-01, -8.196180e-02, -1.234773e-01, +1.097112e-02, -2.863093e-02, +2.681938e-01, -8.408828e-03, -4.316955e-02,
+    +4.182699e-02, +4.042822e-01, -8.539433e-02, +4.214715e-02, -2.894239e-01, +2.475792e-01, +1.634982e-01, +3.336421e-01, -5.658334e-02,
+    -7.337344e-02, -1.624973e-01, +1.571192e-01, +4.773039e-02, -6.654684e-02, -1.860359e-01, +1.106365e-01, -5.697318e-02, +3.037215e-01,
+    +9.193246e-02, +7.077073e-02, +1.062627e-01, -1.392403e-01, +1.223454e-01, +6.370611e-02, -1.940168e-01, -2.881289e-03, -3.514574e-02,
+    +6.459178e-02, +7.127126e-02, +8.440086e-03, -1.660862e-01, +6.940536e-02, -1.769277e-01, -2.552995e-01, +2.383512e-02, +1.730127e-01,
+    +8.870766e-03, +2.017673e-01, -3.379333e-01, +2.072753e-01, +1.442759e-02, -2.331529e+00, -7.509602e-01, +1.999057e-01, -2.826187e-01,
+    -1.372708e-01, +1.049846e-01, +7.780056e-02, -1.844394e-02, +3.354318e-02, -8.803584e-02, +1.196840e-01, -2.211341e-04, -1.445727e-01,
+    +6.820553e-03, -2.778809e-02, -1.529147e-01, +1.557387e-01, -1.020974e-01, +1.399240e-01, -1.139686e-02, +2.212422e-01, -1.090701e-01,
+    +2.096817e-02, -7.542099e-02, -7.357247e-02, +4.441031e-02, +8.275580e-02, -2.513676e-01, -8.322622e-03, +1.602441e-01, +4.180975e-03,
+    -1.449016e-01, +1.592455e-01, -4.727820e-02, +1.223261e-02, -8.495747e-03, -1.026694e-01, -4.726081e-02, -8.584336e-02, -5.582188e-02,
+    -4.807339e-02, -1.543124e-02, +1.266374e-01, -2.353192e-01, -1.421009e-01, +7.065786e-02, +2.200312e-01, +1.753544e-02, +8.888742e-02,
+    +6.542699e-01, -3.562515e-01, +2.575950e-01, +7.881378e-02, +3.363729e-01, -3.164718e-02, -2.516382e-01, -2.386046e-01, +5.934000e-02,
+    +8.558079e-02, +2.448118e-01, -4.300325e-01, +2.982384e-01, +8.240036e-02, -7.240248e-02, -5.044220e-02, +4.062946e-01, -2.193995e-01,
+    -4.508326e-02, +3.151893e-01, -3.927944e-01, +1.496467e-01, -1.233096e-01, -1.063671e-01, +3.008553e-01, +6.820492e-02, +1.224257e-01,
+    -7.713065e-02, +5.756564e-02, +5.186125e-02, -5.340671e-02, -7.716528e-02, +1.812926e-01, +8.466616e-02, -5.044568e-05, -1.516729e-01,
+    -1.320327e-02, +4.690513e-02, +1.514018e-01, +6.635268e-02, +4.934243e-03, -1.753920e-01, -1.459126e-02, -8.120105e-02, -7.709267e-02,
+    +2.900231e-03, -2.421794e-03, -1.539227e-01, -1.191982e-01, +5.608973e-02, +1.128801e-01, +1.156215e-01, +4.369262e-02, +2.623976e-01,
+    -2.573690e-01, +2.130373e-01, -2.559972e-01, -3.418502e-01, +2.472725e-01, -1.918274e-01, -2.049514e-01, +3.308246e-02, -2.347295e-02,
+    +9.601431e-02, -5.800635e-01, +1.079363e-01, -3.204573e-01, -6.094067e-01, +1.780300e-01, -5.056052e-02, -6.356706e-01, -8.195928e-02,
+    -2.942559e-02, +2.092890e-01, -1.655197e-01, +4.234774e-02, -2.323499e-01, -1.796460e-01, -1.163561e-01, +2.321002e-01, +2.998935e-01,
+    +1.372788e-01, +1.255336e-01, -2.450122e-03, -5.796100e-01, +2.436946e-02, -4.394346e-04, -1.705000e-01, +2.817745e-02, +1.041891e-01,
+    -3.244743e-02, -1.827839e-01, +3.185265e-02, +4.161232e-01, +1.067634e-01, +2.133552e-01, +3.351572e-01, -4.239841e-01, +2.597083e-01,
+    +1.546707e-01, -7.296097e-02, +1.563593e-01, -6.479704e-03, +2.399956e-02, +4.868091e-02, -6.041424e-02, -2.307529e-01, +2.922822e-01,
+    +3.406631e-01, -5.692815e-01, +2.093671e-01, +5.723070e-02, -2.110513e-01, +5.141604e-02, +1.903957e-01, -9.459924e-02, -8.959030e-02,
+    //04
+    +2.377601e-01, -1.983030e-02, -1.203052e-01, +6.846399e-02, +1.118263e-01, +1.471504e-01, -8.466923e-02, -2.689147e-01, -6.749845e-02,
+    +9.649788e-02, +1.247494e-01, -2.763085e-03, +1.036048e-01, -1.077802e-02, +2.216426e-02, -5.966142e-02, -2.412313e-01, -6.012106e-02,
+    +1.846637e-02, -4.830312e-01, -1.364669e-02, +2.650775e-01, +2.731807e-01, -4.328546e-02, -2.934736e-02, +6.831391e-02, +4.921220e-02,
+    -4.598081e-02, -1.593485e-02, -8.031572e-02, +1.318977e-01, +1.259413e-01, -5.943507e-02, -3.791705e-02, -9.069776e-03, -1.178658e-02,
+    +3.251488e-03, -3.666506e-01, -3.367160e-02, +1.829833e-01, +7.783616e-02, +4.633857e-02, +8.821345e-02, -3.893433e-02, -3.956041e-02,
+    +1.423506e-01, -4.527024e-01, -1.018497e-01, -4.408461e-01, -2.536509e-01, -7.071596e-01, +2.814538e-01, +7.782940e-01, -7.322627e-02,
+    +9.307674e-02, +8.050704e-02, +5.742186e-01, +1.523027e-01, +8.524171e-02, +2.167615e-01, -2.970780e-01, -2.627347e-01, -1.738520e-01,
+    -1.105925e-01, +1.156408e-03, +6.427806e-02, -1.057562e-01, +1.059308e-01, +1.533182e-01, -3.612469e-02, -1.534286e-01, +3.432940e-03,
+    -2.565913e-01, -2.702553e-01, -6.157935e-02, +1.554634e-01, +3.799288e-02, -6.686872e-02, +1.189123e-01, -1.608999e-01, +9.825843e-02,
+    -1.484255e-01, +3.311298e-01, -1.264464e-01, +1.461099e-01, -2.687989e-01, -2.047485e-01, -4.171661e-01, -1.919634e-01, +3.271034e-01,
+    -1.462929e-01, -3.521058e-01, -2.582156e-01, +1.344267e-01, +1.063546e-01, +2.267326e-01, +3.759193e-01, +1.382493e-01, -1.021931e-01,
+    +1.444737e-01, -1.697841e-02, -3.318258e-02, +7.029998e-02, -5.703921e-02, -1.159547e-02, -2.318522e-01, -1.755887e-01, -6.448036e-03,
+    +1.167640e-01, +1.907134e-01, -7.686106e-02, -8.326579e-02, +1.257550e-01, -1.382082e-02, -4.041062e-02, -2.116687e-01, -2.077459e-01,
+    -1.635265e-01, +2.606754e-02, -1.450319e-01, +2.776742e-01, +3.259478e-01, +3.104654e-01, -3.924972e-01, +5.447790e-01, +1.699541e-01,
+    +1.744247e-01, +3.279073e-02, -7.001811e-02, -4.877124e-02, -3.527061e-02, +9.674437e-02, +7.534572e-03, -9.920658e-02, -3.600482e-02,
+    -4.891921e-02, +1.577765e-01, +6.548516e-02, +3.543371e-02, +3.258899e-02, -1.454942e-01, -1.478264e-01, +3.949380e-02, -2.052829e-01,
+    +4.849145e-02, -1.064799e-02, +2.453427e-02, -1.553868e-01, +1.641341e-03, +8.725852e-02, +1.282620e-01, +4.230959e-02, -2.109162e-01,
+    +2.386950e-01, +2.697229e-01, +1.226263e-01, -1.056133e-01, -3.274324e-01, -1.359176e-01, -1.860086e-01, -2.838003e-02, -5.751215e-02,
+    -9.500031e-02, -2.119707e-01, -5.221785e-02, +7.986815e-02, +6.675085e-02, -1.994050e-01, +1.103309e-01, -4.939749e-04, +1.706410e-01,
+    -7.054956e-02, -5.655026e-01, -4.945132e-01, -1.286448e-01, +1.720279e-01, -1.036097e-01, +1.960714e-01, +4.856509e-04, +3.455640e-01,
+    -1.222820e-01, -4.152003e-02, -1.886983e-01, -1.413622e-02, -5.494064e-02, +4.550880e-02, -1.779341e+00, -2.163129e-01, +2.216293e-01,
+    +2.090182e-02, +2.689159e-03, +2.057212e-01, -1.835949e-01, -6.230759e-02, -7.352857e-02, -7.526683e-02, -3.444743e-01, +6.001001e-01,
+    -2.966051e-01, -1.303363e-01, -2.466592e-02, -1.586724e-01, +3.658113e-02, +2.064249e-02, +3.740850e-01, +2.405646e-01, +3.691495e-02,
+    +9.909796e-02, -1.034973e-01, +1.871794e-01, -9.408305e-02, -1.636776e-01, -1.048632e-01, +3.090309e-01, +2.923338e-01, -8.838756e-03,
+    -4.723392e-01, -1.624784e-01, -2.033005e-01, +1.417778e-01, -1.759012e-02, +6.940115e-02, +3.939929e-02, -2.039965e-01, -3.367796e-01,
+    +8.601241e-02, -7.450397e-02, -1.029238e-01, +1.655420e-01, +5.941751e-02, +1.681847e-01, -1.656302e-01, +2.318629e-02, -1.310481e-01,
+    -1.670567e-01, +2.591972e-01, -4.110771e-01, +1.609137e-01, +1.839035e-01, +9.475368e-02, -2.231755e-01, +9.807090e-02, +5.072640e-01,
+    +4.390688e-02, +2.313554e-01, +2.555063e-02, -2.404731e-01, -9.388776e-03, -5.168766e-02, +7.654184e-03, -1.555032e-01, +4.805508e-02,
+    +5.352478e-01, +6.721870e-01, +3.321369e-01, -4.840727e-01, -8.346822e-01, -3.292217e-01, -1.338512e-01, -3.278323e-01, -2.654693e-03,
+    +1.364803e-01, +3.808017e-01, -1.088953e+00, +2.302797e-01, +1.433699e-01, +2.401611e-01, -4.131457e-01, -8.701750e-02, -1.293915e-01,
+    -1.503643e-02, +1.395286e-01, +2.668375e-01, -2.315613e-01, -9.069320e-02, -2.861354e-01, +2.733279e-01, +2.763898e-01, +1.300352e-01,
+    -1.768178e-01, +2.204661e-02, +5.078262e-02, +9.115309e-02, +2.489440e-01, -3.796825e-01, +6.614136e-02, -5.251468e-02, +1.028627e-02,
+    //05
+    -1.014003e-01, +9.800691e-02, +1.319783e-02, -2.243182e-01, -1.987834e-02, -1.273520e-01, -3.982985e-02, -6.537633e-02, -7.958962e-02,
+    -4.416655e-02, -5.924679e-02, -2.512539e-02, -6.603635e-02, -5.891014e-02, +1.056223e-02, -1.642922e-01, -1.566382e-02, -7.448467e-02,
+    -1.935682e-01, +2.966532e-02, +3.470376e-02, -4.187170e-02, +3.621804e-02, -1.889880e-01, -8.553657e-04, +1.075287e-02, -6.872695e-02,
+    +1.757719e-02, -1.531750e-01, +5.436688e-02, -8.238947e-02, +1.769885e-01, +1.142380e-01, -2.109836e-02, -1.127404e-02, -3.331225e-02,
+    -8.129197e-02, +9.885458e-02, -2.218713e-02, -7.118213e-02, -7.938500e-02, +1.441984e-01, -9.555737e-02, -1.171913e-01, -5.467982e-02,
+    +9.175878e-02, +1.664524e-01, +3.828856e-02, -4.104914e-02, -1.190639e-01, -7.615721e-02, +4.602485e-02, -1.506566e-04, +1.627569e-01,
+    -2.117962e-02, +9.383429e-02, +7.735851e-03, +8.868945e-02, -1.652312e-01, -2.050133e-02, +8.444778e-02, -2.914436e-02, -9.001282e-02,
+    +1.689019e-02, -1.627372e-01, -1.206885e-01, -1.692040e-01, -1.498693e-01, -2.760556e-02, +1.731073e-02, -2.745469e-02, +9.780281e-02,
+    -8.135884e-02, -6.096698e-02, -8.171577e-02, +1.296434e-01, -7.449558e-02, +1.161966e-01, +2.233385e-02, -5.720750e-02, +2.024121e-02,
+    -5.899072e-02, -4.079661e-02, -4.299764e-02, -1.733683e-02, -1.483397e-01, +8.815484e-02, +1.127844e-01, +7.303170e-02, +7.420699e-02,
+    +1.398512e-02, +6.450988e-02, +1.266159e-01, -1.610599e-02, +2.277618e-02, +1.015099e-01, -1.538657e-01, +7.049781e-03, +8.639389e-02,
+    -1.687656e-03, +6.091905e-02, -5.755039e-02, +6.916368e-02, -2.840908e-02, +8.383433e-04, +1.927326e-01, -1.761205e-02, -4.887768e-02,
+    -1.168366e-01, -9.116715e-02, -6.499008e-02, +9.823249e-02, -3.841884e-02, -3.967978e-02, -1.095910e-01, +1.701889e-02, +9.768085e-02,
+    -5.598259e-02, -4.514407e-02, -1.797991e-02, +2.900091e-02, +4.658901e-02, +7.729752e-02, -2.358480e-01, -8.463136e-02, -8.751918e-02,
+    -4.224776e-02, +9.060747e-02, +1.064676e-02, -6.388512e-02, -1.276034e-01, +4.857199e-04, -1.266082e-01, +6.440176e-02, -1.794227e-01,
+    -1.105649e-01, +9.532007e-02, -5.965497e-02, -1.137521e-01, -1.192601e-01, -1.587373e-01, +4.127237e-02, +6.875504e-03, -1.289616e-02,
+    -6.444667e-02, -2.063039e-02, -1.502738e-01, -6.920481e-02, -5.528345e-02, -8.607826e-02, +6.469365e-02, +1.065379e-01, +1.545802e-03,
+    -1.343290e-01, -7.701454e-02, -1.558225e-01, +1.439926e-01, -1.111185e-01, -1.952467e-02, -8.041462e-02, -6.904905e-02, -1.008664e-01,
+    +6.228039e-02, +5.870385e-02, -4.894768e-02, +4.574267e-02, -5.008136e-02, +9.196404e-03, -4.917037e-02, -7.380953e-02, +4.566531e-02,
+    -5.437290e-02, +1.466933e-01, -4.986015e-02, -1.259737e-01, -1.451957e-01, +3.050264e-02, -2.048237e-01, -1.024865e-01, -1.643725e-01,
+    +4.671805e-02, -1.527317e-02, -5.026344e-02, -1.661158e-01, -4.075573e-02, -1.278020e-01, -1.285103e-01, +1.342685e-01, -3.539963e-02,
+    -1.721308e-01, -1.612458e-02, -6.755656e-02, -5.594172e-03, +4.463315e-02, -1.028882e-01, -2.393584e-02, +1.921567e-02, +2.134106e-02,
+    -9.754513e-03, -5.490613e-02, -2.206569e-02, -1.419432e-01, -8.775932e-02, -4.543915e-02, -1.867353e-01, -5.658337e-02, +1.289546e-02,
+    -1.388044e-01, -2.730165e-01, -1.302403e-01, -1.624846e-01, +5.084841e-02, -3.292501e-02, -1.522008e-01, +3.844934e-02, -3.331693e-02,
+    -4.555687e-02, -5.214496e-02, -1.248361e-01, -5.125772e-02, -2.958566e-01, -1.031193e-01, +8.526549e-02, -2.842045e-02, +1.056308e-02,
+    -2.193308e-01, -1.645964e-01, -2.188411e-01, -7.123097e-02, +6.039155e-02, +6.584583e-02, -1.468034e-02, +4.586714e-02, -1.494242e-01,
+    +4.528943e-02, -3.319988e-01, +7.867147e-02, -1.743717e-01, -1.212816e-01, +8.694665e-02, -1.151401e-01, -1.061505e-01, +6.877229e-02,
+    -1.298645e-01, -2.043504e-02, +6.219367e-02, -3.133790e-02, +2.910519e-02, -1.193802e-01, -8.965238e-02, -1.829249e-01, -3.761097e-02,
+    -5.208772e-02, +1.810421e-02, -6.228567e-02, -3.799547e-02, -7.196652e-02, -5.260558e-02, +4.872563e-02, +3.564569e-02, -8.244728e-02,
+    -1.659981e-01, -1.709373e-02, -9.337243e-02, -4.715980e-02, -1.078672e-01, +1.379707e-01, +5.317524e-02, +7.178348e-03, -5.391920e-02,
+    -4.157482e-03, -1.206439e-01, -1.189979e-01, +9.140451e-04, -5.223911e-02, +8.445589e-02, -6.855338e-02, +8.401500e-02, -5.630025e-02,
+    -5.867693e-02, -3.699701e-02, -1.904354e-02, +2.687056e-02, +6.890246e-02, +1.662530e-02, +1.223974e-01, +7.933829e-02, -7.563656e-02,
+    //06
+    -2.395780e-02, +1.601234e-01, -3.741223e-02, +1.955952e-01, +1.713620e-02, +3.026143e-02, -4.270199e-02, +4.167025e-02, -3.314959e-01,
+    +1.519137e-01, -2.107193e-01, -7.870728e-02, +1.086728e-02, +8.799130e-02, +2.548346e-01, -5.977919e-02, -1.447951e-01, +3.070128e-01,
+    +2.296061e-02, +2.667673e-01, +1.271085e-01, -2.093377e-02, +1.040469e-01, +1.722695e-02, -5.216298e-02, -6.523009e-02, -4.767849e-02,
+    +2.259659e-02, -9.188394e-02, -4.241298e-02, +8.681766e-03, -7.980558e-02, -7.011960e-02, +2.239086e-02, +3.513780e-02, +1.909605e-03,
+    -9.880929e-02, -2.028507e-01, +5.956600e-03, +7.063746e-02, +2.577747e-01, -1.099855e-01, +9.307992e-02, -1.119720e-01, +8.742869e-02,
+    +3.130158e-02, -6.333762e-02, +3.743399e-02, +2.311136e-01, +1.950485e-01, +2.773537e-01, +2.261395e-01, +9.071613e-02, -1.083257e-01,
+    +3.530410e-02, +4.965897e-02, -7.171267e-02, -3.996956e-02, -4.537163e-02, -2.290755e-01, -2.059786e-01, +3.173963e-02, -3.538918e-03,
+    +1.721691e-01, +1.554855e-02, +3.843350e-02, -1.490124e-01, -1.123392e-02, -1.047137e-02, +1.476335e-01, +2.500453e-02, -1.193335e-01,
+    +1.391054e-01, +1.348230e-01, +2.551921e-02, -2.197790e-01, -1.289404e-01, -2.319338e-01, -4.100713e-02, -1.687858e-01, -7.470730e-02,
+    -9.087525e-02, +2.181066e-01, +9.804120e-03, +7.375374e-02, -1.141381e-01, +3.134963e-01, -3.177258e-01, +4.982232e-01, -1.247425e-01,
+    +1.145265e-01, -1.575302e-01, +3.252469e-04, +4.439679e-02, +1.146498e-01, +6.934132e-02, -9.419973e-02, -4.138960e-02, -5.024882e-02,
+    -1.191994e-01, +5.782406e-03, +1.384016e-02, +1.330430e-01, +5.336079e-02, -1.056822e-01, -5.989537e-02, -7.553015e-02, +4.340593e-02,
+    -9.569799e-03, -3.322255e-02, +2.315744e-01, -9.466148e-03, +3.743210e-02, -7.904181e-02, -1.149835e-01, +2.095707e-01, -1.689785e-01,
+    +1.102617e-02, -3.216196e-02, -9.825028e-02, -8.331581e-02, -8.406887e-02, -3.563805e-01, -1.209053e-01, -1.012651e-01, -8.957943e-02,
+    -1.978191e-01, +1.333680e-01, +7.923323e-02, -8.129668e-03, +8.315545e-02, -3.621785e-03, +1.360524e-01, -2.530141e-01, +1.197522e-01,
+    -2.439991e-02, +1.711803e-02, +3.631121e-02, -6.674952e-02, +1.886399e-02, +3.602049e-02, +3.337454e-02, -1.250347e-01, +5.001891e-02,
+    -9.424762e-02, -5.666344e-02, -2.096120e-02, -1.561929e-02, +1.255986e-02, +2.056119e-03, +3.896095e-02, +7.191791e-02, +1.324922e-01,
+    +1.392961e-01, +8.907702e-02, -9.304198e-02, +1.173568e-01, -2.763264e-01, +1.264548e-02, -1.254639e-01, +1.138786e-01, -8.771339e-02,
+    +8.625775e-02, +3.455920e-02, +2.607760e-02, +6.821486e-02, -4.935136e-02, +1.770341e-01, -6.070049e-02, +5.322802e-02, -2.356898e-02,
+    -6.175875e-02, -8.233220e-02, -2.791511e-02, -4.440675e-02, -6.801078e-02, +1.905763e-01, +4.981584e-03, +1.191336e-01, +9.982451e-02,
+    +7.999658e-02, +6.021211e-02, +8.389770e-02, +1.537659e-02, -4.526220e-02, +2.594062e-02, +1.077184e-01, +1.824035e-02, +1.315265e-01,
+    +2.072842e-02, -1.594546e-01, -1.234588e-02, +2.476930e-01, -6.321952e-02, +6.359276e-02, -9.532721e-02, -1.104299e-01, -4.823263e-01,
+    +7.457525e-02, +1.215663e-02, +1.753679e-01, -4.371377e-02, +1.105778e-01, +9.609941e-02, -2.120758e-02, -9.102417e-03, +4.326145e-02,
+    +6.684443e-02, -8.033052e-02, -5.486345e-02, +1.944014e-01, +8.897042e-02, +1.467063e-01, -5.196487e-02, -5.308289e-02, -7.043456e-03,
+    +1.181230e-01, -6.584563e-02, -8.567121e-02, +1.112020e-01, -1.332207e-01, -9.872116e-02, +8.660563e-02, -3.620072e-02, +4.574662e-02,
+    -1.885453e-02, +8.202037e-02, +2.614737e-02, -1.736670e-01, +2.036829e-01, -3.114278e-01, -6.099327e-02, +8.181946e-02, -1.746207e-01,
+    +7.768075e-02, -8.072080e-03, -4.666141e-02, +2.937539e-02, +4.946782e-02, -3.192716e-02, +9.643885e-02, -4.998958e-02, +1.313857e-01,
+    +1.160372e-02, +8.091037e-03, -1.853265e-02, -2.491235e-02, -1.305847e-01, -2.832590e-01, +1.206034e-01, +2.017052e-01, -6.410266e-02,
+    +1.777815e-03, +5.147439e-02, -4.304389e-02, +4.138114e-03, -3.955710e-01, +9.499791e-02, -9.960010e-02, +6.445114e-02, -4.971126e-02,
+    +2.692636e-02, +6.839290e-02, +2.830607e-01, +1.798502e-02, +5.955809e-02, -1.261353e-02, +2.076040e-02, -1.100082e-02, +1.976200e-01,
+    -4.826564e-02, +6.627763e-02, -1.406772e-01, +1.834868e-01, +1.728098e-03, +4.678435e-02, +4.313910e-02, -3.423625e-01, +1.623762e-01,
+    +4.269519e-02, -2.782779e-02, -7.614638e-02, -1.984067e-01, +1.563309e-01, -3.085251e-02, +4.254966e-02, -7.652088e-02, -3.719002e-03,
+    //07
+    +7.079930e-02, +1.027634e-01, +2.795481e-02, -3.758689e-02, -9.518693e-02, -1.381354e-01, -1.337708e-01, -1.431336e-02, +1.541740e-01,
+    +9.691965e-02, -1.311899e-01, -7.392118e-02, -1.026334e-01, +5.128314e-02, -1.749270e-02, +5.354598e-02, -7.025078e-02, +1.168566e-01,
+    +1.800899e-01, +1.849543e-01, -4.234714e-01, -4.706909e-02, +6.670259e-02, +1.056961e-01, -8.676214e-02, +1.231066e-04, +2.206083e-02,
+    +2.937628e-02, +1.474433e-01, -1.065908e-02, -2.381016e-01, +1.604600e-02, +3.160571e-02, +3.832592e-02, +5.324964e-02, -1.838083e-01,
+    +9.094536e-02, -2.054826e-01, +1.004675e-01, +5.107401e-03, +5.272781e-02, -1.304716e-02, -1.894264e-02, -1.150411e-01, +5.594440e-02,
+    +1.008553e-01, -3.423496e-02, +3.168608e-03, -2.166737e-01, -8.154360e-02, +3.812140e-01, +3.913479e-02, -2.478363e-01, +2.519206e-01,
+    -8.437228e-02, -8.771741e-02, +4.093562e-01, +1.309295e-01, -1.410914e-01, +9.952870e-02, +1.003282e-01, +2.523744e-02, +4.072267e-01,
+    -5.357939e-02, +5.981278e-02, -6.042171e-02, +4.191123e-02, -1.879581e-01, -9.121685e-02, +1.925689e-01, +1.049838e-01, -2.683346e-01,
+    -4.059036e-01, +1.456951e-01, +8.424490e-02, +1.067346e-01, +1.332215e-01, -2.423684e-01, +1.597240e-02, +9.148705e-02, -6.394613e-02,
+    -1.882908e-01, +2.852939e-01, +1.711079e-01, -7.588889e-02, -6.808262e-01, +8.251723e-02, -9.252258e-02, -5.656168e-01, +1.677230e-02,
+    +2.267981e-01, -4.289341e-01, +2.484587e-01, +7.011769e-02, +4.679164e-02, -4.501380e-01, +2.145795e-01, -2.389220e-01, -5.642357e-02,
+    +1.273172e-01, -1.188214e-01, +1.207093e-01, +1.708806e-02, +8.824298e-03, +3.400351e-02, -9.280556e-02, +1.712950e-03, -9.477925e-02,
+    -1.440982e-02, -6.379452e-02, +1.058531e-02, -2.355690e-01, +3.503723e-02, +1.197598e-01, -5.661027e-02, +1.705483e-01, -1.757523e-02,
+    +2.124912e-02, -1.370779e-01, -1.662783e-01, -1.083172e-01, +4.672069e-02, +1.256347e-01, -7.119341e-02, +3.463238e-01, -7.339790e-02,
+    -7.164002e-02, +6.740285e-02, +8.287885e-02, -2.819843e-03, +2.977642e-03, -1.248076e-01, +1.488072e-01, -1.102228e-01, -1.980230e-01,
+    +1.862770e-01, -1.017787e-01, -9.030829e-02, -8.226546e-02, -2.710947e-01, -1.394899e-01, +7.309899e-02, -3.088294e-01, +2.737968e-02,
+    -1.668350e-01, +4.676530e-02, -4.477311e-02, -8.602819e-02, -6.035837e-02, +1.165221e-01, -4.621303e-02, +1.607229e-01, +1.885214e-02,
+    -1.837242e-01, -8.570387e-02, -5.430195e-02, +1.587175e-01, -4.691432e-02, +5.039189e-02, -4.481398e-02, -5.887265e-03, -6.491490e-02,
+    +8.683954e-02, +1.252803e-01, +1.275595e-01, -4.243322e-01, +1.671205e-01, -5.059290e-02, +1.281484e-01, -3.660608e-02, -4.919308e-02,
+    -1.636664e-01, +2.729590e-01, +5.721935e-02, +3.134625e-01, -3.079836e-01, +1.409744e-01, +3.055310e-02, -1.050520e-01, +6.499816e-02,
+    -6.226082e-01, +5.626889e-02, -2.020042e-01, -2.572002e-01, +2.606709e-01, -3.407799e-01, +1.292041e-01, +1.452683e-01, -1.042303e-01,
+    -5.056017e-02, +9.299753e-02, +2.564196e-01, +3.413684e-02, -3.181615e-02, -1.682235e-01, -3.013526e-01, +2.254377e-01, -4.524405e-02,
+    +8.202415e-02, +7.872722e-02, -8.094346e-02, +1.029904e-01, +1.612576e-01, -4.183584e-01, -7.993797e-02, +1.662701e-01, -2.924565e-01,
+    +1.255201e-01, +7.855420e-02, -1.475970e-01, +3.600308e-02, +1.327775e-01, -8.131155e-02, -6.133853e-02, +9.460184e-03, -1.412168e-01,
+    -1.855199e-01, +2.769624e-01, -3.500698e-02, -2.740245e-02, -2.492377e-02, +4.728954e-02, -1.766301e-01, +3.749995e-02, +2.487006e-01,
+    -1.742636e-01, +2.174321e-01, +1.277610e-01, -2.709764e-01, +2.128617e-01, -2.566878e-01, -2.589518e-01, +7.457328e-02, +2.805910e-01,
+    +9.689442e-02, +8.820507e-02, -8.806159e-02, -5.484597e-01, +2.227042e-01, +1.667482e-01, -2.925026e-01, +2.005186e-01, -2.140032e-02,
+    -3.518104e-01, -5.094700e-03, -6.019271e-02, -3.803641e-02, +4.143558e-01, -1.710232e-01, -1.474046e-01, +1.357656e-03, +1.287902e-01,
+    -6.423953e-03, +3.465200e-01, -1.810864e-01, +2.296133e-01, -8.309159e-01, +5.960545e-01, +2.301903e-02, -3.111773e-01, +1.699569e-01,
+    -1.166288e-01, -9.602536e-02, +1.114725e-01, -9.698647e-02, +3.737433e-01, -8.008116e-02, -5.825809e-02, +2.905172e-01, +1.264305e-01,
+    +6.563532e-02, +1.481675e-01, -1.170213e-01, -6.315522e-03, +1.743797e-01, -8.313669e-02, -1.155163e-01, +2.014496e-01, -1.257296e-01,
+    +1.196022e-01, -1.025310e-01, -1.692753e-01, +1.306741e-02, +1.644477e-02, +2.272370e-02, +3.729302e-02, +1.791769e-02, -3.621892e-02,
+    //08
+    -1.874628e-01, -5.756015e-02, +1.194687e-01, +2.159416e-02, -2.049952e-02, -1.411193e-01, +3.347143e-01, -2.680674e-01, +1.679155e-01,
+    +1.966302e-01, +9.475668e-02, +4.596375e-02, -2.997577e-02, -2.065177e-01, -1.338747e-01, -8.960530e-02, +7.051700e-02, -2.317994e-02,
+    +8.623111e-03, -2.146206e-01, +6.296104e-02, +3.024187e-02, -2.308507e-01, +4.539507e-02, +9.678531e-02, -3.900124e-01, +4.936752e-02,
+    -4.900321e-02, +2.016134e-02, -3.701735e-02, -2.171886e-01, -4.031598e-02, +5.140638e-02, -1.057046e-01, -2.792565e-01, +9.392316e-03,
+    +2.602044e-01, +6.987920e-02, +3.922011e-02, -1.500655e-01, -2.062199e-01, +1.383289e-01, -7.695240e-02, +1.056802e-01, -1.847893e-01,
+    -2.183278e-01, -1.130623e-01, +8.125490e-02, -1.046378e-01, -2.276720e-01, +4.937506e-02, -3.481337e-02, -4.445948e-01, +2.858966e-01,
+    +1.104875e-01, +5.591607e-02, -2.100055e-01, -1.699494e-01, -2.239002e-02, +7.756295e-03, +7.993730e-02, -7.783823e-02, +2.268415e-01,
+    +4.501823e-02, -3.045768e-02, -1.412875e-01, -1.461741e-01, +6.577427e-02, -1.526955e-01, -4.204379e-02, +5.960129e-02, -2.562562e-02,
+    +2.070937e-01, +2.368353e-01, -9.798188e-02, +2.297805e-01, -4.710370e-01, -1.627547e-01, -7.607367e-02, +1.686367e-01, +5.106217e-02,
+    +5.850520e-02, -1.636070e-01, +1.143716e-01, +2.491936e-01, -3.031969e-01, -2.320589e-01, -1.869648e-01, +1.761457e-01, +8.283941e-02,
+    +2.011858e-01, -1.869146e-01, +1.862711e-01, -4.762843e-02, -1.848725e-01, +2.331690e-01, -6.282640e-02, -1.306409e-01, +1.463287e-01,
+    -8.957066e-02, -2.116429e-01, -1.678177e-01, +1.378385e-01, +7.607750e-03, -1.701077e-02, +8.353005e-02, -4.757319e-03, +1.578305e-01,
+    +1.678468e-01, -2.066234e-01, +1.134484e-01, +1.537257e-01, -2.005222e-01, +1.083107e-02, -1.478818e-02, +8.440060e-03, -1.937660e-01,
+    +7.297979e-02, +4.564129e-01, +5.911804e-02, -2.687682e-01, +2.039463e-01, +2.977751e-01, -5.253155e-01, +4.851036e-01, +9.738719e-03,
+    +1.128104e-01, -8.737575e-02, +1.957142e-02, -1.380830e-01, -3.910251e-03, +4.894790e-02, -2.606569e-02, +1.391555e-01, -5.196131e-02,
+    +1.008998e-01, +1.106551e-01, +1.372750e-01, +4.104604e-03, +7.679592e-02, -2.619351e-02, -3.000439e-03, -1.605939e-01, -8.145177e-02,
+    +1.088255e-02, -1.959303e-01, +1.339666e-02, +1.470849e-01, -1.095287e-01, -4.219608e-02, -1.412383e-02, +1.019147e-01, +1.531286e-01,
+    -4.087929e-02, -1.184287e-01, +1.975025e-01, -1.543791e-01, +2.305573e-02, -1.203574e-02, +2.183629e-01, +7.323201e-02, +4.507587e-02,
+    -3.192719e-01, -5.068900e-02, +4.715351e-02, -8.003411e-02, -4.857169e-03, -1.476778e-01, -1.459577e-01, +2.799791e-01, +7.241929e-02,
+    +3.412874e-01, +1.129377e-02, -1.500815e-01, +1.484804e-01, -2.604054e-01, -8.757170e-02, +7.925536e-02, +3.378621e-01, -4.043667e-01,
+    +2.961914e-02, +1.096495e-01, +7.800837e-02, +1.872049e-01, +3.678890e-02, -3.004965e-02, +1.153700e-01, -1.380412e-01, -2.203423e-01,
+    +1.666099e-01, -5.182521e-02, -1.125578e-01, +4.290699e-03, +6.235822e-01, -1.279545e-01, -2.378078e-01, +1.616818e-01, -2.174631e-02,
+    -2.009212e-01, +1.165959e-01, -1.455919e-01, -1.652981e-01, +2.857653e-01, -1.325048e-01, +5.748768e-02, +5.435777e-02, +3.638997e-02,
+    -2.047983e-01, -1.715247e-01, +4.547491e-02, -1.463899e-01, +2.929105e-01, +5.015650e-03, -1.411264e-01, +5.785640e-02, -2.574695e-02,
+    +2.720797e-02, -2.800301e-02, -1.983063e-01, -1.723782e-01, +1.531736e-01, -4.777606e-02, -1.296004e-01, +1.512248e-01, +5.475479e-03,
+    +9.547035e-02, -1.982475e-01, +1.286121e-01, +1.989002e-01, +9.145846e-03, +8.002463e-02, +1.107530e-01, -1.283639e-01, +7.634991e-02,
+    -1.794775e-01, +1.296774e-01, +3.707926e-01, +3.841653e-02, -2.842469e-01, -9.542625e-02, -4.947452e-02, +1.386067e-01, +5.012727e-01,
+    -6.713741e-02, -6.025746e-02, +9.109310e-02, -1.325693e-01, +1.785100e-01, +9.738254e-02, -1.334663e-01, +4.834898e-03, +2.013497e-01,
+    -2.380080e-01, -1.497809e-01, +5.654863e-02, +6.958297e-03, -4.508225e-01, +2.231937e-01, -2.845199e-02, +3.478082e-01, +1.574885e-01,
+    -3.221068e-01, +1.143579e-01, +1.928760e-01, -2.499576e-01, +6.587054e-03, -1.659576e-01, -4.001518e-01, +5.744422e-01, +2.119958e-02,
+    -3.040648e-01, +3.502398e-01, -3.791093e-01, +6.885488e-02, +2.552396e-02, -2.638129e-01, +1.936793e-01, +6.494987e-02, -5.015026e-01,
+    -1.142304e-01, +1.011872e-01, -4.154898e-02, +1.219245e-01, -2.758677e-01, -1.870191e-02, -2.571056e-02, +3.591402e-01, -2.118419e-02,
+    //09
+    -1.436269e-02, +1.601473e-01, -2.604147e-01, -1.408626e-01, +6.484827e-02, +1.793330e-01, -2.412293e-01, +1.645453e-01, +3.246368e-02,
+    -1.228590e-01, +9.757029e-02, -2.018450e-01, -2.926437e-01, +1.856652e-01, -7.666075e-02, -1.185809e-01, +5.828642e-02, -7.598001e-04,
+    -1.603417e-01, +8.556258e-02, +2.478447e-02, -1.418592e-01, +1.797751e-01, +5.839493e-02, -1.301944e-01, -6.829252e-03, +1.335525e-01,
+    +1.937102e-02, -2.134023e-01, +7.168013e-02, +1.189581e-02, -8.764502e-02, +1.788023e-01, -5.737828e-02, -2.200810e-02, +3.314032e-02,
+    +1.441325e-01, -1.009284e-01, +3.481351e-03, -2.298325e-02, -1.103284e-01, +1.179191e-01, +1.186936e-01, -1.685487e-01, +5.278345e-02,
+    +4.281406e-02, +3.487400e-01, -3.209059e-01, -6.069835e-01, +7.378641e-01, -4.685311e-01, -3.885678e-01, -5.428103e-01, -6.158547e-02,
+    -2.572173e-01, -9.160111e-02, -1.235199e-01, +2.775233e-02, +1.555358e-01, -2.553715e-01, +1.492447e-01, +2.039781e-01, -3.984976e-01,
+    -5.461549e-03, -1.564788e-01, +2.969813e-01, -5.782471e-02, -1.257932e-01, +2.213137e-01, -1.732568e-02, -4.010481e-02, -5.321427e-02,
+    +3.926809e-02, +3.427146e-02, -8.907381e-02, -5.597979e-01, +2.458230e-01, -2.203560e-01, +9.363324e-02, +1.380075e-01, -3.131649e-02,
+    +1.210788e-01, +5.073817e-01, -5.308948e-02, +3.475612e-01, +1.341774e-01, +3.256143e-01, +4.223790e-01, +3.351153e-01, -4.597151e-02,
+    -1.093871e-01, +1.732767e-01, +1.493616e-02, -2.035934e-02, +1.346612e-01, +1.345179e-01, -1.546754e-02, -1.480512e-01, +1.734366e-02,
+    +1.075763e-01, +1.887025e-01, +4.709207e-02, -1.689859e-01, +1.877179e-01, -4.253649e-02, -3.505327e-02, +6.481374e-02, -1.818936e-01,
+    +6.379511e-02, -5.897415e-02, +2.023308e-01, -1.122962e-01, +7.545286e-02, +1.282472e-01, -1.476881e-01, -8.822586e-02, +6.392836e-02,
+    +9.575461e-02, -3.112015e-01, -1.104617e-01, +2.180878e-01, -2.679017e-01, -4.068447e-01, +1.232966e-01, -8.095590e-01, +5.141900e-01,
+    -2.839739e-01, +1.137324e-01, -3.667648e-02, +1.734414e-01, +6.714242e-02, -1.087352e-01, +5.511876e-02, +5.100774e-02, -1.445329e-01,
+    +1.766333e-01, -2.907963e-01, +7.878662e-02, -3.083758e-02, -2.085362e-01, -1.064030e-01, +3.559588e-02, -3.730898e-01, +2.286406e-01,
+    -1.389556e-01, +2.684364e-02, +4.668447e-02, +1.041191e-01, +6.994525e-02, -7.046343e-03, +9.714808e-02, +1.551988e-01, -3.818018e-01,
+    -2.878267e-01, +9.075064e-02, -6.440751e-02, -3.654246e-02, -9.822001e-02, -6.209360e-02, +8.123189e-02, +3.825258e-02, +1.161373e-01,
+    -7.252310e-02, -7.084877e-02, -1.875507e-01, +3.171791e-01, -5.013805e-02, +3.210082e-02, -2.316034e-01, +5.835403e-02, +1.899790e-01,
+    +2.911094e-01, -2.696756e-01, -2.251190e-01, +1.960888e-01, -1.223803e-01, -1.325754e-01, +1.544411e-01, -3.365990e-01, -1.108231e-01,
+    +8.553731e-02, -2.426820e-01, -1.634201e-01, -3.148117e-03, +5.166860e-03, +6.878598e-02, +1.358349e-01, +3.262993e-01, -5.698935e-01,
+    +9.326147e-02, -6.094457e-02, -4.593905e-01, +3.719202e-01, +6.758853e-02, -1.002763e-01, +1.671298e-01, -8.525947e-02, -1.699950e-01,
+    -8.186060e-03, -1.255930e-01, -1.334306e-02, +1.239249e-01, -4.787937e-02, +7.425581e-02, -3.068615e-02, +2.610508e-02, -8.814465e-02,
+    +9.073625e-02, +2.704484e-01, +2.997141e-01, -3.331907e-01, +5.814199e-02, -2.037906e-01, -1.240018e-01, -2.688847e-01, +3.767518e-02,
+    +5.210410e-02, +6.277998e-04, -1.287185e-01, +4.574769e-02, +2.042628e-01, -1.203025e-01, +8.906016e-02, +1.851616e-01, -1.270406e-01,
+    +3.346192e-01, -2.264542e-01, -4.357915e-01, +4.389242e-01, -1.288558e-01, -4.461949e-01, +1.690465e-01, -2.574129e-02, -5.364062e-02,
+    -1.175103e-01, +3.088530e-01, -3.220427e-02, -2.747282e-01, +1.949124e-03, -4.650199e-02, -1.522699e-01, +7.836365e-02, +2.146405e-01,
+    +4.339309e-02, +2.167507e-02, +1.022399e-01, -1.618348e-02, -1.773044e-01, -7.725564e-02, -1.676816e-01, +7.998022e-02, -1.652003e-02,
+    +5.364210e-02, -3.265218e-01, +4.619611e-01, -1.842854e-01, -2.004196e-01, +1.676556e-01, -5.908580e-02, -5.662578e-02, +1.127539e-01,
+    -4.805613e-01, +1.766176e-01, +3.542869e-01, -3.262831e-01, -6.417079e-02, -1.290426e+00, -1.047246e+00, +2.341637e-01, -1.494071e+00,
+    +1.230963e-01, -1.601784e-01, +1.109159e-01, -1.185534e-02, +1.602713e-01, -1.438060e-01, +9.058713e-02, -1.014701e-01, -9.152514e-02,
+    +9.019073e-02, -3.620352e-01, +6.626940e-02, -5.710957e-02, +1.011779e-01, +9.153372e-02, +2.084417e-01, -1.599821e-01, -3.725044e-02,
+    //10
+    -6.647577e-02, -3.811469e-02, -1.204946e-01, -7.556069e-02, -2.692003e-02, -6.558047e-02, -7.648827e-02, -6.454656e-02, -6.617916e-02,
+    +9.865334e-02, +3.521141e-02, +4.722034e-02, -1.002152e-01, +1.221039e-02, -1.499851e-02, +9.618314e-02, -1.043186e-01, -3.508033e-02,
+    -1.367476e-01, -3.088196e-02, +3.636231e-02, -7.772128e-02, +6.011004e-02, -7.337835e-02, -8.397762e-02, -7.298873e-02, +2.611107e-01,
+    +1.900503e-02, +4.947705e-02, +4.256601e-02, -1.396148e-01, -6.065664e-02, +1.142044e-01, +6.248378e-03, -5.078609e-02, +6.157182e-02,
+    -1.527721e-01, -2.061857e-01, +4.646492e-02, -1.338508e-01, -3.191042e-02, +2.349218e-02, -8.147322e-02, +1.962636e-02, -3.616931e-02,
+    -9.897292e-02, -6.947850e-02, -1.038702e-01, -3.619939e-02, +5.373192e-02, -7.314669e-02, +1.582693e-02, -3.242343e-02, -2.210724e-02,
+    -5.218533e-02, -3.616938e-02, +7.570596e-02, -4.681439e-02, -2.526254e-02, -8.877386e-02, +6.285580e-02, -9.981601e-02, -1.628477e-02,
+    +7.016954e-02, -1.007123e-01, +1.702089e-01, -5.170978e-02, -1.120251e-01, -7.627032e-03, -5.106262e-02, -7.131727e-02, -9.685540e-03,
+    -5.678973e-02, +6.234045e-02, +3.366230e-02, +3.774744e-02, +1.798189e-02, -7.944465e-03, -1.828142e-02, +2.760098e-02, +9.055477e-03,
+    -4.715868e-02, -3.963016e-02, -4.527104e-02, +6.333900e-02, +6.838972e-03, +3.956729e-02, -2.116400e-01, -5.803679e-03, -3.974559e-02,
+    -6.426048e-02, +4.932252e-02, -1.924623e-02, -5.184428e-02, -2.124013e-01, +2.060912e-02, +8.735538e-02, -3.219882e-02, -7.559747e-02,
+    +1.137038e-02, +1.182364e-01, -1.012964e-01, +1.051776e-01, +1.253379e-01, -5.284690e-02, -1.389643e-01, +1.908769e-03, -4.407305e-03,
+    +1.102952e-01, +2.029996e-02, +1.704056e-02, -1.066505e-01, -1.068070e-01, -1.071835e-01, -6.631158e-04, +7.305236e-03, -2.538572e-02,
+    +1.313629e-02, +8.326656e-02, -4.423786e-02, -4.702486e-02, +1.213516e-02, -7.930814e-02, -2.499086e-02, -1.585342e-01, +1.266558e-02,
+    -2.203690e-02, -1.578073e-01, -4.202431e-02, -1.148654e-01, +4.664993e-02, +4.153623e-02, +9.843697e-02, +7.414825e-02, -6.069876e-02,
+    -4.360259e-02, +1.789442e-01, -1.331110e-01, +3.870429e-02, -1.092856e-01, -3.932355e-02, -2.980920e-02, -6.826109e-02, -8.712098e-02,
+    -9.879458e-02, +4.337819e-02, -9.675714e-02, -1.088246e-01, -1.228502e-01, -3.825943e-02, +8.557632e-02, +1.034575e-01, -6.179344e-02,
+    -1.786785e-01, +4.558731e-03, +1.347576e-02, -6.812049e-02, +5.729976e-02, -3.581548e-02, +5.597137e-02, +1.050288e-02, -1.906873e-01,
+    -1.075201e-01, +3.783890e-02, -4.968962e-02, -2.189568e-02, -1.651196e-01, +9.736140e-02, -9.313757e-03, -1.812658e-01, -7.747231e-02,
+    +2.009698e-02, +6.826365e-04, -8.598948e-02, -4.282294e-02, -2.569615e-02, +9.648734e-02, -1.218314e-02, +9.308680e-03, -2.697594e-02,
+    +5.880722e-02, -3.522072e-02, -6.677026e-02, +1.741957e-02, +9.638091e-03, +4.987665e-02, +4.483612e-02, +6.383677e-02, +4.432541e-02,
+    -8.656690e-02, +1.790074e-01, +1.159959e-01, -6.125317e-02, -8.659504e-02, -8.686201e-02, +9.262293e-02, +2.396315e-02, -2.493626e-02,
+    -5.734753e-02, +1.203964e-01, -6.642107e-02, -4.848009e-02, +4.220864e-03, +1.140882e-01, -9.197074e-02, -7.203276e-02, -1.166817e-01,
+    -1.102814e-01, +1.330973e-01, +1.328700e-01, -4.877423e-02, +8.878049e-02, -7.820515e-02, -9.014253e-02, -4.320454e-02, +6.058957e-02,
+    -4.672386e-02, -1.212789e-01, +5.095037e-02, -2.276956e-01, +1.466253e-01, +7.363061e-02, +5.584706e-02, +1.463241e-01, +1.156587e-02,
+    +2.647149e-02, -9.964286e-02, +9.723649e-04, +4.550164e-02, -4.826601e-02, +1.715785e-02, -1.192593e-01, -7.487131e-03, -6.462325e-02,
+    +1.769727e-02, +6.870941e-02, +1.132856e-01, +5.148726e-02, +3.880022e-02, -2.208786e-02, +1.371050e-03, +2.246046e-02, +4.638577e-02,
+    +3.968047e-02, -5.408825e-02, +2.282007e-01, +1.155441e-01, -7.075064e-02, +1.568769e-02, -1.396747e-01, +3.001923e-02, -9.905712e-02,
+    +1.462572e-02, +9.296168e-02, -1.390038e-01, -8.348887e-02, -2.777279e-03, -9.881637e-02, +2.362380e-02, +7.241183e-02, +6.252906e-02,
+    -1.828137e-02, -1.799494e-01, -2.362198e-02, +1.791687e-01, +8.163185e-02, +7.763299e-02, -4.408947e-02, -4.628823e-02, -5.627988e-02,
+    -1.469724e-01, +8.590408e-04, -1.893061e-01, +8.988333e-02, -4.482681e-02, -7.280511e-02, +9.482172e-03, +4.331608e-02, +2.082565e-02,
+    -1.433271e-02, +7.514501e-02, +3.892035e-02, -1.940361e-02, +6.729928e-02, +1.304085e-01, +3.573050e-02, +2.029051e-02, -1.701918e-02,
+    //11
+    -1.941708e-01, -8.679936e-02, +4.379503e-03, +3.812341e-02, -7.448517e-02, +1.539547e-02, -1.761277e-02, +8.550096e-03, +1.970661e-01,
+    +2.913127e-02, -3.724182e-02, -9.955813e-02, +7.694312e-03, +1.969347e-01, -5.953030e-02, +7.029434e-02, -6.921075e-02, -3.311438e-02,
+    -8.773412e-02, +2.084512e-01, +5.258388e-02, -2.492035e-02, -1.957919e-01, +2.823105e-01, -1.370084e-01, -4.662355e-02, -2.589523e-03,
+    -3.716222e-03, +1.580685e-03, +1.174873e-01, -6.520603e-02, -5.908064e-02, -8.494287e-02, -8.339865e-03, -6.420032e-02, +5.260465e-02,
+    +6.930101e-02, +5.467106e-02, +5.114445e-02, -5.193612e-02, -1.373371e-01, -1.010383e-03, +6.876904e-02, -4.464075e-02, -3.553251e-02,
+    -1.226254e-01, +1.013941e-01, -2.001632e-01, -3.329348e-01, -6.926084e-01, +5.607994e-02, +3.760241e-01, +4.291418e-01, -4.865483e-01,
+    -1.635079e-01, +1.271830e-01, +1.265055e-02, +1.134131e-01, +5.177114e-01, +4.907396e-02, -4.363609e-01, +1.585850e-02, -7.199079e-01,
+    -1.090431e-01, -5.371027e-02, +6.661311e-02, +8.811040e-02, +4.236398e-02, +3.211871e-03, +2.249628e-01, -1.421066e-01, +6.416620e-02,
+    -1.336915e-01, +1.587567e-01, -2.071895e-01, -4.184882e-01, +4.053456e-01, +4.699129e-01, +9.859354e-02, -2.504922e-01, -1.269687e-01,
+    -3.110083e-01, -2.271884e-01, -8.177793e-01, +3.962426e-01, +1.899486e-01, -8.459445e-01, -4.269173e-01, -6.031566e-02, +9.621540e-02,
+    +1.357785e-01, +1.356067e-01, +8.421870e-02, -1.614445e-01, -3.769128e-01, +8.974851e-02, -6.438895e-02, +1.173695e-01, -8.652024e-02,
+    +9.285666e-03, +7.754109e-02, -7.610543e-02, -1.366302e-01, -8.467228e-02, -6.212137e-02, +1.233744e-01, -1.184361e-01, +2.458836e-03,
+    +3.020491e-03, +9.952940e-02, +6.773525e-02, -1.081168e-01, -9.177569e-02, -5.709454e-02, -3.737153e-03, +2.534987e-02, +1.469008e-01,
+    -4.673400e-02, +4.187419e-02, -7.013833e-02, +4.670544e-02, +3.014945e-01, +1.136440e-01, +8.072206e-02, -4.391387e-01, -3.044021e-01,
+    -2.903466e-03, +8.565282e-03, +7.408708e-02, -1.008712e-01, +6.138792e-02, +1.406770e-04, +1.272205e-01, +3.199661e-02, -2.165007e-01,
+    +4.809169e-02, -8.746558e-02, +5.908928e-02, +2.077390e-02, +6.188845e-02, -1.138453e-01, -1.198286e-01, +5.717160e-02, +1.899667e-02,
+    -1.317724e-01, -3.923782e-01, -3.825043e-01, +2.314149e-02, +3.419394e-01, +4.090744e-01, -1.940376e-01, -2.880607e-03, -3.708318e-01,
+    -2.531536e-01, -2.398939e-01, +1.039409e-01, -1.768989e-02, +2.611232e-01, +1.394861e-01, -3.796535e-02, -3.857743e-02, -6.603417e-02,
+    -1.215252e-01, +1.969353e-01, +8.580846e-02, +6.423598e-02, -1.169736e-02, +2.081183e-01, -3.645684e-01, -3.453726e-01, -3.028404e-01,
+    +9.652605e-02, -2.892489e-04, -3.735353e-01, +2.032689e-01, +1.726061e-01, +5.362314e-01, +2.166743e-01, +2.511019e-01, +1.148710e-01,
+    -6.510805e-02, +1.438038e-01, -3.660076e-01, -7.245222e-02, +1.492967e-01, +9.115485e-03, +1.690827e-01, +1.807518e-01, +2.606332e-01,
+    -6.651562e-02, +9.317613e-02, -2.255912e-01, -6.335998e-02, -1.915924e-01, -9.648465e-02, +2.136308e-01, +1.294911e-01, +5.727965e-02,
+    +9.549129e-02, +5.286345e-02, +1.307750e-03, -5.988777e-02, -2.456547e-01, +1.071675e-02, +3.668375e-02, +7.940489e-02, -3.242968e-01,
+    -2.391010e-01, -1.846534e-01, +1.745756e-01, -3.079600e-02, +1.108707e-01, -1.203118e-01, -4.775577e-02, +2.151875e-01, -2.860852e-02,
+    -9.568060e-02, +1.476214e-01, +1.721450e-01, -6.683031e-02, -6.948122e-02, -2.559883e-02, +7.781847e-02, +6.533607e-02, -6.348781e-02,
+    -3.801873e-02, +5.775880e-02, +5.915924e-02, +7.974917e-02, -4.254287e-02, -3.591405e-02, +7.758658e-02, +6.178224e-03, +2.043436e-01,
+    -1.832851e-01, -6.967237e-02, +3.848847e-02, -1.268817e-01, -5.875384e-02, +2.153053e-01, +3.862280e-01, +5.587563e-02, +3.275095e-02,
+    +7.821342e-02, +9.501673e-02, +1.119790e-01, -2.929553e-01, +2.279045e-01, +3.443780e-01, -1.511029e-01, -5.262848e-01, +7.243271e-02,
+    -1.387323e-01, +1.118584e-01, +2.589382e-01, -1.855166e-02, -2.349180e-01, +4.544751e-02, -3.802252e-01, -9.025406e-01, +7.122473e-02,
+    +2.589866e-01, +3.125983e-01, +8.678458e-03, -1.081012e-01, +2.345564e-01, -5.566560e-02, -3.000952e-01, -3.447502e-02, +3.010789e-01,
+    -2.482308e-01, -1.243819e-01, +6.544404e-02, -3.044601e-01, +1.074827e-01, +1.673205e-01, +3.142036e-01, -2.019190e-01, -1.114230e-01,
+    +6.727397e-02, -2.301946e-01, -1.275847e-01, +2.235331e-01, -2.283414e-01, -2.176197e-02, +1.062847e-02, +5.538679e-02, +1.236490e-01,
+    //12
+    +1.452316e-02, -1.458933e-01, +1.788964e-01, -3.438802e-01, +4.438871e-01, -1.690832e-02, -7.707703e-02, -1.921815e-01, +2.868842e-03,
+    -2.868102e-01, +2.726977e-01, -1.462422e-01, -6.814142e-02, +2.178365e-01, +4.706540e-02, +2.266266e-02, +1.459609e-01, +4.373610e-03,
+    -3.009144e-03, -4.441017e-03, +7.529813e-04, +7.727618e-03, +5.750506e-02, +7.683259e-03, -2.395833e-02, -2.916879e-02, -8.229977e-03,
+    -1.489458e-01, +4.765514e-02, -4.094057e-02, -5.690034e-02, +1.581106e-02, +2.069880e-01, +7.694376e-02, -6.368215e-02, -3.321169e-03,
+    +1.638744e-02, +1.931126e-01, +8.256462e-02, +6.317978e-02, -2.531695e-01, +1.150701e-01, -6.087256e-03, -6.932490e-02, +2.060010e-02,
+    +2.621373e-02, +6.935722e-02, +5.196569e-02, +2.745968e-02, +4.681731e-02, +1.009944e-01, +3.829155e-03, -9.596118e-03, +1.796293e-03,
+    +4.982094e-02, +2.953175e-02, +4.460327e-02, -1.946517e-02, -3.945649e-02, -9.295174e-03, +3.094777e-02, +6.587463e-03, +8.954541e-03,
+    -1.868668e-02, +4.970243e-02, -2.308642e-02, +2.917489e-02, +8.780173e-03, +1.493430e-01, +3.316709e-02, -1.245586e-02, -2.135447e-02,
+    +4.856507e-02, +9.107736e-02, -1.460432e-02, -2.906418e-02, +8.316939e-02, +6.280678e-04, -2.767396e-02, -1.095797e-02, +1.961960e-02,
+    -1.296608e-03, +2.340674e-02, +1.450267e-02, +1.049654e-02, -3.776037e-02, -3.034394e-02, -3.483320e-02, -7.353623e-03, -4.463476e-02,
+    -2.787488e-03, +2.759774e-02, +3.394536e-02, +2.428737e-02, -1.363375e-02, -1.787710e-02, -3.114931e-02, +2.395380e-02, -1.142822e-02,
+    -1.218439e-01, +2.346601e-02, +4.135077e-04, -1.942150e-02, -2.780488e-02, +2.299620e-02, +6.590754e-03, -4.275127e-03, +5.666593e-02,
+    -1.640426e-01, -5.390342e-02, +1.691267e-01, +8.711226e-02, +2.553820e-02, +1.005865e-01, +2.666809e-02, +6.924802e-02, -2.935687e-02,
+    +6.716046e-04, +8.762740e-03, -1.426509e-02, -1.816752e-02, -1.988519e-02, +4.314830e-02, -2.927915e-04, -9.960172e-03, -2.564101e-02,
+    -3.299881e-01, -9.947410e-02, -1.229418e-01, +6.778623e-01, -2.839442e-01, +2.211185e-01, -1.202397e-01, -1.520084e-01, +6.537050e-02,
+    +2.080490e-02, +1.911829e-02, +6.411123e-03, -2.103552e-03, -2.909003e-02, -3.992810e-02, +9.937347e-03, -3.802705e-04, -6.829811e-03,
+    +4.789331e-02, -5.288323e-02, -5.837515e-02, -8.008849e-02, -5.980144e-02, -2.832821e-02, +2.508081e-02, -2.986590e-02, -2.101326e-02,
+    +4.548042e-02, -6.617866e-02, +7.430972e-02, +3.206071e-01, -5.768338e-02, +1.840113e-01, +3.298511e-02, +1.100327e-01, -2.742375e-02,
+    +1.626158e-02, +4.548498e-02, +3.533216e-02, +1.810298e-02, +5.732505e-02, +5.962894e-02, -1.370244e-04, -3.855023e-02, +8.526747e-03,
+    +1.237410e-02, -5.602606e-02, -6.674039e-02, -1.423972e-02, -4.029569e-02, +2.855848e-02, +6.284636e-03, -1.376396e-02, -1.053228e-02,
+    +8.143595e-03, +9.521456e-03, +5.056357e-02, +1.917130e-02, +3.287883e-02, +1.179167e-02, -2.156053e-02, -2.831379e-02, -1.234279e-02,
+    -1.154156e-02, +3.142237e-02, -7.727391e-02, -1.848980e-03, +2.176387e-02, -4.335833e-02, -7.569735e-04, -2.933167e-02, -8.001870e-03,
+    +6.037944e-02, +3.692899e-02, +1.361401e-02, -5.743077e-03, -2.434971e-02, -3.557213e-02, +1.282311e-02, +1.389691e-02, +2.138786e-02,
+    +4.765817e-02, -8.789197e-02, -6.598938e-02, -1.750713e-02, -6.517396e-02, +4.664185e-02, +5.585063e-02, -2.393983e-02, +2.304415e-02,
+    +1.411158e-02, +1.405257e-02, -2.049869e-02, +2.618961e-02, +7.446325e-03, +7.254684e-02, -8.810470e-03, -1.042291e-04, -1.594357e-02,
+    -6.553756e-02, +4.865915e-02, +8.733572e-02, -8.370724e-03, -6.260069e-02, -1.007161e-01, -9.825773e-03, +1.685846e-02, +1.866686e-02,
+    +5.189653e-03, +7.817554e-02, +3.280084e-02, +8.760129e-03, +3.429006e-02, +1.524449e-02, -1.519856e-02, -3.639064e-03, -5.626392e-03,
+    -2.560224e-02, -1.841276e-02, -3.051952e-02, -1.415084e-02, +1.898947e-02, +7.069084e-03, -2.439904e-04, +1.946917e-02, +4.433532e-02,
+    -2.474991e-02, -7.228054e-02, -3.484237e-02, +2.288052e-02, +8.128285e-02, +3.081182e-02, +9.427275e-03, +2.333985e-03, -1.754274e-02,
+    -1.380169e-02, +8.820665e-02, +3.525245e-02, +4.666712e-02, +4.503798e-02, -6.422483e-04, -2.650144e-04, -4.423906e-03, -3.082495e-05,
+    +2.637269e-02, +5.374664e-02, +2.106621e-02, +3.881392e-02, +1.484300e-02, +2.861398e-02, -2.508380e-02, -3.320538e-02, -1.293740e-02,
+    +5.348519e-02, +8.761590e-02, +3.968943e-02, -1.526898e-02, +2.084404e-02, +1.543121e-02, +5.491825e-02, -1.746755e-02, +1.300201e-02,
+    //13
+    +7.821766e-03, +1.787574e-01, +1.558441e-01, -2.032703e-01, -3.072843e-01, +8.615576e-02, -2.128279e-01, +1.786050e-01, +2.327216e-02,
+    +1.386064e-02, -1.151717e-02, -3.723675e-02, +7.727454e-02, +4.669923e-02, -1.194015e-01, -5.287064e-02, -1.709285e-01, +6.123127e-04,
+    -1.472540e-01, +1.699339e-01, -9.581023e-03, -3.024440e-01, +1.632802e-01, +1.034498e-01, -7.601610e-02, -1.802568e-01, -1.019353e-01,
+    -3.260931e-02, +8.674783e-02, -2.005465e-03, +5.403895e-02, -1.422058e-03, -2.133649e-02, +1.718702e-01, +8.019153e-02, -5.377414e-02,
+    +1.834188e-01, -1.884667e-01, -1.603501e-02, +1.999697e-03, +3.498074e-02, -7.948236e-02, +1.431778e-01, -1.682534e-01, -1.089772e-02,
+    +3.622790e-01, +8.655295e-02, -3.408925e-01, +4.812042e-01, -3.657236e-01, +2.161679e-01, +3.944068e-01, +1.575776e-01, -3.573244e-01,
+    +1.073715e-01, +1.970998e-01, -3.500503e-01, +2.509698e-01, -6.653338e-02, -2.685723e-01, -9.656499e-02, -8.367351e-02, -2.217771e-01,
+    -2.657548e-01, +9.140326e-03, +1.447551e-01, +4.877814e-02, -1.538855e-01, -6.158964e-02, -2.865706e-03, +7.224502e-02, +2.476628e-02,
+    -2.488241e-01, +8.616163e-02, -3.720351e-01, +2.977941e-01, +1.976053e-01, -3.695446e-01, -5.874875e-01, +8.969983e-02, -9.939769e-02,
+    -1.089575e-01, +1.558233e-01, -1.778040e-01, -3.061608e-02, -9.204235e-01, -2.315289e-01, +2.995005e-01, -1.004998e+00, -5.396328e-01,
+    +1.205088e-01, -1.266863e-01, -1.530969e-01, -2.447430e-02, +3.463708e-01, -5.585001e-02, +2.080030e-01, -2.406808e-02, -4.914770e-02,
+    +5.091479e-03, -4.468411e-02, -1.163193e-01, -1.527940e-01, -1.650532e-02, -1.757473e-01, +9.231421e-02, +6.461716e-02, -1.494884e-01,
+    +4.837645e-03, -7.467543e-02, +1.057496e-01, +2.012002e-01, -1.106043e-01, -1.053193e-01, +1.299942e-01, +6.082459e-02, +1.987361e-02,
+    +2.244572e-01, +1.374835e-01, -3.045034e-01, -4.845333e-01, +5.280371e-01, +3.684822e-01, -5.092621e-02, +4.206246e-01, -3.432074e-01,
+    -1.236988e-01, -1.075941e-01, +9.242237e-02, -1.457475e-01, +7.284861e-02, -9.617928e-02, +2.553118e-01, -2.650307e-02, +1.930058e-03,
+    +1.078958e-01, -1.242493e-01, -4.209185e-02, +1.580064e-02, -3.453510e-02, +4.695811e-02, +8.970216e-02, -3.634921e-02, +6.265736e-02,
+    -1.433227e-01, +1.600721e-01, -1.162829e-01, -6.502478e-02, +9.872357e-02, -9.386279e-03, -3.554133e-01, +2.036255e-01, +1.302656e-01,
+    -2.110290e-01, +9.061854e-02, -1.987453e-01, -5.098176e-02, -7.947181e-02, -3.425310e-02, +1.936516e-01, -2.636607e-02, +1.613780e-01,
+    +1.477022e-01, -2.053318e-01, +2.783458e-02, +5.175428e-02, +1.438702e-01, +2.075541e-01, -2.130888e-01, +7.407582e-02, -1.496848e-01,
+    +8.738296e-03, +1.700016e-02, -7.656788e-02, +4.434428e-01, -2.047133e-01, +3.023031e-01, +2.305885e-02, -2.129609e-01, +1.463577e-02,
+    -1.131195e-01, -2.474396e-01, -1.422514e-01, -1.047545e-01, -4.680026e-02, +4.400321e-02, +1.967508e-01, +2.600914e-01, -2.057370e-01,
+    -7.893278e-02, +1.349250e-01, -1.237947e-01, -4.679703e-02, -2.419421e-03, -8.422510e-02, -1.033665e-01, +4.955329e-02, +2.419739e-01,
+    -6.606950e-03, +7.043412e-02, +1.584915e-01, -4.456640e-02, -6.575163e-02, +1.513570e-02, +1.536513e-02, -2.229327e-02, -6.797755e-04,
+    +1.312589e-02, +1.034473e-01, -7.114719e-02, +1.064492e-01, +2.940546e-04, +3.757968e-02, -2.622027e-01, +1.830925e-02, -1.219472e-01,
+    -2.469831e-01, +1.796119e-01, -3.840934e-01, -1.273123e-01, -1.128197e-02, +6.388701e-02, +3.819275e-01, -4.235819e-02, -1.162517e-01,
+    +1.494605e-01, +7.213715e-02, -1.177173e-01, -5.073926e-01, +3.369349e-01, -2.157785e-02, -9.489345e-02, +3.754431e-02, -6.056997e-02,
+    -2.674828e-02, -3.099205e-01, +1.064229e-01, -3.489503e-01, -8.480788e-03, +2.125337e-02, +5.277296e-03, +1.380871e-01, +2.374716e-01,
+    +1.230437e-01, +2.308190e-01, -3.450070e-02, -3.238337e-01, +1.277568e-01, -2.321537e-01, -2.117566e-01, +4.751908e-01, -7.685731e-02,
+    -2.251406e-01, +5.470396e-02, +8.612263e-02, -5.649316e-01, +3.699659e-01, +4.806983e-02, -2.178305e-01, -3.853370e-01, +3.553192e-01,
+    +1.841530e-01, +2.204554e-02, +2.097542e-01, -4.256116e-01, +3.823871e-01, +2.849234e-01, +1.193369e-01, +4.522987e-01, +1.820007e-01,
+    -2.280360e-01, -9.398910e-02, +1.193448e-01, -3.312157e-01, +4.460663e-01, -1.711180e-01, -4.559272e-02, -5.201415e-02, +4.273328e-01,
+    +7.770737e-02, -8.683461e-02, +1.165197e-01, +2.304738e-02, -1.475308e-01, +1.963535e-01, -1.356780e-01, +1.328010e-01, -1.594002e-01,
+    //14
+    -1.174435e-01, +1.601766e-01, -1.285215e-01, -1.481004e-01, +2.280836e-02, +9.413860e-03, -2.236756e-02, +2.749929e-01, -2.163670e-03,
+    +4.558364e-02, +3.751245e-02, +1.218025e-01, -1.656802e-01, +4.421424e-03, -1.917085e-01, -7.340235e-02, +6.421866e-03, +3.330147e-02,
+    +1.807561e-01, +7.279404e-03, -7.995296e-02, +8.986951e-02, +1.545739e-01, +3.780689e-03, -8.905397e-02, -1.232504e-01, -3.010709e-02,
+    +1.153452e-01, -1.654579e-02, -1.320958e-01, +1.883060e-02, +3.651496e-02, -9.995369e-03, -8.016835e-02, +5.658802e-02, +5.518095e-03,
+    +1.439050e-01, +1.597872e-01, -1.441356e-01, -4.502106e-02, -4.844616e-03, -1.207154e-01, -1.586073e-01, -3.235742e-02, +1.180161e-01,
+    -6.714367e-02, +5.075389e-03, +1.134253e-01, +2.165789e-01, -7.140804e-02, -2.157428e-01, -1.544564e-01, +3.322724e-01, +6.495894e-02,
+    +2.778090e-02, +1.485267e-01, +1.614301e-01, +6.859168e-03, +1.406343e-01, +2.447924e-01, +5.509942e-02, -2.519875e-02, +1.075097e-01,
+    -3.894207e-01, +2.719478e-01, -3.189775e-01, +5.997783e-02, +1.352964e-01, +8.729371e-04, -1.376189e-01, +8.267666e-02, +3.655432e-02,
+    +1.390851e-02, -1.285769e-01, -1.202122e-01, -1.026961e-01, +8.436840e-02, -1.364943e-02, +3.758348e-03, +3.291956e-02, -1.456587e-02,
+    +6.711482e-02, -1.458633e-03, +2.299111e-02, +3.317852e-01, -8.784739e-02, +1.283280e-01, +9.783497e-02, +3.218126e-02, -9.542790e-02,
+    +7.789956e-02, -2.821472e-02, -5.913385e-02, +2.080396e-02, -2.133493e-01, +2.465983e-01, +2.192298e-02, +1.625410e-02, +3.864385e-02,
+    +8.905729e-03, -1.017975e-01, -1.425213e-02, -1.822257e-02, +1.766973e-01, -6.452539e-03, -1.394405e-01, -3.420672e-02, -1.244881e-01,
+    +1.169365e-01, -4.278439e-02, +1.762758e-01, -1.950112e-01, -3.812052e-01, +8.224167e-02, +4.207297e-02, +1.496353e-02, -5.313643e-02,
+    +4.432749e-02, -2.455314e-01, -1.032937e-02, +1.289570e-01, +7.586586e-02, -8.254637e-02, -1.345977e-01, +6.518122e-02, -7.179673e-03,
+    +6.131072e-02, +1.986067e-01, +1.852519e-02, -3.464504e-01, -1.076372e-01, -1.343142e-01, +1.554781e-01, +1.685841e-01, -1.046292e-01,
+    -2.912033e-03, -1.286183e-01, +2.616829e-02, +1.021907e-01, +2.888465e-02, +1.472894e-01, +4.683613e-02, -1.616295e-01, -1.166087e-02,
+    -1.887568e-01, +1.304554e-02, +4.501068e-02, +1.435295e-01, -1.174399e-01, -6.575349e-02, -3.109027e-03, +8.249635e-02, -1.277228e-01,
+    -7.716466e-02, +1.118865e-01, -1.214990e-01, -5.877022e-02, -4.933077e-02, -2.810311e-02, +1.172562e-01, -3.947930e-02, +1.497681e-01,
+    -8.652223e-02, -8.380936e-03, -1.386837e-01, +1.096156e-01, +5.434173e-02, -3.340230e-02, +1.942915e-02, +2.764659e-02, -3.166252e-02,
+    +3.702890e-02, -6.913707e-03, +1.066499e-01, +2.606040e-02, -1.247301e-01, +5.450571e-02, -2.012693e-02, -2.128428e-02, -2.748160e-02,
+    -1.132885e-01, -2.724299e-01, +1.310077e-01, +5.543225e-02, +1.163155e-01, -1.363876e-01, +1.370808e-02, -4.978242e-03, +8.366209e-02,
+    +1.450138e-01, -2.625193e-01, -4.805436e-02, -9.787624e-02, +2.122198e-01, +1.212527e-02, +1.260531e-01, +2.859195e-01, +1.156117e-02,
+    -7.658269e-02, -1.225667e-01, +1.449694e-02, +9.374869e-02, +1.929850e-01, -1.714081e-02, +5.164497e-02, +4.877578e-03, +1.942714e-02,
+    -1.248409e-01, +4.189031e-02, +9.026153e-02, +5.854353e-02, +1.315496e-01, +3.135309e-02, +5.463969e-02, +4.008430e-03, +2.370004e-02,
+    -5.405484e-02, +6.240420e-02, -5.730133e-02, +1.836663e-01, +5.543857e-02, +6.119233e-02, -1.375642e-01, +9.689444e-02, -1.894567e-02,
+    -4.095431e-02, -1.052416e-03, +2.820798e-03, +2.781314e-01, -3.713315e-02, +8.808766e-02, -8.613625e-02, -1.514512e-01, +1.498669e-02,
+    +2.239000e-02, +9.970013e-02, -5.753512e-02, -3.246032e-02, +1.767115e-01, -7.519086e-02, -5.820600e-02, +1.763610e-01, +1.786502e-01,
+    +6.164804e-02, -1.772932e-01, +1.871878e-01, +8.400590e-02, +6.170303e-02, -1.351287e-01, -2.782633e-02, +1.801820e-03, +5.280786e-02,
+    +2.876035e-01, +6.233661e-02, +3.775346e-02, -4.067102e-01, -8.315004e-02, -2.644564e-02, +8.592527e-02, -2.012006e-02, -1.477351e-02,
+    -5.365553e-02, +3.040445e-02, +1.164356e-01, -1.017614e-01, -4.423350e-01, -1.391707e-01, +8.818343e-03, -8.861005e-02, -4.549247e-02,
+    -8.738489e-02, +4.338901e-02, -2.035968e-01, +2.111077e-01, -4.787467e-02, -1.028062e-01, +1.176060e-01, +2.335601e-01, +7.246277e-02,
+    -6.911540e-02, -3.986625e-01, -1.776569e-01, +1.889165e-01, +4.953799e-02, +7.026477e-02, +2.437758e-02, +1.016241e-01, -5.701946e-02,
+    //15
+    +4.678943e-03, -2.286359e-02, +1.252310e-01, +7.242011e-02, +4.078166e-01, -1.402098e-02, -2.920120e-01, -4.913519e-01, +2.587992e-01,
+    -6.759942e-02, -4.734384e-02, +5.663868e-02, +1.547941e-01, +5.875427e-02, +2.912489e-02, +1.631924e-01, -1.568117e-01, -1.072148e-01,
+    +9.477834e-03, +5.835680e-02, -1.750813e-02, +3.939336e-02, +2.591678e-03, -7.162518e-03, +6.474766e-02, +2.892989e-02, -2.961888e-02,
+    +3.081407e-02, -8.029270e-02, -8.797640e-02, -9.837529e-02, +5.379444e-02, -8.190592e-02, -1.040823e-01, -2.279169e-02, -5.166932e-02,
+    -3.475163e-02, -3.634540e-01, +2.797060e-01, +1.824808e-02, -3.042223e-02, -3.989730e-02, +9.042782e-02, +1.017645e-01, +1.960386e-01,
+    +3.108115e-02, +3.358373e-02, +6.271855e-03, +1.236064e-01, +4.646221e-02, +1.216831e-03, +4.465283e-02, +1.278156e-01, +3.547598e-02,
+    +1.461386e-03, -1.537381e-02, -4.175457e-02, +1.330522e-02, +2.318232e-02, -1.777878e-02, -5.282771e-02, -2.984470e-02, -2.813979e-02,
+    +5.219761e-02, -8.895732e-02, +1.257914e-01, +9.582960e-03, +1.051687e-01, -5.156579e-02, -6.940815e-02, +1.970637e-01, +7.200522e-02,
+    +1.811995e-02, -5.054994e-03, -4.129598e-03, +1.422116e-01, +1.464064e-02, -2.317897e-02, +6.181987e-02, +2.909482e-02, -3.806883e-02,
+    +3.529737e-02, +2.424260e-02, +9.814215e-03, +1.060371e-02, +1.454701e-02, +1.828728e-02, +1.570690e-02, -4.233286e-02, +1.145141e-02,
+    +5.823964e-02, -2.669252e-02, +4.383304e-02, -3.860455e-02, +8.040129e-02, +1.403378e-02, +4.624762e-02, -5.167300e-02, +2.419702e-02,
+    +1.350431e-01, -8.400110e-02, +2.093332e-02, -1.554559e-02, +5.572629e-02, -6.885192e-02, +8.845255e-03, +5.514455e-02, -5.712078e-02,
+    +7.503234e-02, -5.490224e-02, +6.156715e-02, -1.847872e-01, +1.938498e-01, -6.501649e-02, -4.265226e-03, +7.195160e-02, +2.594988e-02,
+    -1.182892e-02, -5.581914e-02, -2.333380e-02, +1.990019e-02, -2.705459e-02, -5.181548e-02, -7.286467e-02, +4.371772e-02, -1.463679e-03,
+    -1.967172e-01, -8.500379e-03, -2.352096e-01, +2.371520e-02, +1.164419e-01, +8.645014e-02, +6.731832e-02, +1.273747e-01, +1.511112e-01,
+    +9.633798e-03, -3.753919e-02, +1.395200e-02, -2.453210e-02, +3.462585e-02, -1.416189e-02, -3.237622e-03, -7.137383e-02, +1.051108e-02,
+    -2.259193e-02, +8.812898e-02, -3.064157e-03, +6.018302e-02, -1.330509e-02, +6.808767e-02, -1.736380e-01, -2.795183e-02, -3.239198e-02,
+    -7.437824e-02, +3.183228e-02, +1.578294e-01, -1.999386e-01, -3.897938e-02, +2.007226e-01, +1.547034e-02, +7.220739e-02, -4.044573e-02,
+    +1.802449e-02, -5.008658e-02, +1.499190e-02, +6.372612e-02, +2.442895e-02, +7.677889e-03, -2.841277e-03, +1.083621e-01, +1.573547e-03,
+    -3.617933e-02, +1.523138e-02, +2.095600e-02, -5.913629e-03, -3.526010e-02, -8.455317e-03, -7.167763e-02, +1.172562e-02, +1.633700e-02,
+    -3.204405e-02, -5.761229e-03, -9.464489e-03, +3.049919e-02, +5.258276e-02, +5.449881e-04, +5.752418e-02, +1.827680e-02, +2.279179e-02,
+    +9.395419e-03, +1.171998e-02, +2.298444e-02, +6.690483e-02, -1.098199e-01, -1.393040e-02, +2.220886e-02, -6.693472e-02, -3.236871e-02,
+    -1.090695e-02, +9.841496e-03, +3.111159e-02, +3.558113e-02, -2.904517e-03, +8.718250e-03, -8.653549e-03, -2.138004e-02, -3.204538e-02,
+    -1.659959e-02, +7.602236e-02, +8.722467e-03, +2.636981e-02, -7.671890e-02, +1.049403e-02, -1.810801e-01, +7.325818e-02, -2.623954e-02,
+    -3.929507e-02, -3.305179e-02, -1.495846e-02, -6.826921e-03, -2.447916e-02, -3.886179e-02, -2.101559e-02, +2.961982e-02, +1.220700e-02,
+    +1.129412e-02, +1.648801e-03, +2.316077e-04, -1.594091e-01, +1.094484e-01, +1.888341e-02, +2.456900e-02, -1.148594e-01, -2.282049e-02,
+    +3.152286e-02, -4.368386e-02, +7.447983e-03, +6.633803e-02, +6.471068e-02, -9.536624e-03, +5.863823e-02, +7.389804e-03, +1.863927e-02,
+    -3.213242e-02, +4.367686e-03, -2.526058e-02, +3.511440e-02, -7.333681e-02, -2.543050e-02, -8.729902e-03, +2.939065e-02, -4.343991e-02,
+    -4.051769e-02, -4.415580e-03, -1.454519e-03, -2.323263e-02, -1.052684e-01, -1.243609e-02, +5.251362e-02, +2.775272e-02, +8.807082e-03,
+    +1.533120e-02, -1.488032e-02, -1.342394e-02, +4.564048e-02, +6.761917e-02, +1.696352e-02, +8.385730e-02, +3.925246e-02, +1.692614e-02,
+    +2.572928e-03, +6.505962e-02, -8.598717e-03, +2.772786e-02, +2.742371e-02, +1.389682e-02, +3.200219e-02, +2.279372e-03, +2.268277e-03,
+    +8.444207e-02, -7.358145e-02, -2.715512e-03, +2.331196e-02, +1.036376e-01, +7.214050e-02, +6.671604e-02, -6.996328e-02, +5.316682e-02,
+    //16
+    +4.592931e-02, +9.558088e-02, +8.985881e-03, -1.275213e-01, -1.605008e-01, -8.870652e-02, -4.869767e-02, -1.238619e-01, +7.380750e-03,
+    +2.231845e-02, +5.451260e-03, -3.161311e-02, -1.802421e-01, +5.914258e-02, +6.225549e-02, -8.036601e-02, -1.127795e-01, -1.232538e-01,
+    -5.044926e-02, -1.611863e-01, -1.617067e-01, -1.757931e-01, -5.263758e-02, -5.549249e-02, +8.318696e-03, -1.287344e-02, +8.957193e-03,
+    -8.391844e-02, -6.526621e-02, +3.707152e-02, -1.283181e-02, +4.391460e-02, -1.216752e-01, +5.551950e-02, -5.800957e-02, +1.696582e-02,
+    +1.049798e-02, -1.667648e-01, -1.008346e-01, -8.544640e-02, +3.475840e-04, +9.028322e-02, -8.540933e-02, -3.759846e-04, -2.582632e-02,
+    +2.478488e-02, +1.406983e-01, +6.839842e-02, +5.413798e-02, +2.094737e-03, -2.230036e-02, -6.616264e-02, -1.607578e-02, -3.425294e-02,
+    +4.664860e-02, +5.466103e-02, -1.167120e-02, -1.348837e-01, +8.820025e-03, +7.203199e-02, +6.273715e-03, +5.305938e-02, +1.473905e-02,
+    +6.117511e-03, +9.448362e-02, -7.496434e-02, -1.017227e-01, -4.885176e-02, -2.502077e-02, -7.766083e-02, +4.487795e-02, -2.568739e-01,
+    +1.460519e-01, -6.628338e-02, -7.279958e-02, -6.664363e-03, -3.487140e-02, +7.801206e-02, +1.227938e-01, +7.899821e-02, +1.035048e-02,
+    -1.209380e-01, -1.139934e-01, -4.178134e-02, +4.239683e-02, +4.673535e-02, +2.038781e-02, -1.866643e-02, -1.084782e-01, -9.804154e-02,
+    -9.919849e-02, +1.034758e-01, -7.268238e-02, -2.350412e-02, +1.627254e-01, -1.034839e-01, +3.224659e-03, -3.623292e-03, -6.308803e-02,
+    +3.697262e-03, -9.959058e-02, +6.645134e-03, -2.960357e-03, +4.168836e-02, +1.509817e-02, +5.150869e-02, -1.118039e-01, -1.032566e-01,
+    -6.153203e-02, -3.927529e-03, -1.511334e-01, -2.265492e-02, +4.425531e-02, -5.097066e-02, +9.804219e-02, -1.611797e-01, -7.960556e-02,
+    -1.216362e-01, +2.024292e-02, +1.681325e-02, +1.583901e-02, -1.654032e-01, +9.448313e-03, -2.671153e-02, +5.797099e-02, -2.965710e-02,
+    -8.743875e-02, -1.161226e-01, +1.261137e-01, +1.160045e-01, +4.791682e-02, -1.461477e-01, +1.327242e-01, +1.767736e-02, -7.375518e-02,
+    +6.176206e-02, +5.900447e-02, +9.315050e-02, +4.634054e-02, -1.171287e-01, +1.717701e-01, -1.195525e-01, +9.443169e-02, -1.165713e-01,
+    -1.642820e-01, -4.871074e-02, -2.822714e-02, +1.456786e-02, -8.181540e-02, -4.723734e-02, -4.815935e-02, +1.170827e-02, -5.013811e-02,
+    -1.397027e-01, -3.716227e-02, +1.316380e-01, -1.313583e-01, +8.631372e-04, +3.986743e-02, +4.185454e-03, -1.162798e-01, +1.095219e-01,
+    -1.920806e-02, -9.777798e-03, +3.701558e-02, -9.508594e-03, +6.470116e-02, -3.521260e-02, -4.521936e-02, -5.345503e-02, -2.764308e-02,
+    +7.495194e-02, +2.262190e-02, -5.013275e-02, -5.234067e-02, -2.750152e-02, -1.355980e-01, -5.300253e-02, +1.752979e-01, -9.575592e-02,
+    +3.288658e-02, -4.547220e-02, +9.712655e-02, +5.873093e-02, -3.692052e-02, -7.271523e-02, -1.162047e-01, +7.715843e-02, -1.337082e-01,
+    -5.310176e-02, +1.418513e-02, -1.476754e-01, +3.272481e-02, +9.407858e-03, -1.109856e-01, -1.489848e-01, -2.813757e-02, +5.416331e-02,
+    -1.431337e-02, -3.665327e-02, -1.650242e-01, -7.004933e-02, +3.877002e-02, +7.177233e-02, +3.709957e-03, +6.644255e-02, +5.946068e-02,
+    -7.422214e-02, -2.022889e-01, -1.203809e-01, +1.964404e-01, -1.533304e-01, -9.879324e-02, -9.638149e-02, -9.261746e-02, +2.225919e-02,
+    -8.155557e-03, +1.277074e-02, -9.705994e-02, -6.266470e-02, +3.928890e-02, -5.196888e-02, +5.343492e-02, -1.041969e-02, -1.871043e-02,
+    +2.859334e-02, -7.159968e-02, -3.289126e-01, +2.021459e-02, -1.397872e-01, -8.231029e-02, -7.570791e-02, -6.121521e-02, -5.660451e-02,
+    +7.613382e-02, -1.654174e-02, +3.996931e-03, -9.564569e-03, -9.167860e-02, -5.694223e-02, +8.556062e-02, -9.693665e-02, -3.004342e-02,
+    -1.902676e-01, -1.328042e-01, +8.432874e-03, -1.769513e-01, -1.741188e-02, -5.552350e-02, -7.641421e-02, +1.258802e-02, +7.863402e-02,
+    -3.227015e-02, -9.603354e-02, -1.354457e-02, -4.641752e-03, -2.183170e-02, +6.210985e-02, -7.093658e-02, +5.917477e-02, +5.748267e-02,
+    -6.578226e-02, +7.185920e-02, +7.059313e-03, +3.330851e-02, +8.503330e-02, -5.053880e-02, -1.425213e-02, -5.491822e-02, -2.257546e-01,
+    +1.837949e-01, +6.395160e-02, +5.951860e-03, -2.031760e-02, +4.206603e-02, +1.057509e-01, -3.448201e-02, +9.605484e-03, -2.562983e-01,
+    -4.102375e-02, +2.169316e-02, -3.053514e-02, +5.658764e-02, -7.320689e-03, -1.439183e-01, +9.699862e-03, +2.982711e-02, -8.310693e-02,
+};
+
+/* The 9 phases bias in the sub-pixel layer */
+const float espcn_x3_biases3[9] = \
+{
+    +2.574470e+00, +1.537134e+00, +1.965146e+00,
+    +9.081681e-01, +8.749748e-03, +3.683641e-01,
+    -3.374555e-01, -7.275543e-01, -2.760282e-01,
+};
+
+/* The 9 phases x 16 convolutional kernel(3*3) in the sub-pixel layer */
+const float espcn_x3_weights3[9][ESPCN_CONV2_FILTERS][ESPCN_CONV3_SIZE][ESPCN_CONV3_SIZE] = \
+{
+    //01
+    +8.123360e+00, +2.295762e+00, -2.080539e+00, -4.178561e+01, -2.255693e+01, -3.667740e+00, +2.990245e+01, +1.821815e+01, +4.494975e+00,
+    -2.521027e+00, -2.767826e+00, -2.116158e-01, +1.635513e+01, +4.000900e+01, -3.993961e+00, -9.875547e+00, -1.898377e+01, -1.467635e+00,
+    -3.845290e+00, +2.203131e+01, -2.157148e+01, +9.464257e-01, +1.855381e+01, -4.015876e+01, -5.760702e+00, +5.452537e+00, -8.664701e+00,
+    +1.525257e+01, +1.397659e+01, +1.866000e-01, -4.512783e+01, -2.669560e+01, -7.680183e+00, +1.660431e+01, +1.043403e+01, +2.873080e+00,
+    +3.265359e+00, +4.284124e+00, -3.083722e+00, +7.186788e+00, -5.025986e-01, -2.945667e+00, +1.026976e+01, -7.528412e+00, -6.025324e+00,
+    -3.304028e+01, +9.284410e+00, -1.004158e+01, +1.998437e+01, +8.386986e+00, +1.109749e+00, -7.452026e+00, +3.675377e+00, -1.864180e+00,
+    -2.613059e+01, +2.336893e+01, -1.028016e+01, -2.681167e+01, +1.708573e+01, -1.162574e+01, -6.010506e-01, +1.986423e+00, +1.163466e+00,
+    +1.122984e+01, -7.279559e+00, +1.765107e+00, +4.563510e+00, -2.230863e+01, +1.045606e+01, +1.540017e+01, -1.016889e+01, +6.347396e+00,
+    +3.639829e+01, -1.574246e+01, +9.555591e+00, +7.660669e+01, -1.704268e+01, +3.769560e+00, +6.784374e+00, -5.328644e+00, +4.207266e+00,
+    +6.202116e-01, +3.032530e+00, -3.210801e-01, +3.055991e+00, +9.055515e-02, -4.180355e-01, -5.368274e+00, -5.322780e-01, -4.388476e+00,
+    -3.063383e+01, -1.539825e+01, -3.827018e+00, +2.337293e+01, +7.722873e+00, -1.198566e-01, -6.619792e+00, -3.598760e+00, +2.710938e+00,
+    +8.869571e+00, +5.081893e+00, +1.427430e+00, +1.127940e+01, -3.007472e+01, +1.610773e+01, -1.276554e+00, -4.206343e+01, +8.315536e+00,
+    +5.211175e+00, -2.791151e+01, +1.849430e+01, +3.147842e+00, -2.927265e+01, +1.494918e+01, -3.014623e+00, +1.227807e+00, +3.012509e+00,
+    +2.636409e+00, -1.036203e+01, +2.892342e-02, +1.749682e+01, +1.076911e+01, +4.137636e+00, -2.422109e+00, -1.271779e+01, +2.339877e+00,
+    -1.218213e+01, +3.513502e+00, +1.087416e+01, -3.134518e+00, +3.435684e+01, +1.526116e+01, +9.700214e-01, -2.746501e+01, -4.916879e-01,
+    +1.027767e+01, -1.034370e+01, -2.479966e+00, -7.243652e+00, -2.672671e+00, -1.612629e+00, +4.080105e+00, +6.963789e+00, -4.809726e+00,
+    //02
+    +4.289034e+00, +7.988106e+00, -4.346958e+00, -2.203558e+01, -4.409409e+01, -1.034132e+00, +1.236369e+01, +3.491956e+01, +2.827048e+00,
+    +4.311459e+00, -1.142911e+01, +6.335314e-01, +3.827007e+00, +4.559597e+01, +2.735522e+00, -2.507406e+00, -2.722968e+01, -2.914616e+00,
+    +9.809493e+00, -1.092611e+01, -5.203112e+00, +8.234354e+00, -2.329708e+01, -1.824944e+01, +1.836557e+00, -3.686661e+00, -8.119580e+00,
+    +1.094740e+01, +1.539716e+01, +5.305592e+00, -2.962513e+01, -4.175807e+01, -8.480109e+00, +1.581672e+01, +1.051226e+01, +4.011917e+00,
+    +3.266846e+00, -6.703637e+00, -9.023190e-02, -3.935331e+00, -7.866596e+00, -1.612127e+01, -1.166964e+00, -3.265857e+00, -6.401682e-01,
+    -1.542911e+01, -3.924679e+00, -7.690036e+00, +3.092938e+01, +4.587770e+00, -1.029699e-01, -6.321406e+00, +2.957583e+00, -1.539868e+00,
+    +1.843759e+01, +9.091964e+00, -8.303057e+00, +1.610617e+01, +8.596384e+00, -8.270656e+00, +6.210552e-01, +1.219234e+00, +6.333836e-01,
+    +2.901554e+00, -4.726943e+00, +1.173028e+00, -3.125602e+01, -6.685272e+00, +7.488721e+00, +2.419775e+00, -4.119052e+00, +7.515336e+00,
+    -1.366488e+01, -1.394254e+01, +9.547182e+00, -8.334949e+00, -3.707473e+01, +4.119033e+00, -1.220721e+01, -1.401952e+00, +2.858112e+00,
+    -2.652460e+00, -1.071841e+00, +1.801308e+00, -5.413458e-01, -3.798431e+00, -1.038549e-01, -3.646984e+00, -1.532840e+00, +1.403940e+00,
+    -1.961828e+01, -3.003860e+01, -2.909529e+00, +1.371587e+01, +2.082221e+01, -2.192274e+00, -3.588579e+00, -7.329174e+00, +3.044284e+00,
+    -3.405290e-01, +9.064917e+00, +3.882659e+00, +3.371174e+00, -1.967712e+01, +1.169359e+01, +1.722822e+01, -4.487795e+01, +3.090088e-01,
+    -6.464785e+00, +1.134523e+01, +1.636727e+01, -7.411622e+00, +1.039915e+01, +1.519022e+01, +2.109915e+00, +8.631519e-01, +4.045731e+00,
+    -2.254544e+00, -9.476244e+00, -1.180054e+00, -1.235586e+00, +1.918508e+01, +1.089449e+01, +8.121382e-02, -1.124642e+01, -3.718989e-01,
+    -2.385839e+00, -1.768319e+01, +1.589205e+01, +8.539596e+00, +5.440081e+00, +3.408449e+01, +7.149623e-01, -1.651172e+01, -9.091656e+00,
+    +4.829175e+00, -6.265527e-01, +1.370601e+00, +7.751738e+00, -3.591577e+00, +3.004506e-01, +5.627977e+00, +9.842376e-01, +1.150689e+00,
+    //03
+    -2.619463e+00, +1.085409e+01, -1.264467e+00, -7.031658e+00, -5.135918e+01, -6.800296e+00, +7.887378e-01, +4.068172e+01, +6.908292e+00,
+    +4.408708e+00, -1.067667e+01, -2.769078e-01, -1.150435e+00, +3.230678e+01, +2.051241e+01, -1.057540e+00, -2.155876e+01, -6.996519e+00,
+    +1.085658e+01, -1.645131e+01, +3.704861e+01, +6.980791e+00, -1.632548e+01, +5.127345e+01, +4.167870e+00, -8.181888e+00, +2.779189e+00,
+    +4.744121e+00, +1.445673e+01, +1.000301e+01, -1.775946e+01, -4.833432e+01, -1.331636e+01, +9.881666e+00, +1.178250e+01, +9.025262e+00,
+    -1.520000e+00, -4.101927e+00, +7.339803e+00, +1.399620e+00, +1.263840e+00, -3.453870e+00, -6.932477e+00, +3.980115e+00, -5.668147e+00,
+    +4.659517e-01, -2.953121e+01, +2.471566e+00, +1.749390e+01, +3.672886e+00, +2.077751e+00, -5.775972e+00, -5.437703e+00, +2.522433e-01,
+    +2.352111e+01, -3.073959e+01, +7.201352e+00, +2.018591e+01, -2.680372e+01, +3.836461e+00, +1.805048e+00, +1.149824e+00, +1.858190e+00,
+    -3.035558e+00, +7.784407e+00, -4.087610e+00, -2.035861e+01, +2.099218e+01, -1.154680e+01, -2.121124e+00, +1.237907e+01, -3.379370e+00,
+    -3.063409e+01, +1.821260e+01, -3.794597e-01, -5.337455e+01, +1.765299e+01, +4.144897e+00, -1.123146e+01, +8.953845e+00, -2.669395e+00,
+    -1.634902e+00, +1.460994e+00, -1.572370e+00, -1.768472e+00, -5.055309e-01, +6.509186e-02, +5.047402e+00, -3.041396e+00, -2.251847e+00,
+    -7.762127e+00, -3.644563e+01, -3.611380e+00, +4.362652e+00, +2.718724e+01, +1.213627e+00, -2.299428e+00, -8.560011e+00, +2.325077e+00,
+    -3.076329e+00, +1.419929e+01, +5.189055e+00, +2.427471e+00, +6.097995e+00, -1.444296e+01, +2.247847e+01, -2.889259e+01, -2.568938e+01,
+    -7.164663e+00, +2.148181e+01, -2.424858e+01, -9.439434e+00, +1.844541e+01, -2.424490e+01, +3.422218e+00, -6.477931e-01, +1.876807e+00,
+    -6.207445e+00, +2.072130e+00, -3.594154e+00, -6.624074e+00, +2.601009e+01, +1.232559e+01, +1.246729e+00, -6.063567e+00, -7.491808e+00,
+    +5.141863e-01, -2.114757e+01, +1.857180e+01, +8.973659e+00, -1.101080e+00, +4.179517e+01, +1.058743e+00, -5.161536e+00, -2.034177e+01,
+    +8.219569e+00, +1.183520e+01, +5.581114e+00, -3.496662e+00, -1.242748e+01, +4.304241e-01, -1.014974e+00, -2.966864e+00, +8.222012e+00,
+    //04
+    -8.923350e+00, -7.093536e+00, -5.118162e-01, +1.205024e+01, +1.424466e+01, +6.005216e-02, +2.922814e+01, +1.228559e+01, +4.363635e+00,
+    -3.463594e-03, +1.484983e+01, -2.396367e+00, -8.167614e+00, -3.933005e+00, -6.656781e+00, -1.055789e+01, -1.989722e+01, -2.444233e+00,
+    -4.163584e+00, +1.364938e+01, -1.073352e+01, -2.705515e+00, +2.248555e+01, -4.955136e+01, -2.549825e+00, +1.445861e+01, -1.036638e+01,
+    -3.292599e+01, -1.350457e+01, -3.542608e+00, -2.713466e+00, -7.357726e+00, -3.455357e+00, +1.151607e+01, +9.996234e+00, -1.151694e-01,
+    +6.148676e+00, +3.090468e+00, +2.108158e+00, +3.038828e-01, +6.029034e-01, +5.301657e+00, +1.094423e+01, +3.675291e+00, +6.298979e+00,
+    -5.499946e+00, +7.442914e+00, -7.900113e+00, +1.422589e+00, +9.152478e+00, -2.128646e+00, -8.634053e+00, +4.312223e+00, -2.249735e+00,
+    -1.375025e+01, +8.811525e+00, -4.756854e+00, -4.099138e+01, +3.378279e+01, -1.548761e+01, -1.298345e+00, +6.921311e-01, -4.299104e-01,
+    -2.388747e+00, -4.153620e+00, +1.722032e+00, +1.545802e+01, -1.458558e+01, +1.033461e+01, +1.825905e+01, -1.748656e+01, +9.461405e+00,
+    +1.807529e+01, -1.201467e+01, +5.434896e+00, +8.367764e+01, -1.782680e+01, +1.631233e+00, +2.093253e+01, -8.861620e+00, +6.026684e+00,
+    +1.397699e+00, -4.462867e+00, -6.057901e+00, -4.408607e+00, +1.212747e+00, -1.007188e-01, +1.492454e+00, -3.031234e+00, +1.789457e+00,
+    +2.350244e+01, +7.487908e+00, +5.264621e-01, +1.402749e+01, +9.191196e+00, +9.384869e-01, -4.302952e+00, -3.006619e+00, +1.209027e+00,
+    +1.518471e+00, -2.636507e+00, +1.763513e+00, +6.376555e+00, -1.857185e+00, +1.239372e+01, +1.228107e+01, -6.005832e+01, +1.508106e+01,
+    -5.395442e-01, -1.206614e+01, +6.596867e+00, +8.601386e+00, -4.587998e+01, +2.707058e+01, -5.045019e+00, +2.275184e+00, +7.196889e-01,
+    +6.980286e+00, +5.094265e+00, +1.747710e+00, +1.088123e+01, -1.601308e+01, +2.329793e+00, -4.321594e-01, -7.742333e+00, +2.596620e+00,
+    -7.572050e+00, -1.587169e+01, -8.855488e-01, -9.066544e+00, +4.561578e+01, +2.540905e+01, +2.624723e+00, -2.263314e+01, +5.836948e-01,
+    +8.667942e+00, -4.473168e+00, +6.204849e+00, +1.041657e+01, -1.139933e+00, -1.101567e+00, -1.856848e-02, +8.419375e+00, +1.771814e-01,
+    //05
+    -2.173791e+00, -1.152017e+01, -5.165790e-01, +7.914138e+00, +1.727632e+01, +3.868169e+00, +1.203292e+01, +2.722657e+01, +1.460574e+00,
+    -9.931301e-01, +1.143044e+01, -2.004870e+00, -3.294205e+00, -1.000682e+01, -4.924458e+00, -7.641021e-01, -3.151944e+01, -5.844908e-01,
+    +5.076951e+00, -3.217826e+00, -4.056873e+00, +5.277856e+00, -2.842454e+01, -2.444752e+01, +5.477437e+00, -2.733753e+00, -3.833177e+00,
+    -2.043991e+01, -2.649900e+01, -2.699921e+00, -1.754821e+00, -1.140210e+01, +8.616780e-01, +1.124159e+01, +1.016343e+01, -3.159276e-01,
+    -3.873796e+00, -6.248827e+00, -4.425898e-01, -3.653039e+00, -9.189446e+00, -7.743244e+00, +3.333126e+00, +8.159153e+00, +1.349665e+01,
+    +9.152822e+00, -7.585613e-01, -5.131428e+00, +1.500681e+01, +1.762672e+00, -4.139772e+00, -6.191829e+00, +3.451960e+00, -2.072851e+00,
+    +6.440143e+00, +3.352985e+00, -3.191627e+00, +2.538745e+01, +1.605941e+01, -1.244100e+01, -3.750540e-01, +1.996207e+00, +1.540038e+00,
+    -8.059179e+00, -2.836837e+00, +8.229235e-01, -9.822790e+00, -3.426476e+00, +8.873925e+00, -9.069449e+00, -4.093588e+00, +7.777453e+00,
+    -6.288554e+00, -6.862390e+00, +3.498921e+00, -1.369030e+01, -3.841245e+01, +3.332265e+00, -1.167883e+01, -8.984298e+00, +4.882852e+00,
+    +1.350039e+00, -3.395295e-01, +5.018290e+00, -6.161989e-01, -5.837371e-01, -3.532086e-01, -2.953586e+00, -2.306931e+00, +8.522570e-01,
+    +1.046245e+01, +1.684570e+01, -1.048539e+00, +8.852012e+00, +1.305348e+01, +3.609599e+00, -1.541241e+00, -5.796582e+00, +1.078100e+00,
+    -4.482563e-03, -2.172884e+00, +2.501890e+00, -1.148913e+01, +7.207600e+00, +1.234573e+01, +3.431183e+01, -5.982267e+01, +4.310997e+00,
+    -2.355985e+00, +5.355419e+00, +4.751887e+00, -1.099285e+01, +1.402001e+01, +2.676287e+01, +1.309142e+00, +4.398046e+00, +2.163445e+00,
+    +3.749348e-01, +7.629809e+00, +3.706239e+00, -3.119429e+00, -1.100919e+01, +3.801588e+00, -1.377738e+00, -1.539472e+00, -1.112213e+00,
+    -4.628054e+00, -2.375701e+01, -4.791399e+00, +8.890908e+00, +6.607118e+00, +5.015672e+01, +3.587591e+00, -1.438980e+01, -6.082175e+00,
+    -2.198179e+00, -8.326260e+00, +1.046924e+00, +3.058724e+00, -2.860959e+00, -6.324018e-01, +2.622862e+00, +1.402860e+01, -6.258384e+00,
+    //06
+    -1.485830e+00, -1.277205e+01, -1.526308e+00, +4.338781e+00, +1.673991e+01, +8.175815e+00, +1.820386e+00, +3.652878e+01, +2.921263e+00,
+    +8.114831e-01, +3.812586e+00, +4.838451e+00, -3.186850e+00, -1.376434e+01, -1.605113e+00, +9.842995e-01, -2.720736e+01, -4.764603e+00,
+    +7.017977e+00, -8.383694e+00, +1.379174e+01, +4.222080e+00, -2.453328e+01, +6.188905e+01, +7.028018e+00, -6.639226e+00, +1.721284e+01,
+    -8.671310e+00, -3.719121e+01, -6.360655e+00, -5.143369e+00, -8.967134e+00, +2.512495e+00, +6.792712e+00, +9.528033e+00, +5.904934e+00,
+    -1.336401e+01, -5.140947e+00, +3.726328e+00, -1.327372e+01, -6.552647e+00, +8.382194e+00, -4.131306e-01, +1.446498e+01, +8.565764e+00,
+    +1.030644e+01, -1.202960e+01, +1.874069e+00, +8.974566e+00, -8.549070e+00, -1.212368e-01, -4.895406e+00, -5.291566e+00, -9.711434e-01,
+    +8.381724e+00, -1.478050e+01, +2.077111e+00, +3.302862e+01, -4.270250e+01, +1.055220e+01, +8.639335e-01, -7.138925e-02, +1.577350e+00,
+    -5.860879e+00, +1.984002e+00, -2.483805e+00, -8.950614e+00, +2.313186e+01, -5.191070e+00, -1.096736e+01, +2.182326e+01, -9.398787e+00,
+    -1.265335e+01, +1.441508e+01, -3.499238e+00, -6.207950e+01, +1.906814e+01, +2.774337e+00, -1.774999e+01, +1.525369e+01, +9.603664e-02,
+    -2.268055e+00, -5.057697e+00, +2.833313e+00, -1.103703e+00, -1.736050e+00, +6.321362e-01, +1.415359e+00, +2.194170e+00, +1.772410e+00,
+    +2.617200e+00, +2.552197e+01, +2.768116e+00, +3.439359e+00, +1.762137e+01, +6.074430e+00, -1.229135e+00, -5.998846e+00, +9.892668e-01,
+    +4.421206e-01, +1.770608e+00, +1.428290e+00, -8.152141e+00, +1.612064e+01, +1.659813e+00, +3.195850e+01, -2.818375e+01, -3.439059e+01,
+    -2.363555e+00, +7.519578e+00, -1.363244e+01, -1.324281e+01, +3.134123e+01, -3.596934e+01, +2.738050e+00, -8.744793e-01, +9.702438e-01,
+    -1.563155e+00, +1.320755e+01, +5.438516e+00, -1.014749e+01, +7.214193e+00, -2.681580e+00, -6.229949e-01, +1.882121e+00, -7.379077e+00,
+    -1.384682e+00, -1.699595e+01, -8.649885e+00, +1.254481e+01, -6.793899e+00, +6.132115e+01, +2.122839e+00, -3.402432e+00, -1.518244e+01,
+    -4.271899e+00, +9.165197e+00, +1.091741e+01, -1.378496e+01, -4.075292e+00, -4.706175e+00, +5.024337e-01, -7.567686e-01, +6.110697e-01,
+    //07
+    -9.941614e+00, -8.943029e+00, +2.091880e+00, +2.867889e+01, +1.903286e+01, +1.360530e+00, -3.074627e+01, -2.653172e+01, -1.678436e+00,
+    -6.737650e-01, +1.237058e+01, -2.194999e+00, -1.353877e+01, -2.732889e+01, -2.922779e+00, +1.394058e+01, +2.602766e+01, -3.028859e+00,
+    -6.551010e+00, +3.584413e+00, -8.752877e+00, +1.076200e+00, +2.370622e+01, -3.801006e+01, -2.937012e+00, +1.849860e+01, -2.260332e+01,
+    -1.251064e+01, -1.102847e+01, -7.761896e-01, +6.180456e+01, +3.328849e+01, +2.979357e+00, -1.444133e+01, -2.994950e+00, -6.477893e+00,
+    +8.825034e+00, +2.604946e+00, -1.153919e+00, +8.630963e+00, +3.501380e+00, -4.223367e+00, +2.480490e+00, -6.652479e-01, +1.016036e+01,
+    +1.696427e+01, +6.538554e+00, -1.380574e+00, -3.166113e+01, +1.434271e+01, -9.033798e+00, +4.152735e+00, -1.167611e+00, -3.456050e-02,
+    -4.495599e+00, +1.651743e+00, -1.906218e+00, -3.704293e+01, +3.801030e+01, -1.440426e+01, -8.661628e+00, +2.805000e+00, -3.097733e+00,
+    -5.817911e+00, -2.752880e+00, +2.630417e+00, +2.288401e+01, -1.029819e+01, +5.606702e+00, +1.435348e+01, -2.282716e+01, +9.513877e+00,
+    +1.377580e+01, -8.148603e+00, +1.509865e+00, +5.597233e+01, -1.331576e+01, +5.460516e+00, +5.293801e+01, -1.790244e+01, +9.221719e+00,
+    -7.592268e+00, -6.300582e+00, -3.726524e+00, -1.984808e+00, -1.620446e+00, -3.307393e+00, -3.932639e-01, -8.196149e+00, +9.679450e-01,
+    +3.004654e+01, +7.344376e+00, +3.902846e+00, -3.243026e+01, -1.222583e+01, -1.909468e+00, +3.476382e+00, -1.860238e+00, -1.691711e+00,
+    -7.883755e-01, -2.683930e+00, +2.827853e+00, +4.016178e+00, +9.117504e+00, +5.536588e+00, +1.327228e+01, -6.232751e+01, +1.813464e+01,
+    -2.599480e+00, -1.983796e+00, +3.034651e+00, +9.218324e+00, -4.142473e+01, +2.862557e+01, -1.354855e+00, -1.103200e+01, +4.597669e+00,
+    +6.945127e+00, +6.040415e+00, +8.500371e-01, -4.476946e-01, -3.387357e+01, +2.158172e-01, +7.358877e+00, +5.666294e+00, +4.951786e+00,
+    -1.133743e+00, -1.745674e+01, -8.368101e+00, -1.666156e+01, +2.144114e+01, +2.537453e+01, +1.470976e-01, +4.765228e+00, +9.991081e+00,
+    -1.735944e+00, -2.651678e+00, +6.153177e+00, +1.465021e+01, -5.493626e-01, -2.995754e+00, -1.351065e+01, -3.577721e+00, -4.913011e+00,
+    //08
+    -3.165295e+00, -1.433283e+01, +2.131517e+00, +1.632834e+01, +3.195290e+01, +4.323076e-01, -1.691370e+01, -4.303108e+01, -1.906616e+00,
+    -3.931632e+00, +1.321373e+01, -2.990075e+00, +1.274900e+00, -3.890527e+01, -3.423610e+00, +5.851066e+00, +2.668095e+01, +3.726399e+00,
+    +3.256570e-01, -1.929451e+00, -8.151961e+00, +9.133748e+00, -2.384848e+01, -1.804584e+01, +8.351357e+00, -9.605572e+00, -5.607881e+00,
+    -8.923269e+00, -1.312792e+01, -4.844817e+00, +4.185309e+01, +4.971895e+01, +8.975842e+00, -1.044539e+01, -9.243220e+00, -6.600471e+00,
+    +7.841539e-01, -7.992424e+00, -9.876743e+00, +1.986405e+00, -2.052949e+00, -8.607894e-01, -3.384710e+00, +1.899376e+00, +5.209567e+00,
+    +2.255813e+01, +2.339428e+00, +1.631565e+00, -1.678469e+01, +2.881772e+00, -9.421007e+00, +1.160873e+01, -2.238700e+00, -2.150806e+00,
+    +3.533125e+00, +2.140847e+00, -1.655178e+00, +2.776108e+01, +1.817913e+01, -1.136440e+01, +5.710104e+00, +7.860923e-01, -1.400597e+00,
+    -1.065797e+01, -1.265326e+00, +1.865607e+00, +8.088702e+00, -3.859704e+00, +5.116759e+00, -2.537582e+01, -5.426817e+00, +7.561432e+00,
+    -3.737715e+00, -4.736456e+00, +8.839613e-01, -2.052406e+01, -2.714965e+01, +8.222050e+00, -5.724963e+00, -2.427342e+01, +7.249335e+00,
+    +1.507702e-01, +3.014768e+00, -5.024662e-01, +1.846182e+00, +1.805347e-01, +1.896833e+00, -6.220322e+00, +4.440606e+00, -2.654475e+00,
+    +1.252081e+01, +2.134181e+01, +2.211857e+00, -1.868779e+01, -3.089245e+01, +1.032793e+00, +5.397626e-01, +4.097001e+00, -4.404363e+00,
+    +5.435142e-01, -4.515261e+00, +3.447835e+00, -1.089422e+01, +1.560431e+01, +6.370453e+00, +2.498896e+01, -5.799365e+01, +8.996013e+00,
+    -1.598990e-01, +1.628736e+00, +1.710937e+00, -1.107230e+01, +1.744849e+01, +2.877992e+01, -7.782513e-01, +4.542253e+00, +4.203932e+00,
+    +2.595782e+00, +8.245152e+00, +4.643501e+00, -4.412720e+00, -3.079962e+01, -3.607733e+00, -2.707393e+00, +1.465708e+01, +4.549212e+00,
+    -1.331891e+00, -1.589772e+01, -1.331321e+01, +1.390641e+00, -1.110963e+01, +4.265681e+01, +5.272043e+00, -7.595238e+00, +1.816667e+01,
+    -1.157418e+01, +2.604363e+00, +6.018901e+00, -2.451131e+00, +6.167120e+00, +1.807509e+00, -3.328012e+00, +4.102894e+00, +4.356608e-01,
+    //09
+    -2.105207e+00, -1.564835e+01, -1.555114e-02, +5.492520e+00, +3.576193e+01, +7.442231e+00, -6.865192e+00, -4.310621e+01, -9.653158e+00,
+    -1.320736e+00, +6.817549e+00, +1.764986e+00, +2.441412e+00, -3.333768e+01, -1.214429e+01, +1.297260e+00, +2.034220e+01, +1.661871e+01,
+    +3.816971e+00, -5.325902e+00, +6.470806e-01, +6.302825e+00, -2.165451e+01, +5.316062e+01, +1.118783e+01, -1.165145e+01, +3.684874e+01,
+    -4.511900e+00, -1.435315e+01, -9.468383e+00, +1.697914e+01, +6.053878e+01, +2.247516e+01, -5.560677e+00, -1.281730e+01, -4.487937e+00,
+    -6.895844e+00, -5.884801e+00, +4.392429e+00, -5.685937e+00, +4.396754e+00, +1.302363e+01, -8.478456e+00, +1.077551e+01, +6.501444e+00,
+    +1.170726e+01, +4.049180e+00, +4.811100e+00, -5.750158e+00, -2.446704e+01, +1.771858e+00, +7.595315e+00, -3.358310e+00, -4.134006e+00,
+    +2.629399e+00, -2.141762e+00, -4.267735e-01, +3.408480e+01, -4.191776e+01, +1.306703e+01, +9.290422e+00, -9.480436e+00, +7.749330e-01,
+    -3.383328e+00, +3.862596e+00, +9.301575e-02, -3.077831e+00, +1.730152e+01, -3.224915e+00, -2.183374e+01, +2.483126e+01, -1.355698e+01,
+    -6.551271e+00, +9.897355e+00, -5.131394e+00, -5.186653e+01, +1.617105e+01, +6.810748e+00, -3.388390e+01, +1.801758e+01, -5.092015e-01,
+    -2.449564e+00, +1.602485e+00, -2.604249e+00, -4.710608e-03, -1.977767e+00, -3.480968e+00, -1.214331e+00, +3.688011e+00, +5.139740e+00,
+    +1.460060e+00, +3.356487e+01, +4.251839e+00, -7.368241e+00, -3.699060e+01, -5.082734e-01, -2.672135e+00, +6.394366e+00, -3.922687e+00,
+    +1.817692e+00, -2.277584e+00, +2.263874e+00, -4.898741e+00, +1.630794e+01, +5.928268e+00, +1.878585e+01, -2.037546e+01, -3.297486e+01,
+    -1.849788e-01, -4.278068e-01, -5.513033e+00, -1.273775e+01, +3.413117e+01, -3.203397e+01, -1.804711e+00, +5.062586e+00, -9.928006e+00,
+    +1.496204e+00, +1.127308e+01, +6.341052e+00, -7.244145e+00, -1.005104e+01, -1.664527e+01, -3.580745e+00, +1.771273e+01, +1.149078e+00,
+    +1.181022e-01, -4.931041e+00, -1.830234e+01, +7.161277e+00, -2.170117e+01, +4.639859e+01, +2.731535e+00, -7.859862e+00, +1.813308e+01,
+    -5.883794e+00, +5.568900e+00, -4.837273e+00, +4.850940e+00, +1.325469e+01, -6.919473e+00, +4.218823e+00, -1.511896e-01, +2.618644e+00,
+};
+
+/* --------------------------------- x4 --------------------------------- */
+
+/* The 32 cell bias in the first layer */
+const ESPCNBias1 espcn_x4_biases1 = \
+{
+    -4.345300e-02, +4.329893e-01, +1.234825e-02, -2.696842e-02, +4.068073e-01, +1.028981e-01, +2.423954e-01, +8.056891e-03,
+    -3.994498e-02, +2.295002e-01, +2.011623e-01, -4.007098e-02, +1.034437e-01, +1.311161e-01, -1.343708e-03, +6.542558e-02,
+    +1.409045e-01, -1.121722e-01, -6.624388e-02, +1.944553e-01, -6.448403e-02, +1.118772e-01, +1.629444e-01, +2.976902e-01,
+    +2.530145e-01, -2.557579e-03, +4.356576e-02, -1.468639e-02, -1.025581e-01, -3.195538e-01, -2.067247e-01, +3.851560e-02,
+};
+
+/* The 32 convolutional kernel(5*5) in the first layer */
+const ESPCNKernel1 espcn_x4_weights1 = \
+{
+    //01
+    +4.577965e-04, -7.755493e-04, -1.197088e-04, -1.624117e-04, +3.923850e-04,
+    +7.546592e-04, +8.130521e-04, +1.089577e-03, -4.574674e-04, -1.695641e-03,
+    -1.238991e-03, -2.200230e-03, +6.565740e-04, +3.689394e-03, +2.231304e-04,
+    -3.875145e-04, +1.790341e-03, -2.215395e-03, -4.289327e-04, +1.098871e-03,
+    -1.716436e-04, +6.495714e-04, +2.293338e-04, -6.527673e-04, +7.420610e-05,
+    //02
+    -9.987496e-06, +6.939364e-04, +1.207797e-03, -7.483817e-04, +1.757982e-04,
+    -8.426791e-04, -1.608914e-03, -2.368696e-03, +1.079809e-04, +5.575877e-04,
+    +1.470438e-03, -4.468275e-04, +7.939643e-04, -1.177552e-03, +7.332748e-04,
+    -2.085746e-04, -1.241034e-03, +1.330049e-03, -1.026903e-03, +3.172446e-04,
+    +5.547025e-04, +1.424141e-05, -1.250670e-04, +2.119241e-04, -6.940386e-04,
+    //03
+    +9.764169e-04, -2.043668e-03, +1.203998e-03, +4.115033e-04, -6.020598e-04,
+    +1.014614e-03, -2.826307e-04, +4.358777e-04, -1.056033e-03, -3.948148e-04,
+    +1.122693e-03, +2.866604e-04, +9.691540e-04, -1.399897e-03, +2.089033e-03,
+    -3.425481e-04, +2.249169e-04, -8.217030e-04, -1.013711e-05, -9.265023e-04,
+    -4.430636e-04, +7.987814e-04, -2.764455e-04, -4.992230e-04, +1.046510e-03,
+    //04
+    +9.992292e-04, -2.779829e-04, +4.567924e-04, +7.758530e-05, -5.438886e-04,
+    -8.414668e-04, +2.136913e-03, +3.301503e-04, -8.663771e-04, +1.435635e-03,
+    -1.739475e-03, -1.753453e-04, -2.071538e-04, -1.331331e-03, +8.497069e-04,
+    -9.578679e-04, +8.913703e-04, -4.634445e-04, +9.113449e-04, -5.441831e-04,
+    +1.217617e-03, -1.057943e-03, +3.869084e-04, +1.056442e-03, +2.511036e-04,
+    //05
+    -8.408959e-05, -1.225941e-03, +1.176625e-05, -2.083834e-04, +4.607687e-04,
+    +2.541443e-04, +1.493790e-03, -1.163687e-04, +5.024042e-04, -6.562024e-04,
+    +1.697883e-04, -6.996061e-04, -2.040195e-05, -3.399502e-04, +6.606162e-04,
+    +1.073953e-03, -3.642447e-03, -1.772598e-03, +1.334462e-03, -5.035320e-04,
+    +4.933841e-04, -6.017555e-04, +4.050607e-04, -2.178314e-04, +3.194040e-04,
+    //06
+    +8.163367e-05, -8.268056e-04, +3.462797e-04, -6.410158e-04, +1.552797e-03,
+    +6.762304e-04, +4.571701e-04, -4.091885e-04, -1.595246e-03, +1.022883e-03,
+    -9.730452e-04, +1.231029e-03, +3.557859e-04, +6.860349e-04, -1.176862e-03,
+    -7.993748e-04, +1.807013e-04, +5.329535e-04, -1.543902e-03, +2.620566e-04,
+    +5.813363e-04, +8.346368e-04, +9.431475e-04, -8.560007e-04, -1.345609e-04,
+    //07
+    +6.947090e-04, -7.124298e-04, -3.119056e-04, -8.331408e-04, +5.302337e-04,
+    -1.379546e-03, +1.595646e-03, +6.400611e-04, +1.104382e-03, -1.292299e-03,
+    +1.250542e-03, -2.592272e-03, +3.588492e-04, -1.952144e-03, +2.081941e-03,
+    +2.579883e-04, -1.547419e-03, +3.138976e-03, -1.965069e-03, +5.555183e-04,
+    +5.051488e-04, -1.405306e-06, +1.459178e-04, +5.213906e-04, -1.271890e-03,
+    //08
+    +8.352824e-04, +2.544313e-04, -1.545058e-03, +9.454638e-04, +2.927289e-04,
+    -1.089559e-03, -8.064160e-05, +1.972468e-03, +6.025453e-05, -7.848862e-04,
+    +4.733756e-04, +7.001365e-04, +2.179938e-03, +2.161907e-03, +2.021496e-04,
+    -9.823075e-04, -9.082857e-04, -1.976343e-03, -3.180179e-04, -1.332002e-03,
+    +6.184843e-04, -7.580301e-04, +1.487418e-03, -1.540260e-03, +2.914495e-04,
+    //09
+    +2.419204e-04, -8.850119e-04, +6.498765e-04, -7.719811e-04, +7.194620e-06,
+    -1.036120e-03, +1.463720e-03, +7.519246e-04, +5.837982e-04, +7.254094e-04,
+    +2.766056e-04, -2.957543e-05, -5.911769e-04, -2.071046e-04, -1.272240e-03,
+    +3.053351e-04, +1.302817e-04, +1.572140e-03, +1.092564e-03, -2.348108e-04,
+    +1.104446e-04, -6.144871e-04, -1.018292e-03, -7.697856e-04, +6.939588e-04,
+    //10
+    +7.326152e-04, -8.001956e-05, -3.914506e-04, +2.827891e-04, -8.591894e-05,
+    -1.190283e-03, +8.976416e-05, -9.786011e-04, -1.045901e-04, -7.674217e-04,
+    -1.040110e-04, +1.044638e-03, +2.120771e-03, -1.648792e-03, +1.947771e-03,
+    +3.599294e-04, -4.140656e-04, -6.735796e-04, +2.138069e-03, -4.864434e-04,
+    +6.173872e-04, -3.929010e-04, -2.548684e-04, -1.629322e-03, -1.568308e-04,
+    //11
+    -7.253850e-05, +9.327745e-04, +2.554185e-04, +1.675732e-05, -1.646200e-04,
+    +6.672296e-04, +1.405539e-03, -1.980725e-03, +5.479466e-04, -2.062463e-03,
+    -9.660296e-04, -7.755492e-04, +3.057291e-04, -3.387692e-04, +1.331223e-03,
+    +1.613259e-03, +3.253284e-04, -1.199617e-03, +6.117830e-04, -1.161238e-03,
+    -4.187521e-04, -1.656879e-03, +1.467977e-03, -5.586770e-04, +8.287004e-04,
+    //12
+    +4.443748e-04, -7.177680e-04, +2.589853e-04, +4.382798e-04, -3.518228e-04,
+    -3.795317e-04, -9.992296e-04, -2.685661e-04, +1.884952e-04, +8.730527e-04,
+    +1.552120e-03, -5.027137e-03, +1.294939e-03, +1.173535e-03, -7.744626e-04,
+    -6.540431e-04, -1.969459e-03, +2.135764e-03, +3.733970e-04, +5.660902e-05,
+    +4.843812e-04, +1.692667e-04, +2.988821e-04, -5.439148e-04, +3.735157e-04,
+    //13
+    +6.956939e-04, +2.075957e-04, -1.252189e-03, +5.015020e-04, +2.749849e-04,
+    -7.888584e-04, -2.991256e-04, -1.157513e-03, +1.818382e-04, +8.328342e-04,
+    +1.137490e-03, +7.945140e-04, -2.019292e-03, +2.451976e-04, +6.041814e-04,
+    -2.042914e-03, -8.193423e-04, +2.161630e-03, -3.515129e-03, -8.336919e-05,
+    -4.741373e-05, -5.328675e-05, +2.996077e-03, -1.162513e-03, +6.695515e-04,
+    //14
+    +7.598563e-04, +4.809563e-04, -2.761700e-05, +1.546931e-03, +7.076532e-04,
+    -3.312858e-05, -8.074583e-05, +1.649220e-03, -1.441680e-03, +6.778944e-04,
+    -2.341183e-03, +6.743239e-04, +9.490895e-04, -2.911544e-03, -2.021419e-04,
+    -5.264579e-03, +2.450743e-03, +1.390088e-03, -3.553726e-03, +1.148425e-03,
+    -2.206575e-03, +2.355672e-04, +2.825100e-05, -1.469170e-03, -1.013846e-03,
+    //15
+    +7.759329e-04, -6.706404e-04, -8.872787e-04, +9.385814e-04, +2.270131e-04,
+    -3.359466e-04, +1.342724e-03, -1.337833e-03, -9.268747e-04, -4.258414e-04,
+    -7.702079e-05, -1.944593e-03, +2.161122e-03, +4.982568e-04, +5.511833e-04,
+    +8.263432e-04, -1.457847e-03, +1.980657e-03, -1.021951e-03, -5.539050e-04,
+    +6.007836e-04, -9.381008e-05, -8.711486e-04, -1.572752e-04, +9.255662e-04,
+    //16
+    +4.954834e-04, +7.193451e-04, +4.088292e-04, +1.099262e-03, -4.494469e-04,
+    +6.341883e-04, +6.022233e-04, +1.502377e-03, -1.799878e-03, +1.420853e-04,
+    -8.678966e-05, -2.466063e-04, +2.813773e-04, -1.170278e-04, -2.512951e-05,
+    +4.367306e-04, -2.744976e-04, -1.021521e-03, +1.169738e-04, -9.100036e-04,
+    -2.406890e-04, -1.920943e-04, +2.507312e-03, -1.934679e-03, -5.463274e-04,
+    //17
+    +1.905840e-04, -4.211044e-04, +2.977021e-04, +3.702119e-04, -7.178793e-04,
+    +6.228432e-04, -3.522605e-04, +2.764517e-04, -1.411663e-03, +5.268997e-04,
+    +1.081857e-03, -2.216213e-03, +2.659873e-03, +1.199047e-04, +3.826725e-04,
+    -5.322043e-04, +1.346052e-03, -3.345124e-04, -1.465665e-03, +1.059432e-03,
+    -1.431871e-04, -9.945532e-04, -1.901964e-04, +4.300592e-05, +3.599882e-04,
+    //18
+    -1.772002e-04, -1.046734e-03, +3.234460e-03, +1.047469e-03, +2.730606e-03,
+    -7.176355e-04, -1.549754e-03, -5.280989e-05, -1.954441e-03, -2.498551e-03,
+    -2.110490e-04, +3.178925e-04, +4.784461e-04, -5.947825e-04, +7.065164e-04,
+    -3.731695e-04, +2.017376e-04, +9.148738e-04, -6.869849e-05, +1.203849e-03,
+    -3.414522e-04, -7.337471e-05, +1.905692e-04, +3.775667e-04, +5.398725e-04,
+    //19
+    +1.669922e-04, -9.370956e-04, +2.937694e-04, -9.312817e-04, -4.891445e-05,
+    -2.429271e-04, +2.638875e-03, +2.870367e-03, +1.561585e-03, +8.473385e-05,
+    +1.647364e-04, -1.876421e-03, -5.673964e-03, +1.054671e-04, +2.427267e-05,
+    -1.693621e-04, +8.198411e-04, +5.857122e-04, -2.308952e-04, +4.553032e-04,
+    -1.454251e-04, -2.706913e-04, +7.895615e-04, -4.510496e-04, -7.254420e-05,
+    //20
+    -1.100977e-03, +1.803590e-04, +3.018782e-04, +6.799395e-04, +6.979014e-04,
+    -1.066308e-03, +1.793224e-03, -1.730383e-03, +1.241727e-03, -2.534684e-04,
+    +9.182765e-04, -1.904563e-03, +5.756763e-04, +3.596319e-04, -2.915897e-04,
+    -1.305183e-03, +8.686369e-04, -1.132276e-03, +7.228931e-04, +2.156396e-04,
+    +1.936459e-04, -5.118745e-04, +7.281624e-04, -3.940676e-05, -5.120061e-05,
+    //21
+    +7.173931e-04, -6.229066e-04, +2.596844e-04, +1.425858e-03, -3.062974e-04,
+    -2.857176e-03, +6.729465e-04, -1.452136e-03, +6.888861e-04, -1.593792e-03,
+    -2.441269e-03, +7.476162e-05, +8.000238e-04, +4.703455e-04, -2.071497e-04,
+    -1.164681e-03, +1.945734e-04, +1.657140e-03, +1.500209e-03, +2.450325e-03,
+    -4.735650e-04, -9.255706e-04, -1.794742e-04, +5.658286e-04, -1.927657e-03,
+    //22
+    +7.942192e-04, -1.070003e-03, +3.621714e-04, +2.019169e-04, -6.825003e-04,
+    -3.450791e-04, +1.599056e-03, -3.144234e-04, +2.868407e-05, +2.252422e-05,
+    -2.531566e-04, -1.693553e-03, +6.079205e-04, +5.871656e-04, -7.744674e-04,
+    +1.315449e-03, +2.138325e-04, +2.698753e-03, -9.085956e-04, -2.378876e-03,
+    +1.939145e-04, -7.152553e-04, +1.103660e-03, +4.482285e-04, -1.417986e-03,
+    //23
+    +8.750171e-05, -5.849284e-04, -5.155548e-04, +4.605011e-04, -8.624579e-04,
+    +9.628513e-04, -8.230121e-04, +1.170054e-03, +1.303663e-03, -6.276196e-05,
+    -1.289562e-03, -9.052107e-04, -2.079999e-03, +5.571517e-04, -1.841320e-03,
+    -4.577384e-04, +2.033145e-04, -1.928252e-04, +2.014993e-03, +3.931474e-04,
+    +7.463886e-04, +5.211458e-05, +1.641261e-03, -1.548542e-03, +9.558216e-04,
+    //24
+    -1.099237e-03, +3.272489e-04, +5.813485e-05, -1.287038e-03, +1.317206e-03,
+    +1.304259e-03, +5.360641e-04, -8.263466e-04, +1.883034e-03, -9.100915e-04,
+    +1.156515e-03, -2.302529e-03, +3.884452e-04, -1.747325e-03, +6.489487e-04,
+    -6.711708e-04, +3.632737e-04, -4.107651e-04, +3.072090e-03, -5.019203e-04,
+    -7.103257e-04, +1.149403e-03, -8.017144e-04, -2.046958e-03, +7.155962e-04,
+    //25
+    +2.692865e-04, +2.887058e-04, +1.124785e-03, +8.741222e-04, -6.436902e-05,
+    -1.877234e-04, +1.301505e-04, -5.454983e-04, -3.301410e-03, +3.946722e-04,
+    -2.664119e-04, -1.770787e-03, +9.193375e-04, +7.294148e-04, -6.987079e-04,
+    -5.978448e-04, +1.706194e-03, -1.143567e-04, -1.100383e-03, +6.525089e-04,
+    -1.191969e-06, +7.673651e-04, -3.930961e-04, +6.751188e-04, +5.745767e-04,
+    //26
+    -9.576945e-04, +5.070759e-04, -1.094671e-03, -1.250442e-03, +1.735039e-03,
+    +1.798635e-03, +1.521431e-03, -1.770218e-04, +4.876282e-04, -1.907700e-03,
+    -3.972222e-04, +8.211949e-04, -1.029176e-03, -1.463584e-03, +9.905981e-04,
+    +6.386375e-04, -2.484493e-04, +7.073262e-04, +7.623799e-04, -1.090720e-03,
+    -2.900137e-04, -6.131741e-04, +5.060064e-04, +1.256446e-04, +2.615976e-04,
+    //27
+    +2.844133e-04, +1.553749e-03, -9.660364e-04, +1.670887e-03, +1.284113e-03,
+    +9.072793e-04, -1.409637e-04, +7.785049e-04, +1.382339e-04, -2.990816e-04,
+    -8.653422e-04, -1.600287e-03, -1.317538e-03, -1.429355e-03, -8.613873e-04,
+    +5.358510e-05, -6.723397e-04, +2.614566e-03, -1.819898e-04, +3.630887e-04,
+    -6.567499e-04, -1.398560e-03, +7.152283e-04, -1.767711e-03, -7.274625e-04,
+    //28
+    -6.731524e-04, +8.756656e-04, -8.313839e-04, +6.947437e-04, -5.489573e-04,
+    +5.188128e-04, -9.076774e-04, -7.050861e-04, +2.001170e-03, -2.025025e-03,
+    -3.947781e-04, +6.836597e-04, +1.480966e-03, +3.229185e-03, -1.357290e-03,
+    +4.778529e-06, -4.358030e-04, -2.097305e-03, -4.562325e-04, -1.805696e-04,
+    -1.519447e-04, +7.039726e-04, -1.605990e-04, +1.209873e-03, -1.021988e-03,
+    //29
+    -4.347734e-05, -3.118867e-05, +1.239335e-03, -4.936194e-04, +6.354080e-04,
+    +9.564141e-04, -1.032214e-03, +8.358979e-04, +3.995444e-04, -4.623536e-04,
+    -6.530628e-05, +2.513525e-03, -4.951048e-03, -7.079015e-04, +4.785841e-04,
+    +2.706233e-04, +2.090353e-03, -4.755809e-03, -8.440229e-04, +5.544028e-04,
+    +6.691906e-04, -2.197093e-04, +6.398567e-04, +1.353066e-03, -6.585161e-04,
+    //30
+    +1.091982e-03, +2.816230e-04, -1.320289e-04, +1.933073e-04, +7.157503e-04,
+    +3.177659e-04, +2.463919e-03, +1.842524e-03, -1.925678e-04, -1.459481e-04,
+    +2.440426e-04, +3.834964e-04, +1.301740e-03, -3.437934e-04, +9.710490e-05,
+    -5.163762e-04, -6.579596e-03, -3.550694e-03, +5.406211e-04, +1.375259e-04,
+    -3.419041e-04, +8.317755e-04, +9.814371e-04, -1.258011e-04, -3.419149e-04,
+    //31
+    -8.804400e-04, +4.984883e-04, -2.605749e-05, -1.647434e-03, -6.588412e-05,
+    -1.073639e-05, +3.529739e-04, -3.268940e-03, +3.962876e-04, +1.600653e-03,
+    +6.239522e-04, +1.432165e-03, +1.234161e-03, +2.038042e-03, -2.657730e-04,
+    -1.057726e-04, -3.949046e-05, +1.677242e-03, -1.343317e-03, +5.116736e-04,
+    +1.265833e-05, -4.166584e-04, -4.161382e-06, +1.522736e-04, -2.772449e-04,
+    //32
+    +1.044593e-03, -1.117426e-03, -4.197146e-05, +5.691764e-04, +1.007213e-03,
+    +1.617589e-04, -9.682277e-04, +8.776248e-04, -1.707611e-03, +5.971328e-04,
+    +3.478141e-04, -1.674777e-03, +1.746617e-03, -7.029451e-04, -2.115585e-04,
+    +1.132391e-03, -1.313414e-03, +1.219183e-04, -6.067929e-04, +1.990517e-03,
+    +2.055529e-04, -2.163431e-04, +4.115151e-04, -3.309573e-05, -3.138402e-04,
+};
+
+/* The 16 cell bias in the second layer */
+const ESPCNBias2 espcn_x4_biases2 = \
+{
+    -1.725800e-02, -2.772625e-02, -2.855830e-02, -3.052040e-02, +1.668554e-01, -6.306369e-02, +2.723217e-02, +1.699502e-02,
+    -2.631047e-02, +1.259039e-01, +3.297801e-02, +3.376826e-02, +8.948768e-02, +1.404376e-03, -1.057629e-01, -5.076482e-02,
+};
+
+/* The 16 x 32 convolutional kernel(3*3) in the second layer */
+const ESPCNKernel2 espcn_x4_weights2 = \
+{
+    //01
+    +2.363342e-02, -1.097893e-01, -1.778085e-01, -1.361759e-02, +1.706984e-01, +1.162174e-01, -1.227364e-02, -1.632416e-01, -1.858564e-01,
+    -1.629002e-02, +1.022203e-01, +3.319883e-02, -1.138842e-01, +8.632048e-02, -3.273311e-02, +2.939177e-02, -1.931559e-01, -1.278175e-01,
+    -1.752442e-02, -1.318102e-01, -9.025793e-02, +1.791430e-02, -7.269285e-02, +5.044442e-02, -1.620403e-01, +7.917212e-02, -5.390012e-02,
+    +5.156220e-02, +7.614988e-02, -4.401787e-02, +2.418999e-02, +2.123330e-02, +4.447430e-03, -9.410759e-02, +4.440299e-02, -1.153834e-01,
+    +1.268228e-01, +1.369477e-01, +5.372586e-02, +3.576414e-02, -2.469003e-02, -2.469694e-02, -1.664561e-02, -7.233562e-02, -9.166607e-02,
+    -5.725135e-02, +6.984098e-03, +1.529581e-01, -9.021400e-03, +3.184436e-02, +1.094887e-01, +5.964457e-02, +1.171392e-01, +1.688295e-01,
+    +1.178778e-01, -1.758949e-02, -1.340976e-01, -3.202779e-03, -6.834671e-02, -1.392077e-01, -1.095028e-01, -9.603924e-03, -4.392665e-02,
+    -4.826087e-02, -9.424527e-02, +2.613610e-02, -3.509137e-02, -1.135664e-03, +8.102719e-02, +6.717094e-02, +6.528827e-02, -5.080973e-02,
+    -1.311043e-01, -1.048986e-01, -1.671296e-01, -5.852287e-02, -1.538339e-01, -7.257093e-02, +7.675493e-02, -1.587991e-01, -1.915067e-01,
+    -1.670373e-02, -1.874822e-01, -1.477356e-01, +3.339487e-02, -1.082571e-01, -1.345579e-01, -1.660117e-01, -1.039241e-01, -3.182388e-02,
+    +1.032514e-02, -1.326195e-01, +6.126108e-02, -1.029175e-01, -6.489260e-02, -1.157263e-01, +1.500946e-01, +4.405283e-03, -4.302455e-02,
+    -2.222467e-02, -1.330303e-01, +1.035763e-02, +5.749260e-02, -4.797037e-02, +4.587607e-02, +8.056697e-02, -7.996322e-02, -1.729683e-01,
+    -1.716430e-02, -9.002600e-02, -6.181801e-03, -1.063474e-01, +1.199187e-01, +5.482649e-02, -4.721153e-02, +1.299378e-02, -8.419108e-02,
+    +7.621969e-03, +1.409003e-01, -1.704939e-01, +8.119631e-03, +7.612880e-02, -8.686835e-02, -3.302660e-02, +1.976841e-02, +2.017341e-01,
+    -3.059269e-02, -9.523242e-02, -7.372592e-02, +1.404040e-02, +4.225940e-02, -2.170921e-01, +1.761279e-02, -5.677516e-02, -1.231372e-02,
+    +5.841010e-02, +1.552222e-01, -1.609390e-01, -2.855937e-02, +1.130165e-01, +3.390126e-02, -1.167288e-01, -9.297796e-02, -9.567188e-03,
+    +4.817481e-02, -1.198103e-01, -8.586727e-02, +8.214623e-02, -4.302926e-02, +8.609843e-04, -8.869280e-02, +3.309247e-02, -9.978884e-02,
+    +3.681567e-02, +9.218959e-03, -1.842727e-02, -5.837782e-02, -1.479089e-01, -5.657299e-02, -6.779659e-02, -4.972251e-03, -1.742062e-02,
+    +6.281687e-02, +9.224870e-02, +2.517427e-02, -1.099727e-01, +3.990844e-02, -1.285482e-01, +6.817321e-02, +7.398539e-02, -5.637342e-02,
+    -1.348796e-01, -4.570642e-02, +1.530148e-01, -1.233194e-01, -4.641681e-02, -1.142468e-01, -3.863935e-02, -1.117222e-01, -9.831745e-02,
+    +1.009310e-01, +2.949151e-02, -7.343023e-02, -6.459647e-02, +9.478896e-02, -2.376355e-02, +6.107655e-02, +7.427851e-03, +9.367868e-02,
+    +5.102905e-02, -9.954420e-02, +1.261229e-02, -5.564579e-02, +5.779670e-02, +1.624765e-01, +1.407749e-01, +5.812801e-02, +4.090938e-02,
+    +5.021036e-02, +2.136872e-02, -1.287113e-01, -3.156802e-02, +1.599814e-01, -1.387843e-01, -1.800557e-02, +6.319529e-02, -1.472422e-01,
+    -1.308596e-01, -9.783722e-02, -1.527092e-01, -5.603069e-02, -1.102832e-01, -1.446396e-02, -6.755788e-02, -1.226114e-01, -9.534473e-02,
+    -5.474205e-02, -7.429272e-02, +4.164541e-02, -4.732134e-02, -8.697627e-02, -1.052166e-01, -5.870321e-02, +7.671933e-02, -1.111875e-01,
+    -2.734831e-01, +7.245418e-02, +1.082697e-01, +2.825256e-02, +2.045427e-02, +1.394303e-02, -1.367683e-01, +6.828558e-02, -1.493985e-02,
+    +1.904109e-02, -1.585581e-01, -6.269317e-02, -8.079095e-03, -4.234335e-02, +3.548123e-02, +4.020021e-02, -6.625827e-02, -7.537216e-02,
+    +7.059666e-03, +8.700691e-02, -1.957763e-02, -6.093488e-02, -1.456770e-01, -4.850469e-02, +2.951761e-02, +4.819845e-02, +3.131615e-02,
+    -1.492892e-01, -4.054859e-03, +4.465420e-02, +1.143093e-01, +1.545786e-01, -1.355677e-02, -1.297511e-01, -1.002725e-01, +7.102074e-02,
+    -1.589274e-02, -5.465405e-02, +3.563667e-02, -1.701735e-01, +1.933957e-02, +3.055247e-02, +3.460658e-02, +1.308977e-01, -1.322226e-01,
+    +2.265836e-02, -9.994928e-02, +2.794209e-02, -1.448772e-01, -1.360657e-02, -5.403975e-02, -3.557720e-02, +2.264012e-02, -8.875156e-02,
+    -5.207966e-02, +6.266324e-02, -1.235838e-01, -1.851469e-01, -5.126865e-02, -1.030071e-01, +1.126838e-01, -1.015255e-01, -1.399170e-01,
+    //02
+    -1.169802e-01, +1.663961e-03, -9.265548e-02, -2.179674e-01, -1.778047e-01, +3.327141e-01, +1.328909e-01, -3.828489e-03, +2.695250e-02,
+    -1.618026e-02, -1.923108e-01, +3.537692e-02, +5.953538e-02, -2.939395e-01, +2.125816e-01, -1.578234e-02, +5.091291e-02, +9.578897e-02,
+    +1.015764e-01, +3.029219e-02, -8.206849e-02, -8.089409e-02, -1.363465e-01, +4.055842e-02, +3.229048e-02, -1.322327e-01, +4.270607e-02,
+    -1.803008e-01, +1.776300e-01, +4.050092e-02, +3.952683e-02, -2.537099e-02, -2.194282e-01, -1.234189e-02, -9.701838e-02, +2.521337e-01,
+    +3.304843e-01, -5.941927e-01, +2.998423e-01, +4.130819e-01, -1.019749e+00, +3.793340e-01, -1.057340e-01, +6.518349e-02, -3.650515e-02,
+    -8.729915e-02, -7.914806e-02, +1.965850e-01, +7.105532e-03, -1.698632e-01, +2.720155e-01, -2.107893e-02, -1.497711e-01, +4.881734e-02,
+    -2.269506e-02, -2.018663e-01, +1.134548e-01, +1.840926e-01, -4.061563e-01, +3.146178e-01, +1.434610e-01, -2.614090e-01, +1.241427e-01,
+    +6.481294e-02, -1.827346e-01, -2.620683e-02, -2.211669e-03, -3.097538e-02, -2.201782e-01, +3.189452e-02, -7.992274e-02, +9.974112e-02,
+    -1.518990e-01, +1.438422e-01, -2.654819e-02, -5.337979e-02, +4.855094e-02, +1.253569e-01, -7.443476e-02, +3.005291e-02, -3.789357e-02,
+    +1.625578e-01, +4.802624e-02, -7.483138e-04, -1.607472e-01, -4.111927e-02, -1.487850e-01, +1.588692e-01, -1.642998e-01, +1.781337e-03,
+    +3.766079e-02, -2.417734e-02, +1.702672e-01, -6.336829e-03, +3.201592e-01, -1.298219e-03, -1.093545e-01, +1.658729e-02, +1.255658e-01,
+    -1.807956e-01, +1.937461e-01, -3.622430e-01, +2.980092e-01, -1.295283e+00, +4.937795e-01, +7.017230e-01, -3.755299e+00, +3.049715e-01,
+    +2.077691e-01, +2.189279e-01, -4.900822e-01, +1.374864e-01, +1.506331e-01, -1.654772e-01, -3.173498e-01, -1.757808e-01, -5.419393e-02,
+    -2.075246e-01, -2.821628e-02, -1.727675e+00, -5.276587e-02, -9.780649e-02, -8.035522e-01, -3.274915e-02, +6.517602e-02, -1.694820e+00,
+    +6.532560e-02, +1.074575e-01, -1.220548e-01, -3.266571e-01, -2.730038e-01, +1.183495e-01, +6.237504e-02, -3.096950e-01, +1.076771e-01,
+    -1.125614e-02, -2.017924e-01, +4.504036e-02, -1.046274e-01, +2.133415e-01, +2.644699e-02, +1.085538e-01, +1.056162e-02, -4.013298e-02,
+    +7.948483e-02, -7.672983e-02, -7.234785e-02, +4.919762e-02, +2.331113e-02, +1.733645e-01, -9.720058e-02, -1.380646e-01, +2.045167e-02,
+    +8.577309e-02, -2.023957e-01, +5.864789e-02, -1.691371e-02, -1.145195e-02, +9.121957e-02, +2.468301e-02, +3.590162e-02, -3.606207e-02,
+    -9.362860e-02, +3.881684e-02, -1.174276e-01, -2.477573e-01, -4.189051e-02, -1.089331e-01, -5.096838e-01, +4.700265e-01, -1.969050e-01,
+    +5.021580e-02, +8.931037e-02, +1.131231e-01, +6.953875e-02, -1.382978e-02, -1.704423e-01, +7.830290e-02, -1.617258e-02, -3.237625e-02,
+    +1.953115e-01, +1.866543e-01, -5.612532e-02, -3.492634e-01, +5.595955e-01, +3.588921e-01, -1.689507e-01, +1.920515e-01, -2.145216e+00,
+    +1.731010e-01, -1.547012e-01, +1.549521e-01, +2.524288e-01, -1.015032e-01, -2.240338e-02, +1.069291e-01, -1.086251e-01, +7.657060e-02,
+    +3.352068e-02, -1.251573e-01, -3.402390e-02, -6.360734e-02, -8.436365e-02, +1.845131e-02, +1.020445e-01, -1.497626e-01, -4.750085e-02,
+    +1.687842e-01, +3.738824e-02, +6.704308e-02, -1.008173e-01, -1.276840e-01, +1.595414e-01, -1.283983e-01, -1.467595e-01, +9.625672e-02,
+    -4.679976e-03, -1.851208e-01, -1.308925e-01, +8.505570e-02, -2.548513e-01, +4.071157e-02, +1.765791e-02, -1.912688e-01, +2.180644e-01,
+    -7.197449e-02, -1.088098e-01, -2.533531e-02, +1.093497e-01, +1.256232e-02, -2.124806e-01, +1.878552e-01, -1.662747e-01, +1.538154e-01,
+    +2.815940e-01, -2.335856e-01, +2.733361e-01, +6.702807e-02, +1.113866e-01, -1.356403e-01, +1.280326e-01, -1.064004e-01, +1.141138e-03,
+    -2.730369e-01, -6.854714e-02, +1.466639e-01, +3.344478e-01, -2.042350e-01, +5.502545e-02, -6.650908e-02, +1.527283e-01, -1.147802e-02,
+    +1.711681e-01, +6.864135e-02, -9.602934e-03, -2.335099e+00, +1.281427e-01, -3.208718e-01, -3.126458e-02, +2.197918e-01, -2.511939e-01,
+    -1.137175e-01, -1.978695e-02, +3.839172e-02, +4.494866e-02, -5.498197e-04, +1.906996e-01, -6.160587e-03, +1.278956e-01, -8.548579e-02,
+    -1.958282e-01, -4.553050e-02, +1.746939e-01, -3.909587e-02, -1.644980e-03, +1.244982e-01, +3.305431e-01, -1.890814e-01, -2.791679e-02,
+    -1.159580e-01, +2.241305e-01, -2.467563e-02, -1.543263e-01, +3.379597e-01, -6.288351e-02, -1.865045e-01, +4.976588e-01, -5.991192e-03,
+    //03
+    -1.173661e-01, +9.927754e-02, -1.115920e-01, -1.342228e-01, -3.300027e-01, +2.350728e-01, +1.813233e-01, +2.421163e-02, +1.319208e-01,
+    -1.782043e-02, -2.897894e-02, -8.724123e-02, -1.544915e-02, +1.521651e-02, -9.234124e-02, -3.289446e-02, +5.472064e-02, -1.754555e-01,
+    -1.105657e-02, -2.016686e-02, +9.969764e-02, -7.121101e-02, -1.084142e-01, +1.880243e-01, +8.164175e-03, -3.813877e-02, +1.970880e-04,
+    +2.720569e-02, +8.696028e-03, -3.081605e-02, -1.740269e-01, +3.044553e-01, -8.775163e-02, +3.833642e-02, +9.062029e-02, -1.967582e-01,
+    +2.634180e-03, +9.604280e-02, -5.990987e-01, +1.911935e-02, +1.580055e-02, -5.369687e-03, +5.645528e-02, +1.793041e-01, -3.098865e-02,
+    +3.338538e-01, -5.082108e-02, -1.540289e-01, +3.049835e-02, -8.123548e-02, +5.101868e-02, -1.307393e-01, +1.000262e-02, -6.316415e-02,
+    -1.639638e-01, +7.755931e-02, +3.357288e-01, -2.539818e-01, -8.078264e-02, +1.081394e-01, +1.280917e-01, -3.261578e-02, +1.867228e-02,
+    +1.660041e-02, +1.519077e-01, -4.920573e-02, -8.970653e-02, -2.447809e-01, -1.065305e-01, +5.248747e-02, -1.833844e-01, +4.559719e-02,
+    +1.077115e-01, -1.484742e-01, +2.637268e-02, -9.928676e-04, -1.585265e-01, +3.784081e-02, +3.469324e-02, +3.208310e-02, +1.295213e-02,
+    +1.772902e-01, -8.875640e-03, -2.540562e-02, -1.674417e-01, -6.917169e-02, +5.852117e-02, +1.656094e-02, -8.165006e-02, +7.549231e-02,
+    +1.476374e-01, -2.369853e-02, +1.113905e-01, -3.774349e-02, -2.086581e-01, +1.897571e-01, +1.349874e-01, -1.547771e-01, +1.029451e-01,
+    +3.548201e-01, +4.296223e-01, -1.943239e-01, -2.264139e-01, +6.087119e-01, -8.663779e-01, +2.014334e-01, +5.380408e-02, -6.636989e-02,
+    -2.144242e-01, +2.026337e-01, +1.616663e-03, +1.271242e-01, -5.309963e-01, +1.688775e-01, -4.485167e-03, +8.574944e-02, +6.400969e-02,
+    +4.231445e-01, +2.500243e-01, +7.607760e-01, -1.722140e-01, +1.411892e-01, -4.522487e-01, +1.441635e-01, +1.036807e-01, +1.291373e-01,
+    -2.759718e-01, -9.424054e-02, +3.123046e-01, -3.427497e-01, +6.138612e-02, +4.814503e-01, -1.874672e-01, +2.480423e-01, +8.125815e-02,
+    +3.428814e-02, -9.447638e-02, -5.369521e-02, +5.345884e-02, -6.126273e-03, +4.225260e-02, +3.079762e-02, -4.176801e-02, +1.017046e-01,
+    +1.504090e-04, +7.309898e-02, +8.068237e-02, -1.555112e-01, +7.806414e-02, -4.725315e-02, +1.310827e-01, -8.983874e-02, -1.993035e-02,
+    -9.222372e-02, +2.615378e-01, +9.560782e-02, -1.605544e-01, +4.294601e-02, +8.858696e-02, -1.996311e-01, +1.326692e-01, -7.780962e-02,
+    +1.683280e-01, +4.046997e-01, -4.132530e-01, +3.412860e-01, -1.162717e+00, -4.344297e-01, -4.473138e-01, +3.122837e-01, +1.554896e-01,
+    +2.754809e-03, -1.546642e-01, -1.271992e-01, -2.060950e-01, +2.192821e-01, -5.871319e-02, +2.497982e-01, -1.205551e-01, +1.194809e-01,
+    -5.105366e-04, +2.255496e-03, +2.603644e-01, -3.506431e-02, -5.102016e-01, +3.933107e-01, -4.471399e-02, -3.072207e-01, +6.171894e-02,
+    +2.936659e-01, +9.145021e-02, -8.129716e-02, -5.546103e-04, +5.889149e-02, +1.543939e-02, +1.829593e-01, -3.119865e-02, -4.711631e-02,
+    +3.570525e-02, +1.919823e-01, -1.573494e-01, +1.718881e-01, -6.005709e-03, -1.559936e-01, -1.430944e-01, +1.519063e-01, -1.850677e-01,
+    +1.228447e-01, +1.982489e-01, -7.371604e-02, -1.886881e-01, +1.033354e-01, -9.769829e-02, -1.134337e-02, +3.911619e-02, -1.626620e-01,
+    +8.437925e-02, -1.023308e-01, -2.751853e-01, +6.302130e-02, -3.364040e-03, -1.469642e-02, +2.683624e-02, -1.127431e-01, +9.835978e-02,
+    -1.541476e-01, -5.379691e-02, +1.424519e-01, +1.395697e-01, -6.418997e-03, +7.738291e-02, -1.002167e-02, -2.412867e-01, +8.789604e-02,
+    -8.142515e-01, -9.514594e-02, -1.844131e-01, -1.855437e-02, -3.812743e-02, +3.688638e-01, -1.262505e-01, +1.062294e-01, +1.120903e-01,
+    +4.125305e-01, +2.608526e-01, +1.192024e-01, +6.655352e-01, +4.132158e-01, +2.974892e-01, +7.316052e-01, +1.724560e-01, +2.304822e-01,
+    -4.662837e-01, -1.722580e+00, +8.917869e-02, +1.007437e-01, -2.412001e-01, +3.326738e-01, -1.256053e-01, -3.688027e-02, +3.691950e-02,
+    +1.574080e-01, +1.805900e-01, -3.516545e-01, -9.501102e-02, +3.163154e-01, +1.029563e-01, +9.479576e-02, -1.573416e-01, -2.046108e-01,
+    -1.817082e-01, +9.662524e-02, +1.871259e-01, +4.344065e-02, -1.242628e-01, -3.559505e-02, -8.329002e-02, +5.613146e-02, -8.470417e-02,
+    -1.214965e-03, +1.147529e-01, +2.536067e-02, -4.301215e-02, +1.834067e-01, +4.512794e-02, -1.080890e-01, +1.433763e-01, +4.795164e-02,
+    //04
+    +5.163795e-02, -9.634592e-02, +6.614538e-02, -5.368660e-02, -3.997971e-02, -8.915915e-02, -1.050481e-01, -5.271949e-02, -1.424517e-01,
+    -4.505124e-02, +1.865820e-02, +1.069180e-01, +9.480813e-02, -9.886856e-02, -2.646420e-02, -2.795533e-01, -5.488439e-02, +6.211194e-02,
+    -1.678604e-01, +6.651872e-02, +1.056065e-01, -2.908018e-01, -4.871555e-02, -8.317696e-02, -3.760060e-02, -3.400629e-02, +4.056661e-02,
+    -5.625380e-02, -1.236140e-01, -4.050005e-02, -3.762994e-02, +1.362037e-01, +2.025842e-02, -6.109418e-02, -1.647169e-01, +1.639323e-02,
+    -8.269191e-02, -9.938221e-02, +8.541235e-02, +1.009226e-01, -1.421908e-01, -6.509156e-02, +1.860441e-01, -6.774501e-02, -1.328580e-02,
+    -3.487860e-02, +5.325194e-03, -1.033083e-01, -9.409457e-02, -1.253537e-01, +1.864681e-02, -6.383619e-02, +5.067847e-02, +2.494769e-02,
+    -1.088399e-01, -1.277438e-01, +1.727653e-01, -2.266039e-03, +3.210724e-03, +1.070221e-01, -6.176431e-02, +1.015355e-01, -1.122626e-02,
+    -1.556509e-01, -1.444227e-01, -9.267954e-02, -1.250122e-01, -4.508228e-02, -1.238347e-01, -1.117007e-01, +9.614281e-02, -6.511977e-02,
+    -1.042674e-01, +2.553277e-03, +3.964328e-02, -4.999643e-02, +1.302388e-01, -7.455509e-02, -6.174741e-02, -9.339345e-02, -7.303841e-02,
+    -9.769212e-02, -8.468862e-02, -6.990901e-02, -1.211142e-01, +1.243877e-01, +3.604577e-02, -1.496207e-01, -1.281122e-01, -2.899310e-02,
+    -9.585099e-02, -3.580685e-02, -9.939947e-02, +1.454151e-02, -1.327258e-01, -1.691272e-01, -4.144330e-02, -8.045670e-02, +2.048290e-02,
+    +1.637107e-01, +4.635841e-02, -5.215615e-02, -6.470425e-02, +1.838662e-02, -1.057439e-01, +6.344438e-02, +3.783100e-02, -9.983513e-03,
+    -3.674027e-02, +3.845749e-03, -4.915353e-02, -1.853852e-01, +6.490575e-02, +1.085141e-01, -5.022182e-02, -5.503053e-02, +7.286588e-02,
+    -1.704961e-01, +2.959431e-02, +2.661483e-02, +4.173356e-03, +5.032260e-04, -4.308669e-02, +1.063438e-01, -1.409086e-01, +1.149549e-01,
+    -2.891324e-01, -1.797333e-01, -1.066162e-01, -5.031097e-02, +8.171258e-02, -7.350774e-02, -1.345270e-01, -6.781136e-02, -6.196305e-02,
+    -1.325799e-01, -1.635109e-01, -5.046687e-02, -1.244715e-01, -1.593837e-03, +1.129639e-01, -1.258634e-01, -3.886140e-03, -7.141065e-02,
+    -5.884010e-02, -8.745970e-02, +2.688299e-02, -2.951478e-02, +3.807764e-02, +1.806916e-02, -9.762917e-02, -2.746360e-01, -6.716448e-02,
+    -7.544599e-03, +2.077505e-02, +1.307128e-01, -3.557417e-02, -2.340198e-02, -8.395746e-02, -1.194356e-01, -2.888956e-02, -1.740492e-01,
+    +1.168838e-01, -1.000988e-01, -1.902329e-01, +6.635150e-02, +4.201109e-02, +6.016525e-02, -8.795854e-02, -6.998145e-02, +1.016495e-01,
+    +6.199045e-02, +9.563770e-02, -5.796896e-02, -4.276857e-02, -5.623392e-03, -1.139155e-01, +3.502792e-02, -5.581897e-02, -4.121197e-02,
+    +4.513724e-02, -3.838100e-02, -1.451801e-01, +3.276426e-02, +1.268238e-01, +4.026287e-02, +1.209853e-01, +2.507031e-01, -6.723122e-02,
+    +6.952722e-02, -4.840308e-02, +1.045719e-01, +6.226610e-02, -1.136372e-01, +8.547413e-02, -4.695692e-02, -4.348362e-02, -5.319926e-02,
+    -1.162295e-03, -2.765084e-03, +1.524644e-02, -4.049310e-02, -7.721455e-02, -6.221896e-02, +4.157737e-02, +1.593904e-01, +3.215513e-02,
+    -1.877011e-01, +5.191632e-02, -1.270546e-01, -2.511558e-01, -1.924073e-01, +2.553642e-02, -1.261882e-01, +8.935400e-02, -6.578923e-02,
+    -2.335274e-02, +3.302479e-02, +8.611421e-02, -8.519338e-02, +2.942598e-02, -2.733174e-02, +2.901862e-02, -1.256393e-01, -5.724455e-02,
+    +9.591485e-02, +2.175012e-02, -1.720435e-02, +2.203592e-02, -3.147790e-01, -6.495513e-03, -1.772513e-01, -1.530815e-01, -4.348500e-02,
+    -1.154618e-01, -1.482760e-01, -1.628371e-01, -5.539162e-02, -4.409609e-02, -4.739456e-02, -4.281378e-02, -2.596151e-03, +7.150568e-02,
+    -1.283656e-01, +8.565034e-02, +1.531095e-02, +1.740597e-01, -6.280325e-02, -1.785221e-01, -3.386445e-02, -1.884683e-02, +1.508457e-02,
+    +6.020274e-03, -6.389300e-02, +6.515395e-02, -7.140788e-02, -3.225061e-02, +3.627878e-03, -1.156048e-01, -1.286129e-01, -2.956375e-03,
+    -4.638577e-02, -8.093466e-02, -8.469196e-02, -1.208283e-01, -5.158138e-03, -3.055907e-02, -1.606786e-02, -1.172448e-01, -3.706400e-02,
+    -1.738605e-01, -1.190474e-02, -4.079655e-02, -4.254663e-02, -1.066395e-01, -2.263109e-01, -1.048244e-01, -1.244246e-01, -1.453536e-01,
+    +5.061602e-02, -2.070280e-01, -1.073001e-01, +5.019412e-04, -1.694385e-01, +1.900226e-02, -8.415353e-03, -1.014483e-01, -5.946143e-02,
+    //05
+    -1.406124e-02, -3.997197e-02, -1.353816e-01, +3.304354e-02, -1.316455e-01, +1.232647e-01, -6.722962e-03, +4.238464e-02, -8.580000e-03,
+    -6.086489e-02, +6.320128e-02, +1.271833e-02, -3.631068e-02, -8.430805e-03, -8.816133e-03, -2.839447e-03, -1.189110e-02, +6.517100e-02,
+    -3.346991e-02, +6.112257e-02, -8.379871e-02, +9.017424e-02, +1.129469e-01, -1.447168e-01, +3.971781e-03, -1.440456e-01, -1.189963e-02,
+    +5.651405e-02, +6.731313e-02, +4.120560e-02, +2.615196e-02, -4.836239e-02, -3.800415e-02, +9.732913e-03, -4.387443e-02, -4.273676e-02,
+    +6.014526e-02, -6.031420e-02, -5.528861e-02, +9.518214e-02, -6.896058e-02, -9.662063e-02, +2.936782e-02, -3.772073e-02, +3.599215e-02,
+    +4.607961e-03, -4.525640e-02, -6.443595e-02, -2.469530e-02, +1.161932e-01, +7.276096e-02, -1.792468e-02, -1.976464e-02, +1.796706e-02,
+    -9.479441e-02, +3.255842e-01, -8.690825e-02, +3.949318e-02, -1.427221e-01, +7.831817e-03, +3.814861e-02, +1.023304e-01, -1.258681e-02,
+    +3.574014e-02, -1.033723e-01, +7.001884e-02, -1.592322e-02, +5.894353e-02, +3.833364e-02, -3.062386e-02, -6.731743e-02, +3.174975e-02,
+    +4.003961e-03, +1.398709e-02, -7.103018e-02, -4.917013e-02, -1.112985e-01, +6.616223e-02, -1.968236e-02, +1.396270e-01, -4.331275e-02,
+    -3.178784e-02, +1.382243e-01, -1.833653e-01, +1.468513e-01, +1.882999e-01, +2.407587e-01, -4.369625e-02, -1.314371e-01, +2.856181e-02,
+    +3.271181e-02, -6.761444e-02, +4.026961e-02, -1.044177e-01, +1.455499e-01, -8.423965e-03, +1.188158e-02, +2.343950e-02, -3.216073e-02,
+    -3.184963e-02, +2.927544e-02, +2.508348e-02, +8.339810e-02, +6.694385e-02, +5.608752e-02, +2.347279e-02, +5.401638e-02, -7.808974e-02,
+    -1.669037e-02, +6.770437e-02, +9.973186e-02, +3.766054e-03, +2.246273e-02, -6.236260e-02, +6.235628e-02, -9.150551e-02, -2.865831e-02,
+    +2.395866e-02, -9.363853e-03, -3.376842e-02, -6.185875e-02, -1.494882e-01, +2.506027e-02, +6.490127e-02, +4.223808e-02, +1.610807e-02,
+    +7.905267e-03, -3.129036e-02, +1.271403e-01, -2.199215e-02, +3.244804e-03, +8.887643e-02, -2.193242e-02, +5.443957e-02, +1.017827e-01,
+    -6.317902e-02, +6.641188e-02, -8.515444e-03, +6.953125e-02, -3.048684e-02, -1.028217e-01, -8.755124e-02, +9.282643e-02, +4.471672e-02,
+    -1.028455e-01, -3.667102e-02, -1.501953e-01, -6.024386e-02, +3.460733e-01, -1.321265e-01, -8.521908e-03, +1.472241e-01, +1.540142e-01,
+    -6.419591e-03, +1.621004e-02, +4.102858e-02, +4.083707e-02, +2.058274e-02, +3.281398e-02, -2.298848e-02, +2.016956e-03, +4.696549e-02,
+    -1.280330e-01, +5.161593e-02, -2.662898e-01, +2.211340e-02, +1.409498e-01, +4.253221e-01, +1.052364e-01, +3.503535e-01, +1.699012e-01,
+    +1.602786e-02, -2.171532e-02, -1.664744e-01, -6.077122e-02, +1.161075e-01, -7.831709e-02, +2.297783e-02, +7.149473e-02, -8.212081e-02,
+    -5.676562e-03, +7.679302e-02, -8.380713e-03, -4.043112e-02, -7.883640e-02, +5.057975e-02, -1.089068e-01, -1.478599e-01, +6.426172e-02,
+    +4.703610e-02, +6.655011e-02, -5.854133e-02, +2.093402e-02, +4.511496e-02, +1.217345e-01, -1.869180e-02, -9.702627e-02, -8.913891e-02,
+    -5.629390e-02, +4.335915e-02, +2.507582e-02, +7.487367e-02, +1.068846e-01, -1.566384e-02, +3.302369e-02, +5.778962e-03, +4.441026e-03,
+    -2.707374e-02, +8.870794e-02, -6.293571e-02, +1.359653e-01, -9.643018e-03, -1.926213e-01, +5.291804e-02, +3.941855e-02, -5.871598e-02,
+    -2.832301e-02, -2.413242e-01, +7.566779e-02, +5.118300e-02, +1.146379e-01, -2.798165e-03, -2.210480e-01, -2.288156e-02, +3.194745e-02,
+    -6.114994e-02, +1.877123e-02, -4.649773e-02, -5.184731e-03, +8.129717e-02, -6.201286e-03, -7.673298e-03, -3.808789e-02, -7.436829e-02,
+    -3.758368e-02, +1.450458e-01, -5.140405e-02, +1.096371e-01, -5.093532e-02, +9.699288e-02, -9.628518e-02, +2.743293e-02, +4.317732e-02,
+    +3.958189e-02, +9.930217e-02, -3.005198e-02, +7.790283e-02, +1.900382e-01, +1.281683e-01, +3.556314e-02, +6.722844e-02, -3.319633e-02,
+    -5.504772e-02, -1.416179e-02, +1.798705e-01, +1.229760e-01, +4.831555e-02, -1.911053e-01, -3.780923e-02, -7.422650e-02, +5.000814e-02,
+    +3.432413e-02, -7.104822e-03, -1.236288e-01, +4.187592e-02, +1.370255e-01, +5.820253e-02, -1.483561e-02, +2.359533e-02, +6.691502e-02,
+    -3.478793e-03, -2.220763e-03, +3.397684e-02, -1.858630e-02, +4.785140e-02, +4.899156e-02, -5.367037e-02, -6.609923e-02, +1.321734e-01,
+    +1.199711e-01, -7.327842e-02, +5.156251e-02, -7.972246e-02, +1.200935e-02, +5.278582e-02, +1.517300e-02, -1.494526e-01, +1.727055e-02,
+    //06
+    -1.351581e-01, +1.404272e-01, +2.405979e-01, +7.654501e-02, +1.697017e-01, +1.716963e-02, -2.605370e-01, -2.334397e-02, -3.560188e-01,
+    +1.494426e-01, +8.142009e-02, +1.281500e-01, -3.696746e-01, -5.221561e-01, -5.869234e-01, +8.678025e-02, +1.006872e-01, +1.771975e-01,
+    -1.999961e-01, +1.039267e-01, +1.905262e-02, +1.257166e-02, +5.833986e-03, -1.267207e-03, +6.403036e-02, -1.767900e-01, +2.241101e-01,
+    -4.889036e-02, -8.624747e-02, -1.410013e-01, -4.109988e-04, +5.892976e-02, +1.115588e-01, +4.665239e-02, +1.111816e-01, +3.848509e-02,
+    +1.516312e-01, +3.554744e-01, +1.384926e-01, +1.301823e-01, +4.408688e-02, +2.496136e-01, -7.483372e-02, -4.442310e-02, -1.776353e-01,
+    +1.664804e-02, -4.585394e-02, -1.529013e-01, +3.716223e-02, +4.915449e-02, -9.969133e-02, -4.042314e-02, +1.205692e-01, +1.364102e-01,
+    -5.615658e-02, +4.324033e-02, +4.755377e-02, +8.608108e-02, +3.254900e-01, +2.448343e-01, -2.420122e-01, -9.777208e-02, -4.681289e-02,
+    -5.572270e-02, -2.353431e-01, +5.545770e-02, -6.016628e-03, -6.932098e-02, -3.403086e-01, +1.081147e-01, +1.468219e-02, +5.970919e-03,
+    -6.029398e-02, -1.255084e-01, -3.862267e-02, +9.422946e-02, +5.674861e-02, +1.928143e-02, +1.156214e-01, -8.364545e-02, -1.054000e-02,
+    +2.481316e-02, +8.574866e-02, +8.344144e-02, +8.962746e-02, -1.203216e-01, -1.318751e-02, -2.235021e-01, +1.454190e-01, +3.028215e-02,
+    +2.062181e-01, +3.577149e-02, +6.380899e-02, -2.615985e-01, -3.478923e-01, -9.203344e-02, +1.441829e-01, +2.046445e-01, +2.716425e-01,
+    +2.095886e-01, -3.927898e-01, -3.601476e-01, -5.268349e-02, -1.752258e-01, -1.492857e-01, -4.373393e-02, +3.040207e-01, +2.296620e-01,
+    +6.458791e-03, +6.355761e-02, -7.436812e-02, -2.675898e-01, -3.425740e-01, -1.348873e-01, +1.007648e-01, +5.033263e-03, -9.793870e-02,
+    -1.520092e-01, -4.304158e-01, -4.546401e-01, +2.357988e-01, -6.611397e-01, -7.897491e-02, +1.310910e-02, +4.476946e-01, +2.626661e-01,
+    +1.316823e-01, +2.794216e-01, +1.663098e-01, -1.338729e-01, -3.985747e-01, +3.296338e-01, -3.228017e-01, -1.751407e-01, +2.742552e-02,
+    -7.462647e-03, +8.511642e-02, +7.238134e-02, -1.910925e-01, -1.404657e-01, -2.980517e-02, +6.081533e-02, +9.377388e-03, -6.063426e-02,
+    +2.287681e-01, +1.082039e-01, -2.193442e-02, -7.546152e-02, +1.005278e-01, -4.093082e-02, +8.530140e-03, -1.279564e-01, -1.663724e-01,
+    +1.995496e-01, +4.546024e-02, +1.945894e-01, +1.667064e-01, +4.999439e-02, +8.034471e-02, -3.931975e-01, -1.420431e-01, +1.513951e-01,
+    +8.373889e-02, -8.622599e-01, +7.926380e-01, +9.964516e-02, +4.703621e-01, -2.218153e-01, -3.963851e-01, -9.151557e-01, +4.526465e-02,
+    +2.747254e-02, -2.347581e-01, -7.509673e-02, -8.140739e-02, -3.546912e-02, +2.350330e-02, +1.158779e-01, +7.435846e-02, -1.254562e-01,
+    +1.487160e-01, +7.269778e-02, +1.063627e-01, -1.926932e-01, +6.888015e-02, -2.931629e-01, +2.248602e-01, +9.388538e-02, -1.515191e-01,
+    -5.578720e-02, +6.019588e-02, -6.456364e-02, -7.872625e-02, -1.781056e-02, +1.354236e-01, +9.759788e-02, +1.342570e-02, -1.267972e-02,
+    -2.839019e-03, +1.602917e-01, -5.210226e-02, +2.170558e-02, +6.594850e-03, +8.697154e-02, -2.891728e-01, -3.943085e-02, -2.381889e-02,
+    -7.145268e-02, +5.269729e-02, -1.706693e-01, +1.143742e-01, +8.205844e-02, +1.526336e-01, -7.964353e-02, -5.900076e-02, -4.835907e-02,
+    +2.116406e-01, -2.838840e-02, -7.789547e-02, -1.924924e-01, +1.544725e-01, +2.526863e-01, -6.975588e-02, +6.310965e-03, -1.855898e-01,
+    +2.515387e-02, +2.211124e-01, -1.002208e-01, +7.170184e-03, -7.692030e-03, +1.570548e-01, -2.353447e-01, -2.101555e-01, -8.031976e-02,
+    +2.834467e-01, -1.249925e-01, +1.162359e-02, +2.201586e-01, +7.594761e-02, +3.702035e-01, +3.985355e-02, +9.817983e-02, -1.451710e-01,
+    -2.101827e-01, +7.138905e-04, -1.596258e-01, +1.462785e-01, +8.353267e-03, +2.439775e-01, +9.469106e-02, -2.273919e-01, +8.798373e-02,
+    -1.531363e-01, -1.193359e-01, -1.476032e-01, +3.188411e-01, +3.369818e-03, +7.492857e-02, +4.720455e-02, +2.357539e-01, -1.016847e-02,
+    +1.017017e-01, +7.134432e-01, +8.631551e-02, -1.423536e-02, -4.371709e-01, +1.230950e-01, -2.709342e-01, +1.752217e-01, -4.036308e-01,
+    +1.132129e-01, +4.980371e-02, +1.120172e-01, +1.828364e-01, -1.148358e-01, -2.260071e-01, +4.267298e-02, +1.362207e-01, -1.183489e-01,
+    +8.976879e-02, -1.813420e-01, -1.218385e-01, -6.918588e-02, +3.681930e-02, -1.738081e-03, +1.441881e-01, +7.982230e-02, -6.287554e-02,
+    //07
+    -7.539517e-02, -2.762389e-01, +5.070094e-02, +1.974683e-01, +2.368667e-02, +2.135173e-01, +2.502136e-01, +2.409722e-01, -8.779808e-02,
+    +1.220255e-01, -3.496070e-01, -6.284497e-03, +9.807312e-02, -9.169323e-02, -5.901398e-03, +1.560389e-01, +2.434208e-04, +5.931211e-03,
+    +1.338007e-02, -1.035250e-01, +3.326311e-01, +1.261711e-02, -1.797578e-01, +2.128083e-02, +2.579705e-01, -2.530781e-01, -7.798493e-02,
+    +2.190705e-02, +1.732184e-02, -3.588808e-01, +1.356958e-01, -1.209421e-02, -1.829926e-01, +5.789069e-02, -1.962736e-02, +5.312865e-02,
+    -4.248038e-02, -3.258805e-01, +1.569017e-01, -1.163464e-01, -3.121267e-01, +3.119287e-01, +2.121601e-01, +2.591262e-01, -1.358134e-01,
+    -9.582579e-02, -3.321211e-02, +3.094107e-02, +1.891091e-02, -3.128552e-02, +1.388616e-02, +1.027473e-01, +8.510724e-02, -1.437320e-01,
+    +1.014894e-01, -2.040709e-01, -3.745164e-02, -2.228698e-02, -2.210178e-01, +1.536363e-01, +1.787434e-01, -7.718992e-02, +4.478243e-02,
+    -2.162611e-01, +2.031922e-02, +1.113214e-02, -2.446359e-01, -4.568275e-02, +2.230443e-02, -2.339738e-01, +1.655424e-01, +1.969118e-01,
+    -3.171502e-01, +1.379853e-01, +2.393704e-02, -1.354675e-01, +4.041817e-03, -9.021486e-02, +1.129972e-01, +1.657685e-03, +2.370035e-01,
+    +1.612643e-01, +3.464482e-02, +2.655598e-02, +4.208443e-02, -8.374686e-02, -6.540054e-02, +5.437834e-02, -1.002867e-01, +2.008745e-02,
+    -2.409837e-01, +1.927464e-02, -2.371599e-02, +1.245166e-01, -4.542334e-02, -3.992459e-02, +2.188147e-01, +1.216940e-02, +3.952342e-02,
+    +6.045879e-01, +6.234105e-02, -5.527341e-02, -7.016823e-01, -1.315239e+00, -4.292699e-01, -2.422708e-02, -1.032300e+00, -1.721953e-01,
+    +2.186261e-01, -2.723037e-01, -4.253666e-01, +3.604337e-02, -1.462205e-01, +2.102158e-01, +3.461373e-01, +2.528786e-01, -2.762094e-01,
+    +4.511974e-01, +5.634914e-01, +3.665559e-01, -5.951203e-02, -2.537411e-01, +4.748431e-01, +7.604821e-02, +3.296058e-01, -9.743375e-01,
+    +3.013530e-01, -3.247814e-01, -3.702811e-01, +1.546236e-01, +5.605367e-03, +5.391626e-02, +4.397008e-01, -5.451949e-02, -2.736831e-01,
+    +1.555766e-01, -1.913994e-01, -1.209933e-01, -7.895973e-02, +5.115263e-02, -2.946079e-02, +4.363623e-02, -1.123791e-01, +1.033299e-01,
+    +5.397147e-02, -9.969795e-02, +3.165545e-01, +6.094202e-02, -1.030972e-01, +5.513492e-02, -1.279794e-01, -2.750106e-01, +1.559762e-01,
+    +7.627377e-02, +1.671154e-01, -4.745985e-02, +3.758422e-03, +9.198793e-02, +1.823047e-03, -7.390175e-03, +5.330471e-01, -9.221341e-03,
+    +2.716138e-01, -1.542344e-01, +3.666029e-01, -1.932696e-01, +3.505003e-02, +1.195913e-02, +4.912339e-02, -5.035570e-01, -2.000566e-01,
+    +9.937133e-02, +1.527944e-01, -1.811447e-01, -1.475915e-01, -5.124150e-01, -2.412287e-02, +1.067890e-01, -4.348625e-01, -2.307211e-01,
+    +1.826360e-02, -3.085037e+00, -2.475996e-01, +5.039956e-01, -1.375835e+00, -3.188823e+00, +4.802449e-02, +1.086179e+00, -6.454015e-01,
+    +1.913797e-01, -8.203599e-03, +2.562222e-02, +1.040095e-01, +7.793093e-03, +8.220510e-02, +2.671134e-02, -1.379852e-01, +1.385140e-01,
+    +3.360513e-02, -9.543739e-02, +1.429635e-01, -4.032168e-01, +8.955614e-02, -3.810893e-02, -1.918991e-01, +5.090658e-02, +4.476198e-02,
+    +9.541051e-03, -9.573335e-02, -1.005247e-01, +1.680282e-02, -5.940674e-02, +6.493244e-02, +1.074333e-01, +9.114854e-02, +9.788179e-04,
+    -3.843853e-02, -8.406413e-02, +5.323557e-02, +3.390787e-02, -6.767419e-02, -5.789161e-02, +1.291893e-01, -5.422097e-02, -7.458792e-02,
+    -5.579596e-02, -1.136870e-01, +7.544368e-02, +2.091752e-01, +6.156147e-03, -7.603258e-02, +1.072795e-01, +2.759964e-02, -2.574579e-01,
+    +2.411595e-01, -4.021075e-01, -2.438592e-01, +4.703228e-03, -9.118683e-01, +3.743322e-01, +4.836846e-01, -6.071345e-01, +2.391421e-01,
+    +3.941473e-01, -4.380853e-01, -2.172619e-01, +4.984407e-01, +6.695645e-02, +3.751867e-01, -3.786608e-01, -1.224882e+00, +2.279868e-01,
+    -6.945495e-02, -9.978732e-03, +2.859089e-01, -5.501722e-01, +1.801172e-01, -8.385895e-01, +2.607538e-02, -1.801821e-01, +2.076366e-01,
+    +3.614531e-01, -8.362919e-01, +3.042304e-01, +4.648673e-02, -8.176252e-01, +3.622344e-01, -3.383975e-02, -3.026963e-01, -5.202383e-01,
+    -1.209044e-01, -4.596579e-01, +1.685324e-01, +1.327616e-01, -5.170612e-01, +1.797279e-01, +6.474344e-02, -7.009096e-01, -2.579208e-02,
+    -1.382247e-01, +3.918499e-01, -1.801817e-01, -2.146802e-01, +1.622583e-01, +1.582042e-01, -2.699278e-01, +3.095616e-01, +1.697624e-01,
+    //08
+    +2.893965e-01, +8.431605e-02, -1.311675e-01, +1.777109e-03, -1.883802e-01, +3.853290e-02, +9.711856e-02, +1.161366e-01, -1.123193e-02,
+    -1.442488e-01, +5.141189e-02, -5.985475e-02, -1.716127e-01, +8.438299e-02, +1.844261e-01, -1.900397e-01, -5.873102e-02, -2.797238e-01,
+    +1.747814e-01, -1.319196e-01, -5.377121e-02, +2.127365e-01, +5.168658e-02, +2.024790e-02, -2.103663e-01, -4.215857e-02, -2.680178e-02,
+    -1.709139e-01, +1.929125e-01, +2.241844e-02, +2.627845e-02, +6.872203e-02, +3.266630e-02, +4.540308e-03, +8.255895e-02, -1.050773e-01,
+    +2.449025e-01, -6.403940e-02, -1.044003e-01, +1.489516e-02, -6.242576e-02, -9.663685e-02, +1.029594e-01, +8.968305e-02, +7.707209e-02,
+    -1.400414e-01, -1.663920e-01, +3.105494e-02, +2.281694e-01, -1.772016e-03, -2.761972e-01, +5.987940e-02, +5.618538e-02, +5.128257e-02,
+    -1.201133e-01, +6.512445e-03, +1.534853e-01, +5.656477e-02, -2.206810e-01, +4.055186e-02, +8.244030e-02, -1.663804e-02, -1.858909e-03,
+    -2.471423e-01, -1.324364e-01, +7.983065e-02, -3.174346e-01, -3.057651e-02, +1.805440e-01, +3.763337e-02, +3.719551e-02, +1.668017e-01,
+    +5.098385e-02, +1.807362e-01, +6.641777e-02, -6.002782e-02, -1.251591e-01, -6.506578e-03, -2.014887e-01, +9.026451e-02, +1.447009e-02,
+    -1.206974e-01, -1.089911e-01, -1.108332e-01, +9.636818e-02, +4.705053e-02, -4.106017e-02, +1.882295e-02, +5.165381e-02, -4.123346e-02,
+    +1.183512e-01, -2.685869e-01, +3.131563e-02, -6.184973e-02, +2.319148e-02, +1.056567e-01, -3.034149e-01, -1.986793e-01, -4.994752e-01,
+    +2.612757e-02, -3.779272e-01, -3.989095e-02, +6.306261e-02, -2.826636e-01, +1.136469e-02, -4.696307e-01, +3.320051e-01, +2.503956e-01,
+    -6.001199e-01, +4.867832e-01, +2.993978e-01, -4.285294e-01, -3.876053e-01, -3.269256e-02, -3.749390e-01, -5.851529e-01, -4.271077e-01,
+    +7.367179e-02, +3.973074e-01, -2.391752e-01, -2.948278e-02, +2.540566e-01, -1.764506e-01, -1.964170e-01, +2.879596e-01, -3.189735e-01,
+    -6.806072e-01, -3.245539e-01, -3.078140e-01, +3.712770e-02, -2.048078e-01, -1.335212e-01, -2.344528e-02, +7.732072e-02, +3.055922e-01,
+    -8.047726e-02, +1.888147e-02, -2.866071e-02, -5.133983e-02, +5.534023e-02, -5.281323e-02, +5.890518e-02, -2.115254e-01, -1.122398e-01,
+    -1.497163e-01, +9.841024e-02, +3.836064e-02, +4.300956e-02, -3.631712e-02, +1.029995e-01, +5.402138e-02, -1.112307e-01, +8.064302e-02,
+    +1.177905e-01, -1.195355e-01, -7.818811e-02, -4.361599e-02, +2.474833e-02, +1.174416e-02, -6.232169e-01, -7.554355e-02, +4.005757e-02,
+    -7.346148e-02, -2.483828e-01, +1.489334e-01, -3.653066e-01, -3.305760e-02, -3.831659e-01, +1.119435e-01, +1.746468e-01, +1.561601e-01,
+    -6.124362e-02, -7.819779e-02, +1.531225e-03, -3.918184e-02, -1.870008e-02, +1.617413e-02, -1.450550e-01, +1.858686e-02, -8.600170e-03,
+    +2.938587e-01, +9.580507e-04, +2.685423e-01, -2.513323e-01, -4.585359e-01, -2.420685e-01, +1.439378e-01, +8.083464e-02, -1.492366e-01,
+    +1.927275e-01, +6.137143e-02, +8.904736e-03, +1.719265e-01, -3.573145e-01, +1.402913e-01, -6.025720e-02, -3.213130e-02, -6.438581e-02,
+    -1.295459e-01, -5.928143e-02, -2.182470e-05, +3.176126e-01, -1.316655e-01, -2.017086e-01, +9.180387e-03, -1.118003e-01, -9.937795e-02,
+    -2.949899e-02, -1.329165e-01, +1.114516e-02, +6.444046e-02, +6.472123e-02, -3.620791e-02, +1.489384e-01, +5.414744e-02, +3.774500e-04,
+    -6.187697e-02, +4.749520e-03, -1.674642e-01, +1.106827e-01, -2.346103e-02, -5.444625e-03, +1.019568e-01, -8.997221e-02, -1.539691e-01,
+    +7.291920e-02, -2.236574e-01, +1.219467e-01, +8.131023e-02, +1.894963e-01, -7.757986e-02, +3.502181e-03, +1.990435e-01, +1.196124e-02,
+    +1.212052e-01, +2.227051e-01, +8.442341e-02, +1.619024e-01, -3.991336e-01, +2.594860e-01, -3.473305e-02, +8.218578e-02, -2.957051e-01,
+    +4.491620e-01, -9.871889e-01, +5.347102e-01, +7.041450e-02, +3.057873e-01, -1.016263e-01, -1.396664e-02, -1.856855e-01, -5.949035e-01,
+    -5.990941e-01, -8.659490e-02, +1.536264e-01, +1.160728e-01, -3.114458e-01, -5.571967e-02, +1.749712e-01, +1.145610e-01, +2.902960e-01,
+    -5.912511e-02, -2.421118e-01, +2.479480e-01, -2.318450e-02, -9.406752e-02, -3.787886e-02, -6.662448e-02, +1.276300e-01, +1.349478e-01,
+    -1.237792e-01, -1.367987e-01, -1.533066e-01, +1.384114e-01, +2.391820e-02, -8.202205e-02, -2.004455e-01, -5.246571e-02, +6.539196e-02,
+    +3.319085e-02, -9.445760e-02, +1.549741e-03, -1.546331e-02, +2.875314e-02, +1.965628e-01, -2.755681e-02, +5.600548e-02, -6.829251e-02,
+    //09
+    -2.327378e-02, -1.846649e-02, -9.771240e-02, -7.732892e-02, -1.141041e-01, -1.120996e-01, -1.190304e-01, -2.535223e-01, -2.947450e-02,
+    +1.681702e-01, +5.414174e-02, +9.120520e-02, +7.727487e-03, +6.667148e-02, +7.620985e-02, +8.475425e-03, +2.045457e-03, -1.954090e-01,
+    -1.571309e-01, -4.462928e-02, +3.157615e-02, -3.489536e-02, -1.053347e-02, +3.137069e-03, -1.341670e-01, -1.220301e-01, -4.072288e-02,
+    +1.306710e-01, -3.913622e-02, +1.174765e-01, +3.925555e-02, -9.799020e-02, -8.448795e-02, +1.041036e-01, +1.193424e-02, -8.637963e-02,
+    +2.431475e-02, -1.185343e-01, -8.270847e-02, +3.900601e-02, -1.193527e-01, +4.825789e-03, +2.080551e-02, -2.828294e-03, -1.482364e-01,
+    +1.419601e-02, +5.788440e-02, -2.642024e-02, -7.444178e-02, -3.989009e-02, -4.131999e-02, -1.191190e-01, -3.284528e-02, +1.734892e-02,
+    +3.996541e-02, -1.061406e-01, +1.261541e-01, -8.364550e-02, +1.788259e-02, -1.774908e-01, -7.331791e-02, -1.006423e-01, -3.375701e-02,
+    +5.392212e-03, -8.463217e-02, -6.140295e-02, +1.580250e-02, -1.743813e-02, +2.064964e-01, -5.170207e-03, -1.425162e-01, -1.840239e-01,
+    -1.467935e-01, -1.059369e-01, -1.035438e-01, -5.093601e-03, -4.848225e-02, -2.120437e-01, -5.948827e-02, +2.980265e-03, +9.386873e-02,
+    -1.665335e-01, -6.999297e-02, -1.156227e-01, +5.204048e-03, -3.513267e-02, -6.064278e-02, -4.586792e-02, -7.125627e-02, -9.237054e-02,
+    +6.224292e-02, -7.500223e-02, -7.034248e-03, +1.022103e-01, +9.997223e-02, -1.654310e-01, -1.137512e-01, -2.177838e-02, +5.678322e-03,
+    -1.336516e-03, +5.750585e-02, -3.474291e-02, -4.778611e-02, -5.304149e-02, +9.666245e-02, -3.514186e-02, +5.838036e-02, +5.647562e-04,
+    -1.429505e-01, +8.477698e-02, -8.834732e-02, -8.206961e-02, +5.398212e-02, +1.773440e-01, -2.139951e-01, -4.659696e-02, +9.546660e-02,
+    +2.914532e-02, +2.283321e-01, +3.709799e-02, -1.213761e-01, +1.566997e-01, +6.334440e-02, -4.102805e-02, +1.368076e-01, +5.176530e-02,
+    -1.521506e-01, -2.021636e-01, -2.373610e-02, -8.270014e-02, +3.720159e-02, +7.878584e-02, -1.205940e-01, -5.954659e-02, +1.347944e-01,
+    +5.701520e-03, +2.171922e-02, -1.252131e-01, +8.681537e-02, -8.103325e-02, -1.357808e-01, -9.218165e-02, +1.939033e-01, -9.838351e-02,
+    +4.397262e-02, -1.988097e-01, -5.088470e-02, -3.259973e-02, +7.045108e-02, -1.230744e-01, -1.934005e-01, -4.185203e-02, -1.119644e-01,
+    +1.552734e-01, +2.771958e-02, +9.406556e-02, -1.178447e-03, -6.556869e-02, -6.096474e-02, -3.556439e-02, -4.985845e-02, -4.727842e-02,
+    -8.076449e-02, -9.236281e-02, +1.084420e-01, -2.929685e-02, -1.320664e-01, +2.163505e-02, +2.956570e-04, -1.253986e-01, +1.580552e-01,
+    -1.113141e-01, +4.786854e-02, -2.433799e-02, -6.753288e-02, -5.468081e-02, -8.356565e-02, +5.783514e-02, -7.158437e-02, -1.632243e-01,
+    +6.264462e-02, +1.755431e-01, +1.024099e-01, +1.415122e-01, -3.108322e-02, +1.961052e-02, -1.034913e-01, +5.656565e-02, -1.365170e-01,
+    -7.829507e-02, -5.295270e-03, -1.115985e-01, -2.118776e-01, +1.641340e-01, +2.981937e-03, -2.151328e-02, +3.918923e-02, +2.794196e-03,
+    -5.328110e-03, -4.018998e-02, -2.048100e-02, -3.418992e-02, -4.186482e-02, -1.487052e-01, -1.340641e-01, -1.611651e-01, +2.083925e-03,
+    -1.218232e-01, -9.876735e-02, -7.708259e-02, -2.229160e-01, -1.749052e-01, -1.593611e-01, -1.713382e-01, -1.982597e-01, +1.535111e-02,
+    +1.847160e-02, +7.610905e-02, -5.256141e-02, -4.069300e-02, -1.513964e-02, -2.121089e-01, +5.359580e-02, +2.142839e-02, -1.022098e-01,
+    -2.365894e-01, -7.536889e-02, +1.090064e-01, -2.255233e-02, -4.128359e-02, +8.371969e-02, +1.422774e-02, +5.657960e-02, -5.578918e-02,
+    -9.061512e-02, +7.280475e-02, -1.596098e-02, -9.661195e-02, -5.428563e-02, +1.061030e-01, -2.273472e-02, +1.441629e-01, +2.827046e-01,
+    +3.672329e-02, -4.580116e-03, +1.680795e-02, +2.320533e-02, -1.054738e-01, -1.196000e-01, +4.969519e-02, +1.178182e-01, +6.128177e-02,
+    -1.060927e-01, -1.109896e-01, -3.974170e-02, -7.784662e-02, +3.436892e-03, -2.551005e-02, -4.120393e-02, -1.099045e-01, +1.049103e-01,
+    -1.851992e-01, -1.026612e-01, +5.300749e-04, -6.840322e-02, +1.204978e-01, -1.594813e-01, +1.619888e-02, +2.227044e-01, -2.484676e-02,
+    -1.361283e-01, -1.391760e-02, +1.461255e-01, -4.019010e-03, -5.358899e-03, +7.109875e-02, -6.455778e-02, -9.415940e-02, +1.321045e-03,
+    +3.560908e-02, -3.885008e-02, +7.757115e-03, +7.512340e-02, -7.763980e-02, -6.069620e-02, -9.234183e-02, -2.377731e-02, -2.279316e-02,
+    //10
+    -4.451222e-02, -2.698153e-02, +1.236344e-02, -1.190517e-01, +8.291699e-02, +3.294681e-02, +1.062868e-01, -2.952776e-02, -6.528164e-02,
+    -6.057574e-02, -1.147759e-01, -3.640736e-02, +1.577594e-02, +2.144292e-01, +1.248797e-01, +6.112184e-02, +5.498718e-03, +4.795752e-02,
+    -7.634953e-02, +2.197462e-01, -3.985619e-02, +1.744002e-01, +1.009233e-02, -9.154051e-02, -1.524655e-01, +1.517722e-01, -1.903626e-01,
+    +8.404265e-02, +9.627260e-02, +2.218422e-01, +1.832947e-02, -1.280456e-01, -3.504127e-02, -1.027085e-01, -1.090526e-01, -1.126521e-01,
+    +2.498740e-01, -9.629729e-02, -4.091714e-01, +1.341313e-01, +1.523369e-01, -1.452753e-01, +3.815025e-02, -1.284048e-01, -4.026414e-02,
+    +8.157862e-02, +2.191420e-01, -2.315269e-01, +1.741908e-01, -8.256920e-03, -8.608718e-02, -1.321089e-01, -5.581683e-02, -1.149592e-01,
+    -7.702714e-02, -4.179048e-02, -7.218811e-02, +1.302869e-01, -6.397852e-03, +8.882876e-03, -2.176079e-01, -8.716365e-02, +8.823512e-02,
+    -3.782885e-02, -4.170315e-02, +8.425278e-02, -6.684652e-02, +9.056644e-02, -1.036792e-01, -9.265169e-03, -2.003851e-02, +8.371499e-02,
+    +2.006346e-01, +7.441367e-02, +5.022861e-03, +1.433024e-01, -2.107135e-01, +3.140142e-02, +4.905545e-02, +3.761793e-02, -1.346102e-01,
+    -6.318381e-02, +1.432946e-01, +3.322104e-02, -2.229982e-01, -2.398816e-01, -8.545836e-02, +1.796223e-01, +1.211780e-01, -2.640398e-02,
+    -1.141279e-01, +2.083943e-02, +1.158485e-01, -5.638789e-02, +1.004260e-01, +1.581420e-01, -1.172747e-01, -5.134576e-02, +1.083471e-01,
+    +1.494300e-02, +8.697893e-02, -9.792148e-02, +5.605802e-02, -2.120345e-01, +1.402472e-01, +2.876799e-02, -1.038148e-01, -1.851199e-01,
+    +1.327553e-02, +2.281824e-01, +1.492787e-01, -6.347755e-02, -1.074765e-01, -7.194097e-02, -1.252113e-01, -3.131740e-03, +3.504861e-03,
+    -1.659612e-02, -8.454385e-02, -1.803575e-01, +1.666394e-03, +3.080251e-02, -1.398613e-01, +8.689348e-02, -2.824989e-03, +6.861223e-02,
+    -4.367005e-02, -3.540687e-02, +4.054999e-02, -4.780951e-02, -2.714095e-02, +1.847259e-01, -1.900484e-01, -8.850845e-02, +4.961979e-02,
+    -1.047920e-01, -3.784372e-02, -2.132123e-01, +1.779601e-03, +1.150298e-01, -8.981804e-02, +4.609677e-02, +1.941965e-01, -1.077462e-01,
+    +2.649692e-02, +2.412674e-01, -1.255211e-02, -4.732334e-02, -6.778669e-03, -1.603741e-01, -1.591576e-02, -1.305081e-02, -6.169096e-02,
+    +3.986338e-02, +1.148630e-02, +1.075678e-01, +2.538470e-02, -1.095419e-02, +4.333811e-02, -1.804827e-02, +4.671083e-02, +4.948074e-02,
+    -2.247975e-01, +3.381092e-02, -3.224679e-02, +8.045316e-03, -2.062086e-01, -2.008688e-01, -8.048613e-02, +1.489174e-01, +1.332550e-01,
+    -4.303686e-02, -2.079403e-02, -4.850631e-02, -1.010895e-01, +9.065506e-02, -2.973644e-02, -8.588694e-02, +9.874702e-02, +6.785157e-02,
+    -3.478228e-02, +2.278990e-02, +5.299228e-02, +1.037545e-01, +7.686061e-03, +2.748122e-02, -1.939537e-01, -1.197606e-01, -2.884599e-02,
+    +2.007855e-01, +2.294458e-01, +5.735029e-03, +1.721012e-02, +9.254822e-02, +2.206783e-02, -4.148600e-02, -3.219450e-02, +9.247862e-02,
+    -3.735402e-02, +1.814484e-01, +6.574588e-02, +4.235854e-02, +4.234334e-02, +8.288094e-02, -1.118019e-03, +1.197551e-01, +1.336506e-01,
+    -1.505721e-01, +9.007391e-02, -9.868625e-02, -3.906434e-02, -2.210047e-01, +1.563544e-01, +7.959845e-02, +9.516553e-02, +1.697636e-01,
+    -1.119013e-03, +1.732769e-01, -1.239163e-01, -1.700006e-01, -3.192884e-01, -1.164250e-01, +3.625955e-01, +1.735320e-01, +6.663657e-02,
+    +3.441248e-02, -6.211400e-02, +8.769264e-03, -3.713859e-02, +4.551403e-02, -2.357099e-01, +1.020722e-01, -1.131860e-01, -1.815153e-01,
+    +5.920126e-02, +2.577897e-01, +3.505579e-02, +5.326945e-02, +1.748502e-02, +6.228113e-02, +1.575250e-01, +3.512805e-02, +4.656083e-02,
+    +7.517104e-02, +6.098826e-02, -1.871299e-02, +3.249182e-01, +1.672417e-01, -1.417545e-05, +3.449719e-01, +4.147812e-01, +1.147918e-01,
+    +4.090169e-02, +1.596390e-01, +2.029915e-01, +2.795404e-01, -2.938093e-01, +1.928060e-01, +3.899837e-02, +2.550346e-01, +6.089209e-03,
+    -8.555158e-04, +1.525876e-01, -4.774469e-02, -2.664550e-02, -7.262531e-03, +1.394695e-01, -4.313352e-02, +5.356834e-02, -3.803810e-01,
+    -1.476274e-01, -4.035203e-03, +2.976233e-02, +3.479251e-02, -8.587459e-02, -1.815142e-02, -1.446087e-01, +3.711502e-02, -8.291979e-03,
+    -8.695797e-03, -2.108791e-03, +1.542258e-01, -1.081541e-02, -1.525461e-01, +5.973844e-02, +8.994692e-02, -2.511121e-01, +4.522577e-02,
+    //11
+    +1.142743e-01, -3.472024e-02, +6.997781e-02, +7.569492e-02, -1.430833e-01, -1.056665e-01, -9.950156e-02, +1.578412e-01, -8.406791e-02,
+    +3.144093e-02, +7.818497e-02, -3.122228e-02, -1.567048e-01, +1.337713e-01, -2.762664e-02, -5.101625e-02, -3.684127e-02, +7.527819e-02,
+    -1.335257e-03, +6.635119e-04, -7.329896e-02, +7.539035e-02, -4.249495e-03, +8.174501e-02, +2.215365e-02, +1.993631e-01, +7.927513e-03,
+    +2.032642e-02, -2.288341e-01, -1.354787e-01, +1.349840e-01, -8.001737e-02, +3.259349e-03, +1.100286e-01, +3.809991e-02, +1.421099e-01,
+    -3.613959e-02, +9.190084e-02, +1.944233e-01, -1.123602e-01, -1.222903e-01, -1.199434e-01, -4.998583e-02, +1.821061e-01, +2.435506e-02,
+    -7.784589e-02, +2.145643e-01, +1.458105e-01, -2.203597e-01, +2.156098e-01, +3.939497e-03, -1.155977e-01, -7.030670e-02, +1.378950e-01,
+    +7.897891e-02, +1.185135e-01, -1.025009e-01, -3.470869e-02, +3.166603e-01, -2.416898e-01, +6.594359e-04, +1.023834e-02, -7.580845e-02,
+    -1.098176e-02, +7.849927e-02, +3.804503e-02, +1.790306e-02, +3.231898e-03, -3.179657e-02, -1.606749e-01, +2.979833e-02, -1.340265e-02,
+    +1.167326e-01, -1.593348e-02, +3.187603e-02, -8.483873e-02, -1.642590e-01, -4.768862e-02, +8.028623e-02, +4.749251e-02, +6.173534e-02,
+    -6.548052e-02, -6.484748e-02, -6.903067e-02, -6.492142e-02, -1.161197e-02, -1.482206e-01, -7.465580e-02, +2.747478e-01, +2.333498e-02,
+    -1.776513e-01, -3.471900e-02, -3.094772e-01, -2.915332e-02, +2.051582e-01, -1.153661e-01, -8.654806e-02, +1.410610e-01, -1.272770e-04,
+    -1.919945e-01, +1.072220e-01, -2.380497e-02, -2.721351e-02, -2.953432e-01, -5.566388e-02, +1.845070e-02, -3.311770e-01, -4.442634e-01,
+    -3.883825e-02, -2.466519e-01, +9.915498e-03, +1.633620e-02, +2.866095e-01, -1.947527e-01, +2.431429e-01, -5.921153e-02, +1.635598e-02,
+    +1.525899e-01, +1.275145e-01, +7.414679e-03, +2.712414e-01, +3.395186e-01, +5.244920e-01, -8.974004e-02, -1.037064e-01, -1.669500e-01,
+    +2.092872e-02, +1.078421e-02, -1.019134e-02, -2.722323e-02, -2.855927e-02, -2.624898e-01, +1.373921e-01, +1.272252e-01, -9.250233e-02,
+    +2.128996e-01, +3.906429e-02, -1.732004e-01, +1.447273e-01, -9.071781e-02, -1.368910e-01, +1.522090e-01, +6.586257e-02, +1.328797e-01,
+    +1.311544e-02, -7.274794e-02, +6.881285e-02, -9.390424e-02, -1.049908e-01, -2.438198e-01, +9.338604e-02, +2.423296e-01, +1.539460e-02,
+    +9.543332e-02, -1.231798e-01, +5.474890e-02, +8.950052e-02, +8.206253e-02, +3.567198e-02, -7.362057e-02, -1.041984e-01, +3.131567e-02,
+    -2.214805e-02, -9.964897e-02, -1.449475e-02, +8.437872e-02, -2.103803e-02, -6.541798e-02, -8.525718e-02, -1.122496e+00, -1.065253e-01,
+    +1.912980e-01, +4.247151e-02, -1.851168e-01, -4.849502e-02, -6.003291e-03, +5.674975e-02, -5.760350e-02, -1.170469e-01, -6.933290e-02,
+    +1.286052e-01, +3.065613e-01, +1.571667e-01, -1.749375e-01, +3.350224e-01, -1.277086e-01, -4.471096e-02, +1.531198e-01, +2.939866e-01,
+    -2.516707e-01, -1.536086e-01, +5.605385e-02, +1.301956e-02, +1.791307e-02, +6.524679e-03, -2.101171e-03, +2.469236e-03, -3.305617e-02,
+    +2.239869e-01, +1.589604e-01, +1.496159e-01, -1.345567e-01, -2.113210e-01, -1.715599e-01, +1.121438e-01, +1.705511e-02, +1.514901e-01,
+    -7.823982e-02, -1.987749e-02, +3.210586e-02, +1.353301e-01, -7.812292e-02, -3.091333e-02, +7.145718e-02, -5.967548e-02, -2.724711e-02,
+    +1.697879e-01, +1.421793e-01, +2.286701e-01, -1.009548e-01, -4.346013e-02, -2.037943e-01, -5.269475e-02, +1.151627e-01, +2.710218e-02,
+    -6.490603e-02, -1.013800e-01, +3.218305e-02, -8.500044e-02, -1.111501e-01, -6.304412e-02, +4.905606e-03, -6.150362e-02, +1.817954e-01,
+    -3.970257e-02, -1.377761e-01, -7.437521e-02, -1.396968e-01, -1.729794e-01, -3.534199e-01, +1.298559e-01, +4.922698e-02, +1.813723e-01,
+    -8.462094e-02, +4.464152e-02, +3.155304e-02, +1.308343e-01, +1.504695e-02, +2.229666e-02, -1.780633e-01, +1.103860e-01, +8.067486e-02,
+    +1.644977e-01, +3.442872e-02, +5.733938e-03, -1.995087e-01, +7.650700e-02, -2.540181e-01, -7.272390e-02, -5.364326e-02, -1.743331e-02,
+    -6.744593e-02, -2.274005e-01, -1.217828e-01, -4.998843e-02, +2.519756e-01, +3.326783e-01, -3.007181e-02, +1.515087e-01, +2.308641e-02,
+    +1.229734e-01, -3.049094e-02, +5.796639e-02, -2.217702e-02, -4.974156e-02, +1.035454e-01, +6.020683e-02, -7.240977e-02, -8.375137e-02,
+    -1.028141e-01, +8.351763e-02, -1.246137e-01, +1.380220e-01, -1.733263e-01, -6.500033e-02, +1.046288e-01, -4.620282e-02, +9.111854e-02,
+    //12
+    -1.068195e-01, -1.881147e-01, -3.704989e-01, -7.099707e-02, -8.822796e-02, +2.531300e-01, +7.147638e-03, +2.442399e-02, +1.609546e-01,
+    -1.129484e-01, -1.232530e-01, +1.121050e-01, -6.658816e-02, -4.145581e-03, +1.651671e-01, -1.970485e-01, +8.420254e-02, +2.360407e-01,
+    +1.466903e-01, +1.261537e-01, -1.727433e-02, -2.150361e-01, -7.976330e-02, -1.782825e-01, +1.054654e-01, +1.765692e-02, +8.289102e-02,
+    +9.574408e-02, +5.539731e-02, -9.822527e-02, +1.185241e-01, +3.061528e-02, +1.509478e-01, -1.459507e-01, -1.952863e-01, -6.286129e-02,
+    -8.799993e-02, -1.225139e-01, -4.870215e-01, +1.281684e-01, -6.359000e-01, -1.915578e-01, -6.745049e-03, +4.702803e-01, +3.928873e-01,
+    +7.854659e-02, -1.114764e-02, +2.512534e-01, -2.359046e-01, -1.140402e-01, -3.106208e-01, +4.588835e-02, +2.101509e-01, +6.790046e-02,
+    +1.045743e-01, -9.156142e-02, +2.678262e-01, +5.431266e-02, +1.690704e-01, +9.570921e-02, -5.434096e-02, -2.618858e-01, -1.598797e-01,
+    -2.593067e-01, -1.215035e-01, +1.618985e-02, +8.931191e-02, +2.596002e-01, -1.153118e-01, -2.204536e-01, -2.810261e-01, +1.086455e-01,
+    +8.438938e-02, -2.158779e-01, +6.412673e-03, +2.701151e-02, +1.186577e-01, +4.405791e-02, -1.021638e-01, +4.749755e-02, -2.955934e-02,
+    -1.416474e-01, +1.670061e-01, +2.562378e-01, -9.785715e-02, -2.200755e-01, -3.305730e-01, +3.373780e-02, +1.171224e-01, +2.014479e-01,
+    -1.761891e-01, -9.263158e-02, +9.439943e-02, +8.105206e-02, +1.037559e-01, +2.692092e-01, -1.553721e-02, +2.422085e-01, -2.991500e-01,
+    +1.094569e-01, -3.157701e-01, +3.840454e-01, -1.022675e-01, -2.879951e-02, -2.519453e-01, -1.455634e-01, +7.461546e-01, +1.622033e-01,
+    -1.766649e-01, -1.005531e-01, -2.263020e-01, +1.942107e-01, +3.024997e-01, +1.723652e-01, +2.430668e-01, +5.377145e-02, -2.488120e-01,
+    +2.808944e-01, -5.061333e-01, -6.455855e-01, -3.536017e-01, -7.197832e-01, -6.822794e-01, +3.710859e-01, +3.332226e-01, +6.168525e-01,
+    +3.959553e-02, -2.196644e-01, -2.702797e-02, +1.035364e-01, -1.250921e-01, +7.227507e-03, +9.911779e-02, -1.191905e-01, +1.984411e-02,
+    -1.121761e-01, -4.850398e-02, +3.059402e-02, +1.270531e-02, +4.839360e-02, -1.374326e-01, -8.442941e-02, +8.581654e-02, +1.228015e-01,
+    +7.888244e-02, -3.187382e-02, -1.334976e-01, -3.667571e-02, -2.129782e-01, +9.550735e-03, +2.007508e-01, +1.352195e-01, -3.370396e-02,
+    -3.443693e-02, +1.019317e-03, +2.461328e-01, -1.417199e-01, -1.392989e-02, -1.838306e-01, -7.555189e-03, +2.386964e-01, +4.840944e-02,
+    -2.516037e-01, +6.597513e-01, +1.099541e-01, +1.793357e-01, +5.043846e-01, -4.952519e-02, -3.065077e-03, -9.002516e-01, +1.390658e-01,
+    -1.249815e-01, -6.610708e-02, -1.854431e-02, +1.169679e-01, +1.069542e-02, +1.179174e-02, -3.652432e-02, +1.743781e-01, -1.895117e-01,
+    -7.871133e-02, +9.150839e-02, -2.851136e-03, -6.681384e-02, -1.570863e-01, -3.093773e-01, +6.956358e-02, -2.873599e-02, -1.801696e-01,
+    -2.265470e-01, -1.729524e-01, -9.278324e-03, +2.119331e-02, +1.650078e-03, +1.488135e-01, +3.959085e-02, +2.143702e-04, -1.451394e-01,
+    -7.568008e-02, +2.024056e-01, +1.914152e-01, +7.003756e-02, +4.621699e-02, +2.791528e-03, +5.965994e-02, -3.255887e-01, -1.337868e-01,
+    -3.393627e-01, +4.810056e-02, -1.869020e-02, +1.649213e-01, +1.836865e-01, +1.603730e-01, -8.460996e-02, -2.357078e-02, -2.105109e-01,
+    +1.815905e-01, +5.994981e-02, +2.415219e-02, -2.327598e-01, -7.920499e-02, +3.388385e-02, +1.936416e-01, +9.194463e-02, -1.452133e-01,
+    -1.326135e-01, -1.190141e-01, -2.619157e-01, +9.464467e-02, +1.770486e-02, -1.206654e-01, -1.667109e-01, +1.830028e-01, -1.947606e-01,
+    -1.892988e-01, +2.716945e-01, +2.270683e-02, +6.183196e-02, +2.979908e-01, +3.661684e-01, -7.107323e-01, -5.735380e-01, -1.507602e-01,
+    +1.832131e-01, -5.302153e-01, -1.362035e-01, -4.670080e-01, -1.786458e-01, +1.160870e-01, +1.836985e-01, -1.320797e-01, +6.054641e-02,
+    -2.068678e-01, -7.175645e-02, -1.157658e-01, +6.307074e-01, +2.948430e-01, +4.377395e-01, -3.694417e-01, -7.656506e-01, -5.962108e-02,
+    +3.297727e-01, +3.896859e-02, +1.733407e-03, +4.504983e-01, -4.174819e-01, +4.701087e-01, +8.083487e-02, -1.261387e-01, +9.328173e-02,
+    -1.292370e-01, -6.502257e-02, -1.557525e-01, +2.979023e-01, -2.110410e-01, -5.218581e-02, -5.902595e-03, +8.700269e-02, +1.417418e-01,
+    -6.053976e-02, +1.449049e-01, -6.454376e-02, +9.594460e-02, -1.420225e-02, -9.331749e-02, -1.013808e-01, +4.639919e-02, -5.240867e-03,
+    //13
+    -5.127009e-02, -1.212136e-01, -5.071383e-02, -7.242410e-02, -7.343532e-02, +1.250956e-01, +4.195659e-02, -1.037040e-02, +2.072499e-02,
+    -2.328769e-02, -7.180936e-03, +3.299328e-02, -1.441086e-02, -7.065313e-02, +4.946745e-03, +4.294397e-02, +2.863260e-02, +1.535081e-01,
+    -5.507515e-02, +2.511404e-01, -6.685968e-02, +1.150807e-01, +9.673177e-02, -1.337903e-01, +2.233684e-02, -8.906899e-02, -2.061811e-02,
+    +1.512181e-02, +2.657061e-02, -4.875578e-03, +3.574239e-02, -7.111463e-02, -7.440484e-02, +9.096233e-03, -2.757777e-02, -1.172850e-01,
+    +2.168475e-02, -7.739260e-02, -1.323463e-01, +8.654483e-02, -6.706465e-02, -1.272593e-01, +3.217952e-02, -1.614404e-02, +1.260347e-02,
+    +1.204443e-01, +6.661264e-02, -8.664891e-02, -2.893778e-03, +1.069613e-01, -7.987399e-02, +2.547904e-02, +3.409057e-02, -2.496978e-03,
+    +1.263980e-01, -3.712249e-02, +7.105225e-02, +6.571510e-02, -6.019168e-02, +2.450789e-01, +1.288265e-02, -3.573371e-02, -2.069320e-01,
+    -2.095449e-02, -3.881877e-02, +9.534727e-02, -1.463355e-02, +3.228041e-02, +6.278639e-02, -6.616434e-02, -3.589828e-02, +2.032042e-02,
+    -5.862952e-03, +3.853782e-03, -7.292268e-02, -2.182202e-02, +1.417641e-02, +3.358566e-02, +4.248916e-02, +1.105176e-02, -9.108258e-02,
+    -2.897604e-01, +3.000547e-01, -1.902741e-02, +1.391231e-01, -2.076215e-01, -2.120472e-02, -1.083418e-01, +6.678591e-03, -9.324119e-02,
+    -2.169789e-02, -3.749304e-03, +7.751009e-02, -1.753227e-02, +9.180142e-02, +3.960031e-02, +1.204403e-02, +7.899629e-02, -7.955676e-03,
+    +1.944130e-02, +4.223499e-02, -2.970410e-02, +9.689607e-02, +8.494104e-02, -4.531072e-02, -1.002892e-02, +1.829936e-02, -4.213884e-02,
+    +2.433607e-04, +1.370253e-01, +7.835465e-02, +3.465860e-02, -2.358262e-02, -5.476315e-02, +1.676171e-02, -6.718680e-02, -1.919745e-02,
+    -5.711796e-02, -8.234182e-02, +4.636355e-02, -3.301019e-02, -1.122389e-01, +4.711610e-02, +8.631491e-02, +1.110687e-02, -5.570790e-03,
+    -2.919957e-02, -3.076008e-02, +1.943131e-01, -4.221144e-02, -4.198447e-02, +1.200964e-01, +6.690064e-03, +4.124570e-02, +8.865558e-02,
+    -4.133647e-02, +8.151208e-02, -3.380905e-02, +1.872938e-02, +1.474906e-02, -3.575664e-02, -3.906732e-02, +9.028019e-02, +5.924568e-02,
+    -6.397464e-02, +5.669677e-02, -1.745054e-01, -5.211053e-02, -3.396950e-01, +2.237971e-01, +1.593792e-01, +1.917776e-01, +1.476534e-03,
+    -1.644654e-03, +3.613474e-02, +4.952600e-02, +6.218489e-02, +1.174503e-02, +3.866347e-02, -5.534867e-03, -8.767920e-03, +4.082773e-02,
+    -3.452761e-02, +2.428372e-01, -1.453966e-02, +1.768467e-01, +5.786056e-01, +5.088063e-01, +1.542303e-01, +2.701089e-01, +2.245891e-01,
+    -6.020404e-04, +1.059817e-01, -1.785955e-01, -1.824144e-02, -8.194784e-02, +8.582067e-02, -1.154553e-01, +1.844684e-01, -9.340297e-02,
+    -5.992309e-02, +1.071660e-02, +3.722421e-02, -1.399218e-01, -1.160419e-01, +9.471414e-02, -1.282696e-01, -1.578727e-01, +1.090910e-01,
+    +5.874279e-02, +8.432145e-02, -4.640584e-02, +3.133803e-02, +4.194646e-02, +6.846146e-02, -5.970350e-02, -1.398172e-01, -7.170277e-02,
+    -1.090709e-03, +1.010716e-01, +2.782645e-02, +7.041697e-02, +8.235367e-02, -4.219099e-02, +1.965665e-02, -1.275364e-02, +1.219620e-02,
+    -2.116021e-01, +2.013813e-01, +1.386795e-02, +2.942535e-01, -1.702033e-01, +3.972383e-01, -7.480945e-02, +2.785449e-01, -2.553884e-02,
+    +7.962071e-02, -7.010576e-03, +1.500351e-02, +5.903973e-02, -1.718191e-02, +2.713837e-01, +2.936794e-02, +6.438123e-02, -1.375195e-01,
+    -6.222460e-02, +3.075460e-02, -8.126828e-03, -2.391478e-03, +1.201831e-01, -5.046408e-02, +2.371172e-02, +8.944377e-03, -9.574299e-02,
+    +4.623940e-02, +1.125024e-01, -4.687509e-02, +6.340302e-03, +2.646869e-02, +8.190915e-02, -8.126912e-02, -2.413982e-02, +4.655769e-02,
+    +9.804172e-02, +1.985932e-01, +7.090768e-02, +9.392986e-02, +2.390334e-01, +1.487326e-01, +2.719825e-02, +6.226366e-02, +3.181191e-02,
+    +1.899093e-02, +4.044503e-02, +1.108743e-02, +1.406449e-01, -7.824200e-02, -1.873472e-01, -7.799197e-02, -8.129483e-02, -3.147790e-03,
+    +1.015664e-01, -5.411778e-03, -6.323426e-02, +9.297822e-02, +2.169710e-01, +1.269948e-01, -1.331952e-02, +8.029677e-02, +1.419557e-01,
+    -1.734488e-02, +1.275879e-02, +5.962246e-02, -3.764473e-02, +8.575108e-03, +1.139157e-01, -3.737721e-02, -2.950912e-02, +1.380202e-01,
+    -2.924464e-02, -3.965047e-02, +2.222333e-02, +2.506040e-02, -2.069253e-01, +3.169243e-02, +5.431563e-02, -1.186592e-01, -2.283473e-02,
+    //14
+    -3.705995e-02, -1.619934e-01, -1.179567e-02, +8.746511e-02, +9.885520e-02, -1.454014e-02, +1.229762e-03, -3.557825e-02, -5.336252e-03,
+    +9.673714e-02, -9.137509e-02, -1.359608e-01, -1.285661e-01, -5.472999e-02, +6.357843e-02, +3.163729e-02, -8.085513e-02, +3.674553e-02,
+    +3.633121e-03, -7.384391e-02, -1.575506e-01, -2.959149e-03, -2.494115e-02, -4.735620e-02, -3.617506e-02, -3.885392e-02, -1.164963e-01,
+    +1.679582e-01, +1.115401e-01, +2.025982e-03, -2.795902e-02, -5.127781e-02, +2.074965e-02, -7.113638e-02, +1.039956e-01, -4.563781e-02,
+    -1.391346e-01, +1.490849e-02, +4.229515e-02, -1.177974e-01, +3.045477e-02, -5.394259e-02, +5.825152e-02, +1.066611e-01, +2.891050e-02,
+    -4.425034e-02, +3.346267e-02, +3.128874e-02, -9.545317e-02, -1.961052e-02, +6.831326e-02, +1.175390e-01, -7.716458e-02, -1.193345e-02,
+    -1.185322e-01, +1.975571e-03, +3.019945e-02, +7.197364e-02, -5.052671e-02, +5.861536e-02, -1.407042e-01, -1.042992e-01, +3.458812e-02,
+    -3.804327e-02, +2.787065e-02, -4.375979e-02, +7.644910e-02, +3.484705e-02, -2.135515e-01, -1.689222e-01, -3.215892e-02, -1.634893e-01,
+    -1.066597e-01, -3.347658e-02, +8.299576e-02, +6.055982e-02, -1.019971e-01, +5.169368e-03, +4.758629e-02, +2.282379e-01, +1.460813e-01,
+    -1.159789e-01, +1.016107e-02, -2.114403e-02, -1.518879e-02, +4.187882e-02, -9.162594e-02, -2.111009e-02, -1.725198e-02, -4.095404e-02,
+    +3.991833e-02, -1.958672e-01, -1.035105e-01, +3.560765e-02, +1.663188e-01, -1.086600e-01, -5.675088e-02, -8.886877e-02, -1.072113e-01,
+    +1.071004e-01, -1.582032e-02, -6.204383e-02, +2.458853e-02, +3.032479e-02, -1.320048e-01, -3.342410e-03, -7.517883e-02, -4.716484e-03,
+    -3.276282e-03, -2.333114e-02, +6.790666e-02, -7.854478e-02, -8.644088e-02, +6.899329e-02, +1.205342e-01, +4.459440e-02, +1.996807e-01,
+    -1.181844e-02, -7.509819e-02, +8.504333e-02, -1.761046e-01, -7.377850e-02, -4.478247e-02, +1.285897e-01, +5.451586e-02, +9.594789e-02,
+    +6.110784e-02, -1.052854e-01, -1.002662e-01, +4.782483e-02, +5.337504e-03, -3.690567e-02, -4.953946e-02, -4.449134e-02, -4.298071e-02,
+    -8.615652e-02, -1.129420e-01, -1.543636e-02, +3.803870e-02, +1.010545e-01, +3.547893e-02, +6.411982e-02, -7.382849e-02, +2.752884e-02,
+    +8.597621e-02, +7.352392e-02, +2.783234e-02, -7.328040e-02, +2.618203e-02, -3.903451e-02, -4.399805e-02, +6.496812e-02, -1.261955e-01,
+    +2.768454e-02, -9.209708e-02, -9.633459e-02, -2.108692e-01, -1.637803e-01, +1.265371e-01, +5.067807e-02, +2.798932e-03, -5.366005e-02,
+    -5.855622e-02, -5.484599e-02, +4.974284e-02, -3.584489e-02, -1.824725e-02, +5.016514e-02, +5.907714e-02, +2.119955e-02, -1.387569e-02,
+    -3.867530e-02, -1.273430e-01, -2.588726e-02, +7.585943e-02, +9.269932e-02, -1.313916e-01, -2.506644e-02, -2.190695e-01, +5.148835e-02,
+    -6.031924e-02, +6.312364e-03, -1.537415e-01, -4.730330e-02, -2.363494e-02, +2.433371e-02, -1.130030e-02, -1.194276e-01, +1.194563e-02,
+    -1.935664e-02, +7.469046e-02, +1.020295e-01, +8.150436e-03, -1.330299e-01, -2.386711e-01, +1.028100e-01, -9.868708e-02, -2.807953e-03,
+    -8.079714e-02, -2.235492e-02, -1.358752e-01, -1.437116e-01, +2.368095e-01, +1.163574e-01, -2.199708e-02, +7.754756e-02, -1.605107e-02,
+    -1.757107e-02, -6.788075e-02, +1.639433e-01, +1.216760e-02, +4.938535e-02, -3.672382e-02, +1.840174e-01, -3.367691e-02, -5.699313e-02,
+    -2.547342e-02, -7.430272e-02, -1.036824e-01, +5.924333e-02, -7.144344e-02, +6.258274e-02, +9.763940e-02, -9.648698e-02, +1.683829e-02,
+    -1.034968e-01, +5.590857e-03, -1.306436e-01, -5.954634e-03, -4.374366e-02, -7.331592e-03, +5.507249e-02, -5.952237e-02, -4.883010e-02,
+    +4.434364e-02, -4.421355e-02, +8.473977e-02, -2.879143e-03, +3.475672e-02, -5.309799e-02, +8.199690e-02, -9.655192e-03, +5.184013e-02,
+    -2.738142e-01, +1.523631e-02, +5.951653e-02, -5.979334e-02, -2.615685e-01, +2.206346e-02, +9.527481e-02, -2.435598e-01, +7.940947e-02,
+    -6.464886e-03, -1.168846e-01, +3.326226e-03, +1.383245e-01, -1.287673e-01, +4.344026e-02, +7.715220e-02, -6.944814e-02, +2.993395e-02,
+    -4.574413e-02, -1.027519e-02, -2.362618e-03, -2.092032e-01, +6.259639e-02, -7.979096e-02, +5.416420e-02, -1.318075e-01, +4.139674e-02,
+    -1.349963e-02, +4.882538e-02, -7.235806e-02, -7.970574e-03, +6.846323e-03, -4.753400e-02, -1.084587e-02, +2.203311e-02, -6.650963e-02,
+    -1.136596e-01, -8.568628e-02, -2.300265e-02, -1.270122e-02, +4.645583e-02, -1.563591e-01, +8.798831e-04, -7.291826e-02, +1.120399e-02,
+    //15
+    +1.817074e-01, -2.296520e-01, -4.538677e-02, +1.158546e-01, -6.453165e-02, +2.037075e-02, -2.397887e-03, +9.554808e-02, +8.933806e-02,
+    -1.714972e-01, +9.856470e-02, +1.645448e-01, -6.508330e-02, +2.076131e-01, +1.442875e-01, -1.417588e-01, +8.607931e-02, -1.020536e-01,
+    +1.546364e-01, -4.524475e-02, -3.925319e-02, +1.587653e-01, +7.030816e-02, -2.301988e-01, +8.754804e-02, +1.005158e-01, -1.810786e-01,
+    +2.152814e-01, +2.977435e-02, -1.557178e-01, +6.547442e-02, -1.683999e-01, +1.215595e-01, +7.423607e-02, -7.242410e-02, -8.897421e-02,
+    +3.845784e-01, -3.684789e-01, +4.697531e-02, +8.641472e-02, -4.869146e-01, -2.324905e-01, +7.218332e-02, +1.476680e-01, +6.536760e-02,
+    -1.361040e-01, +1.204386e-01, +4.537119e-02, -9.465745e-02, +9.348954e-02, -1.874981e-01, +1.045276e-01, +6.433740e-02, -5.418937e-02,
+    -2.705492e-01, +3.574871e-01, +3.692472e-02, -3.559309e-03, +3.480589e-01, -1.874140e-01, -7.178686e-02, +5.855685e-02, -2.910062e-01,
+    +1.028317e-02, +1.136297e-01, -2.192182e-02, -3.811543e-02, -1.771812e-02, +1.463773e-01, -2.239581e-01, +1.111231e-01, -1.479908e-01,
+    -7.347608e-02, +5.531770e-02, -6.071223e-02, +1.404964e-01, +1.952710e-02, -1.945947e-01, +6.663002e-04, +1.270533e-01, +8.578514e-02,
+    -6.173466e-02, -1.776814e-02, +1.714013e-02, +8.502348e-02, +8.609954e-02, -5.782743e-02, -2.524118e-01, +1.118216e-01, +8.928218e-02,
+    +1.438701e-01, +8.460957e-03, +6.435724e-02, +7.904635e-02, +2.736883e-01, -4.046130e-01, -8.921366e-02, +1.737715e-01, -2.566462e-01,
+    +6.043856e-01, +1.646370e-01, +5.911255e-01, -1.403472e-01, +3.061679e-01, -6.279817e-01, +2.684338e-01, -2.045379e-02, -5.890300e-03,
+    +3.227564e-01, -3.365369e-01, -1.687330e-01, -5.887524e-01, -1.219089e+00, +2.659414e-01, +1.842265e-01, +1.444566e-01, -8.770882e-02,
+    -1.020271e-01, -2.920529e+00, -2.743252e-02, -1.297057e+00, -1.947828e+00, -2.888334e-01, -1.204668e+00, +1.193012e-01, -8.342474e-02,
+    +2.287859e-01, +6.693307e-02, -6.026295e-01, -1.723324e-01, +9.023678e-02, -2.566296e-01, +1.378181e-01, -8.248270e-02, -4.028830e-01,
+    -3.774618e-01, +3.870033e-02, +2.243985e-01, -1.964158e-01, +1.720707e-01, +2.236264e-01, -2.140720e-01, +4.096265e-02, +3.888059e-02,
+    -1.135015e-03, +1.032547e-01, -1.681329e-01, -5.086517e-02, +8.877291e-02, +1.032179e-02, -1.059466e-01, +2.655471e-01, -1.910916e-01,
+    -8.395746e-02, -7.406532e-02, +1.145624e-01, -1.768499e-02, -9.282040e-02, +1.117504e-01, +9.927693e-02, -7.503229e-02, +2.061566e-01,
+    +1.411895e-01, +2.213448e-01, +9.613462e-02, +4.796996e-02, +3.548588e-01, -8.811681e-02, +8.473860e-02, -3.110010e-01, +2.213022e-01,
+    -8.762324e-02, -1.233133e-02, -1.857921e-01, +2.135589e-01, +1.129976e-01, -7.762342e-02, -1.746169e-01, +1.090084e-01, -1.268071e-01,
+    +1.072039e-01, -3.357396e-01, -5.619295e-02, +7.850327e-02, -1.440934e-01, +2.978379e-01, +8.878010e-02, -2.601750e-01, -2.486551e-01,
+    -1.624831e-01, -1.977411e-02, -2.155118e-01, -5.366424e-01, -7.829315e-02, -2.155633e-01, +4.677845e-02, -5.869581e-03, +9.134497e-02,
+    -1.831563e-01, -3.864468e-02, +8.793640e-02, +1.120343e-01, +2.562485e-02, +2.259972e-01, -7.765798e-02, -4.556940e-02, -2.967456e-02,
+    -1.573100e-01, -1.254860e-02, +3.501160e-02, +1.033214e-01, +5.027226e-02, +5.912598e-02, -5.268498e-02, +9.132352e-02, -2.180006e-01,
+    +1.794719e-01, +1.204208e-01, +4.311961e-02, +4.660155e-02, -4.095169e-02, +1.944101e-03, -1.796138e-01, -1.004578e-01, -5.480243e-02,
+    +1.158385e-01, +1.288722e-02, +1.001965e-01, +9.138091e-03, -1.507645e-01, +2.623806e-01, +3.349288e-02, -9.866434e-01, -9.609798e-02,
+    -2.907862e-01, -6.734989e-01, +6.181575e-01, +3.553189e-01, -4.062988e-01, -1.853925e-01, +2.830085e-01, +2.104209e-02, +6.336169e-01,
+    -2.660609e-01, -3.039235e-02, -1.010141e-01, -7.917230e-02, +1.522787e-01, +1.093156e-01, +2.780392e-02, -1.054815e-01, -2.340769e-02,
+    +1.647593e-01, -1.009495e-01, +3.424102e-01, -1.038557e+00, -1.910477e+00, +4.020588e-01, +6.136850e-01, +7.302574e-01, +3.202751e-01,
+    +1.562009e-01, -6.414633e-01, +6.032404e-01, +1.706807e-02, +1.347610e-02, -9.864663e-01, +4.768419e-03, +1.255452e-01, -1.888163e-03,
+    +1.418127e-01, -6.819443e-02, -4.202747e-02, +2.005644e-02, +1.593079e-01, -6.918103e-02, +3.155275e-02, -2.935235e-01, -3.978322e-02,
+    -7.496297e-02, -3.665977e-02, -6.845904e-02, -3.970344e-02, +1.512478e-01, -1.642071e-01, -1.227425e-01, +1.325940e-01, +1.293947e-01,
+    //16
+    +9.492142e-02, -1.388280e-01, -1.680327e-01, -2.940609e-01, -7.330762e-03, +4.532213e-01, -1.044992e-01, +1.206696e-01, -7.485480e-05,
+    -6.001604e-02, +1.915217e-01, +1.007659e-01, -2.638849e-03, +3.756099e-01, +2.388316e-01, -1.201438e-01, -1.344739e-01, -3.118599e-01,
+    -1.449176e-01, -2.113949e-01, -6.186521e-02, +2.417862e-02, +1.936999e-01, +2.557499e-01, +1.125382e-02, -1.576280e-01, -2.279415e-01,
+    -1.341125e-01, -5.705036e-02, -1.583849e-01, +7.097608e-02, +1.042869e-01, +1.144980e-01, +1.514673e-01, +1.919240e-01, -7.299100e-02,
+    +5.541169e-02, -1.791364e-01, -7.461423e-01, -1.629821e-01, +1.179599e-02, -2.508986e-01, +1.571730e-01, -2.147025e-02, +4.366776e-01,
+    -7.670017e-02, -3.537587e-02, +1.636279e-01, -2.913048e-02, +6.414136e-02, -1.375134e-01, +1.856296e-02, +3.017074e-02, -5.631638e-05,
+    -5.852098e-03, +1.924897e-01, +7.347045e-02, +2.501397e-02, -4.540841e-01, -2.158159e-01, +9.631394e-02, +1.363690e-01, +1.492556e-01,
+    +5.616302e-02, +5.465439e-01, -9.674793e-03, -4.789905e-01, -5.997046e-01, -1.358169e-01, +9.202168e-02, +1.691100e-01, -7.873565e-03,
+    +5.775740e-02, -2.894850e-02, -2.179571e-01, +1.311295e-01, +1.230410e-01, +2.525259e-01, -1.386018e-01, +8.874335e-03, -5.612118e-02,
+    -3.722650e-01, -1.191480e-01, -2.253775e-01, +2.479628e-01, +1.239925e-01, +1.562686e-01, -3.091224e-02, +1.454287e-02, -1.061088e-01,
+    -5.638576e-02, -7.088940e-03, +8.466350e-03, +2.901354e-01, +2.481595e-01, +1.565585e-01, -1.170810e-03, +3.454084e-01, +1.850362e-02,
+    +1.895820e-01, -6.497619e-01, +4.014525e-01, -2.984336e-01, -3.926110e-02, -1.136105e+00, +1.259780e-02, -1.318260e-01, -8.544154e-01,
+    -3.689357e-02, +5.653055e-01, -3.630116e-01, +4.096260e-01, +1.665267e-01, +1.865511e-01, +2.645403e-01, +1.108899e-01, +7.880910e-02,
+    -2.961038e-01, +4.007531e-02, +9.928189e-02, +4.602433e-01, +4.354574e-01, -1.822685e-01, -8.293579e-01, -1.174293e-01, +2.424233e-01,
+    +5.719616e-02, -1.713456e-02, +4.618394e-02, +1.554592e-01, +1.864155e-01, -2.760176e-02, -1.060899e-01, +3.132154e-01, +1.894460e-02,
+    -1.092141e-01, -1.640782e-01, +2.078039e-02, +2.441710e-01, -2.509471e-01, -2.283099e-01, +1.510524e-01, +1.507446e-01, +6.107823e-02,
+    -1.132231e-01, -2.133936e-01, +7.524520e-02, +2.841133e-03, -4.022331e-02, +3.192242e-02, +1.190935e-01, -9.186423e-02, -2.081424e-02,
+    -1.905017e-01, +4.857664e-03, -1.628933e-01, +5.095466e-01, +1.183829e-01, +7.529642e-02, +2.439359e-02, -2.198019e-01, +1.158838e-01,
+    -1.675149e-01, -2.771628e-01, -2.926745e-01, +5.954686e-01, -9.257473e-01, +5.936388e-01, +6.262501e-01, +1.202050e-01, +5.470230e-01,
+    +4.358123e-02, -2.021578e-01, +1.809938e-01, -9.007952e-02, -9.281507e-02, -1.450813e-01, -5.547952e-02, +8.996973e-02, +9.297471e-02,
+    +8.787336e-02, +2.686043e-01, +4.845458e-01, -7.451731e-02, -1.845879e-02, -3.157571e-01, +3.248566e-02, -9.594961e-02, +3.794681e-01,
+    +1.993763e-03, +9.834737e-02, -2.761782e-01, -2.217650e-01, +1.047496e-01, +1.098854e-01, +8.234201e-02, +5.806983e-02, +8.886084e-02,
+    -1.210727e-01, -4.447543e-02, +1.017786e-01, -3.596289e-04, -1.393741e-02, -7.863831e-02, -8.237905e-02, +4.507705e-02, -1.226775e-03,
+    +1.246710e-02, -1.333092e-02, +3.340380e-04, -8.929171e-02, -4.541903e-02, -7.137544e-02, +6.772936e-02, -9.108005e-02, +3.631929e-02,
+    -6.209051e-02, -1.380541e-01, +2.115489e-01, +1.489532e-01, +1.700837e-01, -1.254712e-01, +4.814021e-02, -9.433150e-02, -9.994913e-02,
+    -8.432098e-02, -1.111611e-01, -2.828635e-01, -3.489865e-01, -1.409464e-01, -2.176029e-01, +5.870457e-01, +9.128644e-02, -4.663370e-02,
+    -4.737288e-01, +3.949018e-01, -1.119944e-01, +4.609124e-01, +6.760504e-03, +4.880778e-01, -2.853369e-01, -1.159241e+00, -7.011229e-02,
+    +3.512378e-01, -8.225361e-02, +4.466538e-02, +1.588061e-01, +8.036584e-02, +2.698477e-01, -1.779934e-01, +6.772866e-02, -1.567460e-02,
+    +5.296175e-02, +1.251887e-01, -6.031895e-01, -4.738353e-01, -4.775087e-01, -1.349659e-01, +2.836816e-01, -2.010445e+00, +6.085058e-02,
+    -3.731088e-01, +2.127270e-01, -1.244172e+00, +3.656565e-01, -3.172459e-02, +3.328767e-01, -4.407932e-01, -1.019862e-01, -1.244364e-01,
+    +2.639242e-01, -2.250868e-01, +2.460687e-01, -2.232565e-01, -1.212196e-01, -2.722975e-01, +2.618043e-01, +1.712741e-01, +1.514887e-01,
+    -1.646864e-01, +9.296521e-03, -8.718087e-02, -7.711630e-02, -2.035989e-01, +1.934448e-02, +1.283980e-01, +6.712484e-02, -5.429542e-03,
+};
+
+/* The 16 phases bias in the sub-pixel layer */
+const float espcn_x4_biases3[16] = \
+{
+    -5.526927e+00, -6.029832e+00, -5.461072e+00, -6.978703e+00,
+    +5.326282e+00, +4.312639e+00, +5.020738e+00, +4.023540e+00,
+    +5.397297e+00, +4.315146e+00, +4.934792e+00, +4.123031e+00,
+    -5.573590e+00, -6.481800e+00, -5.993051e+00, -6.562772e+00,
+};
+
+/* The 16 phases x 16 convolutional kernel(3*3) in the sub-pixel layer */
+const float espcn_x4_weights3[16][ESPCN_CONV2_FILTERS][ESPCN_CONV3_SIZE][ESPCN_CONV3_SIZE] = \
+{
+    //01
+    -4.393126e-01, +3.929575e+00, +9.395689e-02, +1.544522e+00, +4.634044e+00, +1.335334e-01, -5.092393e-01, +2.030971e+00, +5.838521e+00,
+    +1.182905e+01, -4.958934e+01, +6.551428e-01, -5.385280e+00, -5.186439e+00, -4.287783e+00, +2.119823e+00, -9.116230e+00, -2.873487e+00,
+    +9.709710e+00, -8.422907e+00, +9.947894e-01, +1.045900e+01, -3.603983e+01, +9.889057e+00, +1.031541e+01, +1.214764e-01, +5.253485e-01,
+    +3.717355e+00, +4.144655e+00, -7.916760e+00, -8.021647e+00, +5.732886e+00, -7.520407e-01, -4.600250e+00, +3.337768e+00, +9.780400e+00,
+    +4.140824e+01, +8.914342e+00, -4.856951e+00, -5.776928e+00, +1.654668e+01, -1.252343e+01, +7.534727e-03, -5.321738e+00, +6.923850e-01,
+    +1.008491e+00, -1.042090e+00, +2.735685e+00, -8.524141e+00, -4.621713e+01, -8.940649e+00, +5.420577e+00, +2.339261e+01, +7.272687e+00,
+    +1.631405e+00, -3.374488e+01, +7.193136e+01, +1.083256e+01, -7.791758e+00, +2.969452e+01, +6.245021e-01, -1.045492e+01, +1.300417e+01,
+    +4.286120e+00, -5.184411e+01, -4.154110e+01, -1.805078e+01, +9.193769e+01, +6.847124e+01, +5.145699e+00, -1.072282e+01, -2.550996e+01,
+    +5.136354e+00, -1.379363e-01, +5.962799e+00, +1.211018e+01, -6.523812e+00, -2.098600e+00, +1.301867e+01, -2.343613e+00, -3.031833e+00,
+    -4.578390e+01, +1.780225e+01, -5.525113e+00, +2.090109e+01, +3.355240e+01, -5.009154e+00, -4.261029e+00, -7.040608e+00, +3.812583e+00,
+    -2.280964e+01, +1.393067e+01, -1.643006e+01, +1.815378e+01, +2.284873e+01, +3.710360e+00, -3.446919e+00, -7.676097e+00, -3.943025e+00,
+    +1.755497e+01, -1.032690e+01, +4.411371e-01, +1.156955e+01, +3.158086e+01, +2.228447e+00, -3.754800e+00, -2.110208e+01, -4.203706e+00,
+    +4.853141e+00, +7.706542e+00, +1.652781e+00, -2.189603e+01, -2.040950e+01, +5.813606e+00, +3.311720e+00, +8.668513e+00, -1.401871e+00,
+    +9.329395e-02, +7.407746e-02, -2.749018e+00, -7.183635e-01, -1.423344e+00, +1.434163e+00, +6.614373e+00, -5.765390e-01, +2.314551e+00,
+    -2.270536e+01, +6.374347e+01, -6.098189e+00, -1.007852e+01, +1.126121e+01, -7.339573e+00, -4.441272e+00, +9.065084e+00, -2.717555e-01,
+    +1.957901e+01, +2.617928e+01, +8.178915e+00, -4.056815e+01, -5.517971e+01, -5.583743e+00, +1.007628e+01, +1.126595e+01, +1.785336e+00,
+    //02
+    -3.969191e+00, +1.366701e+00, +1.082418e+01, -9.840795e+00, +5.675427e+00, +8.834348e+00, +9.415487e-01, +3.552691e+00, +8.902000e+00,
+    -2.443963e+00, -7.264910e+00, +4.315670e+01, +1.721043e+00, +1.008626e+01, -6.248595e+00, +6.338474e-01, -2.957497e+00, +7.635070e+00,
+    +9.712439e-01, -1.083063e+01, +6.073631e+00, -2.226525e+01, -1.901880e+01, +9.307615e+00, -1.950558e+00, -5.121699e+00, +3.511154e+00,
+    -2.517900e+00, +4.079070e-01, -1.134530e+01, -1.802053e+00, +1.087968e+01, -7.113168e+00, -6.257872e-02, +3.386175e+00, -2.253907e+00,
+    +3.158107e+01, +2.047932e+01, -7.481389e+00, -1.698387e+01, +3.437050e+01, -2.189679e+01, -1.400211e+00, -6.002746e-01, -1.649928e+00,
+    -2.373778e+00, +4.922293e+00, +2.001791e-01, -8.094547e+00, -4.105660e+01, -1.588542e+01, +2.210737e+00, +2.343517e+01, +1.133031e+01,
+    -1.216512e+01, +2.635905e+01, +5.605301e+01, +2.964214e+00, +1.820848e+01, +2.319189e+01, -3.415832e+00, -9.705630e+00, +7.928886e+00,
+    +1.565579e+01, -5.252121e+01, -3.480275e+01, -1.870184e+01, +5.574623e+01, +1.200523e+02, -6.770938e+00, -1.287843e+01, -2.115474e+01,
+    +1.545421e+00, -1.953605e+01, -8.746500e+00, +9.425299e+00, -9.270609e+00, -2.003735e+00, -6.983469e+00, -2.055989e+01, +8.114916e-01,
+    -1.767605e+01, -8.201979e+00, -8.365708e+00, +1.820355e+01, +3.698278e+01, -8.592114e+00, -1.259844e+00, -9.989007e+00, +6.975112e-01,
+    +4.771003e-02, -1.965587e+00, -1.984013e+01, +1.340430e+01, +2.639383e+01, +4.325724e+00, -3.095471e+00, -1.186964e+01, -4.742745e+00,
+    +1.666613e+01, -1.119134e+01, +2.608600e+00, +2.523903e+00, +3.289529e+01, +4.741036e+00, +2.424667e+00, -2.257769e+01, -4.806753e+00,
+    +7.159625e+00, +2.423185e-01, +6.060007e+00, -1.016696e+00, -4.032734e+01, +1.003276e+01, +1.915873e-01, +1.098325e+01, +1.212005e-01,
+    -4.943559e+00, -5.071226e+00, -4.636392e+00, -5.672268e+00, -2.051259e+00, -6.519603e-01, +2.495781e-01, -1.634137e+00, +6.827257e-01,
+    +1.101216e+01, +3.401307e+01, -2.526799e+01, +7.422391e+00, +7.227552e+00, -9.599829e+00, -2.450721e+00, +7.662755e+00, -3.383047e+00,
+    +9.229027e+00, +3.330530e+01, +1.068083e+01, -3.017841e+01, -5.774038e+01, -1.127762e+01, +6.123420e+00, +1.504006e+01, +5.527537e+00,
+    //03
+    -9.417489e+00, -3.266460e+00, +1.015868e+01, +2.637604e+00, -9.853194e-01, +2.703860e+00, -9.716196e+00, +3.384301e+00, +4.860455e+00,
+    -1.486333e+01, +2.855312e+01, +3.729327e+01, +4.828094e+00, +9.164884e+00, -8.939188e+00, -7.935632e-04, +3.460816e+00, +1.048109e+01,
+    -2.265461e+00, -1.283558e+00, +2.122359e+00, -2.825465e+01, +1.200275e+01, -2.288394e+00, -3.351858e+00, +1.915992e+00, +1.726232e+00,
+    +1.367810e+01, -1.524347e+01, -4.541922e+00, +7.257037e+00, -7.190156e+00, +9.375264e-01, +2.490556e+00, -8.869780e+00, -7.095220e+00,
+    +2.039862e+01, +2.907125e+01, -5.226102e+00, -1.974616e+01, +3.185701e+01, -1.927250e+01, +5.288132e-01, -1.306523e+00, -3.067378e+00,
+    -4.139031e+00, +6.265255e+00, -7.376500e-01, -7.768798e+00, -2.939805e+01, -2.887899e+01, +2.863528e+00, +2.043602e+01, +1.351985e+01,
+    -1.071846e+01, +3.179786e+01, -3.996371e+01, -1.902140e+00, +2.095164e+01, -9.316839e+00, -2.889850e+00, -4.937855e+00, -9.810099e+00,
+    +1.057666e+01, -2.949915e+01, -3.607760e+01, -3.169131e-01, +2.460977e+01, +1.417663e+02, -1.236076e+01, -2.074841e+01, +3.512467e-01,
+    -6.091029e+00, -9.732328e+00, -1.470556e+01, -4.531984e-01, +4.618011e+00, -9.546553e+00, -1.523649e+01, -6.941317e+00, -1.210132e+00,
+    +2.290073e+00, -3.513025e+01, +1.944310e-01, +1.364921e+01, +3.270959e+01, -2.894598e+00, -2.433814e+00, -1.020166e+01, -3.551308e-01,
+    +1.254234e+01, -2.623572e+01, -8.379782e+00, +8.048821e+00, +2.134353e+01, +1.449740e+01, -2.576359e+00, -1.362237e+01, -5.161653e+00,
+    +1.010723e+01, -1.409620e+00, +8.612190e-01, -1.665144e+00, +2.889717e+01, +1.384314e+01, +2.213909e+00, -1.908571e+01, -7.224959e+00,
+    +9.113971e+00, -3.118773e+00, +8.802456e+00, +1.205334e+01, -5.352887e+01, +1.061842e+01, -1.114348e+00, +6.288965e+00, +6.723217e+00,
+    -4.154016e+00, -9.738961e-01, -4.704725e+00, +3.384132e+00, +3.428894e-01, -3.944965e+00, -1.366896e+00, -2.970969e+00, +9.043565e-01,
+    +2.711263e+01, -2.337624e+01, -2.523008e+01, +1.054266e+01, -1.359092e+01, -4.058411e+00, +5.216640e-01, -3.588901e+00, -4.420355e+00,
+    +4.494430e+00, +3.504330e+01, +1.273573e+01, -1.359449e+01, -6.048188e+01, -2.687694e+01, +2.214375e+00, +1.716874e+01, +7.854370e+00,
+    //04
+    -7.621160e+00, -9.681462e+00, +1.765390e+00, +1.090555e+00, +6.947369e-01, -5.496492e+00, -1.148970e+00, -1.325826e+01, -1.413661e+00,
+    -1.330567e+01, +2.648419e+01, -3.011336e+01, +3.850190e+00, -4.041382e+00, -1.257430e+01, +2.252406e+00, +2.140329e+00, -5.716250e-01,
+    -1.693884e+00, +1.295454e+01, -4.290835e+00, -1.293897e+01, +2.933662e+01, -2.386908e+01, +4.162222e+00, +1.341046e+01, +8.187639e-01,
+    -3.418860e+00, +3.267274e+00, +1.704291e+00, +1.799947e+00, +1.249855e+00, +4.786527e+00, +4.373353e+00, +1.650883e+00, +2.688791e-01,
+    +9.766277e+00, +4.029833e+01, -4.548616e+00, -1.177065e+01, +1.621294e+01, -9.210880e+00, +1.546233e+00, -2.647048e+00, -7.472749e+00,
+    -3.021961e+00, +6.742813e+00, -2.989063e+00, -6.288677e+00, -1.808796e+01, -4.379426e+01, +1.124299e+00, +1.510534e+01, +1.790853e+01,
+    -4.479591e+00, +1.263223e+01, -9.953036e+01, -4.066560e+00, +1.529741e+01, -2.633823e+01, -2.010036e+00, -1.836155e+00, -1.648199e+01,
+    -8.081134e+00, -9.881128e+00, -5.004559e+01, +8.704903e+00, +2.520105e+00, +1.308823e+02, +7.382476e+00, -1.465930e+01, +4.088458e+00,
+    +7.773158e+00, +6.443315e+00, +1.354892e+01, +6.303594e+00, +1.215364e+01, +9.343523e+00, +1.053528e+00, +1.088553e+01, +1.329409e+01,
+    +8.070124e+00, -5.281141e+01, +2.036867e+01, +1.006581e+01, +2.467396e+01, +1.265187e+01, -7.886409e-01, -8.976251e+00, -2.198370e+00,
+    +1.123616e+01, -3.975281e+01, +1.042920e+01, +4.087114e+00, +1.900061e+01, +2.163558e+01, -2.651495e+00, -9.033734e+00, -5.386170e+00,
+    +2.962270e+00, +8.218209e+00, -1.161873e+00, -4.225798e+00, +2.230673e+01, +2.499802e+01, +3.425706e-01, -1.290974e+01, -1.441105e+01,
+    +4.237620e+00, +4.861333e-01, +9.015500e+00, +1.049510e+01, -4.634737e+01, +2.273146e+00, -5.406078e-01, +2.731791e+00, +1.089114e+01,
+    +7.388174e+00, +2.220633e+00, -2.395365e+00, -2.778205e+00, +1.380066e+00, -1.734181e+00, +1.329197e+00, -2.302759e+00, +4.784436e+00,
+    +1.924586e+01, -4.969431e+01, +2.424078e+01, +4.811690e+00, -2.517987e+01, +4.290319e+00, +2.283583e-01, -8.601798e+00, +6.920027e-01,
+    +4.116093e+00, +3.027848e+01, +1.914390e+01, -4.743654e+00, -5.396301e+01, -4.335142e+01, +5.505336e-01, +1.105134e+01, +1.066524e+01,
+    //05
+    +8.094256e+00, +3.449691e+00, +9.808393e+00, -1.466407e-01, -6.487724e-01, -2.467619e+00, -1.845175e+00, +1.198363e+00, +5.405823e+00,
+    +1.393489e+01, -5.168507e+01, +4.229152e+00, -4.123291e+00, -8.362652e+00, -2.160897e+00, -2.598753e-01, -7.250954e+00, -9.379516e-01,
+    +3.555995e+00, -1.808209e+00, -4.464114e+00, +1.919755e+01, -3.634937e+01, +1.526539e+01, +9.827843e+00, -2.587566e+00, +3.102411e+00,
+    +2.630264e+00, -2.272789e-01, +2.130336e+00, +4.197009e+00, +1.756098e+00, +5.867513e+00, -3.215237e+00, -2.225582e+00, +1.278803e+01,
+    +1.206947e+01, -6.259591e+00, -5.078020e+00, +1.493423e+01, +2.330496e+01, -9.478437e+00, -3.868244e+00, -9.439806e+00, -6.104279e+00,
+    +2.326183e+00, -1.420694e+01, +2.463365e+00, +6.134495e+00, -2.416490e+00, +6.149959e+00, +8.828024e+00, +3.491706e+01, +8.420219e+00,
+    +5.688908e+00, -3.071722e+01, +5.186346e+01, +7.018022e+00, -2.611246e+01, +4.347949e+01, -4.860007e-01, -6.838994e-01, +1.344333e+01,
+    -2.590566e+00, +1.829493e+00, -1.552606e+01, +5.251741e+00, +5.800775e+01, +4.090490e+00, +2.542199e+01, -1.147614e+01, -3.728625e+01,
+    -3.894153e+00, +3.481877e+00, +3.385295e+00, +4.682009e+00, -6.962584e+00, +5.785186e+00, +8.032681e+00, -7.623626e+00, -4.274220e+00,
+    -1.811706e+01, +2.239440e+01, -2.853286e+00, +3.660689e+00, +2.839272e+01, -6.044454e+00, -8.804191e+00, -9.726628e+00, +7.999679e-01,
+    -1.657644e+01, +3.477018e+01, -1.303718e+01, +8.180835e+00, +1.189086e+01, -1.995316e+00, -7.573464e+00, -1.093402e+01, -6.488862e+00,
+    +3.628495e+00, +1.492539e+01, +2.732316e+00, -7.464779e+00, +5.716900e+00, -4.267162e+00, -9.034119e+00, -2.482259e+01, -6.682980e+00,
+    +4.671854e+00, +1.953347e+01, -3.189873e+00, -3.558213e+01, -3.913537e+01, +5.727212e+00, +7.852614e+00, +1.794810e+01, +4.822680e-01,
+    +3.802951e+00, +3.150283e+00, +1.345005e+00, +2.004830e+00, +6.082619e+00, -1.207970e+00, -2.814161e+00, -2.124026e-01, +3.720667e+00,
+    -2.008388e+01, +5.355806e+01, -8.976190e+00, -1.445775e+01, +2.421054e+01, -4.989659e+00, -2.279904e+00, +9.192101e+00, -3.389137e+00,
+    -1.412525e+01, -1.313844e+01, -4.970770e+00, -1.273504e+01, -3.335428e+01, -2.569379e+00, +2.242378e+01, +2.137996e+01, +7.261351e+00,
+    //06
+    -1.947450e+00, -4.104438e+00, +1.180817e+01, -5.764989e-01, +7.767834e+00, +6.968227e-01, +3.769478e+00, -4.741621e+00, +9.203836e+00,
+    -5.338017e-01, -7.248748e+00, +4.114121e+01, +2.330612e+00, +8.405099e+00, +3.630272e+00, -2.176057e+00, +1.086795e-01, +7.221920e+00,
+    -9.456791e-01, -7.318579e+00, +5.775347e-01, -1.771836e+01, -1.672384e+01, +1.601032e+01, -4.991190e+00, -7.665626e+00, +6.316477e+00,
+    -5.806740e+00, +6.193986e-01, -1.089733e+01, +2.253906e+00, +5.487410e+00, -3.437597e+00, +1.193320e+00, +3.691820e-01, -5.114484e+00,
+    +5.619602e+00, +1.190109e+00, -8.019551e+00, +3.206851e+00, +3.815058e+01, -1.540785e+01, -8.196672e+00, +1.807399e+00, -1.253749e+01,
+    +1.228670e+00, -9.360606e+00, -1.084807e+00, +2.892118e+00, -1.298787e-01, +6.185598e+00, +3.872675e+00, +3.292544e+01, +1.685592e+01,
+    -9.634968e+00, +2.006092e+01, +3.857814e+01, -3.604009e+00, +1.408671e+01, +3.997835e+01, -3.270529e+00, -2.190056e-02, +6.598868e+00,
+    +1.161877e+01, -1.567425e+01, -8.160614e+00, +6.545923e+00, +3.435313e+01, +2.641460e+01, +1.463454e+01, +1.131209e+01, -4.705271e+01,
+    +7.371371e+00, -1.615314e+01, +4.296809e-01, -2.533042e+00, -1.323628e+01, +8.053715e-02, -6.969213e+00, -2.448302e+01, -1.227614e+01,
+    -1.846202e+00, +8.814578e+00, -6.356594e+00, +1.220597e+01, +1.930455e+01, -8.281094e+00, -6.198297e+00, -1.153608e+01, -2.837150e+00,
+    +2.458192e+00, +2.089959e+01, -1.428414e+01, +6.638387e+00, +1.334152e+01, -1.765438e+00, -6.964474e+00, -1.437550e+01, -8.480874e+00,
+    +6.643665e-01, +1.982717e+01, +2.110967e+00, -1.039539e+01, +2.894821e+00, -3.877220e+00, -2.551327e+00, -2.653252e+01, -9.803420e+00,
+    +3.060890e+00, +1.482090e+01, +2.616992e+00, -7.601184e+00, -6.183752e+01, +5.500872e+00, +2.623449e+00, +2.018057e+01, +5.572541e+00,
+    -3.272427e+00, +4.329254e+00, -1.128125e+00, -1.617681e+00, +3.053429e-01, +6.563217e-02, -3.490282e+00, +1.915745e+00, +2.850537e+00,
+    +1.022748e+01, +3.061555e+01, -2.632999e+01, +6.811377e+00, +1.230467e+01, -1.315940e+01, +7.436355e-01, +9.115315e+00, -2.504598e+00,
+    -1.422882e+01, -1.370495e+01, -6.121208e+00, -1.320741e+01, -3.413465e+01, -1.354614e+00, +1.428595e+01, +2.918944e+01, +1.206789e+01,
+    //07
+    -1.347773e+00, +1.210459e+00, +4.353253e+00, -2.754869e+00, -5.924885e+00, -5.466073e+00, -6.027919e+00, -2.158401e-01, -1.033512e+01,
+    -1.351183e+01, +3.080365e+01, +2.979804e+01, +4.625202e+00, +9.223238e+00, +3.101486e-01, -2.872695e+00, +6.298742e+00, +9.654314e+00,
+    -2.344840e+00, -5.701632e+00, +1.252774e+00, -2.665297e+01, +2.053354e+01, +1.102813e+00, -6.925038e+00, +5.382206e-01, +4.854299e+00,
+    +5.718797e+00, -1.062719e+01, +5.236553e+00, +1.181549e+01, -4.370035e+00, +9.067308e+00, +9.232880e+00, -6.355114e+00, +6.161280e-01,
+    -1.700468e-01, +7.347011e+00, -8.916258e+00, -4.116983e+00, +3.917548e+01, -1.309812e+01, -6.358251e+00, +2.862604e+00, -1.566809e+01,
+    +7.615778e-02, -4.738739e+00, -5.641343e+00, +1.685964e+00, +4.745935e+00, +2.477947e+00, +3.806108e+00, +2.551386e+01, +2.398814e+01,
+    -1.086050e+01, +2.925888e+01, -3.108543e+01, -5.932349e+00, +2.235179e+01, -1.124004e+01, -1.680863e+00, -3.435354e+00, -8.486034e+00,
+    +1.780658e+01, -1.890625e+01, +4.904512e+00, +4.385912e+00, +1.574419e+01, +4.370200e+01, +1.061501e+01, +1.672362e+01, -3.672211e+01,
+    -3.593810e+00, -2.079033e+00, -8.426350e+00, -1.066210e+01, +1.200545e+01, -6.363387e+00, -1.882517e+01, -5.558332e-01, -8.783347e+00,
+    +7.749065e+00, -7.516942e+00, +1.564872e-01, +1.513755e+01, +7.285735e+00, -1.421465e+00, -5.021023e+00, -1.319897e+01, -4.871519e+00,
+    +1.466856e+01, -8.544053e+00, +1.061991e+00, +3.001952e+00, +8.001026e+00, +6.887379e+00, -5.639363e+00, -1.658589e+01, -8.202721e+00,
+    -4.671718e-01, +2.159214e+01, +4.083005e+00, -9.753338e+00, -4.131328e-01, -4.630397e-01, -1.575296e+00, -2.347460e+01, -1.464725e+01,
+    +2.894683e+00, +8.779169e+00, +1.053053e+01, +1.088447e+01, -7.558598e+01, +6.711307e-01, -5.464119e-01, +1.542287e+01, +1.508198e+01,
+    -5.201972e+00, +8.739142e-01, -2.604806e-01, -3.326230e+00, -4.195867e+00, +2.179799e-02, -1.181126e+00, +2.313954e+00, -6.234964e-01,
+    +2.431008e+01, -1.942781e+01, -2.394426e+01, +1.304962e+01, -1.594502e+01, -1.157659e+01, +4.658628e+00, -1.932028e+00, -6.322603e-02,
+    -9.201562e+00, -1.430546e+01, -9.317871e+00, -9.729060e+00, -3.113520e+01, -9.421195e+00, +9.003660e+00, +3.228956e+01, +1.316008e+01,
+    //08
+    +1.763309e+01, +1.082085e+01, -5.455371e+00, +7.990729e+00, +2.146287e+00, -1.743572e+01, +8.536189e+00, -5.055791e+00, -1.109937e+01,
+    -1.181939e+01, +2.908992e+01, -3.632673e+01, +5.295835e+00, -2.542800e+00, -8.981952e+00, -5.183399e-02, +2.369991e+00, -1.095523e+00,
+    -1.539069e+00, +3.329308e+00, -4.780491e-01, -1.244448e+01, +4.105187e+01, -2.357592e+01, +1.550529e+00, +1.428276e+01, +1.872576e+00,
+    -5.163580e+00, +2.676850e+00, +5.004817e+00, +4.102952e+00, +4.215620e+00, +1.171875e+00, +3.461201e+00, +6.785747e+00, -3.920243e+00,
+    -2.717785e+00, +1.563233e+01, -1.296216e+01, -5.648931e+00, +3.318474e+01, -5.570351e+00, -1.381608e+00, -3.161768e+00, -1.818153e+01,
+    -5.469570e-01, +1.832331e+00, -1.205879e+01, +2.328446e+00, +5.634113e+00, -2.000396e+00, +4.321946e+00, +1.571178e+01, +3.151820e+01,
+    -8.560007e+00, +1.849281e+01, -7.730364e+01, -6.111435e-01, +1.076736e+01, -4.922560e+01, -4.210883e+00, -3.211415e+00, -1.210141e+01,
+    +1.516324e+01, -2.422499e+01, +1.147055e+01, +7.734382e+00, +7.841867e-02, +5.838903e+01, +9.583712e+00, +1.895057e+01, -2.192822e+01,
+    +3.443900e+00, +8.404132e+00, +1.737608e+01, +3.802418e+00, +1.022809e+01, +9.213651e+00, +2.739844e+00, +1.414472e+01, +9.690320e+00,
+    +7.452942e+00, -1.934917e+01, +1.915231e+01, +1.282455e+01, -2.065021e+00, +1.550203e+01, -1.824232e+00, -1.327938e+01, -6.205707e+00,
+    +1.300533e+01, -2.750988e+01, +2.439277e+01, -3.896225e-01, +6.621192e+00, +1.321690e+01, -4.439280e+00, -1.273841e+01, -8.183881e+00,
+    -1.125451e-02, +1.357150e+01, +1.102031e+01, -8.885517e+00, -2.033981e+00, +3.952759e+00, -3.405858e+00, -1.762413e+01, -2.135540e+01,
+    -2.112768e-01, +6.544921e+00, +1.540374e+01, +9.962342e+00, -6.400652e+01, -1.337438e+01, -1.865926e+00, +1.151593e+01, +2.069110e+01,
+    +6.133731e-01, +4.772892e+00, -2.087465e+00, +3.942395e+00, -3.083281e+00, +4.599736e+00, +1.183623e+00, +3.003992e+00, +5.674395e+00,
+    +1.537585e+01, -4.240115e+01, +2.032017e+01, +8.263465e+00, -3.009933e+01, +8.660712e+00, +2.348002e+00, -9.737682e+00, +3.486468e+00,
+    -3.745605e+00, -1.398873e+01, -1.045873e+01, -7.156803e+00, -2.013240e+01, -2.264282e+01, +5.440944e+00, +2.634300e+01, +1.730532e+01,
+    //09
+    +8.032495e+00, +7.491438e-01, +9.576362e+00, -8.050284e-02, +2.890255e+00, +2.862733e+00, -1.556941e+00, +1.084506e+01, +6.629603e+00,
+    +1.380370e+01, -4.657310e+01, +2.852913e+00, -1.625969e+00, -1.911796e+01, -3.818252e+00, -2.575462e+00, -7.287553e+00, +1.127543e+00,
+    -1.653931e+00, +1.340545e+00, -6.432660e+00, +2.682558e+01, -2.831663e+01, +1.809878e+01, +1.016270e+01, -1.197051e+01, +4.478607e+00,
+    +2.750489e+00, -1.562570e-01, +8.976129e+00, +1.105901e+00, -4.385247e+00, -4.051629e+00, +1.790642e+00, +6.510644e-01, +3.858369e+00,
+    -8.472047e+00, -1.218985e+01, -2.895854e+00, +4.501713e+01, +2.910623e+01, -9.784786e+00, -1.326808e+01, -7.837936e+00, -1.267088e+01,
+    +2.110935e+00, -1.385516e+01, +2.029376e+00, +1.312332e+01, +2.719779e+01, +1.204538e+01, -3.317683e-01, +4.252700e+00, -4.965518e-02,
+    +8.662360e+00, -2.054620e+01, +3.975183e+01, +4.246180e+00, -3.496708e+01, +5.803487e+01, +2.526696e+00, +4.809230e+00, +1.420187e+01,
+    +5.570994e+00, +3.723469e+01, +2.077850e+01, +6.314829e-01, -1.995084e+01, -5.324574e+01, +1.426669e+01, -5.363433e+01, -2.357563e+01,
+    -6.292236e+00, +7.005274e+00, -3.984992e-01, +1.221685e+01, -6.053690e+00, +1.102431e+01, +1.146616e+01, -1.162311e+00, -2.775970e+00,
+    +5.218718e+00, +1.834790e+01, -1.201798e+00, -2.758364e+01, +1.622138e+01, -9.351953e+00, -3.832920e+00, +3.418218e-01, -2.098782e+00,
+    -1.035967e+01, +3.699917e+01, -9.787624e+00, -7.834431e+00, -3.734697e+00, -8.905284e+00, -1.927584e-01, -2.164370e+00, -4.446550e+00,
+    -7.901153e+00, +1.273063e+01, -2.716767e+00, -1.550896e+01, -2.520351e+01, -9.155032e+00, -3.101387e-01, +1.961553e+00, +2.041422e+00,
+    +1.825422e+00, +1.719506e+01, -5.812994e+00, -2.825900e+01, -3.191653e+01, +6.872770e+00, +4.051697e+00, +1.695612e+01, +4.664121e+00,
+    +6.027187e+00, -3.890557e+00, -6.192878e-01, +1.388676e+00, -9.883495e-01, +9.805869e-01, -7.218993e-01, +2.157620e+00, +6.706311e+00,
+    -1.755474e+01, +3.528116e+01, -8.156897e+00, -1.975875e+01, +3.961895e+01, -5.199678e+00, -4.134009e+00, +1.000862e+01, -2.134286e+00,
+    -2.528045e+01, -2.478781e+01, -8.512626e+00, +2.187524e+01, +1.779167e+01, +7.569000e+00, +1.077985e+01, +1.263144e+01, +6.032297e-01,
+    //10
+    -3.082652e+00, -1.234538e+01, -1.305408e+00, +4.478857e+00, -1.131838e-01, -2.086387e+00, +5.828168e+00, -9.994114e+00, -6.471833e+00,
+    +1.427363e+00, -6.492803e+00, +2.822251e+01, +9.947666e-01, +2.500105e+00, +1.564002e+01, -2.784572e+00, +5.252377e-01, +5.673590e+00,
+    -3.853025e+00, -3.823103e+00, -2.554007e+00, -6.864650e+00, -1.362226e+01, +2.041849e+01, -1.061098e+01, -1.281557e+01, +7.274621e+00,
+    -1.543058e+00, -7.334415e-01, -3.407318e+00, +2.548124e+00, +8.255561e+00, -2.026687e+00, +2.453267e+00, +4.913810e+00, -1.394815e+01,
+    -1.225761e+01, -7.223928e+00, -6.878324e+00, +3.170680e+01, +4.489373e+01, -1.202815e+01, -2.081871e+01, +8.738080e+00, -2.283517e+01,
+    +3.896376e+00, -1.200030e+01, -9.650578e-01, +5.758974e+00, +2.929560e+01, +1.664785e+01, -2.007196e+00, +2.150597e+00, +3.813805e+00,
+    -2.917661e+00, +1.060467e+01, +3.200783e+01, -8.590713e+00, +2.121564e+01, +5.219964e+01, -3.248244e+00, +1.106075e+01, +5.579156e+00,
+    +3.364719e-01, +1.872424e+01, +4.391417e+01, +3.853479e+00, -1.672645e+01, -6.140897e+01, +2.238670e+00, -3.170638e+01, -3.614793e+01,
+    +4.766053e+00, -1.258538e+01, -6.523361e+00, +4.766497e-01, -8.974476e+00, +4.029370e+00, -5.654735e+00, -1.147120e+01, -3.871924e+00,
+    +1.056619e+01, +1.511729e+01, -4.125513e+00, -5.430860e+00, -4.924823e+00, -1.107705e+01, -4.460272e+00, +2.033203e+00, -7.030040e+00,
+    +3.298921e+00, +2.679002e+01, -9.420463e+00, +6.270080e-01, -8.315824e+00, -1.176043e+01, -1.468038e+00, -4.422624e+00, -5.466409e+00,
+    -8.845292e+00, +1.427366e+01, -9.931540e-01, -8.928104e+00, -3.312859e+01, -1.008227e+01, -1.041689e+00, +2.175326e+00, +5.426015e-01,
+    -1.124397e+00, +1.611920e+01, -1.891838e+00, -3.072054e+00, -5.277698e+01, +6.438090e+00, +3.367263e+00, +1.253806e+01, +1.230121e+01,
+    -3.371656e+00, -1.064770e+00, -4.709352e-01, -5.909112e+00, +1.133194e+00, +2.328644e+00, +6.424256e-01, +1.169942e+00, +1.653195e+00,
+    +7.807084e+00, +2.264129e+01, -2.039690e+01, +5.394149e+00, +1.663274e+01, -1.801290e+01, +3.644198e+00, +9.988630e+00, -1.558689e+00,
+    -1.689535e+01, -2.995898e+01, -1.113763e+01, +8.840822e+00, +2.768925e+01, +9.708502e+00, +4.174944e+00, +2.064367e+01, +4.104541e+00,
+    //11
+    +6.474857e+00, +4.370410e+00, -3.726741e+00, +1.714223e+01, -4.660356e+00, -6.729325e+00, +2.142190e+00, -6.393621e-01, -3.417947e+00,
+    -1.028133e+01, +2.716081e+01, +1.525234e+01, -1.315126e-01, +9.286991e+00, +1.288605e+01, -2.293043e+00, +6.766611e+00, +7.373128e+00,
+    -4.081494e+00, -5.758909e+00, -6.930811e-01, -1.670121e+01, +2.239893e+01, +7.329469e+00, -1.314781e+01, +8.442077e-01, +2.461498e+00,
+    +7.644238e+00, -1.214908e+01, -1.733981e+00, +1.113092e+01, -9.320357e+00, +6.661090e+00, +7.863909e+00, -4.635284e+00, -6.526716e+00,
+    -1.317535e+01, -4.382384e+00, -1.005630e+01, +1.850590e+01, +5.214589e+01, -8.803167e+00, -1.806066e+01, +7.208479e+00, -2.435570e+01,
+    +2.963264e+00, -7.656936e+00, -5.373577e+00, +2.659618e+00, +2.742160e+01, +2.206657e+01, -2.585871e+00, +8.911409e-01, +4.680682e+00,
+    -4.488900e+00, +1.639963e+01, -1.054194e+01, -9.581554e+00, +3.204181e+01, -2.458725e+01, -1.168464e+00, +5.849862e+00, -9.345181e+00,
+    -3.394573e-01, +1.464495e+01, +6.313146e+01, -6.502901e-01, -9.856755e+00, -5.873756e+01, +2.617065e+00, -1.019008e+01, -5.697296e+01,
+    -1.010546e+01, -1.116157e-01, -1.191154e+01, -9.851189e+00, +9.326206e+00, -7.261579e+00, -1.429168e+01, +5.109164e+00, -4.102198e+00,
+    +1.228689e+01, +8.942837e+00, -1.030664e+00, +7.368343e+00, -2.605322e+01, -3.264862e+00, -5.000701e+00, -4.119013e-01, -6.354844e+00,
+    +1.466591e+01, -3.032772e-01, +4.695796e+00, +1.183513e+00, -1.541335e+01, -5.102512e+00, -3.329923e+00, -7.530793e+00, -1.086880e+00,
+    -7.703195e+00, +1.148960e+01, +1.384046e+00, -5.807594e+00, -3.191016e+01, -1.334203e+01, -8.515789e-02, +1.326018e+00, +1.380153e-04,
+    -2.245920e+00, +1.032525e+01, +6.818910e+00, +1.394542e+01, -6.559149e+01, +2.331513e+00, +3.090890e+00, +5.825459e+00, +2.024021e+01,
+    -6.148046e+00, -4.027401e+00, +1.543220e+00, +8.665835e+00, +6.445761e+00, +1.635477e+00, +1.593251e+00, +1.365430e+00, -3.296212e+00,
+    +1.919362e+01, -1.858591e+01, -1.843712e+01, +1.538644e+01, -1.996776e+01, -1.527927e+01, +8.199604e+00, -2.080465e+00, +2.190406e-01,
+    -6.717407e+00, -3.274434e+01, -1.529648e+01, +3.764546e+00, +3.216046e+01, +1.062173e+01, +3.516092e+00, +2.139472e+01, +3.126648e+00,
+    //12
+    +1.687935e+01, +1.318492e+01, -4.776509e+00, +1.096381e+01, -2.667470e+00, -5.693006e+00, +1.230026e+01, +5.899998e+00, -1.169305e+01,
+    -8.952376e+00, +2.466942e+01, -3.685586e+01, +1.262619e+00, +5.111987e-01, -1.296599e+01, +6.587761e-01, +1.211350e+00, -6.369584e-01,
+    -2.249808e+00, -2.471996e+00, +3.839995e-01, -6.686487e+00, +4.620336e+01, -1.540003e+01, -1.314799e+00, +1.770495e+01, -5.970949e+00,
+    -3.459384e+00, +5.435548e-03, +4.317094e+00, +6.656525e+00, +3.169751e+00, +7.337943e+00, +1.022781e+01, +6.096124e+00, -4.017538e+00,
+    -9.892888e+00, -6.457271e-01, -1.548543e+01, +6.888849e+00, +5.602308e+01, -3.251180e+00, -7.803442e+00, -6.535023e+00, -2.172704e+01,
+    +5.905701e-01, +5.276761e-01, -1.197423e+01, +4.128998e+00, +1.949662e+01, +2.609048e+01, -1.014907e+00, -6.192154e-01, +4.263594e+00,
+    -4.032223e+00, +1.566017e+01, -4.466910e+01, -2.855469e+00, +1.313481e+01, -7.868514e+01, -2.692681e+00, +4.012419e+00, -1.254719e+01,
+    +7.134445e+00, +1.469540e+01, +6.147584e+01, -5.438939e-01, -1.090958e+01, -4.052286e+01, -7.490330e+00, +8.153682e+00, -6.719934e+01,
+    -9.921741e-01, +9.283849e+00, +1.705577e+01, +5.310379e+00, +1.024791e+01, +5.737171e+00, +5.789006e+00, +1.052602e+01, +1.573452e+01,
+    +8.905754e+00, +4.267263e+00, +1.177562e+01, +7.120479e+00, -3.894947e+01, +1.440400e+01, -2.687114e+00, -4.147135e+00, -1.779979e+00,
+    +1.210960e+01, -1.790117e+01, +2.596973e+01, -2.478295e+00, -1.609977e+01, +1.208611e+00, -3.303362e+00, -5.312184e+00, +1.602405e+00,
+    -7.130155e+00, +1.522998e+00, +8.159577e+00, -7.703075e+00, -2.083764e+01, -1.968059e+01, -1.064207e+00, +4.487634e-01, +9.233098e-01,
+    -3.554496e+00, +5.460834e+00, +1.314265e+01, +1.103640e+01, -5.350808e+01, -1.033439e+01, +1.034005e+00, +5.206030e+00, +2.272919e+01,
+    +1.039957e+00, -6.404757e+00, +1.097301e-01, -2.660102e-01, +3.321862e-01, +6.125718e+00, +5.394325e+00, -4.359308e+00, +1.579524e+00,
+    +1.111681e+01, -3.803167e+01, +1.224310e+01, +1.046651e+01, -3.585821e+01, +1.812443e+01, +2.880477e+00, -1.159795e+01, +4.052144e+00,
+    +1.258107e+00, -3.167526e+01, -2.072785e+01, +5.111427e+00, +3.018446e+01, +1.274963e+01, +3.237485e+00, +1.383746e+01, +6.213976e+00,
+    //13
+    -6.653650e+00, -7.040388e+00, -5.791283e+00, -6.567266e+00, +4.981280e+00, -1.764023e-01, +9.330060e-01, +7.259941e+00, +4.960814e+00,
+    +8.264840e+00, -2.872097e+01, -3.680221e+00, +4.111637e+00, -3.242206e+01, -1.086667e+00, -3.586097e+00, -7.952426e+00, -4.281665e+00,
+    -1.063213e-01, +1.671631e+00, -3.138693e+00, +1.992777e+01, -1.967926e+01, +1.130410e+01, +1.258876e+01, -2.390645e+01, +6.463472e+00,
+    +1.927152e+00, +5.927331e+00, +5.853733e+00, +1.846148e+00, -1.690013e+00, -4.609281e+00, -4.977779e+00, -3.472172e+00, +3.321551e-01,
+    -6.540364e+00, -7.809755e+00, -5.769398e-01, +5.734615e+01, +2.430434e+01, -6.436929e+00, -1.501990e+01, +4.108819e+00, -1.460098e+01,
+    -1.163823e+00, -5.112250e+00, +1.912685e+00, +6.786849e+00, +2.031118e+01, +6.925164e+00, -1.054337e+01, -4.633836e+01, -9.321041e+00,
+    +1.206001e+01, -8.628271e+00, +2.890014e+01, -5.063128e+00, -3.894032e+01, +7.056167e+01, +1.043842e+01, +6.705230e+00, +1.863684e+01,
+    +2.971914e+00, +3.195642e+01, +1.723140e+01, +1.468216e+01, -6.352689e+01, -5.730064e+01, -1.925089e+01, -6.281214e+00, +4.620646e+01,
+    +1.615526e-01, +9.004580e+00, +6.825137e+00, +1.265664e+01, -7.782007e+00, +5.182854e+00, +1.325680e+01, +6.049578e+00, -1.279730e+00,
+    +7.345608e+00, +8.327761e+00, -1.994664e+00, -5.116965e+01, +1.069652e+01, -8.113008e+00, +1.332986e+01, +2.058075e+01, -3.838529e+00,
+    -6.394922e+00, +2.256262e+01, -6.512378e+00, -1.869972e+01, -8.330724e+00, -1.317642e+01, +1.331118e+01, +1.267328e+01, +9.904924e-01,
+    -7.030877e+00, +2.269243e+00, -5.844963e+00, +5.662291e+00, -3.223607e+01, -7.731381e+00, +1.210396e+01, +3.057431e+01, +4.260287e+00,
+    +3.478442e-01, +7.761451e+00, -3.171852e+00, -9.538928e+00, -9.953875e+00, +5.510212e+00, -4.689601e+00, +3.383723e+00, +7.066370e+00,
+    +5.439585e-01, +2.568331e+00, -3.824630e+00, +1.023062e+00, +1.635427e+00, +1.290399e-01, -3.761150e+00, -2.051017e+00, -1.141117e+00,
+    -1.526964e+01, +1.848587e+01, -6.003237e+00, -2.111644e+01, +5.604420e+01, -3.379238e+00, -6.032685e+00, +8.635325e+00, -4.356960e+00,
+    -1.062022e+01, -1.089102e+01, -3.007073e+00, +4.029672e+01, +5.063742e+01, +1.605265e+01, -2.321901e+01, -2.659309e+01, -6.195206e+00,
+    //14
+    -1.080353e+00, -3.995511e+00, -7.768882e+00, +3.105193e+00, -8.713290e+00, -2.515849e+00, -2.701001e-01, -3.000705e+00, -6.164767e-01,
+    +2.362166e+00, -1.504103e+00, +1.256561e+01, -2.690111e+00, -4.143010e+00, +2.986531e+01, -5.668140e-01, +1.749580e+00, -2.788220e+00,
+    -3.087198e+00, -1.130609e+00, -1.652725e+00, -3.708722e+00, -1.474736e+01, +1.538108e+01, -1.455635e+01, -1.711863e+01, +8.057850e+00,
+    -1.130487e+00, +2.871948e+00, -3.439709e+00, +4.931008e+00, +3.117941e-01, -1.323939e+01, -2.858385e+00, +8.572605e+00, -1.259344e+01,
+    -9.346490e+00, -3.539993e+00, -4.081826e+00, +4.314201e+01, +4.155469e+01, -9.248276e+00, -2.459032e+01, +2.185434e+01, -2.474980e+01,
+    +1.176824e+00, -3.719853e+00, +9.836056e-02, -1.901247e+00, +2.626878e+01, +7.514940e+00, -9.427155e+00, -4.148127e+01, -1.598316e+01,
+    -4.511443e-01, +8.228615e+00, +2.316166e+01, -1.247404e+01, +2.585216e+01, +5.888817e+01, +6.044468e-01, +1.449784e+01, +8.579987e+00,
+    -2.382487e+01, +2.487958e+01, +5.269700e+01, +1.209714e+01, -4.099697e+01, -6.124905e+01, -2.292308e+01, -1.881400e+01, +6.428551e+01,
+    -8.359164e+00, -1.276373e+01, +1.596343e+00, -3.618188e-01, -1.208181e+01, -6.143394e+00, +5.069538e+00, -7.886537e+00, -2.913815e-01,
+    +8.703111e+00, +9.810890e+00, -4.732941e+00, -2.132986e+01, -1.781159e+01, -1.113652e+01, +9.481755e+00, +2.505595e+01, -8.061785e+00,
+    +9.449323e-01, +1.677494e+01, -5.859770e+00, -1.493755e-01, -1.922684e+01, -1.867146e+01, +9.682487e+00, +1.135833e+01, +1.772149e+00,
+    -4.434457e+00, -3.753450e+00, -9.969200e-01, +1.130366e+01, -3.935160e+01, -4.999796e+00, +3.725983e+00, +3.258332e+01, +8.147753e+00,
+    -1.888780e+00, +9.413060e+00, -2.884966e+00, +5.283785e+00, -2.491603e+01, +8.078630e+00, +3.984640e+00, -1.015361e+01, +1.586069e+01,
+    -7.039797e-01, +3.155433e-01, -2.833475e+00, +1.468861e+00, -2.458997e+00, +1.571438e+00, +5.086794e+00, -2.201720e-01, -1.156762e+00,
+    +4.305049e+00, +1.141718e+01, -1.139811e+01, +7.528499e+00, +2.991365e+01, -2.166936e+01, +5.363668e+00, +4.408127e+00, -3.526007e+00,
+    -2.674509e+00, -1.680257e+01, -4.516851e+00, +2.256116e+01, +6.479672e+01, +1.742456e+01, -2.038589e+01, -2.384757e+01, -1.016234e+01,
+    //15
+    +7.464747e+00, +6.967625e+00, -5.230569e+00, +1.021657e+01, +5.182274e-01, +1.221725e+00, +3.650568e+00, -3.114309e+00, -1.623573e+00,
+    -4.762046e+00, +1.733029e+01, +5.292256e+00, -9.963869e+00, +1.522597e+01, +2.842995e+01, +2.401717e+00, +8.279816e+00, -1.404789e+00,
+    -3.365759e+00, -6.805647e-01, -1.926560e+00, -1.006359e+01, +9.872154e+00, +7.915734e+00, -1.922827e+01, +5.804562e+00, -1.906922e+00,
+    +9.750141e+00, -6.944394e+00, -5.877403e+00, +6.658310e+00, -1.059161e+01, -3.664549e+00, +6.385608e+00, -1.073899e+01, -6.264877e+00,
+    -9.494820e+00, -2.542996e+00, -6.060022e+00, +2.809680e+01, +5.258962e+01, -6.930132e+00, -2.275633e+01, +1.760924e+01, -2.269953e+01,
+    +1.441619e+00, -1.947975e+00, -2.580604e+00, -5.064907e+00, +2.476073e+01, +1.213304e+01, -9.687325e+00, -2.845107e+01, -3.006998e+01,
+    -1.479432e+00, +1.000602e+01, -3.607928e-01, -1.029225e+01, +3.299521e+01, -3.942799e+01, -1.438533e+00, +1.106146e+01, -9.156480e+00,
+    -3.549773e+01, +2.583839e+01, +6.536022e+01, +6.733060e+00, -1.116044e+01, -6.638085e+01, -1.321682e+01, -2.208634e+01, +4.964795e+01,
+    -6.475195e+00, +2.144157e+00, -1.056233e+01, -8.969793e+00, +6.001604e+00, -8.405200e+00, -6.119635e+00, +6.892823e+00, +1.062850e-01,
+    +8.813326e+00, +7.068655e+00, -3.815523e+00, +2.161510e-01, -4.602177e+01, -3.721884e+00, +3.419294e+00, +2.316905e+01, -2.266450e+00,
+    +9.124289e+00, -7.776948e-01, +2.010168e+00, +6.110512e+00, -3.182271e+01, -1.174035e+01, +3.312948e+00, +9.825352e+00, +9.043628e+00,
+    -2.713613e+00, -5.754194e+00, -5.430938e-01, +7.792651e+00, -3.113706e+01, -7.779470e+00, +1.599364e+00, +2.760441e+01, +1.583226e+01,
+    -2.575068e+00, +6.279264e+00, +2.216054e+00, +1.504946e+01, -3.479242e+01, +8.753451e+00, +9.077231e+00, -1.934233e+01, +2.014466e+01,
+    -8.076939e+00, +2.197779e+00, +5.435587e-02, -2.569121e+00, +5.835917e-01, -7.018003e+00, -7.639874e-01, +2.899886e+00, -3.391518e-01,
+    +1.180659e+01, -1.883302e+01, -8.950185e+00, +2.075908e+01, -1.728867e+01, -1.971331e+01, +9.746998e+00, -1.087490e+01, -1.759724e+00,
+    +1.608921e+00, -1.909922e+01, -4.678649e+00, +1.484125e+01, +6.841040e+01, +2.216597e+01, -9.561273e+00, -2.517166e+01, -1.982933e+01,
+    //16
+    +4.663930e+00, -3.995825e+00, -7.851363e+00, -3.964799e+00, -6.016114e+00, -2.884196e+00, +2.743927e+00, -2.868990e+00, -2.815784e-01,
+    -4.140787e+00, +1.260401e+01, -2.660059e+01, -8.143856e+00, +1.184049e+01, -1.630881e+01, +4.305795e+00, +1.162449e-01, -6.475038e+00,
+    -7.995727e-01, +7.560698e-01, -5.109450e-01, -4.035023e+00, +3.169511e+01, -8.542307e+00, -4.685473e+00, +2.619710e+01, -1.681164e+01,
+    -1.559309e+00, +2.164652e+00, +1.349771e+00, +6.580721e+00, +4.458829e+00, +4.474180e+00, +8.700965e+00, -1.331730e-01, -3.688296e-01,
+    -6.609528e+00, -1.584664e+00, -9.466818e+00, +1.444157e+01, +6.144335e+01, -3.263297e+00, -1.191661e+01, -5.444052e-01, -1.561229e+01,
+    +1.290354e-01, +8.949269e-01, -5.546759e+00, -1.863616e+00, +1.737880e+01, +1.619169e+01, -7.630258e+00, -1.785314e+01, -4.357402e+01,
+    +6.221917e-01, +1.301471e+01, -2.178190e+01, -5.053785e+00, +9.794932e+00, -1.016776e+02, -1.918613e+00, +1.218599e+01, -1.231528e+01,
+    -2.195087e+01, +3.009855e+01, +4.870167e+01, +2.997147e+00, +2.321064e+00, -7.341374e+01, -1.790716e+01, -1.437305e+01, +2.559541e+01,
+    +8.227376e+00, +6.524357e+00, +2.275856e+01, +9.727072e+00, +1.167113e+01, +4.149747e+00, +3.928943e+00, +1.311452e+01, +1.617003e+01,
+    +6.573595e+00, +5.514589e+00, +3.143936e+00, +5.068987e+00, -6.231153e+01, +1.336413e+01, +9.502610e-01, +1.699324e+01, +9.509603e+00,
+    +6.685212e+00, -1.117148e+01, +1.592499e+01, +2.794756e+00, -3.574193e+01, -2.326211e+00, -3.198592e-02, +1.249254e+01, +1.342228e+01,
+    -5.452139e+00, -5.766662e+00, +8.643006e-01, -1.456790e+00, -1.181716e+01, -1.821274e+01, +1.760751e-01, +2.008780e+01, +2.469470e+01,
+    -2.527920e+00, +1.912035e+00, +6.221956e+00, +9.506731e+00, -2.598238e+01, +3.231317e+00, +6.467244e+00, -1.510513e+01, +1.680738e+01,
+    +1.383755e+00, +8.614724e-01, +2.293332e+00, +1.911004e+00, +9.709488e-02, -1.490422e+00, -3.892320e+00, +3.480238e+00, -6.149399e-02,
+    +4.379538e+00, -3.097653e+01, +7.964156e+00, +1.614954e+01, -4.140849e+01, +2.213056e+01, +3.965024e+00, -1.769376e+01, +4.562712e+00,
+    +6.630991e+00, -1.833112e+01, -7.580825e+00, +1.517958e+01, +5.846317e+01, +3.585271e+01, -1.619401e+00, -2.865987e+01, -2.487154e+01,
+};
+
+#endif /// of __ESPCNDATA_H__
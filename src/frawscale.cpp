@@ -4,6 +4,7 @@
 
 #include "frawscale.h"
 #include "minmax.h"
+#include "threadpool.h"
 
 FRawScaleWeightsTable::FRawScaleWeightsTable( FRAWGenericFilter* pFilter, unsigned uDstSize,
                                               unsigned uSrcSize )
@@ -292,13 +293,11 @@ void FRAWResizeEngine::horizontalFilter( const float* src, const unsigned height
     // allocate and calculate the contributions
     FRawScaleWeightsTable weightsTable( _pFilter, dst_width, src_width );
 
-    unsigned y = 0;
-    unsigned x = 0;
-    unsigned i = 0;
-
-    #pragma omp parallel for private(x,i)
-    for ( y = 0; y < height; y++)
+    libsrcnn::parallelFor( height, [&]( unsigned y )
     {
+        unsigned x = 0;
+        unsigned i = 0;
+
         const \
         float* src_bits = &src[ ( ( y + src_offset_y ) * src_width ) + src_offset_x  ];
         float* dst_bits = &dst[ y * dst_width ];
@@ -328,7 +327,7 @@ void FRAWResizeEngine::horizontalFilter( const float* src, const unsigned height
             *dst_bits = (float)gray;
             dst_bits++;
         }
-    }
+    } );
 }
 
 /// Performs vertical image filtering
@@ -344,13 +343,11 @@ void FRAWResizeEngine::verticalFilter( const float* src, unsigned width, unsigne
     float*    dst_base  = dst;
     unsigned  src_pitch = width;
 
-    unsigned y = 0;
-    unsigned x = 0;
-    unsigned i = 0;
-
-    #pragma omp parallel for private(y,i)
-    for ( x = 0; x < width; x++)
+    libsrcnn::parallelFor( width, [&]( unsigned x )
     {
+        unsigned y = 0;
+        unsigned i = 0;
+
         // work on column x in dst
         const unsigned  index    = x;
         float*          dst_bits = dst_base + index;
@@ -381,5 +378,5 @@ void FRAWResizeEngine::verticalFilter( const float* src, unsigned width, unsigne
             *dst_bits = (float)gray;
             dst_bits += dst_pitch;
         }
-    }
+    } );
 }
@@ -0,0 +1,567 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <map>
+#include <vector>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
+#include "hugemem.h"
+#include "threadpool.h"
+#include "minmax.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace libsrcnn {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// planes of this size or more go mapped for huge pages.
+#ifndef HUGEMEM_MIN_BYTES
+#define HUGEMEM_MIN_BYTES       ( 2ULL << 20 )
+#endif
+// huge page size when system tells nothing.
+#define HUGEMEM_DEFAULT_PAGE    ( 2ULL << 20 )
+// planes start at one of colours of this step inside their mapping, not
+// all at a huge page boundary, so same pixel of many planes ( eg. layer II
+// reading all of layer I ) falls into different cache sets.
+#define HUGEMEM_COLOUR_STEP     ( 4096 + 64 )
+#define HUGEMEM_COLOURS         16
+// freed mappings kept for next planes while calls run, at most.
+#ifndef HUGEMEM_CACHE_BYTES
+#define HUGEMEM_CACHE_BYTES     ( 1ULL << 30 )
+#endif
+
+typedef enum
+{
+    HUGEMEM_Plain = 0,          /// mapped, normal pages.
+    HUGEMEM_Advised,            /// MADV_HUGEPAGE.
+    HUGEMEM_Explicit            /// hugetlbfs pages.
+}HugeBacking;
+
+typedef struct
+{
+    char*               base;       /// start of mapping.
+    size_t              bytes;      /// bytes of plane.
+    size_t              length;     /// bytes mapped.
+    HugeBacking         backing;
+    bool                measured;
+    unsigned long long  huge;       /// bytes in huge pages, once measured.
+    unsigned long long  pendbytes;  /// bytes of uses before measured.
+    unsigned            pendcount;
+}HugeMapping;
+
+static SRCNNHugePagesType               huge_type = SRCNNH_Transparent;
+static std::mutex                       huge_lock;
+static std::map<void*,HugeMapping>      huge_maps;
+static std::vector<HugeMapping>         huge_cache;
+static size_t                           huge_cached = 0;
+// bytes of cache allowed, memory left under ceiling of running calls.
+static size_t                           huge_limit = HUGEMEM_CACHE_BYTES;
+static std::atomic<unsigned>            huge_colour( 0 );
+// statistics asked once, so mappings are measured before trimmed.
+static std::atomic<bool>                huge_watched( false );
+static std::atomic<unsigned long long>  huge_planes( 0 );
+static std::atomic<unsigned long long>  huge_explicit( 0 );
+static std::atomic<unsigned long long>  huge_advised( 0 );
+static std::atomic<unsigned long long>  huge_transparent( 0 );
+
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__linux__)
+// first number of file, 0 if none.
+static unsigned long long readNumber( const char* path, const char* key )
+{
+    FILE* fp = fopen( path, "r" );
+
+    if ( fp == NULL )
+        return 0;
+
+    unsigned long long value  = 0;
+    size_t             keylen = ( key != NULL ) ? strlen( key ) : 0;
+    char               line[256] = {0};
+
+    while( fgets( line, 256, fp ) != NULL )
+    {
+        if ( ( keylen == 0 ) || ( strncmp( line, key, keylen ) == 0 ) )
+        {
+            value = strtoull( &line[keylen], NULL, 10 );
+            break;
+        }
+    }
+
+    fclose( fp );
+
+    return value;
+}
+
+// size of transparent huge page, alignment of advised mapping.
+static size_t transparentPageSize()
+{
+    static size_t pagesz = 0;
+
+    if ( pagesz == 0 )
+    {
+        pagesz = readNumber( "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size",
+                             NULL );
+        pagesz = ( pagesz > 0 ) ? pagesz : HUGEMEM_DEFAULT_PAGE;
+    }
+
+    return pagesz;
+}
+
+// default size of hugetlbfs pages.
+static size_t explicitPageSize()
+{
+    static size_t pagesz = 0;
+
+    if ( pagesz == 0 )
+    {
+        pagesz = readNumber( "/proc/meminfo", "Hugepagesize:" ) * 1024;
+        pagesz = ( pagesz > 0 ) ? pagesz : HUGEMEM_DEFAULT_PAGE;
+    }
+
+    return pagesz;
+}
+
+inline size_t roundUp( size_t bytes, size_t pagesz )
+{
+    return ( bytes + pagesz - 1 ) / pagesz * pagesz;
+}
+
+static void* mapExplicit( size_t length )
+{
+#ifdef MAP_HUGETLB
+    // fails when no hugetlbfs pages are reserved.
+    void* addr = mmap( NULL, length, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+
+    return ( addr != MAP_FAILED ) ? addr : NULL;
+#else
+    return NULL;
+#endif /// of MAP_HUGETLB
+}
+
+// mapping aligned to huge page, so all of it may be huge.
+static void* mapAligned( size_t length, size_t pagesz, bool &advised )
+{
+    size_t span = length + pagesz;
+    char*  addr = (char*)mmap( NULL, span, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+    if ( (void*)addr == MAP_FAILED )
+        return NULL;
+
+    size_t head = ( pagesz - (uintptr_t)addr % pagesz ) % pagesz;
+    size_t tail = span - head - length;
+
+    if ( head > 0 )
+    {
+        munmap( addr, head );
+    }
+
+    if ( tail > 0 )
+    {
+        munmap( addr + head + length, tail );
+    }
+
+    addr += head;
+
+    advised = false;
+#ifdef MADV_HUGEPAGE
+    // fails when transparent huge pages are disabled.
+    advised = ( madvise( addr, length, MADV_HUGEPAGE ) == 0 );
+#endif
+
+    return addr;
+}
+
+// bytes of huge pages of each mapping starting at bases[] ( sorted ),
+// as kernel reports, by one pass of /proc/self/smaps. Mappings merged
+// into one area by kernel share its huge pages in order.
+static void anonHugeBytes( const std::vector<char*> &bases,
+                           const std::vector<size_t> &lengths,
+                           std::vector<unsigned long long> &huges )
+{
+    huges.assign( bases.size(), 0 );
+
+    FILE* fp = fopen( "/proc/self/smaps", "r" );
+
+    if ( fp == NULL )
+        return;
+
+    unsigned long long start = 0;
+    unsigned long long end   = 0;
+    char               line[512] = {0};
+
+    while( fgets( line, 512, fp ) != NULL )
+    {
+        unsigned long long lstart = 0;
+        unsigned long long lend   = 0;
+
+        // "start-end perms ..." begins each area.
+        if ( sscanf( line, "%llx-%llx ", &lstart, &lend ) == 2 )
+        {
+            start = lstart;
+            end   = lend;
+            continue;
+        }
+
+        if ( strncmp( line, "AnonHugePages:", 14 ) != 0 )
+            continue;
+
+        unsigned long long rest = strtoull( &line[14], NULL, 10 ) * 1024ULL;
+
+        for ( size_t cnt=0; ( cnt<bases.size() ) && ( rest > 0 ); cnt++ )
+        {
+            uintptr_t base = (uintptr_t)bases[cnt];
+
+            if ( ( base >= start ) && ( base < end ) )
+            {
+                huges[cnt] = MIN( rest, (unsigned long long)lengths[cnt] );
+                rest      -= huges[cnt];
+            }
+        }
+    }
+
+    fclose( fp );
+}
+#endif /// of __linux__
+
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__linux__)
+// mapping of a plane, cached one of same length first. pages of cached
+// ones sit on nodes of their last planes, so none taken while placed.
+static bool mapPlane( HugeMapping &mapping, SRCNNHugePagesType htype )
+{
+    size_t pagesz = ( htype == SRCNNH_Explicit ) ? explicitPageSize()
+                                                 : transparentPageSize();
+
+    size_t span = mapping.bytes + HUGEMEM_COLOURS * HUGEMEM_COLOUR_STEP;
+
+    mapping.length = roundUp( span, pagesz );
+
+    if ( parallelPlaced() == false )
+    {
+        std::lock_guard<std::mutex> guard( huge_lock );
+
+        for ( size_t cnt=0; cnt<huge_cache.size(); cnt++ )
+        {
+            if ( huge_cache[cnt].length == mapping.length )
+            {
+                size_t bytes = mapping.bytes;
+
+                mapping       = huge_cache[cnt];
+                mapping.bytes = bytes;
+                huge_cached  -= mapping.length;
+
+                huge_cache.erase( huge_cache.begin() + cnt );
+                return true;
+            }
+        }
+    }
+
+    mapping.base      = NULL;
+    mapping.measured  = false;
+    mapping.huge      = 0;
+    mapping.pendbytes = 0;
+    mapping.pendcount = 0;
+
+    if ( htype == SRCNNH_Explicit )
+    {
+        mapping.backing = HUGEMEM_Explicit;
+        mapping.base    = (char*)mapExplicit( mapping.length );
+    }
+
+    if ( mapping.base == NULL )
+    {
+        bool advised = false;
+
+        mapping.length  = roundUp( span, transparentPageSize() );
+        mapping.base    = (char*)mapAligned( mapping.length, transparentPageSize(),
+                                             advised );
+        mapping.backing = advised ? HUGEMEM_Advised : HUGEMEM_Plain;
+    }
+
+    return ( mapping.base != NULL );
+}
+#endif /// of __linux__
+
+float* allocFloats( size_t count )
+{
+#if defined(__linux__)
+    size_t             bytes = count * sizeof( float );
+    SRCNNHugePagesType htype = huge_type;
+
+    if ( ( bytes >= HUGEMEM_MIN_BYTES ) && ( htype != SRCNNH_None ) )
+    {
+        HugeMapping mapping;
+        memset( &mapping, 0, sizeof( HugeMapping ) );
+
+        mapping.bytes = bytes;
+
+        if ( mapPlane( mapping, htype ) == true )
+        {
+            unsigned colour = huge_colour++ % HUGEMEM_COLOURS;
+            char*    addr   = mapping.base + colour * HUGEMEM_COLOUR_STEP;
+
+            // huge pages of a mapping are known once measured.
+            if ( mapping.backing == HUGEMEM_Advised )
+            {
+                if ( mapping.measured == true )
+                {
+                    huge_transparent += MIN( mapping.huge,
+                                             (unsigned long long)bytes );
+                }
+                else
+                {
+                    mapping.pendbytes += bytes;
+                    mapping.pendcount++;
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> guard( huge_lock );
+
+                huge_maps[ addr ] = mapping;
+            }
+
+            huge_planes += bytes;
+
+            if ( mapping.backing == HUGEMEM_Explicit )
+                huge_explicit += bytes;
+            else
+            if ( mapping.backing == HUGEMEM_Advised )
+                huge_advised += bytes;
+
+            return (float*)addr;
+        }
+    }
+#endif /// of __linux__
+
+    return new float[ count ];
+}
+
+void freeFloats( float* buff )
+{
+    if ( buff == NULL )
+        return;
+
+#if defined(__linux__)
+    HugeMapping mapping;
+    bool        mapped = false;
+
+    {
+        std::lock_guard<std::mutex> guard( huge_lock );
+
+        std::map<void*,HugeMapping>::iterator it = huge_maps.find( buff );
+
+        if ( it != huge_maps.end() )
+        {
+            mapping = it->second;
+            mapped  = true;
+
+            huge_maps.erase( it );
+        }
+    }
+
+    if ( mapped == true )
+    {
+        // rows of next plane are first touched on nodes of their threads.
+        if ( parallelPlaced() == false )
+        {
+            std::lock_guard<std::mutex> guard( huge_lock );
+
+            if ( huge_cached + mapping.length <= huge_limit )
+            {
+                huge_cache.push_back( mapping );
+                huge_cached += mapping.length;
+                return;
+            }
+        }
+
+        munmap( mapping.base, mapping.length );
+        return;
+    }
+#endif /// of __linux__
+
+    delete[] buff;
+}
+
+#if defined(__linux__)
+// mapping measured, its uses so far counted. huge_lock is held.
+static void takeMeasure( HugeMapping &mapping, unsigned long long huge )
+{
+    mapping.huge     = huge;
+    mapping.measured = true;
+
+    huge_transparent += MIN( mapping.pendbytes,
+                             huge * mapping.pendcount );
+
+    mapping.pendbytes = 0;
+    mapping.pendcount = 0;
+}
+
+// one pass of smaps for advised mappings freed and not measured yet,
+// planes in use may not be touched all.
+static void measureCache()
+{
+    std::vector<char*>              bases;
+    std::vector<size_t>             lengths;
+    std::vector<unsigned long long> huges;
+    std::map<char*,size_t>          order;
+
+    {
+        std::lock_guard<std::mutex> guard( huge_lock );
+
+        for ( size_t cnt=0; cnt<huge_cache.size(); cnt++ )
+        {
+            if ( ( huge_cache[cnt].backing == HUGEMEM_Advised )
+                 && ( huge_cache[cnt].measured == false ) )
+            {
+                order[ huge_cache[cnt].base ] = huge_cache[cnt].length;
+            }
+        }
+    }
+
+    if ( order.empty() == true )
+        return;
+
+    for ( std::map<char*,size_t>::iterator it = order.begin();
+          it != order.end(); ++it )
+    {
+        bases.push_back( it->first );
+        lengths.push_back( it->second );
+    }
+
+    anonHugeBytes( bases, lengths, huges );
+
+    std::lock_guard<std::mutex> guard( huge_lock );
+
+    // mappings taken again meanwhile are measured as freed next time.
+    for ( size_t cnt=0; cnt<huge_cache.size(); cnt++ )
+    {
+        if ( huge_cache[cnt].measured == true )
+            continue;
+
+        for ( size_t pos=0; pos<bases.size(); pos++ )
+        {
+            if ( bases[pos] == huge_cache[cnt].base )
+            {
+                takeMeasure( huge_cache[cnt], huges[pos] );
+                break;
+            }
+        }
+    }
+}
+#endif /// of __linux__
+
+void hugePagesTrim()
+{
+#if defined(__linux__)
+    // mappings unmapped are never measured, so measure them now as
+    // statistics are watched.
+    if ( huge_watched.load() == true )
+    {
+        measureCache();
+    }
+
+    std::vector<HugeMapping> cache;
+
+    {
+        std::lock_guard<std::mutex> guard( huge_lock );
+
+        cache.swap( huge_cache );
+        huge_cached = 0;
+    }
+
+    for ( size_t cnt=0; cnt<cache.size(); cnt++ )
+    {
+        munmap( cache[cnt].base, cache[cnt].length );
+    }
+#endif /// of __linux__
+}
+
+void hugePagesLimit( unsigned long long bytes )
+{
+#if defined(__linux__)
+    bool over = false;
+
+    {
+        std::lock_guard<std::mutex> guard( huge_lock );
+
+        huge_limit = (size_t)MIN( bytes, (unsigned long long)HUGEMEM_CACHE_BYTES );
+        over       = ( huge_cached > huge_limit );
+    }
+
+    if ( over == false )
+        return;
+
+    if ( huge_watched.load() == true )
+    {
+        measureCache();
+    }
+
+    std::vector<HugeMapping> cache;
+
+    {
+        std::lock_guard<std::mutex> guard( huge_lock );
+
+        while( ( huge_cached > huge_limit ) && ( huge_cache.empty() == false ) )
+        {
+            cache.push_back( huge_cache.back() );
+            huge_cached -= huge_cache.back().length;
+            huge_cache.pop_back();
+        }
+    }
+
+    for ( size_t cnt=0; cnt<cache.size(); cnt++ )
+    {
+        munmap( cache[cnt].base, cache[cnt].length );
+    }
+#endif /// of __linux__
+}
+
+void hugePagesType( SRCNNHugePagesType htype )
+{
+    if ( htype < SRCNNH_MAX )
+    {
+        huge_type = htype;
+
+        // cached mappings are of previous type.
+        hugePagesTrim();
+    }
+}
+
+void hugePagesStat( SRCNNHugePages* stat, bool reset )
+{
+#if defined(__linux__)
+    huge_watched = true;
+
+    measureCache();
+#endif /// of __linux__
+
+    if ( stat != NULL )
+    {
+        stat->planes        = huge_planes.load();
+        stat->explicitpages = huge_explicit.load();
+        stat->advised       = huge_advised.load();
+        stat->transparent   = huge_transparent.load();
+    }
+
+    if ( reset == true )
+    {
+        huge_planes      = 0;
+        huge_explicit    = 0;
+        huge_advised     = 0;
+        huge_transparent = 0;
+    }
+}
+
+}; /// of namespace libsrcnn
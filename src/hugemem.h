@@ -0,0 +1,44 @@
+#ifndef __HUGEMEM_H__
+#define __HUGEMEM_H__
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Buffers of float planes, huge pages for large ones.
+//
+// A plane of HUGEMEM_MIN_BYTES or more is mapped on its own, aligned to
+// a huge page, and advised by MADV_HUGEPAGE, or taken from hugetlbfs by
+// MAP_HUGETLB first for SRCNNH_Explicit. Either fails, then next one,
+// and new[] at last, or always on systems other than Linux.
+// Mapped planes are known by their address, so freeFloats() takes any
+// buffer of new[] as well ( eg. of resizing engine ). Planes start at
+// staggered offsets of their mappings, against cache set conflicts of
+// many planes aligned to huge pages. Freed mappings
+// are kept for next planes of same length while calls run, new pages
+// fault in each time otherwise, and released by hugePagesTrim().
+// Kept ones stay within memory left under admission ceiling by
+// hugePagesLimit(), and none are kept while placed on NUMA nodes.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+
+#include "libsrcnn.h"
+
+namespace libsrcnn {
+
+// floats of a plane, huge pages for large one as configured.
+float* allocFloats( size_t count );
+// frees buffer of allocFloats() or new[], NULL is ignored.
+void   freeFloats( float* buff );
+// unmaps freed mappings kept for next planes, measured before if
+// statistics were asked.
+void   hugePagesTrim();
+// bytes of freed mappings kept at most, ones over it are unmapped.
+void   hugePagesLimit( unsigned long long bytes );
+// pages of next large planes.
+void   hugePagesType( SRCNNHugePagesType htype );
+void   hugePagesStat( SRCNNHugePages* stat, bool reset );
+
+}; /// of namespace libsrcnn
+
+#endif /// of __HUGEMEM_H__
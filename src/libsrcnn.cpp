@@ -32,17 +32,30 @@
 #include <cstdint>
 #include <cmath>
 #include <string>
-
-#ifndef NO_OMP
-    #include <omp.h>
-#endif
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <system_error>
+#include <deque>
+#include <algorithm>
+#include <chrono>
 
 #include "libsrcnn.h"
 #include "frawscale.h"
 #include "minmax.h"
 
-/* pre-calculated convolutional data */
-#include "convdata.h"
+/* compiled in or loaded model */
+#include "srcnnmodel.h"
+#include "sysinfo.h"
+#include "blasgemm.h"
+#include "convjit.h"
+#include "taskgraph.h"
+#include "threadpool.h"
+#include "hugemem.h"
+
+/* weights of LR space engine */
+#include "espcndata.h"
 
 #ifdef DEBUG
 #include "debugtool.h"
@@ -72,6 +85,8 @@ typedef struct
     unsigned       height;
     unsigned       depth;
     float*         buff;
+    unsigned       stride;      /// floats of a row, width + halo * 2.
+    unsigned       halo;        /// edge pixels repeated around image.
 }ImgF32;
 
 typedef struct
@@ -83,26 +98,355 @@ typedef struct
     ImgF32      A;
 }ImgYCbCr;
 
-typedef ImgF32  ImgConv1Layers[CONV1_FILTERS];
-typedef ImgF32  ImgConv2Layers[CONV2_FILTERS];
+typedef enum
+{
+    CONV_ReLU = 0,      /// max( x, 0 ).
+    CONV_Clamp,         /// 0 ~ 255, single output as reconstructed Y.
+    CONV_Shuffle        /// scale x scale phases added into scaled Y.
+}ConvActivation;
+
+typedef struct
+{
+    unsigned        ksz;
+    unsigned        cin;
+    unsigned        cout;
+    ConvActivation  act;
+    const float*    weights;    /// [cout][cin][ksz][ksz]
+    const float*    biases;     /// [cout]
+    const float*    packed;     /// [ksz][ksz][cout], [cin][cout] for 1x1 or
+                                /// [ksz][ksz][cin] for single output, or NULL.
+}ConvLayer;
+
+// layers of a network to be executed.
+#define CONV_MAX_LAYERS     16
+
+// pixels in a row shares non-zero channel list in sparse layer II.
+#define SPARSE_BLOCK_SIZE   16
+
+// pixels in a row convoluted at once, as accumulators of registers.
+#define CONV_BLOCK_SIZE     16
+
+// tiles of a layer for each thread, and least pixels of a tile.
+#define CONV_TILES_PER_THREAD   4
+#define CONV_TILE_PIXELS        ( 1U << 12 )
+
+// floats of unrolled windows for a band of rows to GEMM, 4MB.
+#define CONV_GEMM_BAND      ( 1U << 20 )
+
+typedef struct
+{
+    unsigned    scale;
+    unsigned    count;      /// destination length = source * scale.
+    unsigned    window;     /// maximum taps of a destination.
+    unsigned*   left;       /// first source of destination.
+    unsigned*   taps;
+    float*      weights;    /// [count][window]
+    bool*       inside;     /// layer I window has only periodic taps.
+    unsigned    ksz;        /// layer I kernel size.
+    int         first[8][MODEL_MAX_KERNEL]; /// [phase][tap] first source.
+    int         lowest;
+    unsigned    span;       /// composite kernel size.
+}ResizeTaps;
+
+typedef struct
+{
+    unsigned    scale;
+    ResizeTaps  rows;
+    ResizeTaps  cols;
+    const ConvLayer* layer;
+    float*      kernels;    /// [phase row][phase col][filter][span][span]
+}CompositeConv1;
+
+// an image in atlas, x and y are its first pixel inside of gutter.
+typedef struct
+{
+    unsigned    x;
+    unsigned    y;
+    unsigned    w;
+    unsigned    h;
+}ConvRect;
+
+// cancel and progress of asynchronous call, a part of call reports
+// its progress between from and to.
+typedef struct
+{
+    std::atomic<bool>       cancel;
+    std::atomic<unsigned>   progress;   /// thousandths, never goes back.
+    unsigned                from;
+    unsigned                to;
+}JobControl;
+
+typedef struct
+{
+    const unsigned* actf;       /// active filters of first layer, or NULL.
+    unsigned        actfsz;
+    bool            fused;      /// first layer with next 1x1 layer at once.
+    SRCNNSparsity*  sparse;     /// skips zero activations in 1x1 layers.
+    CompositeConv1* comp;       /// first layer reads source Y.
+    bool            interleaved;/// channels of a pixel next to each other.
+    SgemmFunc       sgemm;      /// GEMM of system BLAS for channels last.
+    bool            jit;        /// generated kernels for channels last.
+    unsigned        frames;     /// images of same size stacked in rows,
+                                /// channels last only, 0 as 1.
+    const ConvRect* rects;      /// images of atlas, edges repeated in
+    unsigned        rectsz;     /// gutters after each layer, or NULL.
+    unsigned        gutter;
+    JobControl*     job;        /// stops between tiles, or NULL.
+    unsigned        bandrows;   /// layers by bands of rows, 0 for whole.
+}ConvOptions;
+
+// working set of a call, fixed and for each row its layers run at.
+typedef struct
+{
+    unsigned long long  fixed;
+    unsigned long long  perrow;
+    unsigned            rows;
+    unsigned            margin;     /// rows of halo of all layers.
+    bool                bands;      /// layers may go by bands of rows.
+}MemoryNeed;
+
+typedef void (*Conv99Func)( ImgF32&, ImgF32&, const float*, unsigned, float,
+                            unsigned, unsigned );
+typedef void (*ConvNNFunc)( ImgF32*, ImgF32*, const float*, const float*,
+                            unsigned, unsigned, unsigned,
+                            const unsigned*, unsigned );
+typedef void (*ConvPSFunc)( ImgF32*, ImgF32&, const float*, const float*,
+                            unsigned, unsigned, unsigned,
+                            const unsigned*, unsigned );
+typedef void (*Conv55Func)( ImgF32*, ImgF32&, const float*, unsigned,
+                            float, const unsigned*, unsigned );
+typedef void (*Conv99x11Func)( ImgF32&, ImgF32*, const ConvLayer*, const ConvLayer*,
+                               const unsigned*, unsigned, SRCNNSparsity* );
+typedef void (*Conv99cFunc)( ImgF32&, ImgF32&, const ConvLayer*, const bool*,
+                             unsigned );
+typedef void (*Conv55cFunc)( ImgF32&, ImgF32&, const ConvLayer*, unsigned );
+
+// kernels specialized for a kernel size, 0 is for any size.
+typedef struct
+{
+    unsigned        ksz;
+    Conv99Func      conv99;
+    ConvNNFunc      convNN;
+    ConvPSFunc      convPS;
+    Conv55Func      conv55;
+    Conv99x11Func   conv99x11;
+    Conv99cFunc     conv99c;
+    Conv55cFunc     conv55c;
+}ConvKernels;
+
+typedef struct
+{
+    unsigned        scale;
+    const float*    weights1;   /// [n1][f1][f1]
+    const float*    biases1;
+    const float*    weights2;   /// [n2][n1][f2][f2]
+    const float*    biases2;
+    const float*    weights3;   /// [scale*scale][n2][f3][f3]
+    const float*    biases3;
+}ESPCNWeights;
+
+static const ESPCNWeights espcn_weights[] = \
+{
+    { 2, &espcn_x2_weights1[0][0][0], espcn_x2_biases1,
+         &espcn_x2_weights2[0][0][0][0], espcn_x2_biases2,
+         &espcn_x2_weights3[0][0][0][0], espcn_x2_biases3 },
+    { 3, &espcn_x3_weights1[0][0][0], espcn_x3_biases1,
+         &espcn_x3_weights2[0][0][0][0], espcn_x3_biases2,
+         &espcn_x3_weights3[0][0][0][0], espcn_x3_biases3 },
+    { 4, &espcn_x4_weights1[0][0][0], espcn_x4_biases1,
+         &espcn_x4_weights2[0][0][0][0], espcn_x4_biases2,
+         &espcn_x4_weights3[0][0][0][0], espcn_x4_biases3 }
+};
+
+#define ESPCN_SCALES    ( sizeof( espcn_weights ) / sizeof( ESPCNWeights ) )
+
+// composite layer I supports integer multiply up to this.
+#define COMPOSITE_MAX_SCALE 8
+
+// rows for each thread and limit of pixels in a pass of batch.
+#define CONV_BATCH_ROWS         32
+#define CONV_BATCH_PIXELS       ( 1U << 16 )
+
+// least width and limit of pixels of an atlas.
+#ifndef CONV_ATLAS_WIDTH
+#define CONV_ATLAS_WIDTH        512
+#endif
+#ifndef CONV_ATLAS_PIXELS
+#define CONV_ATLAS_PIXELS       ( 1U << 17 )
+#endif
+
+// activations under this size go separated without looking at memory.
+#define CONV_SMALL_FOOTPRINT    ( 64ULL << 20 )
+
+// images over this size first touched by threads of their rows.
+#define NUMA_PLACE_BYTES        ( 1U << 20 )
+
+// least rows of a band, halo of each band costs more under this.
+#define MEMORY_BAND_ROWS        32
+// milliseconds a waiting call looks at cancel again.
+#define MEMORY_WAIT_MS          20
 
 ////////////////////////////////////////////////////////////////////////////////
 
 static bool             intp_stepscale  = false;
 static SRCNNFilterType  intp_filter     = SRCNNF_Bicubic;
+static bool             conv1_pruned[MODEL_MAX_FILTERS] = {false};
+static bool             conv2_sparse    = true;
+static bool             conv1_composite = false;
+// each thread counts its own calls.
+static thread_local SRCNNSparsity conv2_sparsity = {0,0,0,0};
+static SRCNNEngineType  engine_type     = SRCNNE_SRCNN;
+static bool             conv_interleave = true;
+#ifdef NEW_FAST_I_II_LAYERS
+static SRCNNLayersType  layers_type     = SRCNNL_Fused;
+#else
+static SRCNNLayersType  layers_type     = SRCNNL_Auto;
+#endif /// of NEW_FAST_I_II_LAYERS
+static SRCNNPolicyType  call_policy     = SRCNNP_Latency;
+static std::atomic<unsigned> calls_running( 0 );
+static thread_local unsigned calls_depth = 0;
+// asynchronous call running in this thread.
+static thread_local JobControl* job_current = NULL;
+// working sets admitted for running calls, others wait in order.
+static std::mutex               mem_lock;
+static std::condition_variable  mem_cond;
+static unsigned long long       mem_ceiling  = 0;
+static unsigned long long       mem_auto     = 0;
+static unsigned long long       mem_reserved = 0;
+static unsigned                 mem_holders  = 0;
+static unsigned long long       mem_tickets  = 0;
+static std::deque<unsigned long long> mem_queue;
+
+////////////////////////////////////////////////////////////////////////////////
+
+inline bool jobCancelled( JobControl* job )
+{
+    return ( job != NULL ) && ( job->cancel.load() == true );
+}
+
+// permille of current part of call.
+void jobProgress( JobControl* job, unsigned permille )
+{
+    if ( job == NULL )
+        return;
+
+    unsigned value = job->from
+                     + ( job->to - job->from ) * MIN( permille, 1000U ) / 1000;
+    unsigned prev  = job->progress.load();
+
+    while( ( prev < value )
+           && ( job->progress.compare_exchange_weak( prev, value ) == false ) );
+}
+
+// narrows current part to [from,to) permille of it, outer[2] is for
+// jobLeave(). Calling thread only, never inside of a parallel loop.
+void jobEnter( JobControl* job, unsigned from, unsigned to, unsigned* outer )
+{
+    if ( job == NULL )
+        return;
+
+    unsigned span = job->to - job->from;
+
+    outer[0] = job->from;
+    outer[1] = job->to;
+
+    job->from = outer[0] + span * from / 1000;
+    job->to   = outer[0] + span * to / 1000;
+}
+
+void jobLeave( JobControl* job, const unsigned* outer )
+{
+    if ( job == NULL )
+        return;
+
+    jobProgress( job, 1000 );
+
+    job->from = outer[0];
+    job->to   = outer[1];
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template <unsigned KSZ>
 void convolution99( ImgF32 &src, ImgF32 &dst, \
-                    const KernelMat99 kernel, float bias );
-void convolution11( ImgConv1Layers &src, ImgYCbCr &dst, \
-                    const ConvKernel1 kernel, float bias );
-void convolution55( ImgConv2Layers &src, ImgF32 &dst, \
-                    const ConvKernel32_55 kernel, float bias );
-void Convolution99x11( ImgF32& src, ImgF32* dst, const ConvKernel64_99 kernel99, \
-                                                 const ConvKernel1 bias99, \
-                                                 const ConvKernel21 kernel11, \
-                                                 const ConvKernel2 bias11 );
+                    const float* kernel, unsigned ksz, float bias, \
+                    unsigned row0, unsigned row1 );
+void convolution11( ImgF32* src, ImgF32 &dst, \
+                    const float* kernel, float bias, \
+                    const unsigned* actf, unsigned actfsz, \
+                    unsigned row0, unsigned row1 );
+void convolution11s( ImgF32* src, ImgF32* dst, \
+                     const float* kernel, const float* bias, \
+                     unsigned cin, unsigned cout, \
+                     const unsigned* actf, unsigned actfsz, \
+                     SRCNNSparsity &stat );
+template <unsigned KSZ>
+void accumulateRowNN( ImgF32* src, unsigned row, const float* kernel, \
+                      unsigned cin, unsigned cout, unsigned ksz, \
+                      const unsigned* actf, unsigned actfsz, \
+                      float* acc );
+template <unsigned KSZ>
+void convolutionNN( ImgF32* src, ImgF32* dst, \
+                    const float* kernel, const float* bias, \
+                    unsigned cin, unsigned cout, unsigned ksz, \
+                    const unsigned* actf, unsigned actfsz );
+template <unsigned KSZ>
+void convolutionPS( ImgF32* src, ImgF32 &dst, \
+                    const float* kernel, const float* bias, \
+                    unsigned cin, unsigned ksz, unsigned scale, \
+                    const unsigned* actf, unsigned actfsz );
+template <unsigned KSZ>
+void convolution55( ImgF32* src, ImgF32 &dst, \
+                    const float* kernel, unsigned ksz, \
+                    float bias, const unsigned* actf, unsigned actfsz );
+template <unsigned KSZ>
+void Convolution99x11( ImgF32& src, ImgF32* dst, \
+                       const ConvLayer* layer1, const ConvLayer* layer2, \
+                       const unsigned* actf, unsigned actfsz, \
+                       SRCNNSparsity* stat );
+template <unsigned KSZ>
+void convolution99c( ImgF32 &src, ImgF32 &dst, \
+                     const ConvLayer* layer, const bool* active, \
+                     unsigned frames );
+void convolution11c( ImgF32 &src, ImgF32 &dst, \
+                     const ConvLayer* layer, \
+                     const unsigned* actf, unsigned actfsz, \
+                     SRCNNSparsity* stat );
+template <unsigned KSZ>
+void convolution55c( ImgF32 &src, ImgF32 &dst, const ConvLayer* layer, \
+                     unsigned frames );
+void convolution99g( ImgF32 &src, ImgF32 &dst, \
+                     const ConvLayer* layer, const bool* active, \
+                     unsigned frames, SgemmFunc sgemm );
+void convolution11g( ImgF32 &src, ImgF32 &dst, \
+                     const ConvLayer* layer, \
+                     const unsigned* actf, unsigned actfsz, \
+                     SRCNNSparsity* stat, SgemmFunc sgemm );
+bool convolution99j( ImgF32 &src, ImgF32 &dst, \
+                     const ConvLayer* layer, const bool* active, \
+                     unsigned frames );
+bool convolution11j( ImgF32 &src, ImgF32 &dst, \
+                     const ConvLayer* layer, \
+                     const unsigned* actf, unsigned actfsz, \
+                     SRCNNSparsity* stat );
+bool convolution55j( ImgF32 &src, ImgF32 &dst, const ConvLayer* layer, \
+                     unsigned frames );
+bool initCompositeConv1( CompositeConv1 &comp, const ConvLayer* layer,
+                         FRAWGenericFilter* filter,
+                         unsigned w, unsigned h, unsigned scale,
+                         const unsigned* actf, unsigned actfsz );
+void discardCompositeConv1( CompositeConv1 &comp );
+void convolutionLR99( ImgF32 &src, ImgF32* dst, CompositeConv1 &comp, \
+                      const unsigned* actf, unsigned actfsz );
+const ConvKernels* selectConvKernels( unsigned ksz );
+bool interleavedLayers( const ConvLayer* layers, unsigned count, \
+                        ConvOptions &opts );
+bool runConvLayersInterleaved( const ConvLayer* layers, unsigned count, \
+                               ImgF32 &src, ImgF32 &dst, ConvOptions &opts );
+bool runConvLayers( const ConvLayer* layers, unsigned count, \
+                    ImgF32 &src, ImgF32 &dst, ConvOptions &opts );
+bool runConvLayersBands( const ConvLayer* layers, unsigned count, \
+                         ImgF32 &src, ImgF32 &dst, ConvOptions &opts );
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -152,22 +496,152 @@ void resetImgF32( ImgF32 &img )
     img.width = 0;
     img.height = 0;
     img.depth = 0;
+    img.stride = 0;
+    img.halo = 0;
 
     if ( img.buff != NULL )
     {
-        delete[] img.buff;
+        freeFloats( img.buff );
         img.buff = NULL;
     }
 }
 
+/* --
+ * Loops over rows give a thread same rows each time while placed on
+ * NUMA nodes, so a large image is first touched by threads of its rows,
+ * and its pages sit on node of threads reading and writing them.
+ */
+void placeImgF32( ImgF32 &img, unsigned rows )
+{
+    unsigned long long rowsz = (unsigned long long)img.stride * img.depth
+                               * sizeof( float );
+
+    if ( ( rowsz * rows < NUMA_PLACE_BYTES ) || ( parallelPlaced() == false ) )
+        return;
+
+    float* buff = img.buff;
+
+    parallelFor( rows, [&, buff]( unsigned row )
+    {
+        memset( (char*)buff + rowsz * row, 0, rowsz );
+    } );
+}
+
 void initImgF32( ImgF32 &img, unsigned w, unsigned h )
 {
     img.width = w;
     img.height = h;
     img.depth = 1;
+    img.stride = w;
+    img.halo = 0;
 
     unsigned buffsz = w * h;
-    img.buff = new float[ buffsz ];
+    img.buff = allocFloats( buffsz );
+
+    placeImgF32( img, h );
+}
+
+void initImgF32Halo( ImgF32 &img, unsigned w, unsigned h, unsigned halo )
+{
+    img.width  = w;
+    img.height = h;
+    img.depth  = 1;
+    img.stride = w + halo * 2;
+    img.halo   = halo;
+
+    unsigned buffsz = img.stride * ( h + halo * 2 );
+    img.buff = allocFloats( buffsz );
+
+    placeImgF32( img, h + halo * 2 );
+}
+
+// first pixel of image, inside of its halo.
+inline float* originF32( const ImgF32 &img )
+{
+    return &img.buff[ img.halo * img.stride + img.halo ];
+}
+
+// row of haloed frames for a row of stacked frames without halo.
+inline unsigned frameRow( unsigned row, unsigned frameh, unsigned halo )
+{
+    return row + ( row / frameh ) * halo * 2;
+}
+
+void fillImgF32Halo( ImgF32 &img )
+{
+    if ( ( img.halo == 0 ) || ( img.buff == NULL ) )
+        return;
+
+    int    halo   = img.halo;
+    int    stride = img.stride;
+    float* org    = originF32( img );
+
+    /* Edge pixels repeated, left and right of each row */
+    for ( unsigned row=0; row<img.height; row++ )
+    {
+        float* line = &org[ row * stride ];
+        float* last = &line[ img.width - 1 ];
+
+        for ( int x=1; x<=halo; x++ )
+        {
+            line[ -x ] = line[0];
+            last[ x ]  = *last;
+        }
+    }
+
+    /* Then rows of top and bottom, with its corners */
+    float* top    = &org[ -halo ];
+    float* bottom = &org[ ( img.height - 1 ) * stride - halo ];
+
+    // image may be a part of larger plane, nothing out of its halo.
+    unsigned linesz = ( img.width + halo * 2 ) * sizeof( float );
+
+    for ( int y=1; y<=halo; y++ )
+    {
+        memcpy( &top[ -y * stride ], top, linesz );
+        memcpy( &bottom[ y * stride ], bottom, linesz );
+    }
+}
+
+void copyImgF32Halo( ImgF32 &dst, ImgF32 &src, unsigned halo )
+{
+    initImgF32Halo( dst, src.width, src.height, halo );
+
+    float* org = originF32( dst );
+
+    for ( unsigned row=0; row<src.height; row++ )
+    {
+        memcpy( &org[ row * dst.stride ], &src.buff[ row * src.width ],
+                src.width * sizeof( float ) );
+    }
+
+    fillImgF32Halo( dst );
+}
+
+void copyImgF32Frames( ImgF32 &dst, ImgF32 &src, unsigned frames, unsigned halo )
+{
+    unsigned frameh = src.height / frames;
+
+    // frames keep own halo, rows between frames are halo of both.
+    initImgF32Halo( dst, src.width, frames * ( frameh + halo * 2 ) - halo * 2, halo );
+
+    for ( unsigned cnt=0; cnt<frames; cnt++ )
+    {
+        ImgF32 frame = dst;
+        frame.height = frameh;
+        frame.buff   = &dst.buff[ cnt * ( frameh + halo * 2 ) * dst.stride ];
+
+        float* org = originF32( frame );
+
+        for ( unsigned row=0; row<frameh; row++ )
+        {
+            memcpy( &org[ row * frame.stride ],
+                    &src.buff[ ( cnt * frameh + row ) * src.width ],
+                    src.width * sizeof( float ) );
+        }
+
+        fillImgF32Halo( frame );
+    }
 }
 
 void initImgConvLayers( ImgF32* img, unsigned w, unsigned h, unsigned count )
@@ -179,9 +653,13 @@ void initImgConvLayers( ImgF32* img, unsigned w, unsigned h, unsigned count )
             img[cnt].width  = w;
             img[cnt].height = h;
             img[cnt].depth  = 1;
+            img[cnt].stride = w;
+            img[cnt].halo   = 0;
 
             unsigned buffsz = w * h;
-            img[cnt].buff = new float[ buffsz ];
+            img[cnt].buff = allocFloats( buffsz );
+
+            placeImgF32( img[cnt], h );
         }
     }
 }
@@ -194,7 +672,7 @@ void discardConvLayers( ImgF32* img, unsigned count )
         {
             if ( img[cnt].buff != NULL )
             {
-                delete[] img[cnt].buff;
+                freeFloats( img[cnt].buff );
                 img[cnt].buff = NULL;
             }
         }
@@ -239,8 +717,7 @@ void converImgU8toYCbCr( ImgU8 &src, ImgYCbCr &out )
 
     unsigned imgsz = src.width * src.height;
 
-    #pragma omp parallel for
-    for( unsigned cnt=0; cnt<imgsz; cnt++ )
+    parallelFor( imgsz, [&]( unsigned cnt )
     {
         float fR = (float)src.buff[ ( cnt * src.depth ) + 0 ];
         float fG = (float)src.buff[ ( cnt * src.depth ) + 1 ];
@@ -268,7 +745,7 @@ void converImgU8toYCbCr( ImgU8 &src, ImgYCbCr &out )
             // Alpha
             out.A.buff[cnt] = (float)src.buff[ ( cnt * src.depth ) + 3 ];
         }
-    }
+    } );
 }
 
 void convertImgF32XtoImgU8( ImgF32* src, unsigned d, ImgU8 &out )
@@ -283,8 +760,7 @@ void convertImgF32XtoImgU8( ImgF32* src, unsigned d, ImgU8 &out )
     out.depth  = d;
     out.buff   = new unsigned char[ imgsz * d ];
 
-    #pragma omp parallel for
-    for( unsigned cnt=0; cnt<imgsz; cnt++ )
+    parallelFor( imgsz, [&]( unsigned cnt )
     {
         float fY  = src[0].buff[cnt];
         float fCb = src[1].buff[cnt] - 128.f;
@@ -304,7 +780,7 @@ void convertImgF32XtoImgU8( ImgF32* src, unsigned d, ImgU8 &out )
             float fA = MIN(255.f, src[3].buff[cnt]);
             out.buff[( cnt * d ) + 3] = (unsigned char)MAX( 0.f, fA );
         }
-    }
+    } );
 }
 
 void convertYCbCrtoImgU8( ImgYCbCr &src, unsigned d, ImgU8* &out )
@@ -324,8 +800,7 @@ void convertYCbCrtoImgU8( ImgYCbCr &src, unsigned d, ImgU8* &out )
     if ( out->buff == NULL )
         return;
 
-    #pragma omp parallel for
-    for( unsigned cnt=0; cnt<imgsz; cnt++ )
+    parallelFor( imgsz, [&]( unsigned cnt )
     {
         float fY  = src.Y.buff[cnt];
         float fCb = src.Cb.buff[cnt];
@@ -342,98 +817,306 @@ void convertYCbCrtoImgU8( ImgYCbCr &src, unsigned d, ImgU8* &out )
         {
             out->buff[( cnt * d ) +3] = src.A.buff[cnt];
         }
-    }
+    } );
 }
 
-////////////////////////////////////////////////////////////////////////////////
+FRAWGenericFilter* createResizeFilter( bool luma )
+{
+    // Y channel takes configured filter,
+    // other channels just doing linear interpolation.
+    if ( luma == true )
+    {
+        switch( intp_filter )
+        {
+            default:
+            case SRCNNF_Nearest:
+                return new FRAWBoxFilter;
+
+            case SRCNNF_Bilinear:
+                return new FRAWBilinearFilter;
+
+            case SRCNNF_Bicubic:
+                return new FRAWBicubicFilter;
+
+            case SRCNNF_Lanczos3:
+                return new FRAWLanczos3Filter;
+
+            case SRCNNF_Bspline:
+                return new FRAWBSplineFilter;
+        }
+    }
+
+    switch( intp_filter )
+    {
+        case SRCNNF_Nearest:
+            return new FRAWBoxFilter;
 
-void convolution99( ImgF32 &src, ImgF32 &dst, const KernelMat99 kernel, float bias )
+        default:
+        case SRCNNF_Bilinear:
+            return new FRAWBilinearFilter;
+    }
+}
+
+unsigned buildActiveFilters( unsigned* actf, unsigned count )
 {
-    /* Expand the src image */
-    ImgF32 src2;
-    initImgF32( src2, src.width + 8, src.height + 8 );
+    unsigned actfsz = 0;
+
+    for( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        if ( conv1_pruned[cnt] == false )
+        {
+            actf[actfsz] = cnt;
+            actfsz++;
+        }
+    }
+
+    // pruned all by a model having less filters.
+    if ( actfsz == 0 )
+    {
+        for( unsigned cnt=0; cnt<count; cnt++ )
+        {
+            actf[cnt] = cnt;
+        }
+
+        actfsz = count;
+    }
+
+    return actfsz;
+}
 
-    if ( src2.buff == NULL )
+void resizeImgChannel( ImgYCbCr &src, unsigned ch, unsigned rs_w, unsigned rs_h,
+                       ImgF32* dst, bool resizeY )
+{
+    const float* refimgbuf[4] = { src.Y.buff,
+                                  src.Cb.buff,
+                                  src.Cr.buff,
+                                  src.A.buff };
+
+    dst[ch].width  = rs_w;
+    dst[ch].height = rs_h;
+    dst[ch].depth  = 1;
+    dst[ch].buff   = NULL;
+    dst[ch].stride = rs_w;
+    dst[ch].halo   = 0;
+
+    // Y to be filled by caller.
+    if ( ( ch == 0 ) && ( resizeY == false ) )
     {
-        resetImgF32( src2 );
+        dst[ch].buff = allocFloats( rs_w * rs_h );
         return;
     }
 
-    for ( unsigned row = 0; row<src2.height; row++ )
+    FRAWGenericFilter* rszfilter = createResizeFilter( ch == 0 );
+
+    FRAWResizeEngine rsze( rszfilter );
+
+    rsze.scale( refimgbuf[ch],
+                src.Y.width,
+                src.Y.height,
+                rs_w,
+                rs_h,
+                &dst[ch].buff );
+
+    delete rszfilter;
+}
+
+void resizeImgYCbCr( ImgYCbCr &src, unsigned d, unsigned rs_w, unsigned rs_h,
+                     ImgF32* dst, bool resizeY )
+{
+    // rows of a channel go parallel, channels never nest regions.
+    for ( unsigned cnt=0; cnt<d; cnt++ )
+    {
+        resizeImgChannel( src, cnt, rs_w, rs_h, dst, resizeY );
+    }
+}
+
+int composeImgU8( ImgF32* imgResized, unsigned d, ImgF32 &imgConv,
+                  unsigned char* &outbuff,
+                  unsigned &outbuffsz,
+                  unsigned char** convbuff,
+                  unsigned* convbuffsz )
+{
+    int retval = -100;
+
+    // ---------------------------------------------------------
+	// Copy last layer result to Y channel.
+
+	unsigned convsz = imgResized[0].width \
+                      * imgResized[0].height * sizeof( float );
+	memcpy( imgResized[0].buff, imgConv.buff, convsz );
+
+    /* Convert the image from YCrCb to RGB Space */
+    ImgU8 imgRGB;
+    convertImgF32XtoImgU8( imgResized, d, imgRGB );
+
+    // discard used image of Resized Y-Cr-Cb.
+    discardConvLayers( imgResized, d );
+
+    if ( imgRGB.buff != NULL )
     {
-        for ( unsigned col = 0; col<src2.width; col++ )
+        outbuffsz = imgRGB.width * imgRGB.height * imgRGB.depth;
+        outbuff = new unsigned char[ outbuffsz ];
+        if ( outbuff != NULL )
+        {
+            memcpy( outbuff, imgRGB.buff, outbuffsz );
+            retval = 0;
+        }
+        else
         {
-            int tmpRow = (int)row - 4;
-            int tmpCol = (int)col - 4;
+            retval = -11;
+        }
 
-            if ( tmpRow < 0 )
-            {
-                tmpRow = 0;
-            }
-            else
-            if ( tmpRow >= src.height )
-            {
-                tmpRow = src.height - 1;
-            }
+        resetImgU8( imgRGB );
+    }
 
-            if ( tmpCol < 0 )
+    if ( ( convbuff != NULL ) && ( convbuffsz != NULL ) )
+    {
+        if ( ( imgConv.buff != NULL ) && ( retval == 0 ) )
+        {
+            unsigned bsz = imgConv.width * imgConv.height;
+            unsigned char* buff = new unsigned char[ bsz ];
+            if ( buff != NULL )
             {
-                tmpCol = 0;
+                parallelFor( bsz, [&]( unsigned cnt )
+                {
+                    buff[ cnt ] = (unsigned char)imgConv.buff[ cnt ];
+                } );
+
+                *convbuff   = buff;
+                *convbuffsz = bsz;
+
+                retval = 0;
             }
             else
-            if ( tmpCol >= src.width )
             {
-                tmpCol = src.width - 1;
+                retval = -12;
             }
 
-            src2.buff[ row * src2.width + col ] = \
-                                src.buff[ tmpRow * src.width + tmpCol ];
+            resetImgF32( imgConv );
         }
     }
+    else
+    if ( imgConv.buff != NULL )
+    {
+        resetImgF32( imgConv );
+    }
 
-    /* Complete the Convolution Step */
-    for ( unsigned row=0; row<dst.height; row++ )
+    // loops above skip rows once cancelled, so a whole output is known
+    // here, and a cancel after this never takes it.
+    if ( ( retval == 0 ) && ( jobCancelled( job_current ) == true ) )
     {
-        for ( unsigned col=0; col<dst.width; col++ )
+        delete[] outbuff;
+        outbuff   = NULL;
+        outbuffsz = 0;
+
+        if ( ( convbuff != NULL ) && ( *convbuff != NULL ) )
         {
-            /* Convolution */
-            float temp = 0;
+            delete[] *convbuff;
+            *convbuff   = NULL;
+            *convbuffsz = 0;
+        }
+
+        retval = -4;
+    }
+
+    return retval;
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-            for ( unsigned x=0; x<9; x++ )
+template <unsigned KSZ>
+void convolution99( ImgF32 &src, ImgF32 &dst, const float* kernel, unsigned ksz, float bias,
+                    unsigned row0, unsigned row1 )
+{
+    // taps unrolled for known kernel size.
+    if ( KSZ > 0 )
+        ksz = KSZ;
+
+    // src has halo of ksz / 2 at least, no copy for each filter.
+    int          half   = (int)ksz / 2;
+    int          stride = src.stride;
+    unsigned     width  = dst.width;
+    unsigned     blkw   = width / CONV_BLOCK_SIZE * CONV_BLOCK_SIZE;
+    const float* img    = &originF32( src )[ -half * stride - half ];
+    float*       out    = originF32( dst );
+
+    // a band of rows, a tile of scheduler.
+    for ( unsigned row=row0; row<row1; row++ )
+    {
+        float* outline = &out[ row * dst.stride ];
+
+        /* Convolution, a block of pixels at once */
+        for ( unsigned col=0; col<blkw; col+=CONV_BLOCK_SIZE )
+        {
+            float temp[CONV_BLOCK_SIZE] = {0.f};
+
+            for ( unsigned x=0; x<ksz; x++ )
             {
-                for ( unsigned y=0; y<9; y++ )
+                const float* line = &img[ ( row + x ) * stride + col ];
+
+                for ( unsigned y=0; y<ksz; y++ )
                 {
-                    unsigned pos = ( row  + x ) * src2.width + ( col + y );
+                    const float wgt = kernel[ x * ksz + y ];
+
+                    for ( unsigned b=0; b<CONV_BLOCK_SIZE; b++ )
+                    {
+                        temp[b] += wgt * line[ y + b ];
+                    }
+                }
+            }
+
+            for ( unsigned b=0; b<CONV_BLOCK_SIZE; b++ )
+            {
+                float result = temp[b] + bias;
+
+                /* Threshold */
+                outline[ col + b ] = (result >= 0) ? result : 0;
+            }
+        }
+
+        /* Remained pixels of a row */
+        for ( unsigned col=blkw; col<width; col++ )
+        {
+            float temp = 0.f;
+
+            for ( unsigned x=0; x<ksz; x++ )
+            {
+                const float* line = &img[ ( row + x ) * stride + col ];
 
-                    temp += kernel[x][y] * src2.buff[pos];
+                for ( unsigned y=0; y<ksz; y++ )
+                {
+                    temp += kernel[ x * ksz + y ] * line[y];
                 }
             }
 
             temp += bias;
 
             /* Threshold */
-            temp = (temp >= 0) ? temp : 0;
-
-            dst.buff[ row * dst.width + col ] = temp;
+            outline[col] = (temp >= 0) ? temp : 0;
         }
     }
-
-    delete[] src2.buff;
 }
 
-void convolution11( ImgConv1Layers &src, ImgF32 &dst, const ConvKernel1 kernel, float bias )
+void convolution11( ImgF32* src, ImgF32 &dst, const float* kernel, float bias,
+                    const unsigned* actf, unsigned actfsz,
+                    unsigned row0, unsigned row1 )
 {
-    for ( unsigned row=0; row<dst.height; row++ )
+    float* out = originF32( dst );
+
+    for ( unsigned row=row0; row<row1; row++ )
     {
         for ( unsigned col=0; col<dst.width; col++ )
         {
             /* Process with each pixel */
             float temp = 0;
 
-            for ( unsigned fc=0; fc<CONV1_FILTERS; fc++ )
+            /* pruned filters have no plane */
+            for ( unsigned cnt=0; cnt<actfsz; cnt++ )
             {
-                temp += src[fc].buff[ row * src[fc].width + col ]
-                        * kernel[fc];
+                const ImgF32 &plane = src[ actf[cnt] ];
+
+                temp += originF32( plane )[ row * plane.stride + col ]
+                        * kernel[ actf[cnt] ];
             }
 
             temp += bias;
@@ -441,75 +1124,191 @@ void convolution11( ImgConv1Layers &src, ImgF32 &dst, const ConvKernel1 kernel,
             /* Threshold */
             temp = (temp >= 0) ? temp : 0;
 
-            dst.buff[ row * dst.width + col ] = temp;
+            out[ row * dst.stride + col ] = temp;
         }
     }
 }
 
-void convolution55( ImgConv2Layers &src, ImgF32 &dst, const ConvKernel32_55 kernel, float bias )
+void convolution11s( ImgF32* src, ImgF32* dst, const float* kernel,
+                     const float* bias, unsigned cin, unsigned cout,
+                     const unsigned* actf, unsigned actfsz,
+                     SRCNNSparsity &stat )
 {
-    /* Expand the src image */
-    ImgConv2Layers src2;
-    initImgConvLayers( &src2[0],
-                       src[0].width + 4,
-                       src[0].height + 4,
-                       CONV2_FILTERS );
+    unsigned width   = dst[0].width;
+    unsigned height  = dst[0].height;
+    unsigned sstride = src[ actf[0] ].stride;
+    unsigned dstride = dst[0].stride;
+    unsigned blocks  = ( width + SPARSE_BLOCK_SIZE - 1 ) / SPARSE_BLOCK_SIZE;
+
+    // skipped channels counted for each row, summed after.
+    unsigned* rowskip = new unsigned[ height ];
 
-    #pragma omp parallel for
-    for ( unsigned cnt=0; cnt<CONV2_FILTERS; cnt++ )
+    unsigned long long zeros = parallelSum( height, [&]( unsigned row )
     {
-        for ( unsigned row=0; row<src2[cnt].height; row++ )
+        unsigned nzf[MODEL_MAX_FILTERS];
+        float    temp[SPARSE_BLOCK_SIZE];
+        unsigned long long zeros = 0;
+
+        rowskip[row] = 0;
+
+        for ( unsigned blk=0; blk<blocks; blk++ )
         {
-            for ( unsigned col=0; col<src2[cnt].width; col++ )
+            unsigned col   = blk * SPARSE_BLOCK_SIZE;
+            unsigned bsz   = MIN( SPARSE_BLOCK_SIZE, width - col );
+            unsigned spos  = row * sstride + col;
+            unsigned dpos  = row * dstride + col;
+            unsigned nzfsz = 0;
+
+            /* Collect channels having any non-zero in this block */
+            for ( unsigned cnt=0; cnt<actfsz; cnt++ )
             {
-                int tmpRow = (int)row - 2;
-                int tmpCol = (int)col - 2;
+                const float* pix = &originF32( src[ actf[cnt] ] )[ spos ];
+                unsigned     nzc = 0;
 
-                if (tmpRow < 0)
+                for ( unsigned x=0; x<bsz; x++ )
                 {
-                    tmpRow = 0;
-                }
-                else
-                if (tmpRow >= src[cnt].height)
-                {
-                    tmpRow = src[cnt].height - 1;
+                    nzc += ( pix[x] != 0.f );
                 }
 
-                if (tmpCol < 0)
+                zeros += bsz - nzc;
+
+                if ( nzc > 0 )
                 {
-                    tmpCol = 0;
+                    nzf[nzfsz] = actf[cnt];
+                    nzfsz++;
                 }
                 else
-                if (tmpCol >= src[cnt].width)
                 {
-                    tmpCol = src[cnt].width - 1;
+                    rowskip[row]++;
+                }
+            }
+
+            for ( unsigned k=0; k<cout; k++ )
+            {
+                for ( unsigned x=0; x<bsz; x++ )
+                {
+                    temp[x] = 0.f;
+                }
+
+                for ( unsigned cnt=0; cnt<nzfsz; cnt++ )
+                {
+                    const float* pix = &originF32( src[ nzf[cnt] ] )[ spos ];
+                    const float  wgt = kernel[ k * cin + nzf[cnt] ];
+
+                    for ( unsigned x=0; x<bsz; x++ )
+                    {
+                        temp[x] += pix[x] * wgt;
+                    }
                 }
 
-                src2[cnt].buff[ row * src2[cnt].width + col ] = \
-                        src[cnt].buff[ tmpRow * src[cnt].width + tmpCol ];
+                float* out = &originF32( dst[k] )[ dpos ];
+
+                for ( unsigned x=0; x<bsz; x++ )
+                {
+                    float result = temp[x] + bias[k];
+
+                    /* Threshold */
+                    out[x] = ( result >= 0 ) ? result : 0;
+                }
             }
         }
+
+        return zeros;
+    } );
+
+    unsigned long long skipped = 0;
+
+    for ( unsigned row=0; row<height; row++ )
+    {
+        skipped += rowskip[row];
     }
 
-    /* Complete the Convolution Step */
-    #pragma omp parallel for
-    for ( unsigned row=0; row<dst.height; row++ )
+    delete[] rowskip;
+
+    stat.activations += (unsigned long long)width * height * actfsz;
+    stat.zeros       += zeros;
+    stat.blocks      += (unsigned long long)blocks * height * actfsz;
+    stat.skipped     += skipped;
+}
+
+template <unsigned KSZ>
+void convolution55( ImgF32* src, ImgF32 &dst, const float* kernel, unsigned ksz, float bias,
+                    const unsigned* actf, unsigned actfsz )
+{
+    if ( KSZ > 0 )
+        ksz = KSZ;
+
+    // src planes have halo of ksz / 2 at least, no copy of planes.
+    int      half   = (int)ksz / 2;
+    int      stride = src[ actf[0] ].stride;
+    unsigned width  = dst.width;
+    unsigned blkw   = width / CONV_BLOCK_SIZE * CONV_BLOCK_SIZE;
+
+    /* Complete the Convolution Step, a block of pixels at once */
+    parallelFor( dst.height, [&]( unsigned row )
     {
-        for ( unsigned col=0; col<dst.width; col++ )
+        for ( unsigned col=0; col<blkw; col+=CONV_BLOCK_SIZE )
+        {
+            float temp[CONV_BLOCK_SIZE] = {0.f};
+
+            for ( unsigned n=0; n<actfsz; n++ )
+            {
+                unsigned     i   = actf[n];
+                const float* ker = &kernel[ i * ksz * ksz ];
+                const float* img = &originF32( src[i] )[ ( (int)row - half ) * stride
+                                                         + (int)col - half ];
+                double temppixel[CONV_BLOCK_SIZE] = {0.0};
+
+                for ( unsigned y=0; y<ksz; y++ )
+                {
+                    const float* line = &img[ y * stride ];
+
+                    for ( unsigned x=0; x<ksz; x++ )
+                    {
+                        const float wgt = ker[ y * ksz + x ];
+
+                        for ( unsigned b=0; b<CONV_BLOCK_SIZE; b++ )
+                        {
+                            temppixel[b] += wgt * line[ x + b ];
+                        }
+                    }
+                }
+
+                for ( unsigned b=0; b<CONV_BLOCK_SIZE; b++ )
+                {
+                    temp[b] += temppixel[b];
+                }
+            }
+
+            for ( unsigned b=0; b<CONV_BLOCK_SIZE; b++ )
+            {
+                float result = temp[b] + bias;
+
+                result = MAX( result, 0.f );
+                result = MIN( result, 255.f );
+
+                dst.buff[ row * width + col + b ] = result;
+            }
+        }
+
+        /* Remained pixels of a row */
+        for ( unsigned col=blkw; col<width; col++ )
         {
             float temp = 0;
 
-            for ( unsigned i=0; i<CONV2_FILTERS; i++ )
+            for ( unsigned n=0; n<actfsz; n++ )
             {
+                unsigned     i   = actf[n];
+                const float* ker = &kernel[ i * ksz * ksz ];
+                const float* img = &originF32( src[i] )[ ( (int)row - half ) * stride
+                                                         + (int)col - half ];
                 double temppixel = 0;
 
-                for ( unsigned y=0; y<5; y++ )
+                for ( unsigned y=0; y<ksz; y++ )
                 {
-                    for ( unsigned x=0; x<5; x++ )
+                    for ( unsigned x=0; x<ksz; x++ )
                     {
-                        unsigned pos = ( (row + y) * src2[i].width ) \
-                                       + ( col + x );
-                        temppixel += kernel[i][x][y] * src2[i].buff[pos];
+                        temppixel += ker[ y * ksz + x ] * img[ y * stride + x ];
                     }
                 }
 
@@ -518,27 +1317,164 @@ void convolution55( ImgConv2Layers &src, ImgF32 &dst, const ConvKernel32_55 kern
 
             temp += bias;
 
-			temp = MAX( temp, 0.f );
-			temp = MIN( temp, 255.f );
+            temp = MAX( temp, 0.f );
+            temp = MIN( temp, 255.f );
+
+            dst.buff[ row * width + col ] = temp;
+        }
+    } );
+}
+
+template <unsigned KSZ>
+void accumulateRowNN( ImgF32* src, unsigned row, const float* kernel, \
+                      unsigned cin, unsigned cout, unsigned ksz, \
+                      const unsigned* actf, unsigned actfsz, \
+                      float* acc )
+{
+    if ( KSZ > 0 )
+        ksz = KSZ;
+
+    unsigned width  = src[ actf[0] ].width;
+    int      stride = src[ actf[0] ].stride;
+    int      half   = ksz / 2;
+    unsigned kksz   = ksz * ksz;
+
+    memset( acc, 0, cout * width * sizeof( float ) );
+
+    for ( unsigned n=0; n<actfsz; n++ )
+    {
+        unsigned i = actf[n];
+
+        for ( unsigned y=0; y<ksz; y++ )
+        {
+            // halo has edge pixels, inner loops go stride 1.
+            const float* line = &originF32( src[i] )[ ( (int)row + (int)y - half ) * stride
+                                                      - half ];
+
+            for ( unsigned k=0; k<cout; k++ )
+            {
+                const float* ker = &kernel[ ( k * cin + i ) * kksz + y * ksz ];
+                float*       out = &acc[ k * width ];
+
+                for ( unsigned x=0; x<ksz; x++ )
+                {
+                    const float  wgt = ker[x];
+                    const float* pix = &line[x];
 
-            dst.buff[ row * dst.width + col ] = temp;
+                    for ( unsigned col=0; col<width; col++ )
+                    {
+                        out[col] += wgt * pix[col];
+                    }
+                }
+            }
         }
     }
+}
+
+template <unsigned KSZ>
+void convolutionNN( ImgF32* src, ImgF32* dst, const float* kernel, \
+                    const float* bias, unsigned cin, unsigned cout, unsigned ksz, \
+                    const unsigned* actf, unsigned actfsz )
+{
+    if ( KSZ > 0 )
+        ksz = KSZ;
+
+    unsigned width  = src[ actf[0] ].width;
+    unsigned height = src[ actf[0] ].height;
+
+    /* Layer II with spatial kernel, as 9-3-5 or 9-5-5 models */
+    parallelFor( height, [&]( unsigned row )
+    {
+        float* acc  = new float[ cout * width ];
+
+        accumulateRowNN<KSZ>( src, row, kernel, cin, cout, ksz,
+                              actf, actfsz, acc );
+
+        for ( unsigned k=0; k<cout; k++ )
+        {
+            float* out = &originF32( dst[k] )[ row * dst[k].stride ];
+
+            for ( unsigned col=0; col<width; col++ )
+            {
+                float result = acc[ k * width + col ] + bias[k];
+
+                /* Threshold */
+                out[col] = (result < 0.f) ? 0.f : result;
+            }
+        }
+
+        delete[] acc;
+    } );
+}
+
+template <unsigned KSZ>
+void convolutionPS( ImgF32* src, ImgF32 &dst, const float* kernel, \
+                    const float* bias, unsigned cin, unsigned ksz, \
+                    unsigned scale, const unsigned* actf, unsigned actfsz )
+{
+    if ( KSZ > 0 )
+        ksz = KSZ;
+
+    unsigned width  = src[ actf[0] ].width;
+    unsigned height = src[ actf[0] ].height;
+    unsigned cout   = scale * scale;
+
+    /* --
+     * Sub-pixel layer, each output channel is a phase of scale x scale
+     * block, shuffled into dst as residual of resized Y.
+     */
+    parallelFor( height, [&]( unsigned row )
+    {
+        float* acc  = new float[ cout * width ];
+
+        accumulateRowNN<KSZ>( src, row, kernel, cin, cout, ksz,
+                              actf, actfsz, acc );
+
+        for ( unsigned pr=0; pr<scale; pr++ )
+        {
+            float* out = &originF32( dst )[ ( row * scale + pr ) * dst.stride ];
 
-    discardConvLayers( &src2[0], CONV2_FILTERS );
+            for ( unsigned pc=0; pc<scale; pc++ )
+            {
+                unsigned     k   = pr * scale + pc;
+                const float* res = &acc[ k * width ];
+
+                for ( unsigned col=0; col<width; col++ )
+                {
+                    float result = out[ col * scale + pc ] + ( res[col] + bias[k] );
+
+                    result = MAX( result, 0.f );
+                    result = MIN( result, 255.f );
+
+                    out[ col * scale + pc ] = result;
+                }
+            }
+        }
+
+        delete[] acc;
+    } );
 }
 
-void Convolution99x11( ImgF32& src, ImgF32* dst, const ConvKernel64_99 kernel99, \
-                                                 const ConvKernel1 bias99, \
-                                                 const ConvKernel21 kernel11, \
-                                                 const ConvKernel2 bias11 )
+template <unsigned KSZ>
+void Convolution99x11( ImgF32& src, ImgF32* dst, const ConvLayer* layer1, \
+                                                 const ConvLayer* layer2, \
+                                                 const unsigned* actf, \
+                                                 unsigned actfsz, \
+                                                 SRCNNSparsity* stat )
 {
     float    result = 0.f;
     unsigned height   = src.height;
     unsigned width    = src.width;
     unsigned row      = 0;
     unsigned col      = 0;
-    float    temp[CONV1_FILTERS] = {0.f};
+    unsigned ksz      = ( KSZ > 0 ) ? KSZ : layer1->ksz;
+    unsigned half     = ksz / 2;
+    unsigned cout1    = layer1->cout;
+    unsigned cout2    = layer2->cout;
+    float    temp[MODEL_MAX_FILTERS] = {0.f};
+    float    res[MODEL_MAX_FILTERS]  = {0.f};
+    unsigned nzf[MODEL_MAX_FILTERS] = {0};
+    unsigned nzfsz = 0;
 
 #ifdef DEBUG
     if ( ( height == 0 ) || ( width == 0 ) )
@@ -549,32 +1485,9 @@ void Convolution99x11( ImgF32& src, ImgF32* dst, const ConvKernel64_99 kernel99,
     }
 #endif
 
-    // allocation required by macOS clang compatibility.
-    unsigned rowsz = height + 9;
-    unsigned* rowf = new unsigned[rowsz];
-    if ( rowf == NULL )
-        return;
-
-    unsigned colsz = width + 9;
-    unsigned* colf = new unsigned[colsz];
-    if ( colf == NULL )
-    {
-        delete[] rowf;
-        return;
-    }
-
-    /* Expand the src image */
-    #pragma omp parallel for
-    for (row = 0; row < rowsz-1; row++)
-    {
-        rowf[row] = uTrim32(0, height - 1, row - 4);
-    }
-
-    #pragma omp parallel for
-    for (col = 0; col < colsz-1; col++)
-    {
-        colf[col] = uTrim32(0, width - 1, col - 4);
-    }
+    // src has halo of ksz / 2 at least, edge pixels repeated.
+    int          stride = src.stride;
+    const float* org    = originF32( src );
 
     /* Complete the Convolution Step */
     /* TODO : need to be optimized with OpenMP */
@@ -582,348 +1495,3338 @@ void Convolution99x11( ImgF32& src, ImgF32* dst, const ConvKernel64_99 kernel99,
     {
         for (col = 0; col < width; col++)
         {
-            for (unsigned k = 0; k < CONV1_FILTERS; k++)
+            const float* img = &org[ ( (int)row - (int)half ) * stride
+                                     + (int)col - (int)half ];
+
+            if ( layer1->packed != NULL )
             {
-                /* Convolution */
-                temp[k] = 0.f;
+                /* All filters of a tap at once, from its panel */
+                for (unsigned k = 0; k < cout1; k++)
+                {
+                    temp[k] = 0.f;
+                }
 
-                for (unsigned i = 0; i < 9; i++)
+                for (unsigned i = 0; i < ksz; i++)
                 {
-                    for (unsigned j = 0; j < 9; j++)
+                    for (unsigned j = 0; j < ksz; j++)
                     {
-                        temp[k] += (float)(kernel99[k][i][j]) \
-                                   * float(src.buff[ rowf[row + i] * width + colf[col + j] ]);
+                        const float* panel = &layer1->packed[ ( i * ksz + j ) * cout1 ];
+                        const float  pixel = img[ i * stride + j ];
+
+                        for (unsigned k = 0; k < cout1; k++)
+                        {
+                            temp[k] += panel[k] * pixel;
+                        }
                     }
                 }
+            }
+            else
+            {
+                for (unsigned n = 0; n < actfsz; n++)
+                {
+                    unsigned k = actf[n];
+                    const float* kernel99 = &layer1->weights[ k * ksz * ksz ];
 
-                temp[k] += bias99[k];
+                    /* Convolution */
+                    temp[k] = 0.f;
 
-                /* Threshold */
-                temp[k] = (temp[k] < 0.f) ? 0.f : temp[k];
+                    for (unsigned i = 0; i < ksz; i++)
+                    {
+                        for (unsigned j = 0; j < ksz; j++)
+                        {
+                            temp[k] += (float)(kernel99[ i * ksz + j ]) \
+                                       * float(img[ i * stride + j ]);
+                        }
+                    }
+                }
             }
 
-            /* Process with each pixel */
-            for (unsigned k = 0; k < CONV2_FILTERS; k++)
+            for (unsigned n = 0; n < actfsz; n++)
             {
-                result = 0.0;
+                unsigned k = actf[n];
 
-                for (unsigned i = 0; i < CONV1_FILTERS; i++)
-                {
-                    result += temp[i] * kernel11[k][i];
-                }
-                result += bias11[k];
+                temp[k] += layer1->biases[k];
 
                 /* Threshold */
-                result = (result < 0.f) ? 0.f : result;
-
-                dst[k].buff[row * width + col] = result;
+                temp[k] = (temp[k] < 0.f) ? 0.f : temp[k];
             }
-        }
-    }
-
-    delete[] rowf;
-    delete[] colf;
-}
-
-int doSRCNN( const unsigned char* refbuff,
-             unsigned w, unsigned h, unsigned d,
-             float muliply,
-             unsigned char* &outbuff,
-             unsigned &outbuffsz,
-             unsigned char** convbuff,
-             unsigned* convbuffsz )
-{
-    int retval = -100;
 
-    // -------------------------------------------------------------
-    // Convert RGB to Y-Cb-Cr
-    //
-    // warning: imgSrc is referenced, don't remove from memory !
-    libsrcnn::ImgU8     imgSrc = { w ,h ,d, (unsigned char*)refbuff };
-    libsrcnn::ImgYCbCr  imgYCbCr;
+            /* Zero activations don't need to be multiplied */
+            if ( stat != NULL )
+            {
+                nzfsz = 0;
 
-    converImgU8toYCbCr( imgSrc, imgYCbCr );
+                for (unsigned n = 0; n < actfsz; n++)
+                {
+                    if ( temp[ actf[n] ] != 0.f )
+                    {
+                        nzf[nzfsz] = actf[n];
+                        nzfsz++;
+                    }
+                }
 
-#ifdef DEBUG_COLORSAPCE
-    saveImgYCbCr( &imgYCbCr, "debugimg" );
-#endif
+                stat->activations += actfsz;
+                stat->zeros       += actfsz - nzfsz;
+                stat->blocks      += actfsz;
+                stat->skipped     += actfsz - nzfsz;
+            }
+            else
+            {
+                memcpy( nzf, actf, actfsz * sizeof( unsigned ) );
+                nzfsz = actfsz;
+            }
 
-    /* --
-     * Resize the Y Channel with Bicubic Interpolation,
-     * Other layers just doing linear interpolation.
-     */
+            /* Process with each pixel */
+            if ( layer2->packed != NULL )
+            {
+                /* All filters of an input at once, from its panel */
+                for (unsigned k = 0; k < cout2; k++)
+                {
+                    res[k] = 0.f;
+                }
 
-    libsrcnn::ImgF32 imgResized[4];
-    const float* refimgbuf[4] = { imgYCbCr.Y.buff,
-                                  imgYCbCr.Cb.buff,
-                                  imgYCbCr.Cr.buff,
-                                  imgYCbCr.A.buff };
+                for (unsigned n = 0; n < nzfsz; n++)
+                {
+                    unsigned     i     = nzf[n];
+                    const float* panel = &layer2->packed[ i * cout2 ];
+                    const float  act   = temp[i];
 
-    unsigned rs_w = imgYCbCr.Y.width  * muliply;
-    unsigned rs_h = imgYCbCr.Y.height * muliply;
+                    for (unsigned k = 0; k < cout2; k++)
+                    {
+                        res[k] += act * panel[k];
+                    }
+                }
 
-    #pragma omp parallel for
-    for ( unsigned cnt=0; cnt<d; cnt++ )
-    {
-        imgResized[cnt].width  = rs_w;
-        imgResized[cnt].height = rs_h;
-        imgResized[cnt].depth  = 1;
-        imgResized[cnt].buff   = NULL;
+                for (unsigned k = 0; k < cout2; k++)
+                {
+                    result = res[k] + layer2->biases[k];
 
-        FRAWGenericFilter* rszfilter;
+                    /* Threshold */
+                    result = (result < 0.f) ? 0.f : result;
 
-        if ( cnt == 0 )
-        {
-            switch( libsrcnn::intp_filter )
+                    originF32( dst[k] )[row * dst[k].stride + col] = result;
+                }
+            }
+            else
             {
-                default:
-                case SRCNNF_Nearest:
-                    rszfilter = new FRAWBoxFilter;
-                    break;
+                for (unsigned k = 0; k < cout2; k++)
+                {
+                    const float* kernel11 = &layer2->weights[ k * layer2->cin ];
 
-                case SRCNNF_Bilinear:
-                    rszfilter = new FRAWBilinearFilter;
-                    break;
+                    result = 0.0;
 
-                case SRCNNF_Bicubic:
-                    rszfilter = new FRAWBicubicFilter;
-                    break;
+                    for (unsigned n = 0; n < nzfsz; n++)
+                    {
+                        unsigned i = nzf[n];
+                        result += temp[i] * kernel11[i];
+                    }
+                    result += layer2->biases[k];
 
-                case SRCNNF_Lanczos3:
-                    rszfilter = new FRAWLanczos3Filter;
-                    break;
+                    /* Threshold */
+                    result = (result < 0.f) ? 0.f : result;
 
-                case SRCNNF_Bspline:
-                    rszfilter = new FRAWBSplineFilter;
-                    break;
+                    originF32( dst[k] )[row * dst[k].stride + col] = result;
+                }
             }
         }
-        else
-        {
-            switch( libsrcnn::intp_filter )
-            {
-                case SRCNNF_Nearest:
-                    rszfilter = new FRAWBoxFilter;
-                    break;
+    }
+}
 
-                default:
-                case SRCNNF_Bilinear:
-                    rszfilter = new FRAWBilinearFilter;
-                    break;
-            }
-        }
+void initImgInterleaved( ImgF32 &img, unsigned w, unsigned h, unsigned channels )
+{
+    img.width  = w;
+    img.height = h;
+    img.depth  = channels;
+    img.stride = w;
+    img.halo   = 0;
 
-        FRAWResizeEngine rsze( rszfilter );
+    unsigned buffsz = w * h * channels;
+    img.buff = allocFloats( buffsz );
 
-        rsze.scale( refimgbuf[cnt],
-                    imgYCbCr.Y.width,
-                    imgYCbCr.Y.height,
-                    rs_w,
-                    rs_h,
-                    &imgResized[cnt].buff );
+    placeImgF32( img, h );
+}
 
-        delete rszfilter;
-    }
+void fillInterleavedRects( ImgF32 &img, ConvOptions &opts )
+{
+    if ( opts.rects == NULL )
+        return;
 
-    // Release splitted image of Y-Cb-Cr --
-    discardImgYCbCr( imgYCbCr );
+    const ConvRect* rects  = opts.rects;
+    unsigned        gutter = opts.gutter;
+    unsigned        width  = img.width;
+    unsigned        chs    = img.depth;
 
-#ifdef DEBUG
-    printf("rY:");
-    saveImgF32( &imgResized[0], "resized_Y.png" );
-    printf("rCb:");
-    saveImgF32( &imgResized[1], "resized_Cb.png" );
-    printf("rCr:");
-    saveImgF32( &imgResized[2], "resized_Cr.png" );
-    if ( d == 4 )
+    /* Pixels of edges repeated in gutter, left and right then rows */
+    parallelFor( opts.rectsz, [&, rects]( unsigned r )
     {
-        printf("rA:");
-        saveImgF32( &imgResized[3], "resized_A.png" );
-    }
-#endif
-
-#ifdef NEW_FAST_I_II_LAYERS
-    /******************* Fast I + II Layer *******************/
+        const ConvRect &rect  = rects[r];
+        size_t          linesz = ( rect.w + gutter * 2 ) * chs;
 
-    libsrcnn::ImgConv2Layers imgConv2;
-
-    libsrcnn::initImgConvLayers( imgConv2,
-                                 imgResized[0].width,
-                                 imgResized[0].height,
-                                 CONV2_FILTERS );
-#ifdef DEBUG
-    printf( "initImgConvLayers, imgConv2 = %p, imgResized[0].width = %u, imgResized[0].height = %u, %u\n",
-            imgConv2, imgResized[0].width, imgResized[0].height, CONV2_FILTERS );
-    fflush( stdout );
-#endif /// of DEBUG
+        for ( unsigned row=rect.y; row<rect.y + rect.h; row++ )
+        {
+            float* line = &img.buff[ ( (size_t)row * width + rect.x ) * chs ];
+            float* last = &line[ ( rect.w - 1 ) * chs ];
 
-    /* PERFORMANCE ISSUE !!
-       Convolution99x11 saves memory than separated 99 and 11 convolution,
-       But no way to apply OpenMP MPI for now.
-    */
-    Convolution99x11( imgResized[0],
-                      imgConv2, weights_conv1_data, 
-                      biases_conv1, weights_conv2_data, 
-                      biases_conv2 );
+            for ( unsigned x=1; x<=gutter; x++ )
+            {
+                memcpy( &line[ -(int)( x * chs ) ], line, chs * sizeof( float ) );
+                memcpy( &last[ x * chs ], last, chs * sizeof( float ) );
+            }
+        }
 
-    #ifdef DEBUG
-        printf("new memory saving I & II layers ..\n" );
-        fflush( stdout );
+        float* top    = &img.buff[ ( (size_t)rect.y * width + rect.x - gutter ) * chs ];
+        float* bottom = &top[ (size_t)( rect.h - 1 ) * width * chs ];
 
-        #pragma omp parallel for
-        for ( unsigned cnt=0; cnt<CONV2_FILTERS; cnt++ )
+        for ( unsigned y=1; y<=gutter; y++ )
         {
-            char strtmp[80] = {0};
-            snprintf( strtmp, 80, "new_conv2_%u.png", cnt );
-            printf( "Writing %s\n", strtmp ); fflush( stdout );
-            saveImgF32( &imgConv2[cnt], strtmp );
+            memcpy( &top[ -(int64_t)( y * width * chs ) ], top, linesz * sizeof( float ) );
+            memcpy( &bottom[ y * width * chs ], bottom, linesz * sizeof( float ) );
         }
-    #endif
-#else
-    /******************* The First Layer *******************/
+    } );
+}
 
-    libsrcnn::ImgConv1Layers imgConv1;
+void initEdgeIndex( unsigned* index, unsigned count, unsigned ksz, unsigned size )
+{
+    int half = ksz / 2;
 
-    libsrcnn::initImgConvLayers( imgConv1,
-                                 imgResized[0].width,
-                                 imgResized[0].height,
-                                 CONV1_FILTERS );
-    #pragma omp parallel for
-    for ( unsigned cnt=0; cnt<CONV1_FILTERS; cnt++)
+    // position of padded pixel, edge pixels repeated.
+    for ( unsigned cnt=0; cnt<count + ksz - 1; cnt++ )
     {
-        libsrcnn::convolution99( imgResized[0],
-                                 imgConv1[cnt],
-                                 weights_conv1_data[cnt],
-                                 biases_conv1[cnt] );
+        index[cnt] = uTrim( 0, size - 1, (int64_t)cnt - half );
     }
+}
 
-#ifdef DEBUG
-    for ( unsigned cnt=0; cnt<CONV1_FILTERS; cnt++ )
+template <unsigned KSZ>
+void convolution99c( ImgF32 &src, ImgF32 &dst, const ConvLayer* layer,
+                     const bool* active, unsigned frames )
+{
+    unsigned width  = dst.width;
+    unsigned height = dst.height;
+    unsigned ksz    = ( KSZ > 0 ) ? KSZ : layer->ksz;
+    unsigned cout   = layer->cout;
+
+    // src has halo of ksz / 2 at least, for each frame.
+    int      half   = ksz / 2;
+    int      stride = src.stride;
+    unsigned frameh = height / frames;
+
+    // locals of thread, not reloaded through shared references.
+    const float* org    = originF32( src );
+    const float* panels = layer->packed;
+    const float* biases = layer->biases;
+
+    /* Filters of a pixel go together, a block of channels at once */
+    parallelFor( height, [&, org, panels, biases]( unsigned row )
     {
-        char strtmp[80] = {0};
-        snprintf( strtmp, 80, "conv1_%u.png", cnt );
-        saveImgF32( &imgConv1[cnt], strtmp );
-    }
-#endif
+        for ( unsigned col=0; col<width; col++ )
+        {
+            float*       out = &dst.buff[ ( row * width + col ) * cout ];
+            const float* img = &org[ ( (int)frameRow( row, frameh, half ) - half ) * stride
+                                     + (int)col - half ];
 
-    /******************* The Second Layer *******************/
+            for ( unsigned k0=0; k0<cout; k0+=CONV_BLOCK_SIZE )
+            {
+                float temp[CONV_BLOCK_SIZE] = {0.f};
 
-    libsrcnn::ImgConv2Layers imgConv2;
+                for ( unsigned y=0; y<ksz; y++ )
+                {
+                    const float* line = &img[ y * stride ];
 
-    libsrcnn::initImgConvLayers( imgConv2,
-                                 imgResized[0].width,
-                                 imgResized[0].height,
-                                 CONV2_FILTERS );
-    #pragma omp parallel for
-    for ( unsigned cnt=0; cnt<CONV2_FILTERS; cnt++ )
-    {
-        libsrcnn::convolution11( imgConv1,
-                                 imgConv2[cnt],
-                                 weights_conv2_data[cnt],
-                                 biases_conv2[cnt]);
-    }
+                    for ( unsigned x=0; x<ksz; x++ )
+                    {
+                        const float* panel = &panels[ ( y * ksz + x ) * cout + k0 ];
+                        const float  pixel = line[x];
+
+                        for ( unsigned b=0; b<CONV_BLOCK_SIZE; b++ )
+                        {
+                            temp[b] += panel[b] * pixel;
+                        }
+                    }
+                }
+
+                for ( unsigned b=0; b<CONV_BLOCK_SIZE; b++ )
+                {
+                    float result = temp[b] + biases[ k0 + b ];
+
+                    /* Threshold, pruned filters stay zero */
+                    result = (result >= 0) ? result : 0;
+                    out[ k0 + b ] = active[ k0 + b ] ? result : 0.f;
+                }
+            }
+        }
+    } );
+}
+
+void convolution11c( ImgF32 &src, ImgF32 &dst, const ConvLayer* layer,
+                     const unsigned* actf, unsigned actfsz,
+                     SRCNNSparsity* stat )
+{
+    unsigned width  = src.width;
+    unsigned height = src.height;
+    unsigned cin    = layer->cin;
+    unsigned cout   = layer->cout;
+
+    const float* img    = src.buff;
+    const float* panels = layer->packed;
+    const float* biases = layer->biases;
+
+    unsigned long long zeros = parallelSum( height, [&, img, panels, biases]( unsigned row )
+    {
+        unsigned nzf[MODEL_MAX_FILTERS];
+        unsigned long long zeros = 0;
+
+        for ( unsigned col=0; col<width; col++ )
+        {
+            unsigned     pos   = row * width + col;
+            const float* in    = &img[ pos * cin ];
+            float*       out   = &dst.buff[ pos * cout ];
+            unsigned     nzfsz = 0;
+
+            /* Zero activations don't need to be multiplied */
+            for ( unsigned n=0; n<actfsz; n++ )
+            {
+                if ( ( stat == NULL ) || ( in[ actf[n] ] != 0.f ) )
+                {
+                    nzf[nzfsz] = actf[n];
+                    nzfsz++;
+                }
+            }
+
+            zeros += actfsz - nzfsz;
+
+            for ( unsigned k0=0; k0<cout; k0+=CONV_BLOCK_SIZE )
+            {
+                float temp[CONV_BLOCK_SIZE] = {0.f};
+
+                for ( unsigned n=0; n<nzfsz; n++ )
+                {
+                    const float* panel = &panels[ nzf[n] * cout + k0 ];
+                    const float  act   = in[ nzf[n] ];
+
+                    for ( unsigned b=0; b<CONV_BLOCK_SIZE; b++ )
+                    {
+                        temp[b] += act * panel[b];
+                    }
+                }
+
+                for ( unsigned b=0; b<CONV_BLOCK_SIZE; b++ )
+                {
+                    float result = temp[b] + biases[ k0 + b ];
+
+                    /* Threshold */
+                    out[ k0 + b ] = (result >= 0) ? result : 0;
+                }
+            }
+        }
+
+        return zeros;
+    } );
+
+    if ( stat != NULL )
+    {
+        unsigned long long pixels = (unsigned long long)width * height;
+
+        stat->activations += pixels * actfsz;
+        stat->zeros       += zeros;
+        stat->blocks      += pixels * actfsz;
+        stat->skipped     += zeros;
+    }
+}
+
+template <unsigned KSZ>
+inline float convolution55Pixel( const float* img, const float* panels,
+                                 const unsigned* rowf, const unsigned* colf,
+                                 unsigned row, unsigned col, unsigned width,
+                                 unsigned ksz, unsigned cin, float bias )
+{
+    double temppixel[MODEL_MAX_FILTERS];
+
+    for ( unsigned c=0; c<cin; c++ )
+    {
+        temppixel[c] = 0.0;
+    }
+
+    /* Each channel sums its own window, channels at once */
+    for ( unsigned y=0; y<ksz; y++ )
+    {
+        for ( unsigned x=0; x<ksz; x++ )
+        {
+            const float* in    = &img[ ( rowf[ row + y ] * width
+                                        + colf[ col + x ] ) * cin ];
+            const float* panel = &panels[ ( y * ksz + x ) * cin ];
+
+            for ( unsigned c0=0; c0<cin; c0+=CONV_BLOCK_SIZE )
+            {
+                for ( unsigned b=0; b<CONV_BLOCK_SIZE; b++ )
+                {
+                    temppixel[ c0 + b ] += panel[ c0 + b ] * in[ c0 + b ];
+                }
+            }
+        }
+    }
+
+    float temp = 0;
+
+    for ( unsigned c=0; c<cin; c++ )
+    {
+        temp += temppixel[c];
+    }
+
+    temp += bias;
+
+    temp = MAX( temp, 0.f );
+    temp = MIN( temp, 255.f );
+
+    return temp;
+}
+
+template <unsigned KSZ>
+void convolution55c( ImgF32 &src, ImgF32 &dst, const ConvLayer* layer,
+                     unsigned frames )
+{
+    unsigned width  = src.width;
+    unsigned height = src.height;
+    unsigned frameh = height / frames;
+    unsigned ksz    = ( KSZ > 0 ) ? KSZ : layer->ksz;
+    unsigned cin    = layer->cin;
+    float    bias   = *layer->biases;
+
+    const float* img    = src.buff;
+    const float* panels = layer->packed;
+
+    // edges repeated in each frame.
+    unsigned* rowf = new unsigned[ frameh + ksz ];
+    unsigned* colf = new unsigned[ width + ksz ];
+
+    initEdgeIndex( rowf, frameh, ksz, frameh );
+    initEdgeIndex( colf, width, ksz, width );
+
+    parallelFor( height, [&, img, panels, rowf, colf]( unsigned row )
+    {
+        const float* frame = &img[ (size_t)( row - row % frameh ) * width * cin ];
+
+        for ( unsigned col=0; col<width; col++ )
+        {
+            dst.buff[ row * width + col ] = \
+                convolution55Pixel<KSZ>( frame, panels, rowf, colf,
+                                         row % frameh, col,
+                                         width, ksz, cin, bias );
+        }
+    } );
+
+    delete[] rowf;
+    delete[] colf;
+}
+
+void countSparsity( const float* img, unsigned pixels, unsigned cin,
+                    const unsigned* actf, unsigned actfsz, SRCNNSparsity* stat )
+{
+    if ( stat == NULL )
+        return;
+
+    unsigned long long zeros = parallelSum( pixels, [&, img, actf]( unsigned pos )
+    {
+        const float* in    = &img[ pos * cin ];
+        unsigned     count = 0;
+
+        for ( unsigned n=0; n<actfsz; n++ )
+        {
+            if ( in[ actf[n] ] == 0.f )
+                count++;
+        }
+
+        return (unsigned long long)count;
+    } );
+
+    unsigned long long total = (unsigned long long)pixels * actfsz;
+
+    stat->activations += total;
+    stat->zeros       += zeros;
+    stat->blocks      += total;
+    stat->skipped     += zeros;
+}
+
+void convolution99g( ImgF32 &src, ImgF32 &dst, const ConvLayer* layer,
+                     const bool* active, unsigned frames, SgemmFunc sgemm )
+{
+    unsigned width  = dst.width;
+    unsigned height = dst.height;
+    unsigned frameh = height / frames;
+    unsigned ksz    = layer->ksz;
+    unsigned kksz   = ksz * ksz;
+    unsigned cout   = layer->cout;
+    int      half   = ksz / 2;
+    int      stride = src.stride;
+
+    const float* org    = originF32( src );
+    const float* biases = layer->biases;
+
+    /* --
+     * Windows of a band of rows unrolled as [pixel][tap], then
+     * one GEMM with [tap][filter] panel makes channels last rows.
+     */
+    unsigned bandh = MAX( 1U, CONV_GEMM_BAND / ( width * kksz ) );
+    float*   cols  = allocFloats( MIN( bandh, height ) * width * kksz );
+
+    for ( unsigned row0=0; row0<height; row0+=bandh )
+    {
+        unsigned rows = MIN( bandh, height - row0 );
+
+        parallelFor( rows, [&, org, cols]( unsigned r )
+        {
+            for ( unsigned col=0; col<width; col++ )
+            {
+                const float* img = &org[ ( (int)frameRow( row0 + r, frameh, half )
+                                           - half ) * stride + (int)col - half ];
+                float*       win = &cols[ ( r * width + col ) * kksz ];
+
+                for ( unsigned y=0; y<ksz; y++ )
+                {
+                    memcpy( &win[ y * ksz ], &img[ y * stride ], ksz * sizeof( float ) );
+                }
+            }
+        } );
+
+        float* out = &dst.buff[ (size_t)row0 * width * cout ];
+
+        sgemm( rows * width, cout, kksz, cols, kksz,
+               layer->packed, cout, out, cout );
+
+        parallelFor( rows * width, [&, out, biases]( unsigned pos )
+        {
+            float* act = &out[ pos * cout ];
+
+            for ( unsigned k=0; k<cout; k++ )
+            {
+                float result = act[k] + biases[k];
+
+                /* Threshold, pruned filters stay zero */
+                result = (result >= 0) ? result : 0;
+                act[k] = active[k] ? result : 0.f;
+            }
+        } );
+    }
+
+    freeFloats( cols );
+}
+
+void convolution11g( ImgF32 &src, ImgF32 &dst, const ConvLayer* layer,
+                     const unsigned* actf, unsigned actfsz,
+                     SRCNNSparsity* stat, SgemmFunc sgemm )
+{
+    unsigned pixels = src.width * src.height;
+    unsigned cin    = layer->cin;
+    unsigned cout   = layer->cout;
+
+    const float* img    = src.buff;
+    const float* biases = layer->biases;
+    float*       out    = dst.buff;
+
+    /* All pixels at once, pruned channels are zero and add nothing */
+    sgemm( pixels, cout, cin, img, cin, layer->packed, cout, out, cout );
+
+    parallelFor( pixels, [&, biases, out]( unsigned pos )
+    {
+        float* act = &out[ pos * cout ];
+
+        for ( unsigned k=0; k<cout; k++ )
+        {
+            float result = act[k] + biases[k];
+
+            /* Threshold */
+            act[k] = (result >= 0) ? result : 0;
+        }
+    } );
+
+    // same statistics as skipping, nothing skipped by GEMM.
+    countSparsity( img, pixels, cin, actf, actfsz, stat );
+}
+
+// repeatable values of a probe to check generated kernels, some zeros.
+void fillProbe( float* buff, unsigned count )
+{
+    uint32_t seed = 0x5EED;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        seed = seed * 1103515245U + 12345U;
+
+        buff[cnt] = ( ( seed >> 8 ) & 3 ) ? ( ( seed >> 16 ) & 0x7FFF ) / 32768.f : 0.f;
+    }
+}
+
+bool sameProbe( const float* ref, const float* out, unsigned count )
+{
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        // order of additions differs.
+        if ( fabsf( ref[cnt] - out[cnt] ) > 1e-3f * MAX( 1.f, fabsf( ref[cnt] ) ) )
+            return false;
+    }
+
+    return true;
+}
+
+bool checkJit99( JitConv99Row kernel, const ConvLayer* layer, unsigned width,
+                 unsigned halo, const bool* active, const float* mask )
+{
+    unsigned cout = layer->cout;
+    int      half = layer->ksz / 2;
+
+    ImgF32 probe, ref, out;
+
+    initImgF32Halo( probe, width, 1, halo );
+    fillProbe( probe.buff, probe.stride * ( 1 + halo * 2 ) );
+    initImgInterleaved( ref, width, 1, cout );
+    initImgInterleaved( out, width, 1, cout );
+
+    convolution99c<0>( probe, ref, layer, active, 1 );
+    kernel( &originF32( probe )[ -half * (int)probe.stride - half ], out.buff,
+            layer->packed, layer->biases, mask );
+
+    bool same = sameProbe( ref.buff, out.buff, width * cout );
+
+    resetImgF32( probe );
+    resetImgF32( ref );
+    resetImgF32( out );
+
+    return same;
+}
+
+bool checkJit11( JitConv11Row kernel, const ConvLayer* layer, unsigned width,
+                 const unsigned* actf, unsigned actfsz )
+{
+    ImgF32 probe, ref, out;
+
+    initImgInterleaved( probe, width, 1, layer->cin );
+    fillProbe( probe.buff, width * layer->cin );
+    initImgInterleaved( ref, width, 1, layer->cout );
+    initImgInterleaved( out, width, 1, layer->cout );
+
+    convolution11c( probe, ref, layer, actf, actfsz, NULL );
+    kernel( probe.buff, out.buff, layer->packed, layer->biases );
+
+    bool same = sameProbe( ref.buff, out.buff, width * layer->cout );
+
+    resetImgF32( probe );
+    resetImgF32( ref );
+    resetImgF32( out );
+
+    return same;
+}
+
+bool checkJit55( JitConv55Row kernel, const ConvLayer* layer, unsigned width,
+                 const float* consts )
+{
+    unsigned ksz  = layer->ksz;
+    unsigned half = ksz / 2;
+
+    ImgF32 probe, ref, out;
+
+    // values of last layer clamped, inputs scaled up to reach them.
+    initImgInterleaved( probe, width, ksz, layer->cin );
+    fillProbe( probe.buff, width * ksz * layer->cin );
+
+    for ( unsigned cnt=0; cnt<width * ksz * layer->cin; cnt++ )
+    {
+        probe.buff[cnt] *= 64.f;
+    }
+
+    initImgF32( ref, width, ksz );
+    initImgF32( out, width, 1 );
+
+    convolution55c<0>( probe, ref, layer, 1 );
+    kernel( probe.buff, out.buff, layer->packed, consts );
+
+    bool same = sameProbe( &ref.buff[ half * width + half ], out.buff,
+                           width - half * 2 );
+
+    resetImgF32( probe );
+    resetImgF32( ref );
+    resetImgF32( out );
+
+    return same;
+}
+
+bool convolution99j( ImgF32 &src, ImgF32 &dst, const ConvLayer* layer,
+                     const bool* active, unsigned frames )
+{
+    unsigned width  = dst.width;
+    unsigned height = dst.height;
+    unsigned frameh = height / frames;
+    unsigned ksz    = layer->ksz;
+    unsigned cout   = layer->cout;
+    int      half   = ksz / 2;
+    int      stride = src.stride;
+    bool     fresh  = false;
+
+    JitConv99Row kernel = jitConv99Row( width, stride, ksz, cout, &fresh );
+
+    if ( kernel == NULL )
+        return false;
+
+    // pruned filters are masked out by bits.
+    uint32_t mask[MODEL_MAX_FILTERS];
+
+    for ( unsigned k=0; k<cout; k++ )
+    {
+        mask[k] = active[k] ? 0xFFFFFFFFU : 0;
+    }
+
+    const float* maskf = (const float*)mask;
+
+    if ( ( fresh == true )
+         && ( checkJit99( kernel, layer, width, src.halo, active, maskf ) == false ) )
+    {
+        disableJit();
+        return false;
+    }
+
+    const float* org    = originF32( src );
+    const float* panels = layer->packed;
+    const float* biases = layer->biases;
+
+    parallelFor( height, [&, kernel, org, panels, biases, maskf]( unsigned row )
+    {
+        kernel( &org[ ( (int)frameRow( row, frameh, half ) - half ) * stride - half ],
+                &dst.buff[ (size_t)row * width * cout ], panels, biases, maskf );
+    } );
+
+    return true;
+}
+
+bool convolution11j( ImgF32 &src, ImgF32 &dst, const ConvLayer* layer,
+                     const unsigned* actf, unsigned actfsz,
+                     SRCNNSparsity* stat )
+{
+    unsigned width  = src.width;
+    unsigned height = src.height;
+    unsigned cin    = layer->cin;
+    unsigned cout   = layer->cout;
+    bool     fresh  = false;
+
+    JitConv11Row kernel = jitConv11Row( width, cin, cout, actf, actfsz, &fresh );
+
+    if ( kernel == NULL )
+        return false;
+
+    if ( ( fresh == true )
+         && ( checkJit11( kernel, layer, width, actf, actfsz ) == false ) )
+    {
+        disableJit();
+        return false;
+    }
+
+    const float* img    = src.buff;
+    const float* panels = layer->packed;
+    const float* biases = layer->biases;
+
+    /* Active channels only, zero activations multiplied as well */
+    parallelFor( height, [&, kernel, img, panels, biases]( unsigned row )
+    {
+        size_t pos = (size_t)row * width;
+
+        kernel( &img[ pos * cin ], &dst.buff[ pos * cout ], panels, biases );
+    } );
+
+    countSparsity( img, width * height, cin, actf, actfsz, stat );
+
+    return true;
+}
+
+bool convolution55j( ImgF32 &src, ImgF32 &dst, const ConvLayer* layer,
+                     unsigned frames )
+{
+    unsigned width  = src.width;
+    unsigned height = src.height;
+    unsigned frameh = height / frames;
+    unsigned ksz    = layer->ksz;
+    unsigned half   = ksz / 2;
+    unsigned cin    = layer->cin;
+    float    bias   = *layer->biases;
+    bool     fresh  = false;
+
+    if ( ( width <= half * 2 ) || ( frameh <= half * 2 ) )
+        return false;
+
+    unsigned     inner  = width - half * 2;
+    JitConv55Row kernel = jitConv55Row( inner, width, ksz, cin, &fresh );
+
+    if ( kernel == NULL )
+        return false;
+
+    const float consts[3] = { bias, 0.f, 255.f };
+
+    if ( ( fresh == true )
+         && ( checkJit55( kernel, layer, width, consts ) == false ) )
+    {
+        disableJit();
+        return false;
+    }
+
+    const float* img    = src.buff;
+    const float* panels = layer->packed;
+    const float* cnsts  = consts;
+
+    unsigned* rowf = new unsigned[ frameh + ksz ];
+    unsigned* colf = new unsigned[ width + ksz ];
+
+    initEdgeIndex( rowf, frameh, ksz, frameh );
+    initEdgeIndex( colf, width, ksz, width );
+
+    /* Windows inside of image by generated kernel, edges repeated by reference */
+    parallelFor( height, [&, kernel, img, panels, cnsts, rowf, colf]( unsigned row )
+    {
+        float*       out   = &dst.buff[ row * width ];
+        unsigned     frow  = row % frameh;
+        const float* frame = &img[ (size_t)( row - frow ) * width * cin ];
+        unsigned     step  = 1;
+
+        if ( ( frow >= half ) && ( frow < frameh - half ) )
+        {
+            kernel( &frame[ (size_t)( frow - half ) * width * cin ], &out[ half ],
+                    panels, cnsts );
+
+            // left and right edges only.
+            step = inner + 1;
+        }
+
+        for ( unsigned col=0; col<width; col+=( col == half - 1 ) ? step : 1 )
+        {
+            out[col] = convolution55Pixel<0>( frame, panels, rowf, colf, frow, col,
+                                              width, ksz, cin, bias );
+        }
+    } );
+
+    delete[] rowf;
+    delete[] colf;
+
+    return true;
+}
+
+bool interleavedLayers( const ConvLayer* layers, unsigned count, ConvOptions &opts )
+{
+    if ( ( opts.interleaved == false ) || ( opts.fused == true )
+         || ( opts.comp != NULL ) || ( count < 2 ) )
+        return false;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        const ConvLayer &layer = layers[cnt];
+        bool             last  = ( cnt + 1 == count );
+
+        if ( layer.packed == NULL )
+            return false;
+
+        // channels go by blocks.
+        if ( ( layer.cin % CONV_BLOCK_SIZE != 0 ) && ( cnt > 0 ) )
+            return false;
+
+        if ( last == true )
+        {
+            if ( ( layer.act != CONV_Clamp ) || ( layer.cout != 1 ) )
+                return false;
+        }
+        else
+        if ( ( layer.act != CONV_ReLU ) || ( layer.cout % CONV_BLOCK_SIZE != 0 )
+             || ( ( cnt > 0 ) && ( layer.ksz != 1 ) ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool runConvLayersInterleaved( const ConvLayer* layers, unsigned count,
+                               ImgF32 &src, ImgF32 &dst, ConvOptions &opts )
+{
+    unsigned width  = dst.width;
+    unsigned height = dst.height;
+    unsigned frames = MAX( 1U, opts.frames );
+
+    unsigned allf[MODEL_MAX_FILTERS] = {0};
+    bool     active[MODEL_MAX_FILTERS] = {false};
+
+    for ( unsigned cnt=0; cnt<MODEL_MAX_FILTERS; cnt++ )
+    {
+        allf[cnt] = cnt;
+    }
+
+    const unsigned* actf   = allf;
+    unsigned        actfsz = layers[0].cout;
+
+    if ( opts.actf != NULL )
+    {
+        actf   = opts.actf;
+        actfsz = opts.actfsz;
+    }
+
+    for ( unsigned cnt=0; cnt<actfsz; cnt++ )
+    {
+        active[ actf[cnt] ] = true;
+    }
+
+    /* Channels of a pixel are next to each other, two tensors alive */
+    ImgF32 tensors[2];
+    memset( tensors, 0, 2 * sizeof( ImgF32 ) );
+
+    ImgF32 srcpad;
+    memset( &srcpad, 0, sizeof( ImgF32 ) );
+
+    copyImgF32Frames( srcpad, src, frames, layers[0].ksz / 2 );
+
+    initImgInterleaved( tensors[0], width, height, layers[0].cout );
+
+    // generated kernels first, false for shapes those are not made.
+    bool jitted = ( opts.jit == true )
+                  && ( convolution99j( srcpad, tensors[0], &layers[0], active,
+                                       frames ) == true );
+
+    if ( jitted == false )
+    {
+        if ( opts.sgemm != NULL )
+        {
+            convolution99g( srcpad, tensors[0], &layers[0], active, frames, opts.sgemm );
+        }
+        else
+        {
+            selectConvKernels( layers[0].ksz )->conv99c( srcpad, tensors[0], &layers[0],
+                                                         active, frames );
+        }
+    }
+
+    resetImgF32( srcpad );
+    fillInterleavedRects( tensors[0], opts );
+
+    bool retval = true;
+
+    for ( unsigned cnt=1; cnt<count; cnt++ )
+    {
+        const ConvLayer &layer = layers[cnt];
+        ImgF32          &in    = tensors[ ( cnt - 1 ) % 2 ];
+        ImgF32          &out   = tensors[ cnt % 2 ];
+
+        // cancelled call drops its activations now.
+        if ( jobCancelled( opts.job ) == true )
+        {
+            retval = false;
+            break;
+        }
+
+        jobProgress( opts.job, cnt * 1000 / count );
+
+        if ( cnt + 1 == count )
+        {
+            if ( ( opts.jit == false )
+                 || ( convolution55j( in, dst, &layer, frames ) == false ) )
+            {
+                selectConvKernels( layer.ksz )->conv55c( in, dst, &layer, frames );
+            }
+        }
+        else
+        {
+            resetImgF32( out );
+            initImgInterleaved( out, width, height, layer.cout );
+
+            jitted = ( opts.jit == true )
+                     && ( convolution11j( in, out, &layer, actf, actfsz,
+                                          opts.sparse ) == true );
+
+            if ( jitted == false )
+            {
+                if ( opts.sgemm != NULL )
+                {
+                    convolution11g( in, out, &layer, actf, actfsz,
+                                    opts.sparse, opts.sgemm );
+                }
+                else
+                {
+                    convolution11c( in, out, &layer, actf, actfsz,
+                                    opts.sparse );
+                }
+            }
+
+            fillInterleavedRects( out, opts );
+
+            // outputs of 1x1 layer are all active.
+            actf   = allf;
+            actfsz = layer.cout;
+        }
+
+        resetImgF32( in );
+    }
+
+    resetImgF32( tensors[0] );
+    resetImgF32( tensors[1] );
+
+    // loops of last layer may stop half way.
+    if ( jobCancelled( opts.job ) == true )
+        return false;
+
+    return retval;
+}
+
+bool initResizeTaps( ResizeTaps &taps, FRAWGenericFilter* filter,
+                     unsigned srcsz, unsigned scale, unsigned ksz )
+{
+    unsigned half = ksz / 2;
+
+    taps.scale   = scale;
+    taps.ksz     = ksz;
+    taps.count   = srcsz * scale;
+    taps.window  = 2 * (unsigned)ceil( filter->GetWidth() ) + 1;
+    taps.left    = new unsigned[ taps.count ];
+    taps.taps    = new unsigned[ taps.count ];
+    taps.weights = new float[ taps.count * taps.window ];
+    taps.inside  = new bool[ taps.count ];
+
+    // same weights table with resizing engine.
+    FRawScaleWeightsTable wtable( filter, taps.count, srcsz );
+
+    for ( unsigned u=0; u<taps.count; u++ )
+    {
+        taps.left[u] = wtable.getLeftBoundary( u );
+        taps.taps[u] = wtable.getRightBoundary( u ) - taps.left[u] + 1;
+
+        for ( unsigned i=0; i<taps.window; i++ )
+        {
+            taps.weights[ u * taps.window + i ] = \
+                ( i < taps.taps[u] ) ? (float)wtable.getWeight( u, i ) : 0.f;
+        }
+    }
+
+    /* --
+     * Weights are periodic by scale except near of edges,
+     * compares each destination to its phase at the middle.
+     */
+    bool* periodic = new bool[ taps.count ];
+
+    for ( unsigned u=0; u<taps.count; u++ )
+    {
+        unsigned ref = ( srcsz / 2 ) * scale + ( u % scale );
+        int      ru  = (int)taps.left[u] - (int)( u / scale );
+        int      rr  = (int)taps.left[ref] - (int)( ref / scale );
+        int      lo  = MIN( ru, rr );
+        int      hi  = MAX( ru + (int)taps.taps[u], rr + (int)taps.taps[ref] );
+
+        periodic[u] = true;
+
+        for ( int t=lo; t<hi; t++ )
+        {
+            float wu = 0.f;
+            float wr = 0.f;
+
+            if ( ( t >= ru ) && ( t < ru + (int)taps.taps[u] ) )
+                wu = taps.weights[ u * taps.window + ( t - ru ) ];
+
+            if ( ( t >= rr ) && ( t < rr + (int)taps.taps[ref] ) )
+                wr = taps.weights[ ref * taps.window + ( t - rr ) ];
+
+            if ( fabsf( wu - wr ) > 1e-6f )
+            {
+                periodic[u] = false;
+                break;
+            }
+        }
+    }
+
+    // Layer I window of ksz taps at each destination.
+    for ( unsigned u=0; u<taps.count; u++ )
+    {
+        taps.inside[u] = ( u >= half ) && ( u + half < taps.count );
+
+        for ( unsigned a=0; ( a<ksz ) && ( taps.inside[u] == true ); a++ )
+        {
+            taps.inside[u] = periodic[ u + a - half ];
+        }
+    }
+
+    delete[] periodic;
+
+    taps.lowest = 0;
+    int highest = 0;
+
+    for ( unsigned p=0; p<scale; p++ )
+    {
+        for ( unsigned a=0; a<ksz; a++ )
+        {
+            int      d   = (int)p + (int)a - (int)half;
+            int      fb  = ( d >= 0 ) ? d / (int)scale
+                                      : -( ( -d + (int)scale - 1 ) / (int)scale );
+            unsigned q   = (unsigned)( d - fb * (int)scale );
+            unsigned ref = ( srcsz / 2 ) * scale + q;
+
+            taps.first[p][a] = fb + (int)taps.left[ref] - (int)( ref / scale );
+
+            if ( ( p == 0 ) && ( a == 0 ) )
+            {
+                taps.lowest = taps.first[p][a];
+                highest     = taps.first[p][a] + (int)taps.taps[ref];
+            }
+            else
+            {
+                taps.lowest = MIN( taps.lowest, taps.first[p][a] );
+                highest     = MAX( highest, taps.first[p][a] + (int)taps.taps[ref] );
+            }
+        }
+    }
+
+    taps.span = highest - taps.lowest;
+
+    // composite kernel reads its whole span of source.
+    for ( unsigned u=0; u<taps.count; u++ )
+    {
+        int sfirst = (int)( u / scale ) + taps.lowest;
+
+        if ( ( sfirst < 0 ) || ( sfirst + (int)taps.span > (int)srcsz ) )
+        {
+            taps.inside[u] = false;
+        }
+    }
+
+    return true;
+}
+
+void discardResizeTaps( ResizeTaps &taps )
+{
+    delete[] taps.left;
+    delete[] taps.taps;
+    delete[] taps.weights;
+    delete[] taps.inside;
+
+    memset( &taps, 0, sizeof( ResizeTaps ) );
+}
+
+bool initCompositeConv1( CompositeConv1 &comp, const ConvLayer* layer,
+                         FRAWGenericFilter* filter,
+                         unsigned w, unsigned h, unsigned scale,
+                         const unsigned* actf, unsigned actfsz )
+{
+    memset( &comp, 0, sizeof( CompositeConv1 ) );
+
+    if ( ( filter == NULL ) || ( scale < 2 ) || ( scale > COMPOSITE_MAX_SCALE ) )
+        return false;
+
+    comp.scale = scale;
+    comp.layer = layer;
+
+    unsigned f1    = layer->ksz;
+    unsigned half  = f1 / 2;
+
+    initResizeTaps( comp.rows, filter, h, scale, f1 );
+    initResizeTaps( comp.cols, filter, w, scale, f1 );
+
+    unsigned rspan = comp.rows.span;
+    unsigned cspan = comp.cols.span;
+    unsigned ksz   = rspan * cspan;
+    unsigned kcnt  = scale * scale * layer->cout * ksz;
+
+    comp.kernels = new float[ kcnt ];
+    memset( comp.kernels, 0, kcnt * sizeof( float ) );
+
+    /* --
+     * Compose resize taps into layer I for each phase,
+     * taps of periodic phases are taken from middle of image.
+     */
+    parallelFor( actfsz, [&]( unsigned cnt )
+    {
+        unsigned k = actf[cnt];
+
+        for ( unsigned pr=0; pr<scale; pr++ )
+        for ( unsigned pc=0; pc<scale; pc++ )
+        {
+            float* kern = &comp.kernels[ ( ( pr * scale + pc ) * layer->cout + k ) * ksz ];
+
+            for ( unsigned a=0; a<f1; a++ )
+            {
+                unsigned rref = ( h / 2 ) * scale + ( pr + a + half * scale - half ) % scale;
+                unsigned roff = (unsigned)( comp.rows.first[pr][a] - comp.rows.lowest );
+                const float* rw = &comp.rows.weights[ rref * comp.rows.window ];
+
+                for ( unsigned b=0; b<f1; b++ )
+                {
+                    unsigned cref = ( w / 2 ) * scale + ( pc + b + half * scale - half ) % scale;
+                    unsigned coff = (unsigned)( comp.cols.first[pc][b] - comp.cols.lowest );
+                    const float* cw = &comp.cols.weights[ cref * comp.cols.window ];
+                    float kv = layer->weights[ ( k * f1 + a ) * f1 + b ];
+
+                    for ( unsigned i=0; i<comp.rows.taps[rref]; i++ )
+                    {
+                        for ( unsigned j=0; j<comp.cols.taps[cref]; j++ )
+                        {
+                            kern[ ( roff + i ) * cspan + ( coff + j ) ] += kv * rw[i] * cw[j];
+                        }
+                    }
+                }
+            }
+        }
+    } );
+
+    return true;
+}
+
+void discardCompositeConv1( CompositeConv1 &comp )
+{
+    discardResizeTaps( comp.rows );
+    discardResizeTaps( comp.cols );
+
+    if ( comp.kernels != NULL )
+    {
+        delete[] comp.kernels;
+    }
+
+    memset( &comp, 0, sizeof( CompositeConv1 ) );
+}
+
+inline float resizedPixel( ImgF32 &src, CompositeConv1 &comp, unsigned v, unsigned u )
+{
+    const float* rw = &comp.rows.weights[ v * comp.rows.window ];
+    const float* cw = &comp.cols.weights[ u * comp.cols.window ];
+    float        sum = 0.f;
+
+    for ( unsigned i=0; i<comp.rows.taps[v]; i++ )
+    {
+        const float* pix = &src.buff[ ( comp.rows.left[v] + i ) * src.width
+                                      + comp.cols.left[u] ];
+        float hsum = 0.f;
+
+        for ( unsigned j=0; j<comp.cols.taps[u]; j++ )
+        {
+            hsum += cw[j] * pix[j];
+        }
+
+        sum += rw[i] * hsum;
+    }
+
+    return sum;
+}
+
+void convolutionLR99( ImgF32 &src, ImgF32* dst, CompositeConv1 &comp,
+                      const unsigned* actf, unsigned actfsz )
+{
+    const float* bias = comp.layer->biases;
+    unsigned scale  = comp.scale;
+    unsigned width  = comp.cols.count;
+    unsigned height = comp.rows.count;
+    unsigned rspan  = comp.rows.span;
+    unsigned cspan  = comp.cols.span;
+    unsigned ksz    = rspan * cspan;
+
+    /* --
+     * Destinations of same phase in a row are a stride 1 convolution
+     * on source, interior goes by each filter and phase.
+     */
+    parallelFor( actfsz, [&]( unsigned cnt )
+    {
+        unsigned k    = actf[cnt];
+        float*   temp = new float[ src.width ];
+
+        for ( unsigned row=0; row<height; row++ )
+        {
+            if ( comp.rows.inside[row] == false )
+                continue;
+
+            unsigned pr = row % scale;
+            int      sr = (int)( row / scale ) + comp.rows.lowest;
+
+            for ( unsigned pc=0; pc<scale; pc++ )
+            {
+                unsigned jlo = src.width;
+                unsigned jhi = 0;
+
+                for ( unsigned j=0; j * scale + pc < width; j++ )
+                {
+                    if ( comp.cols.inside[ j * scale + pc ] == true )
+                    {
+                        jlo = MIN( jlo, j );
+                        jhi = MAX( jhi, j + 1 );
+                    }
+                }
+
+                if ( jlo >= jhi )
+                    continue;
+
+                const float* kern = &comp.kernels[ ( ( pr * scale + pc ) * comp.layer->cout + k ) * ksz ];
+                const float* base = &src.buff[ sr * (int)src.width
+                                               + (int)jlo + comp.cols.lowest ];
+                unsigned     jsz  = jhi - jlo;
+
+                for ( unsigned j=0; j<jsz; j++ )
+                {
+                    temp[j] = 0.f;
+                }
+
+                for ( unsigned m=0; m<rspan; m++ )
+                {
+                    for ( unsigned n=0; n<cspan; n++ )
+                    {
+                        const float* pix = &base[ m * src.width + n ];
+                        const float  wgt = kern[ m * cspan + n ];
+
+                        for ( unsigned j=0; j<jsz; j++ )
+                        {
+                            temp[j] += wgt * pix[j];
+                        }
+                    }
+                }
+
+                float* out = &originF32( dst[k] )[ row * dst[k].stride + jlo * scale + pc ];
+
+                for ( unsigned j=0; j<jsz; j++ )
+                {
+                    float result = temp[j] + bias[k];
+
+                    /* Threshold */
+                    out[ j * scale ] = ( result >= 0 ) ? result : 0;
+                }
+            }
+        }
+
+        delete[] temp;
+    } );
+
+    /* Edges: resized pixels just for each window */
+    unsigned f1   = comp.layer->ksz;
+    int      half = f1 / 2;
+
+    parallelFor( height, [&]( unsigned row )
+    {
+        float patch[MODEL_MAX_KERNEL][MODEL_MAX_KERNEL];
+
+        for ( unsigned col=0; col<width; col++ )
+        {
+            if ( ( comp.rows.inside[row] == true ) && ( comp.cols.inside[col] == true ) )
+                continue;
+
+            for ( unsigned a=0; a<f1; a++ )
+            {
+                int v = MIN( MAX( (int)row + (int)a - half, 0 ), (int)height - 1 );
+
+                for ( unsigned b=0; b<f1; b++ )
+                {
+                    int u = MIN( MAX( (int)col + (int)b - half, 0 ), (int)width - 1 );
+
+                    patch[a][b] = resizedPixel( src, comp, v, u );
+                }
+            }
+
+            for ( unsigned cnt=0; cnt<actfsz; cnt++ )
+            {
+                unsigned     k    = actf[cnt];
+                const float* kern = &comp.layer->weights[ k * f1 * f1 ];
+                float        temp = 0.f;
+
+                for ( unsigned a=0; a<f1; a++ )
+                {
+                    for ( unsigned b=0; b<f1; b++ )
+                    {
+                        temp += kern[ a * f1 + b ] * patch[a][b];
+                    }
+                }
+
+                temp += bias[k];
+
+                /* Threshold */
+                originF32( dst[k] )[ row * dst[k].stride + col ] = ( temp >= 0 ) ? temp : 0;
+            }
+        }
+    } );
+}
+
+// kernel sizes of compiled in networks ( 9-1-5, 9-3-5, 9-5-5, ESPCN 5-3-3 ).
+#define CONV_KERNELS( _k_ ) { _k_, convolution99<_k_>, convolutionNN<_k_>, \
+                              convolutionPS<_k_>, convolution55<_k_>, \
+                              Convolution99x11<_k_>, convolution99c<_k_>, \
+                              convolution55c<_k_> }
+
+static const ConvKernels conv_kernels[] = \
+{
+    CONV_KERNELS( 0 ),
+    CONV_KERNELS( 3 ),
+    CONV_KERNELS( 5 ),
+    CONV_KERNELS( 9 )
+};
+
+#define CONV_KERNELS_COUNT  ( sizeof( conv_kernels ) / sizeof( ConvKernels ) )
+
+const ConvKernels* selectConvKernels( unsigned ksz )
+{
+    for ( unsigned cnt=1; cnt<CONV_KERNELS_COUNT; cnt++ )
+    {
+        if ( conv_kernels[cnt].ksz == ksz )
+            return &conv_kernels[cnt];
+    }
+
+    // any other size goes by runtime loop bounds.
+    return &conv_kernels[0];
+}
+
+// rows of a band, planes x bands are tiles enough for every thread.
+unsigned convBandRows( unsigned height, unsigned width, unsigned planes )
+{
+    unsigned threads = parallelThreads();
+
+    if ( ( threads <= 1 ) || ( planes == 0 ) || ( width == 0 ) )
+        return MAX( height, 1U );
+
+    unsigned tiles = threads * CONV_TILES_PER_THREAD;
+    unsigned bands = ( tiles + planes - 1 ) / planes;
+    unsigned rows  = ( height + bands - 1 ) / bands;
+
+    // small tiles cost more to schedule than to convolute.
+    rows = MAX( rows, ( CONV_TILE_PIXELS + width - 1 ) / width );
+
+    return MAX( MIN( rows, height ), 1U );
+}
+
+void allocConvPlanes( ImgF32* planes, const unsigned* list, unsigned listsz,
+                      unsigned w, unsigned h, unsigned halo )
+{
+    for ( unsigned cnt=0; cnt<listsz; cnt++ )
+    {
+        ImgF32 &plane = planes[ list[cnt] ];
+
+        if ( plane.buff == NULL )
+        {
+            initImgF32Halo( plane, w, h, halo );
+        }
+    }
+}
+
+void fillConvPlanesHalo( ImgF32* planes, const unsigned* list, unsigned listsz )
+{
+    parallelFor( listsz, [&]( unsigned cnt )
+    {
+        fillImgF32Halo( planes[ list[cnt] ] );
+    } );
+}
+
+void fillConvPlanesRects( ImgF32* planes, const unsigned* list, unsigned listsz,
+                          ConvOptions &opts )
+{
+    if ( opts.rects == NULL )
+        return;
+
+    const ConvRect* rects  = opts.rects;
+    unsigned        gutter = opts.gutter;
+
+    /* Each image of atlas sees its own edges, as a plane of its size */
+    parallelFor( listsz, [&, rects]( unsigned cnt )
+    {
+        ImgF32 &plane = planes[ list[cnt] ];
+
+        for ( unsigned r=0; r<opts.rectsz; r++ )
+        {
+            ImgF32 part = plane;
+            part.width  = rects[r].w;
+            part.height = rects[r].h;
+            part.halo   = gutter;
+            part.buff   = &originF32( plane )[ ( rects[r].y - gutter ) * plane.stride
+                                               + rects[r].x - gutter ];
+
+            fillImgF32Halo( part );
+        }
+    } );
+}
+
+bool runConvLayers( const ConvLayer* layers, unsigned count,
+                    ImgF32 &src, ImgF32 &dst, ConvOptions &opts )
+{
+    if ( ( layers == NULL ) || ( count < 2 ) || ( count > CONV_MAX_LAYERS )
+         || ( layers[0].cin != 1 ) )
+        return false;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        if ( ( layers[cnt].cout > MODEL_MAX_FILTERS )
+             || ( ( cnt > 0 ) && ( layers[cnt].cin != layers[cnt-1].cout ) ) )
+            return false;
+    }
+
+    if ( jobCancelled( opts.job ) == true )
+        return false;
+
+    // short of memory, a band of rows at a time.
+    if ( ( opts.bandrows > 0 ) && ( opts.bandrows < dst.height )
+         && ( opts.frames <= 1 ) && ( opts.rects == NULL )
+         && ( opts.comp == NULL ) && ( layers[ count - 1 ].act != CONV_Shuffle )
+         && ( src.width == dst.width ) && ( src.height == dst.height ) )
+    {
+        return runConvLayersBands( layers, count, src, dst, opts );
+    }
+
+    if ( interleavedLayers( layers, count, opts ) == true )
+    {
+        return runConvLayersInterleaved( layers, count, src, dst, opts );
+    }
+
+    // stacked frames go channels last only.
+    if ( opts.frames > 1 )
+    {
+        return false;
+    }
+
+    const ConvLayer &lastl = layers[ count - 1 ];
+
+    // sub-pixel network has activations at source size.
+    unsigned aw = dst.width;
+    unsigned ah = dst.height;
+
+    if ( lastl.act == CONV_Shuffle )
+    {
+        aw = src.width;
+        ah = src.height;
+    }
+
+    unsigned allf[MODEL_MAX_FILTERS] = {0};
+
+    for ( unsigned cnt=0; cnt<MODEL_MAX_FILTERS; cnt++ )
+    {
+        allf[cnt] = cnt;
+    }
+
+    /* --
+     * Plan of buffers: output of layer N goes to slot ( N % 2 ),
+     * a slot is kept for next writer or released after its last reader,
+     * so two activation tensors are alive at most.
+     */
+    unsigned capacity[2] = {0,0};
+
+    for ( unsigned cnt=0; cnt+1<count; cnt++ )
+    {
+        capacity[ cnt % 2 ] = MAX( capacity[ cnt % 2 ], layers[cnt].cout );
+    }
+
+    // halo of a slot is widest of its readers, no padding while reading.
+    unsigned halos[2] = {0,0};
+
+    for ( unsigned cnt=0; cnt+1<count; cnt++ )
+    {
+        halos[ cnt % 2 ] = MAX( halos[ cnt % 2 ], layers[ cnt + 1 ].ksz / 2 );
+    }
+
+    ImgF32* slots[2] = {NULL,NULL};
+
+    for ( unsigned cnt=0; cnt<2; cnt++ )
+    {
+        if ( capacity[cnt] > 0 )
+        {
+            slots[cnt] = new ImgF32[ capacity[cnt] ];
+            memset( slots[cnt], 0, capacity[cnt] * sizeof( ImgF32 ) );
+        }
+    }
+
+    // first layer reads Y with its halo, unless composite reads source.
+    ImgF32 srcpad;
+    memset( &srcpad, 0, sizeof( ImgF32 ) );
+
+    if ( opts.comp == NULL )
+    {
+        copyImgF32Halo( srcpad, src, layers[0].ksz / 2 );
+    }
+
+    // active channels of input of current layer.
+    const unsigned* actin   = allf;
+    unsigned        actinsz = 0;
+    bool            retval  = true;
+
+    for ( unsigned cnt=0; ( cnt<count ) && ( retval == true ); cnt++ )
+    {
+        // cancelled call drops its activations now.
+        if ( jobCancelled( opts.job ) == true )
+        {
+            retval = false;
+            break;
+        }
+
+        jobProgress( opts.job, cnt * 1000 / count );
+
+        const ConvLayer   &layer   = layers[cnt];
+        const ConvKernels* kernels = selectConvKernels( layer.ksz );
+        bool    last = ( cnt + 1 == count );
+        ImgF32* in   = ( cnt > 0 ) ? slots[ ( cnt - 1 ) % 2 ] : NULL;
+        ImgF32* out  = last ? NULL : slots[ cnt % 2 ];
+
+        // pruned filters of first layer never be calculated.
+        const unsigned* actout   = allf;
+        unsigned        actoutsz = layer.cout;
+
+        if ( ( cnt == 0 ) && ( opts.actf != NULL ) )
+        {
+            actout   = opts.actf;
+            actoutsz = opts.actfsz;
+        }
+
+        if ( cnt == 0 )
+        {
+            const ConvLayer &next = layers[1];
+
+            if ( ( opts.fused == true ) && ( opts.comp == NULL )
+                 && ( next.ksz == 1 ) && ( count > 2 ) )
+            {
+                /* Layer I + II at once, saves memory of layer I */
+                out = slots[1];
+                allocConvPlanes( out, allf, next.cout, aw, ah, halos[1] );
+
+                kernels->conv99x11( srcpad, out, &layer, &next,
+                                    actout, actoutsz, opts.sparse );
+
+                resetImgF32( srcpad );
+                fillConvPlanesHalo( out, allf, next.cout );
+                fillConvPlanesRects( out, allf, next.cout, opts );
+
+                actin   = allf;
+                actinsz = next.cout;
+                cnt++;
+                continue;
+            }
+
+            allocConvPlanes( out, actout, actoutsz, aw, ah, halos[0] );
+
+            if ( opts.comp != NULL )
+            {
+                convolutionLR99( src, out, *opts.comp, actout, actoutsz );
+            }
+            else
+            {
+                /* Tiles of filter and band, more than filters for threads */
+                unsigned bandh  = convBandRows( ah, aw, actoutsz );
+                unsigned bands  = ( ah + bandh - 1 ) / bandh;
+                bool     placed = parallelPlaced();
+
+                // placed tiles go band by band, rows stay with a node.
+                auto tile = [&]( unsigned t )
+                {
+                    unsigned fc   = actout[ placed ? t % actoutsz : t / bands ];
+                    unsigned row0 = ( placed ? t / actoutsz : t % bands ) * bandh;
+
+                    kernels->conv99( srcpad,
+                                     out[fc],
+                                     &layer.weights[ fc * layer.ksz * layer.ksz ],
+                                     layer.ksz,
+                                     layer.biases[fc],
+                                     row0, MIN( row0 + bandh, ah ) );
+                };
+
+                if ( placed == true )
+                {
+                    parallelFor( actoutsz * bands, tile );
+                }
+                else
+                {
+                    parallelForDynamic( actoutsz * bands, tile );
+                }
+
+                resetImgF32( srcpad );
+            }
+
+            fillConvPlanesHalo( out, actout, actoutsz );
+            fillConvPlanesRects( out, actout, actoutsz, opts );
+        }
+        else
+        if ( last == true )
+        {
+            if ( ( layer.act == CONV_Clamp ) && ( layer.cout == 1 ) )
+            {
+                kernels->conv55( in, dst, layer.weights, layer.ksz,
+                                 *layer.biases, actin, actinsz );
+            }
+            else
+            if ( layer.act == CONV_Shuffle )
+            {
+                unsigned scale = dst.width / src.width;
+
+                if ( ( scale * scale == layer.cout )
+                     && ( dst.height == src.height * scale ) )
+                {
+                    kernels->convPS( in, dst, layer.weights, layer.biases,
+                                     layer.cin, layer.ksz, scale,
+                                     actin, actinsz );
+                }
+                else
+                {
+                    retval = false;
+                }
+            }
+            else
+            {
+                retval = false;
+            }
+        }
+        else
+        if ( layer.act != CONV_ReLU )
+        {
+            retval = false;
+        }
+        else
+        {
+            allocConvPlanes( out, actout, actoutsz, aw, ah, halos[ cnt % 2 ] );
+
+            if ( layer.ksz > 1 )
+            {
+                kernels->convNN( in, out, layer.weights, layer.biases,
+                                 layer.cin, layer.cout, layer.ksz,
+                                 actin, actinsz );
+            }
+            else
+            if ( opts.sparse != NULL )
+            {
+                convolution11s( in, out, layer.weights, layer.biases,
+                                layer.cin, layer.cout,
+                                actin, actinsz,
+                                *opts.sparse );
+            }
+            else
+            {
+                unsigned bandh  = convBandRows( ah, aw, layer.cout );
+                unsigned bands  = ( ah + bandh - 1 ) / bandh;
+                bool     placed = parallelPlaced();
+
+                auto tile = [&]( unsigned t )
+                {
+                    unsigned k    = placed ? t % layer.cout : t / bands;
+                    unsigned row0 = ( placed ? t / layer.cout : t % bands ) * bandh;
+
+                    convolution11( in,
+                                   out[k],
+                                   &layer.weights[ k * layer.cin ],
+                                   layer.biases[k],
+                                   actin, actinsz,
+                                   row0, MIN( row0 + bandh, ah ) );
+                };
+
+                if ( placed == true )
+                {
+                    parallelFor( layer.cout * bands, tile );
+                }
+                else
+                {
+                    parallelForDynamic( layer.cout * bands, tile );
+                }
+            }
+
+            fillConvPlanesHalo( out, actout, actoutsz );
+            fillConvPlanesRects( out, actout, actoutsz, opts );
+        }
+
+#ifdef DEBUG
+        if ( out != NULL )
+        {
+            for ( unsigned n=0; n<actoutsz; n++ )
+            {
+                char strtmp[80] = {0};
+                snprintf( strtmp, 80, "conv%u_%u.png", cnt + 1, actout[n] );
+                saveImgF32( &out[ actout[n] ], strtmp );
+            }
+        }
+#endif
+
+        // input never be read again, unless next layer writes there.
+        if ( ( in != NULL ) && ( cnt + 2 >= count ) )
+        {
+            discardConvLayers( in, capacity[ ( cnt - 1 ) % 2 ] );
+        }
+
+        actin   = actout;
+        actinsz = actoutsz;
+    }
+
+    for ( unsigned cnt=0; cnt<2; cnt++ )
+    {
+        if ( slots[cnt] != NULL )
+        {
+            discardConvLayers( slots[cnt], capacity[cnt] );
+            delete[] slots[cnt];
+        }
+    }
+
+    resetImgF32( srcpad );
+
+    // loops of last layer may stop half way.
+    if ( jobCancelled( opts.job ) == true )
+        return false;
+
+    return retval;
+}
+
+/* --
+ * Each band reads rows of halo of all layers above and below, so its
+ * own rows come out same as whole image, only activations of a band
+ * are alive at once.
+ */
+bool runConvLayersBands( const ConvLayer* layers, unsigned count,
+                         ImgF32 &src, ImgF32 &dst, ConvOptions &opts )
+{
+    unsigned margin = 0;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        margin += layers[cnt].ksz / 2;
+    }
+
+    ConvOptions bopts = opts;
+    bopts.bandrows = 0;
+
+    unsigned bands = ( dst.height + opts.bandrows - 1 ) / opts.bandrows;
+
+    for ( unsigned band=0; band<bands; band++ )
+    {
+        unsigned row0 = band * opts.bandrows;
+        unsigned row1 = MIN( row0 + opts.bandrows, dst.height );
+        unsigned in0  = ( row0 > margin ) ? row0 - margin : 0;
+        unsigned in1  = MIN( row1 + margin, src.height );
+
+        // rows of source seen in place.
+        ImgF32 bsrc = src;
+        bsrc.buff   = &src.buff[ in0 * src.stride ];
+        bsrc.height = in1 - in0;
+
+        ImgF32 bdst;
+        initImgF32( bdst, dst.width, in1 - in0 );
+
+        unsigned outer[2] = {0,0};
+
+        jobEnter( opts.job, band * 1000 / bands, ( band + 1 ) * 1000 / bands,
+                  outer );
+
+        bool convok = runConvLayers( layers, count, bsrc, bdst, bopts );
+
+        jobLeave( opts.job, outer );
+
+        if ( convok == false )
+        {
+            resetImgF32( bdst );
+            return false;
+        }
+
+        float* dorg = originF32( dst );
+
+        for ( unsigned row=row0; row<row1; row++ )
+        {
+            memcpy( &dorg[ row * dst.stride ], &bdst.buff[ ( row - in0 ) * bdst.stride ],
+                    dst.width * sizeof( float ) );
+        }
+
+        resetImgF32( bdst );
+    }
+
+    return true;
+}
+
+// bytes of a plane with halo for kernel size of its reader.
+inline unsigned long long planeBytes( unsigned w, unsigned h, unsigned ksz )
+{
+    unsigned halo = ksz / 2;
+
+    return (unsigned long long)( w + halo * 2 ) * ( h + halo * 2 ) * sizeof( float );
+}
+
+unsigned long long convLayersFootprint( const ConvLayer* layers,
+                                        unsigned w, unsigned h, unsigned actfsz,
+                                        bool fused )
+{
+    unsigned long long srcsz = planeBytes( w, h, layers[0].ksz );
+
+    // layer I and II alive together, or layer II only.
+    unsigned long long actsz = layers[1].cout * planeBytes( w, h, layers[2].ksz );
+
+    if ( fused == false )
+    {
+        actsz += actfsz * planeBytes( w, h, layers[1].ksz );
+    }
+
+    return srcsz + actsz;
+}
+
+bool fusedConvLayers( const ConvLayer* layers, unsigned count,
+                      unsigned w, unsigned h, unsigned actfsz )
+{
+    if ( ( count < 3 ) || ( layers[1].ksz != 1 ) )
+        return false;
+
+    if ( layers_type != SRCNNL_Auto )
+        return ( layers_type == SRCNNL_Fused );
+
+    unsigned long long sepsz = convLayersFootprint( layers, w, h, actfsz, false );
+
+    // small image never be short of memory, no need to ask.
+    if ( sepsz <= CONV_SMALL_FOOTPRINT )
+        return false;
+
+    unsigned long long avail = availableMemorySize();
+
+    if ( avail == 0 )
+        return false;
+
+    /* --
+     * Fused layer runs in a thread, it loses more for more threads,
+     * so separated layers may take more of available memory then.
+     */
+    unsigned threads = parallelThreads();
+
+    unsigned long long budget = ( threads > 1 ) ? avail / 4 * 3 : avail / 2;
+
+    return ( sepsz > budget );
+}
+
+// bytes of activations alive for a pixel, two tensors of adjacent layers
+// ( only layer II while fused ), padded source and output of layers.
+unsigned long long layersPixelBytes( const ConvLayer* layers, unsigned count,
+                                     bool fused )
+{
+    unsigned peak = 0;
+
+    for ( unsigned cnt=0; cnt+1<count; cnt++ )
+    {
+        unsigned alive = layers[cnt].cout + layers[ cnt + 1 ].cout;
+
+        if ( ( cnt == 0 ) && ( fused == true ) )
+            alive = layers[1].cout;
+
+        peak = MAX( peak, alive );
+    }
+
+    return (unsigned long long)( peak + 2 ) * sizeof( float );
+}
+
+MemoryNeed memoryNeedSRCNN( const ConvLayer* layers, unsigned count, bool fused,
+                            unsigned w, unsigned h, unsigned d,
+                            unsigned rs_w, unsigned rs_h )
+{
+    MemoryNeed need;
+
+    unsigned long long srcsz = (unsigned long long)w * h;
+    unsigned long long rssz  = (unsigned long long)rs_w * rs_h;
+
+    need.margin = 0;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        need.margin += layers[cnt].ksz / 2;
+    }
+
+    // Y-Cb-Cr of source, resized channels and Y of layers, RGB and gray.
+    need.fixed  = ( srcsz * d + rssz * ( d + 1 ) ) * sizeof( float )
+                  + rssz * ( d + 1 );
+    need.perrow = layersPixelBytes( layers, count, fused )
+                  * ( rs_w + need.margin * 2 );
+    need.rows   = rs_h;
+    need.bands  = true;
+
+    return need;
+}
+
+// limit of working sets, auto one sampled while nothing is admitted,
+// so running calls are never counted twice. mem_lock held.
+unsigned long long memoryCeiling()
+{
+    if ( mem_ceiling > 0 )
+        return mem_ceiling;
+
+    if ( ( mem_holders == 0 ) || ( mem_auto == 0 ) )
+    {
+        unsigned long long avail = availableMemorySize();
+
+        mem_auto = ( avail > 0 ) ? avail / 4 * 3 : ~0ULL;
+    }
+
+    return mem_auto;
+}
+
+// memory left under ceiling by admitted calls. mem_lock held.
+unsigned long long memoryHeadroom()
+{
+    unsigned long long ceiling = memoryCeiling();
+
+    return ( ceiling > mem_reserved ) ? ceiling - mem_reserved : 0;
+}
+
+// working set of a call admitted under memory ceiling, first come
+// first served. a call waits while others hold memory, or runs its
+// layers by bands of rows when a band fits.
+class MemoryScope
+{
+    public:
+        MemoryScope( const MemoryNeed &need );
+        ~MemoryScope();
+
+    public:
+        int      result()   { return status; }
+        unsigned bandrows() { return bands; }
+
+    private:
+        int                 status;
+        unsigned            bands;
+        unsigned long long  reserved;
+};
+
+MemoryScope::MemoryScope( const MemoryNeed &need )
+ : status( 0 ),
+   bands( 0 ),
+   reserved( 0 )
+{
+    unsigned long long whole = need.fixed + need.perrow * need.rows;
+
+    std::unique_lock<std::mutex> guard( mem_lock );
+
+    unsigned long long ticket = mem_tickets++;
+
+    mem_queue.push_back( ticket );
+
+    while( true )
+    {
+        unsigned long long left = memoryHeadroom();
+
+        if ( mem_queue.front() == ticket )
+        {
+            if ( whole <= left )
+            {
+                reserved = whole;
+                break;
+            }
+
+            // band reads rows of halo above and below.
+            if ( ( need.bands == true ) && ( need.perrow > 0 )
+                 && ( left > need.fixed ) )
+            {
+                unsigned long long fit = ( left - need.fixed ) / need.perrow;
+
+                if ( fit >= need.margin * 2 + MEMORY_BAND_ROWS )
+                {
+                    bands    = (unsigned)( fit - need.margin * 2 );
+                    reserved = need.fixed + need.perrow * ( bands + need.margin * 2 );
+                    break;
+                }
+            }
+
+            // never fits, even alone.
+            if ( mem_holders == 0 )
+            {
+                status = -5;
+                break;
+            }
+        }
+
+        if ( jobCancelled( job_current ) == true )
+        {
+            status = -4;
+            break;
+        }
+
+        mem_cond.wait_for( guard, std::chrono::milliseconds( MEMORY_WAIT_MS ) );
+    }
+
+    mem_queue.erase( std::find( mem_queue.begin(), mem_queue.end(), ticket ) );
+
+    unsigned long long headroom = ~0ULL;
+
+    if ( status == 0 )
+    {
+        mem_reserved += reserved;
+        mem_holders++;
+
+        headroom = memoryHeadroom();
+    }
+
+    // next one may go now.
+    mem_cond.notify_all();
+
+    guard.unlock();
+
+    // freed mappings kept are memory beside working sets.
+    if ( status == 0 )
+    {
+        hugePagesLimit( headroom );
+    }
+}
+
+MemoryScope::~MemoryScope()
+{
+    if ( status != 0 )
+        return;
+
+    unsigned long long headroom = 0;
+
+    {
+        std::lock_guard<std::mutex> guard( mem_lock );
+
+        mem_reserved -= reserved;
+        mem_holders--;
+
+        headroom = memoryHeadroom();
+    }
+
+    mem_cond.notify_all();
+
+    hugePagesLimit( headroom );
+}
+
+unsigned modelConvLayers( const libsrcnn::SRCNNModel* model, libsrcnn::ConvLayer* layers )
+{
+    ConvLayer layer1 = { model->f1, 1, model->n1, CONV_ReLU,
+                         model->weights1, model->biases1, model->packed1 };
+    ConvLayer layer2 = { model->f2, model->n1, model->n2, CONV_ReLU,
+                         model->weights2, model->biases2, model->packed2 };
+    ConvLayer layer3 = { model->f3, model->n2, 1, CONV_Clamp,
+                         model->weights3, model->biases3, model->packed3 };
+
+    layers[0] = layer1;
+    layers[1] = layer2;
+    layers[2] = layer3;
+
+    return 3;
+}
+
+// stages of doSRCNN, tasks of a graph.
+typedef struct
+{
+    libsrcnn::ImgYCbCr*     src;
+    libsrcnn::ImgF32*       resized;
+    unsigned                d;
+    unsigned                rs_w;
+    unsigned                rs_h;
+    unsigned                lrscale;
+    libsrcnn::ConvLayer*    layers;
+    unsigned                layerssz;
+    libsrcnn::ConvOptions*  opts;
+    libsrcnn::ImgF32*       lr;
+    libsrcnn::ImgF32*       conv;
+    bool                    convok;
+}SRCNNStages;
+
+void stageResizeY( void* param )
+{
+    SRCNNStages* st = (SRCNNStages*)param;
+
+    // composite layer I never reads resized Y.
+    resizeImgChannel( *st->src, 0, st->rs_w, st->rs_h, st->resized,
+                      st->lrscale == 0 );
+
+    jobProgress( st->opts->job, 100 );
+}
+
+void stageResizeChroma( void* param )
+{
+    SRCNNStages* st = (SRCNNStages*)param;
+
+    for ( unsigned cnt=1; cnt<st->d; cnt++ )
+    {
+        // no composition after cancel.
+        if ( jobCancelled( st->opts->job ) == true )
+            break;
+
+        resizeImgChannel( *st->src, cnt, st->rs_w, st->rs_h, st->resized,
+                          true );
+    }
+}
+
+void stageLuma( void* param )
+{
+    SRCNNStages* st = (SRCNNStages*)param;
+
+    libsrcnn::CompositeConv1 comp;
+
+    if ( st->lrscale > 0 )
+    {
+        FRAWGenericFilter* rszfilter = createResizeFilter( true );
+
+        libsrcnn::initCompositeConv1( comp, &st->layers[0], rszfilter,
+                                      st->lr->width, st->lr->height,
+                                      st->lrscale,
+                                      st->opts->actf, st->opts->actfsz );
+        delete rszfilter;
+
+        st->opts->comp = &comp;
+    }
+
+    libsrcnn::initImgF32( *st->conv, st->rs_w, st->rs_h );
+
+    unsigned outer[2] = {0,0};
+
+    jobEnter( st->opts->job, 100, 950, outer );
+
+    st->convok = libsrcnn::runConvLayers( st->layers, st->layerssz,
+                                          ( st->lrscale > 0 ) ?
+                                          *st->lr : st->resized[0],
+                                          *st->conv, *st->opts );
+
+    jobLeave( st->opts->job, outer );
+
+    if ( st->lrscale > 0 )
+    {
+        libsrcnn::discardCompositeConv1( comp );
+        st->opts->comp = NULL;
+    }
+
+    libsrcnn::resetImgF32( *st->lr );
+}
+
+int doSRCNN( const unsigned char* refbuff,
+             unsigned w, unsigned h, unsigned d,
+             float muliply,
+             const libsrcnn::SRCNNModel* model,
+             unsigned char* &outbuff,
+             unsigned &outbuffsz,
+             unsigned char** convbuff,
+             unsigned* convbuffsz )
+{
+    // Pruned filters of first layer never be calculated.
+    unsigned actf[MODEL_MAX_FILTERS] = {0};
+    unsigned actfsz = buildActiveFilters( actf, model->n1 );
+
+    libsrcnn::ConvLayer layers[CONV_MAX_LAYERS];
+    unsigned layerssz = modelConvLayers( model, layers );
+
+    unsigned rs_w = w * muliply;
+    unsigned rs_h = h * muliply;
+
+    /* PERFORMANCE ISSUE !!
+       Convolution99x11 saves memory than separated 99 and 11 convolution,
+       But no way to apply OpenMP MPI for now, so it goes only when needed.
+    */
+    bool fused = libsrcnn::fusedConvLayers( layers, layerssz, rs_w, rs_h, actfsz );
+
+    // Waits for memory of other calls, or takes a band of rows.
+    libsrcnn::MemoryScope memory( libsrcnn::memoryNeedSRCNN( layers, layerssz, fused,
+                                                             w, h, d, rs_w, rs_h ) );
+
+    if ( memory.result() != 0 )
+        return memory.result();
+
+    // -------------------------------------------------------------
+    // Convert RGB to Y-Cb-Cr
+    //
+    // warning: imgSrc is referenced, don't remove from memory !
+    libsrcnn::ImgU8     imgSrc = { w ,h ,d, (unsigned char*)refbuff };
+    libsrcnn::ImgYCbCr  imgYCbCr;
+
+    converImgU8toYCbCr( imgSrc, imgYCbCr );
+
+#ifdef DEBUG_COLORSAPCE
+    saveImgYCbCr( &imgYCbCr, "debugimg" );
+#endif
+
+    /* --
+     * Resize the Y Channel with Bicubic Interpolation,
+     * Other layers just doing linear interpolation.
+     */
+
+    libsrcnn::ImgF32 imgResized[4];
+    memset( imgResized, 0, 4 * sizeof( libsrcnn::ImgF32 ) );
+
+    // Layer I may take Y straight for integer multiply, not by bands.
+    unsigned lrscale = 0;
+    float    mround  = floorf( muliply + 0.5f );
+
+    if ( ( conv1_composite == true ) && ( memory.bandrows() == 0 )
+         && ( fabsf( muliply - mround ) < 1e-4f )
+         && ( mround >= 2.f ) && ( mround <= (float)COMPOSITE_MAX_SCALE )
+         && ( rs_w == imgYCbCr.Y.width  * (unsigned)mround )
+         && ( rs_h == imgYCbCr.Y.height * (unsigned)mround ) )
+    {
+        lrscale = (unsigned)mround;
+    }
+
+    // Source Y remained for composite layer I.
+    libsrcnn::ImgF32 imgLR = { 0, 0, 0, NULL, 0, 0 };
+
+    if ( lrscale > 0 )
+    {
+        imgLR = imgYCbCr.Y;
+        imgYCbCr.Y.buff = NULL;
+    }
+
+    libsrcnn::ConvOptions opts;
+    memset( &opts, 0, sizeof( libsrcnn::ConvOptions ) );
+
+    opts.actf   = actf;
+    opts.actfsz = actfsz;
+    opts.sparse = conv2_sparse ? &conv2_sparsity : NULL;
+    opts.interleaved = conv_interleave;
+    opts.sgemm  = libsrcnn::systemSgemm();
+    opts.jit    = libsrcnn::jitAvailable();
+    opts.job    = job_current;
+    opts.fused  = ( lrscale == 0 ) && fused;
+    opts.bandrows = memory.bandrows();
+
+    libsrcnn::ImgF32 imgConv3 = { 0, 0, 0, NULL, 0, 0 };
+
+    // Chroma resized by side lane while luma network runs.
+    SRCNNStages stages;
+    stages.src      = &imgYCbCr;
+    stages.resized  = imgResized;
+    stages.d        = d;
+    stages.rs_w     = rs_w;
+    stages.rs_h     = rs_h;
+    stages.lrscale  = lrscale;
+    stages.layers   = layers;
+    stages.layerssz = layerssz;
+    stages.opts     = &opts;
+    stages.lr       = &imgLR;
+    stages.conv     = &imgConv3;
+    stages.convok   = false;
+
+    libsrcnn::TaskGraph graph;
+
+    unsigned taskY = graph.add( stageResizeY, &stages, libsrcnn::TASK_Main );
+
+    if ( d > 1 )
+    {
+        graph.add( stageResizeChroma, &stages, libsrcnn::TASK_Side );
+    }
+
+    graph.add( stageLuma, &stages, libsrcnn::TASK_Main, &taskY, 1 );
+    graph.run();
+
+    // Release splitted image of Y-Cb-Cr --
+    discardImgYCbCr( imgYCbCr );
+
+#ifdef DEBUG
+    if ( lrscale == 0 )
+    {
+        printf("rY:");
+        saveImgF32( &imgResized[0], "resized_Y.png" );
+    }
+    printf("rCb:");
+    saveImgF32( &imgResized[1], "resized_Cb.png" );
+    printf("rCr:");
+    saveImgF32( &imgResized[2], "resized_Cr.png" );
+    if ( d == 4 )
+    {
+        printf("rA:");
+        saveImgF32( &imgResized[3], "resized_A.png" );
+    }
+#endif
+
+    if ( stages.convok == false )
+    {
+        libsrcnn::resetImgF32( imgConv3 );
+        discardConvLayers( imgResized, d );
+        return jobCancelled( opts.job ) ? -4 : -100;
+    }
 
 #ifdef DEBUG
-    for ( unsigned cnt=0; cnt<CONV2_FILTERS; cnt++ )
+    saveImgF32( &imgConv3, "conv3.png" );
+#endif
+
+    return composeImgU8( imgResized, d, imgConv3,
+                         outbuff, outbuffsz,
+                         convbuff, convbuffsz );
+}
+
+// images of batch one after another.
+int doSRCNNEach( const unsigned char** refbuffs, unsigned count,
+                 unsigned w, unsigned h, unsigned d,
+                 float muliply,
+                 const libsrcnn::SRCNNModel* model,
+                 unsigned char** outbuffs,
+                 unsigned* outbuffszs )
+{
+    int retval = -100;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        retval = doSRCNN( refbuffs[cnt], w, h, d, muliply, model,
+                          outbuffs[cnt], outbuffszs[cnt], NULL, NULL );
+
+        if ( retval != 0 )
+            break;
+    }
+
+    return retval;
+}
+
+int doSRCNNBatch( const unsigned char** refbuffs, unsigned count,
+                  unsigned w, unsigned h, unsigned d,
+                  float muliply,
+                  const libsrcnn::SRCNNModel* model,
+                  unsigned char** outbuffs,
+                  unsigned* outbuffszs )
+{
+    unsigned actf[MODEL_MAX_FILTERS] = {0};
+    unsigned actfsz = buildActiveFilters( actf, model->n1 );
+
+    unsigned rs_w = w * muliply;
+    unsigned rs_h = h * muliply;
+
+    libsrcnn::ConvLayer layers[CONV_MAX_LAYERS];
+    unsigned layerssz = modelConvLayers( model, layers );
+
+    libsrcnn::ConvOptions opts;
+    memset( &opts, 0, sizeof( libsrcnn::ConvOptions ) );
+
+    opts.actf   = actf;
+    opts.actfsz = actfsz;
+    opts.sparse = conv2_sparse ? &conv2_sparsity : NULL;
+    opts.interleaved = conv_interleave;
+    opts.sgemm  = libsrcnn::systemSgemm();
+    opts.jit    = libsrcnn::jitAvailable();
+
+    /* --
+     * Frames of a pass give rows to every thread, but activations
+     * should stay in cache, so a batch goes by groups just enough.
+     */
+    unsigned threads = parallelThreads();
+
+    unsigned group = ( threads * CONV_BATCH_ROWS + rs_h - 1 ) / rs_h;
+
+    group = MIN( group, CONV_BATCH_PIXELS / ( rs_w * rs_h ) );
+    group = MAX( 1U, MIN( count, group ) );
+
+    opts.fused  = libsrcnn::fusedConvLayers( layers, layerssz,
+                                             rs_w, rs_h * group, actfsz );
+
+    /* --
+     * Frames stacked in rows need channels last layers,
+     * others ( and composite layer I ) go image by image.
+     */
+    if ( ( conv1_composite == true )
+         || ( libsrcnn::interleavedLayers( layers, layerssz, opts ) == false ) )
+    {
+        return doSRCNNEach( refbuffs, count, w, h, d, muliply, model,
+                            outbuffs, outbuffszs );
+    }
+
+    // A group of frames admitted as one image, never by bands.
+    libsrcnn::MemoryNeed need = libsrcnn::memoryNeedSRCNN( layers, layerssz, opts.fused,
+                                                           w, h * group, d,
+                                                           rs_w, rs_h * group );
+    need.bands = false;
+
+    libsrcnn::MemoryScope memory( need );
+
+    // too large for stacked frames, each image may go by bands.
+    if ( memory.result() == -5 )
+    {
+        return doSRCNNEach( refbuffs, count, w, h, d, muliply, model,
+                            outbuffs, outbuffszs );
+    }
+
+    if ( memory.result() != 0 )
+        return memory.result();
+
+    int retval = 0;
+
+    // Y of frames stacked, Cb, Cr ( and A ) kept for each.
+    libsrcnn::ImgF32* imgResized = new libsrcnn::ImgF32[ group * 4 ];
+
+    for ( unsigned first=0; ( first<count ) && ( retval == 0 ); first+=group )
+    {
+        unsigned frames = MIN( group, count - first );
+
+        libsrcnn::ImgF32 imgStack;
+        libsrcnn::initImgF32( imgStack, rs_w, rs_h * frames );
+
+        for ( unsigned cnt=0; cnt<frames; cnt++ )
+        {
+            libsrcnn::ImgU8     imgSrc = { w, h, d, (unsigned char*)refbuffs[ first + cnt ] };
+            libsrcnn::ImgYCbCr  imgYCbCr;
+
+            converImgU8toYCbCr( imgSrc, imgYCbCr );
+            resizeImgYCbCr( imgYCbCr, d, rs_w, rs_h, &imgResized[ cnt * 4 ], true );
+            discardImgYCbCr( imgYCbCr );
+
+            memcpy( &imgStack.buff[ cnt * rs_w * rs_h ], imgResized[ cnt * 4 ].buff,
+                    rs_w * rs_h * sizeof( float ) );
+        }
+
+        libsrcnn::ImgF32 imgConv3;
+        libsrcnn::initImgF32( imgConv3, rs_w, rs_h * frames );
+
+        opts.frames = frames;
+
+        bool convok = libsrcnn::runConvLayers( layers, layerssz,
+                                               imgStack, imgConv3, opts );
+
+        libsrcnn::resetImgF32( imgStack );
+
+        retval = ( convok == true ) ? 0 : -100;
+
+        for ( unsigned cnt=0; cnt<frames; cnt++ )
+        {
+            if ( retval != 0 )
+            {
+                discardConvLayers( &imgResized[ cnt * 4 ], d );
+                continue;
+            }
+
+            libsrcnn::ImgF32 imgConv;
+            libsrcnn::initImgF32( imgConv, rs_w, rs_h );
+
+            memcpy( imgConv.buff, &imgConv3.buff[ cnt * rs_w * rs_h ],
+                    rs_w * rs_h * sizeof( float ) );
+
+            retval = composeImgU8( &imgResized[ cnt * 4 ], d, imgConv,
+                                   outbuffs[ first + cnt ], outbuffszs[ first + cnt ],
+                                   NULL, NULL );
+        }
+
+        libsrcnn::resetImgF32( imgConv3 );
+    }
+
+    delete[] imgResized;
+
+    return retval;
+}
+
+// shelves of slots by descending height in atlases of width, a new
+// atlas starts when a shelf goes over height, returns count of atlases.
+unsigned packAtlas( const unsigned* slotw, const unsigned* sloth, unsigned count,
+                    unsigned width, unsigned height,
+                    unsigned* slotx, unsigned* sloty, unsigned* slota,
+                    unsigned* atlash )
+{
+    unsigned* order = new unsigned[ count ];
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        order[cnt] = cnt;
+    }
+
+    // insertion sort, count is not huge.
+    for ( unsigned cnt=1; cnt<count; cnt++ )
+    {
+        unsigned idx = order[cnt];
+        unsigned pos = cnt;
+
+        while( ( pos > 0 ) && ( sloth[ order[ pos - 1 ] ] < sloth[idx] ) )
+        {
+            order[pos] = order[ pos - 1 ];
+            pos--;
+        }
+
+        order[pos] = idx;
+    }
+
+    unsigned atlases = 1;
+    unsigned x       = 0;
+    unsigned y       = 0;
+    unsigned shelfh  = 0;
+
+    atlash[0] = 0;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        unsigned idx = order[cnt];
+
+        if ( x + slotw[idx] > width )
+        {
+            y      += shelfh;
+            x       = 0;
+            shelfh  = 0;
+        }
+
+        // first shelf of atlas may be higher, for large image.
+        if ( ( x == 0 ) && ( y > 0 ) && ( y + sloth[idx] > height ) )
+        {
+            atlash[ atlases - 1 ] = y;
+            atlash[ atlases ]     = 0;
+            atlases++;
+            y = 0;
+        }
+
+        slotx[idx] = x;
+        sloty[idx] = y;
+        slota[idx] = atlases - 1;
+
+        x      += slotw[idx];
+        shelfh  = MAX( shelfh, sloth[idx] );
+    }
+
+    atlash[ atlases - 1 ] = y + shelfh;
+
+    delete[] order;
+
+    return atlases;
+}
+
+int doSRCNNAtlas( SRCNNAtlasImage* images, unsigned count, unsigned d,
+                  float muliply,
+                  const libsrcnn::SRCNNModel* model )
+{
+    unsigned actf[MODEL_MAX_FILTERS] = {0};
+    unsigned actfsz = buildActiveFilters( actf, model->n1 );
+
+    libsrcnn::ConvLayer layers[CONV_MAX_LAYERS];
+    unsigned layerssz = modelConvLayers( model, layers );
+
+    // widest halo of layers, edges of each image repeated there.
+    unsigned gutter = 0;
+
+    for ( unsigned cnt=0; cnt<layerssz; cnt++ )
+    {
+        gutter = MAX( gutter, layers[cnt].ksz / 2 );
+    }
+
+    /* --
+     * Resized channels of all images alive till composed, layers of
+     * an atlas at a time ( or of largest image ), admitted at once.
+     */
+    libsrcnn::MemoryNeed need;
+    memset( &need, 0, sizeof( libsrcnn::MemoryNeed ) );
+
+    unsigned long long atlaspx = CONV_ATLAS_PIXELS;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        unsigned long long slotpx = (unsigned long long)
+                                    ( (unsigned)( images[cnt].w * muliply ) + gutter * 2 )
+                                    * ( (unsigned)( images[cnt].h * muliply ) + gutter * 2 );
+
+        need.fixed += slotpx * ( d * sizeof( float ) + d + 1 );
+        atlaspx     = MAX( atlaspx, slotpx );
+    }
+
+    need.fixed += atlaspx * layersPixelBytes( layers, layerssz, false );
+
+    libsrcnn::MemoryScope memory( need );
+
+    if ( memory.result() != 0 )
+        return memory.result();
+
+    libsrcnn::ImgF32*   imgResized = new libsrcnn::ImgF32[ count * 4 ];
+    libsrcnn::ConvRect* rects      = new libsrcnn::ConvRect[ count ];
+    unsigned*           slots      = new unsigned[ count * 7 ];
+    unsigned*           slotw      = &slots[ 0 ];
+    unsigned*           sloth      = &slots[ count ];
+    unsigned*           slotx      = &slots[ count * 2 ];
+    unsigned*           sloty      = &slots[ count * 3 ];
+    unsigned*           slota      = &slots[ count * 4 ];
+    unsigned*           atlash     = &slots[ count * 5 ];
+    unsigned*           members    = &slots[ count * 6 ];
+
+    /* One fork for all images, their own loops go in a thread */
+    parallelForDynamic( count, [&]( unsigned cnt )
+    {
+        libsrcnn::ImgU8     imgSrc = { images[cnt].w, images[cnt].h, d,
+                                       (unsigned char*)images[cnt].refbuff };
+        libsrcnn::ImgYCbCr  imgYCbCr;
+
+        converImgU8toYCbCr( imgSrc, imgYCbCr );
+        resizeImgYCbCr( imgYCbCr, d,
+                        images[cnt].w * muliply, images[cnt].h * muliply,
+                        &imgResized[ cnt * 4 ], true );
+        discardImgYCbCr( imgYCbCr );
+    } );
+
+    unsigned atlasw = CONV_ATLAS_WIDTH;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        slotw[cnt] = imgResized[ cnt * 4 ].width  + gutter * 2;
+        sloth[cnt] = imgResized[ cnt * 4 ].height + gutter * 2;
+        atlasw     = MAX( atlasw, slotw[cnt] );
+    }
+
+    /* --
+     * Width of atlases fixed ( generated kernels are for a width ),
+     * and activations of an atlas should stay in cache.
+     */
+    unsigned atlases = packAtlas( slotw, sloth, count,
+                                  atlasw, CONV_ATLAS_PIXELS / atlasw,
+                                  slotx, sloty, slota, atlash );
+    int      retval  = 0;
+
+    libsrcnn::ConvOptions opts;
+    memset( &opts, 0, sizeof( libsrcnn::ConvOptions ) );
+
+    opts.actf   = actf;
+    opts.actfsz = actfsz;
+    opts.sparse = conv2_sparse ? &conv2_sparsity : NULL;
+    opts.interleaved = conv_interleave;
+    opts.sgemm  = libsrcnn::systemSgemm();
+    opts.jit    = libsrcnn::jitAvailable();
+    opts.rects  = rects;
+    opts.gutter = gutter;
+
+    for ( unsigned atlas=0; atlas<atlases; atlas++ )
+    {
+        unsigned ah = atlash[atlas];
+
+        // images of this atlas.
+        opts.rectsz = 0;
+
+        for ( unsigned cnt=0; cnt<count; cnt++ )
+        {
+            if ( slota[cnt] == atlas )
+            {
+                members[ opts.rectsz ] = cnt;
+                opts.rectsz++;
+            }
+        }
+
+        libsrcnn::ImgF32 imgAtlas;
+        libsrcnn::initImgF32( imgAtlas, atlasw, ah );
+        memset( imgAtlas.buff, 0, atlasw * ah * sizeof( float ) );
+
+        /* Y of each image with gutter of its edge pixels repeated */
+        parallelForDynamic( opts.rectsz, [&]( unsigned n )
+        {
+            unsigned         cnt  = members[n];
+            libsrcnn::ImgF32 slot = imgAtlas;
+            slot.width  = imgResized[ cnt * 4 ].width;
+            slot.height = imgResized[ cnt * 4 ].height;
+            slot.halo   = gutter;
+            slot.buff   = &imgAtlas.buff[ sloty[cnt] * atlasw + slotx[cnt] ];
+
+            float* org = originF32( slot );
+
+            for ( unsigned row=0; row<slot.height; row++ )
+            {
+                memcpy( &org[ row * atlasw ],
+                        &imgResized[ cnt * 4 ].buff[ row * slot.width ],
+                        slot.width * sizeof( float ) );
+            }
+
+            fillImgF32Halo( slot );
+
+            rects[n].x = slotx[cnt] + gutter;
+            rects[n].y = sloty[cnt] + gutter;
+            rects[n].w = slot.width;
+            rects[n].h = slot.height;
+        } );
+
+        opts.fused = libsrcnn::fusedConvLayers( layers, layerssz,
+                                                atlasw, ah, actfsz );
+
+        libsrcnn::ImgF32 imgConv3;
+        libsrcnn::initImgF32( imgConv3, atlasw, ah );
+
+        if ( libsrcnn::runConvLayers( layers, layerssz,
+                                      imgAtlas, imgConv3, opts ) == false )
+        {
+            retval = -100;
+        }
+
+        libsrcnn::resetImgF32( imgAtlas );
+
+        /* Results scattered back, each composed in a thread */
+        parallelForDynamic( opts.rectsz, [&]( unsigned n )
+        {
+            unsigned          cnt     = members[n];
+            libsrcnn::ImgF32* resized = &imgResized[ cnt * 4 ];
+
+            if ( retval != 0 )
+                return;
+
+            unsigned     rs_w = resized->width;
+            unsigned     rs_h = resized->height;
+            const float* org  = &imgConv3.buff[ rects[n].y * atlasw + rects[n].x ];
+
+            libsrcnn::ImgF32 imgConv;
+            libsrcnn::initImgF32( imgConv, rs_w, rs_h );
+
+            for ( unsigned row=0; row<rs_h; row++ )
+            {
+                memcpy( &imgConv.buff[ row * rs_w ], &org[ row * atlasw ],
+                        rs_w * sizeof( float ) );
+            }
+
+            // Resized Y-Cb-Cr discarded by composing.
+            if ( composeImgU8( resized, d, imgConv,
+                               images[cnt].outbuff, images[cnt].outbuffsz,
+                               NULL, NULL ) != 0 )
+            {
+                images[cnt].outbuff = NULL;
+            }
+        } );
+
+        libsrcnn::resetImgF32( imgConv3 );
+
+        if ( retval != 0 )
+            break;
+    }
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
     {
-        char strtmp[80] = {0};
-        snprintf( strtmp, 80, "conv2_%u.png", cnt );
-        // saveImgF32( &imgConv2[cnt], strtmp );
+        if ( images[cnt].outbuff == NULL )
+        {
+            // not composed, or failed.
+            discardConvLayers( &imgResized[ cnt * 4 ], d );
+
+            if ( retval == 0 )
+                retval = -11;
+        }
     }
-#endif /// of DEBUG
-#endif /// of NEW_FAST_I_II_LAYERS
 
-    /******************* The Third Layer *******************/
+    delete[] imgResized;
+    delete[] rects;
+    delete[] slots;
+
+    return retval;
+}
+
+unsigned espcnConvLayers( const ESPCNWeights* wgts, libsrcnn::ConvLayer* layers )
+{
+    ConvLayer layer1 = { ESPCN_CONV1_SIZE, 1, ESPCN_CONV1_FILTERS, CONV_ReLU,
+                         wgts->weights1, wgts->biases1, NULL };
+    ConvLayer layer2 = { ESPCN_CONV2_SIZE, ESPCN_CONV1_FILTERS, ESPCN_CONV2_FILTERS,
+                         CONV_ReLU, wgts->weights2, wgts->biases2, NULL };
+    ConvLayer layer3 = { ESPCN_CONV3_SIZE, ESPCN_CONV2_FILTERS,
+                         wgts->scale * wgts->scale, CONV_Shuffle,
+                         wgts->weights3, wgts->biases3, NULL };
+
+    layers[0] = layer1;
+    layers[1] = layer2;
+    layers[2] = layer3;
+
+    return 3;
+}
+
+const ESPCNWeights* selectESPCN( float muliply )
+{
+    // smallest trained scale covers multiply, or largest one.
+    for ( unsigned cnt=0; cnt<ESPCN_SCALES; cnt++ )
+    {
+        if ( (float)espcn_weights[cnt].scale + 1e-4f >= muliply )
+            return &espcn_weights[cnt];
+    }
+
+    return &espcn_weights[ ESPCN_SCALES - 1 ];
+}
+
+int doESPCN( const unsigned char* refbuff,
+             unsigned w, unsigned h, unsigned d,
+             float muliply,
+             unsigned char* &outbuff,
+             unsigned &outbuffsz,
+             unsigned char** convbuff,
+             unsigned* convbuffsz )
+{
+    const ESPCNWeights* wgts  = selectESPCN( muliply );
+    unsigned            scale = wgts->scale;
+
+    libsrcnn::ConvLayer layers[CONV_MAX_LAYERS];
+    unsigned layerssz = espcnConvLayers( wgts, layers );
+
+    unsigned rs_w = w * muliply;
+    unsigned rs_h = h * muliply;
+
+    /* --
+     * Layers run at source size, sub-pixel layer writes trained scale,
+     * so it goes whole or waits, never by bands.
+     */
+    libsrcnn::MemoryNeed need = libsrcnn::memoryNeedSRCNN( layers, layerssz, false,
+                                                           w, h, d, w, h );
+    unsigned long long srcsz = (unsigned long long)w * h;
+    unsigned long long rssz  = (unsigned long long)rs_w * rs_h;
+    unsigned long long srsz  = srcsz * scale * scale;
+
+    // bicubic Y at trained scale and its output, resized to multiply.
+    need.fixed = ( srcsz * d + rssz * d + srsz * 2 ) * sizeof( float )
+                 + rssz * ( d + 1 );
+    need.bands = false;
+
+    libsrcnn::MemoryScope memory( need );
+
+    if ( memory.result() != 0 )
+        return memory.result();
+
+    // -------------------------------------------------------------
+    // Convert RGB to Y-Cb-Cr
+    //
+    // warning: imgSrc is referenced, don't remove from memory !
+    libsrcnn::ImgU8     imgSrc = { w ,h ,d, (unsigned char*)refbuff };
+    libsrcnn::ImgYCbCr  imgYCbCr;
+
+    converImgU8toYCbCr( imgSrc, imgYCbCr );
+
+    libsrcnn::ImgF32 imgResized[4];
 
-    libsrcnn::ImgF32 imgConv3;
+    // Y comes from sub-pixel layer.
+    resizeImgYCbCr( imgYCbCr, d, rs_w, rs_h, imgResized, false );
 
-    libsrcnn::initImgF32( imgConv3,
-                          imgResized[0].width,
-                          imgResized[0].height );
+    /* --
+     * Network is trained for residual of bicubic resized Y,
+     * at its trained scale.
+     */
+    libsrcnn::ImgF32 imgSR;
+
+    imgSR.width  = imgYCbCr.Y.width  * scale;
+    imgSR.height = imgYCbCr.Y.height * scale;
+    imgSR.depth  = 1;
+    imgSR.buff   = NULL;
+    imgSR.stride = imgSR.width;
+    imgSR.halo   = 0;
+
+    FRAWBicubicFilter bicubic;
+    FRAWResizeEngine  rsze( &bicubic );
+
+    rsze.scale( imgYCbCr.Y.buff,
+                imgYCbCr.Y.width,
+                imgYCbCr.Y.height,
+                imgSR.width,
+                imgSR.height,
+                &imgSR.buff );
+
+    libsrcnn::ConvOptions opts;
+    memset( &opts, 0, sizeof( libsrcnn::ConvOptions ) );
+
+    opts.job = job_current;
+
+    unsigned outer[2] = {0,0};
 
-    libsrcnn::convolution55( imgConv2, imgConv3,
-                             weights_conv3_data,
-                             biases_conv3 );
+    jobEnter( opts.job, 100, 950, outer );
+
+    libsrcnn::runConvLayers( layers, layerssz, imgYCbCr.Y, imgSR, opts );
+
+    jobLeave( opts.job, outer );
+
+    // Release splitted image of Y-Cb-Cr --
+    discardImgYCbCr( imgYCbCr );
+
+    if ( jobCancelled( opts.job ) == true )
+    {
+        resetImgF32( imgSR );
+        discardConvLayers( imgResized, d );
+        return -4;
+    }
 
 #ifdef DEBUG
-    saveImgF32( &imgConv3, "conv3.png" );
+    saveImgF32( &imgSR, "espcn.png" );
 #endif
 
-    // ---------------------------------------------------------
-	// Copy Third layer result to Y channel.
+    // Trained scale to multiply.
+    libsrcnn::ImgF32 imgConv = imgSR;
 
-	unsigned convsz = imgResized[0].width \
-                      * imgResized[0].height * sizeof( float );
-	memcpy( imgResized[0].buff, imgConv3.buff, convsz );
+    if ( ( imgSR.width != rs_w ) || ( imgSR.height != rs_h ) )
+    {
+        imgConv.width  = rs_w;
+        imgConv.height = rs_h;
+        imgConv.buff   = NULL;
 
-    /* Convert the image from YCrCb to RGB Space */
-    libsrcnn::ImgU8 imgRGB;
-    libsrcnn::convertImgF32XtoImgU8( imgResized, d, imgRGB );
+        FRAWGenericFilter* rszfilter = createResizeFilter( true );
+        FRAWResizeEngine   rszf( rszfilter );
 
-    // discard used image of Resized Y-Cr-Cb.
-    libsrcnn::discardConvLayers( imgResized, d );
+        rszf.scale( imgSR.buff,
+                    imgSR.width,
+                    imgSR.height,
+                    rs_w,
+                    rs_h,
+                    &imgConv.buff );
+
+        delete rszfilter;
 
-    // discard used buffers ..
-#ifndef NEW_FAST_I_II_LAYERS
-    libsrcnn::discardConvLayers( &imgConv1[0], CONV1_FILTERS );
-#endif /// of ! NEW_FAST_I_II_LAYERS
-    libsrcnn::discardConvLayers( &imgConv2[0], CONV2_FILTERS );
+        resetImgF32( imgSR );
 
-    if ( imgRGB.buff != NULL )
+        unsigned imgsz = rs_w * rs_h;
+
+        parallelFor( imgsz, [&]( unsigned cnt )
+        {
+            float temp = imgConv.buff[cnt];
+
+            temp = MAX( temp, 0.f );
+            temp = MIN( temp, 255.f );
+
+            imgConv.buff[cnt] = temp;
+        } );
+    }
+
+    return composeImgU8( imgResized, d, imgConv,
+                         outbuff, outbuffsz,
+                         convbuff, convbuffsz );
+}
+
+int doProcess( const unsigned char* refbuff,
+               unsigned w, unsigned h, unsigned d,
+               float muliply,
+               unsigned char* &outbuff,
+               unsigned &outbuffsz,
+               unsigned char** convbuff,
+               unsigned* convbuffsz )
+{
+    if ( engine_type == SRCNNE_ESPCN )
     {
-        outbuffsz = imgRGB.width * imgRGB.height * imgRGB.depth;
-        outbuff = new unsigned char[ outbuffsz ];
-        if ( outbuff != NULL )
+        return doESPCN( refbuff, w, h, d, muliply,
+                        outbuff, outbuffsz,
+                        convbuff, convbuffsz );
+    }
+
+    ModelScope selected( muliply );
+
+    return doSRCNN( refbuff, w, h, d, muliply,
+                    selected.model,
+                    outbuff, outbuffsz,
+                    convbuff, convbuffsz );
+}
+
+// threads of a call by policy, for outermost call of a thread.
+class PolicyScope
+{
+    public:
+        PolicyScope( SRCNNPolicyType ptype );
+        ~PolicyScope();
+
+    private:
+        bool        outer;
+        bool        serial;
+        bool        limited;
+        bool        pinned;
+        bool        prevserial;
+        unsigned    prevlimit;
+};
+
+PolicyScope::PolicyScope( SRCNNPolicyType ptype )
+ : outer( calls_depth == 0 ),
+   serial( false ),
+   limited( false ),
+   pinned( false ),
+   prevserial( false ),
+   prevlimit( 0 )
+{
+    calls_depth++;
+
+    if ( outer == false )
+        return;
+
+    unsigned running = ++calls_running;
+
+    if ( ptype == SRCNNP_Throughput )
+    {
+        serial = true;
+    }
+    else
+    if ( ( ptype == SRCNNP_Auto ) && ( running > 1 ) )
+    {
+        // even share for each running call, a call started alone
+        // keeps its threads until it returns.
+        unsigned share = parallelThreads() / running;
+
+        if ( share <= 1 )
         {
-            memcpy( outbuff, imgRGB.buff, outbuffsz );
-            retval = 0;
+            serial = true;
         }
         else
         {
-            retval = -11;
+            limited   = true;
+            prevlimit = parallelMaximum( share, true );
         }
+    }
 
-        resetImgU8( imgRGB );
+    if ( serial == true )
+    {
+        prevserial = parallelSerial( true );
+    }
+    else
+    {
+        // threads of its loops stay on their NUMA nodes.
+        pinned = parallelPin( true );
     }
+}
 
-    if ( ( convbuff != NULL ) && ( convbuffsz != NULL ) )
+PolicyScope::~PolicyScope()
+{
+    calls_depth--;
+
+    if ( outer == false )
+        return;
+
+    if ( serial == true )
+    {
+        parallelSerial( prevserial );
+    }
+
+    if ( limited == true )
+    {
+        parallelMaximum( prevlimit, true );
+    }
+
+    if ( pinned == true )
+    {
+        parallelPin( false );
+    }
+
+    // mappings of planes kept while calls run.
+    if ( --calls_running == 0 )
     {
-        if ( ( imgConv3.buff != NULL ) && ( retval == 0 ) )
+        hugePagesTrim();
+    }
+}
+
+bool fanOutBatch( unsigned count )
+{
+    if ( count < 2 )
+        return false;
+
+    if ( call_policy == SRCNNP_Throughput )
+        return true;
+
+    // every thread has an image at least.
+    unsigned threads = parallelThreads();
+
+    return ( call_policy == SRCNNP_Auto )
+           && ( threads > 1 ) && ( count >= threads );
+}
+
+// each image by a thread, as a ProcessSRCNN() in throughput policy.
+int doBatchFanOut( const unsigned char** refbuffs, unsigned count,
+                   unsigned w, unsigned h, unsigned d, float multiply,
+                   unsigned char** outbuffs, unsigned* outbuffszs )
+{
+    int*           rets  = new int[ count ];
+    SRCNNSparsity* stats = new SRCNNSparsity[ count ];
+
+    parallelForDynamic( count, [&]( unsigned idx )
+    {
+        PolicyScope scope( SRCNNP_Throughput );
+
+        // calling thread takes images too, its own count comes back.
+        SRCNNSparsity keep = conv2_sparsity;
+
+        rets[idx] = ProcessSRCNN( refbuffs[idx], w, h, d, multiply,
+                                  outbuffs[idx], outbuffszs[idx],
+                                  NULL, NULL );
+
+        stats[idx]     = conv2_sparsity;
+        conv2_sparsity = keep;
+    } );
+
+    int retval = 0;
+
+    memset( &conv2_sparsity, 0, sizeof( SRCNNSparsity ) );
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        if ( ( retval == 0 ) && ( rets[cnt] != 0 ) )
         {
-            unsigned bsz = imgConv3.width * imgConv3.height;
-            unsigned char* buff = new unsigned char[ bsz ];
-            if ( buff != NULL )
+            retval = rets[cnt];
+        }
+
+        conv2_sparsity.activations += stats[cnt].activations;
+        conv2_sparsity.zeros       += stats[cnt].zeros;
+        conv2_sparsity.blocks      += stats[cnt].blocks;
+        conv2_sparsity.skipped     += stats[cnt].skipped;
+    }
+
+    delete[] rets;
+    delete[] stats;
+
+    return retval;
+}
+
+int doAnalyzeSRCNN( const unsigned char* refbuff,
+                    unsigned w, unsigned h, unsigned d,
+                    float muliply,
+                    const libsrcnn::SRCNNModel* model,
+                    double* energy )
+{
+    libsrcnn::ImgU8     imgSrc = { w ,h ,d, (unsigned char*)refbuff };
+    libsrcnn::ImgYCbCr  imgYCbCr;
+
+    converImgU8toYCbCr( imgSrc, imgYCbCr );
+
+    libsrcnn::ImgF32 imgResized;
+
+    imgResized.width  = imgYCbCr.Y.width  * muliply;
+    imgResized.height = imgYCbCr.Y.height * muliply;
+    imgResized.depth  = 1;
+    imgResized.buff   = NULL;
+    imgResized.stride = imgResized.width;
+    imgResized.halo   = 0;
+
+    FRAWGenericFilter* rszfilter = createResizeFilter( true );
+    FRAWResizeEngine rsze( rszfilter );
+
+    rsze.scale( imgYCbCr.Y.buff,
+                imgYCbCr.Y.width,
+                imgYCbCr.Y.height,
+                imgResized.width,
+                imgResized.height,
+                &imgResized.buff );
+
+    delete rszfilter;
+
+    discardImgYCbCr( imgYCbCr );
+
+    if ( imgResized.buff == NULL )
+        return -11;
+
+    unsigned imgsz = imgResized.width * imgResized.height;
+
+    /* --
+     * Energy of a filter is a mean of squared activation after ReLU,
+     * weighted by squared sum of its column in second layer, that is
+     * how much it pushes into the second layer.
+     */
+    unsigned f1sz = model->f1 * model->f1;
+    unsigned f2sz = model->f2 * model->f2;
+
+    libsrcnn::Conv99Func conv99 = libsrcnn::selectConvKernels( model->f1 )->conv99;
+
+    // layer I reads Y with its halo.
+    libsrcnn::ImgF32 imgPadded;
+
+    libsrcnn::copyImgF32Halo( imgPadded, imgResized, model->f1 / 2 );
+    resetImgF32( imgResized );
+
+    parallelFor( model->n1, [&]( unsigned cnt )
+    {
+        libsrcnn::ImgF32 imgConv1;
+
+        libsrcnn::initImgF32( imgConv1,
+                              imgPadded.width,
+                              imgPadded.height );
+
+        conv99( imgPadded,
+                imgConv1,
+                &model->weights1[ cnt * f1sz ],
+                model->f1,
+                model->biases1[cnt],
+                0, imgConv1.height );
+
+        double actsum = 0.0;
+
+        for ( unsigned pos=0; pos<imgsz; pos++ )
+        {
+            actsum += (double)imgConv1.buff[pos] * imgConv1.buff[pos];
+        }
+
+        double colsum = 0.0;
+
+        for ( unsigned fc=0; fc<model->n2; fc++ )
+        {
+            const float* col = &model->weights2[ ( fc * model->n1 + cnt ) * f2sz ];
+
+            for ( unsigned tap=0; tap<f2sz; tap++ )
             {
-				#pragma omp parallel for
-				for( unsigned cnt=0; cnt<bsz; cnt++ )
-                {
-					buff[ cnt ] = (unsigned char)imgConv3.buff[ cnt ];
-				}
+                colsum += (double)col[tap] * col[tap];
+            }
+        }
+
+        energy[cnt] += ( actsum / (double)imgsz ) * colsum;
+
+        libsrcnn::resetImgF32( imgConv1 );
+    } );
+
+    resetImgF32( imgPadded );
+
+    return 0;
+}
+////////////////////////////////////////////////////////////////////////////////
+
+}; /// of namespace libsrcnn
+
+////////////////////////////////////////////////////////////////////////////////
+
+// asynchronous call, shared by its thread and its handle.
+struct SRCNNJobState
+{
+    libsrcnn::JobControl    control;
+    unsigned char*          refbuff;    /// copy of source.
+    unsigned                w;
+    unsigned                h;
+    unsigned                d;
+    float                   multiply;
+    bool                    convout;
+    SRCNNJobFunc            done;
+    void*                   user;
+    std::mutex              lock;
+    std::condition_variable cond;
+    unsigned                refs;       /// thread and handle.
+    bool                    finished;
+    int                     result;
+    unsigned char*          outbuff;
+    unsigned                outbuffsz;
+    unsigned char*          convbuff;
+    unsigned                convbuffsz;
+};
+
+static void releaseJob( SRCNNJob job )
+{
+    bool last = false;
+
+    {
+        std::lock_guard<std::mutex> guard( job->lock );
+
+        job->refs--;
+        last = ( job->refs == 0 );
+    }
+
+    if ( last == true )
+    {
+        // outputs nobody took.
+        if ( job->refbuff != NULL )
+            delete[] job->refbuff;
+
+        if ( job->outbuff != NULL )
+            delete[] job->outbuff;
+
+        if ( job->convbuff != NULL )
+            delete[] job->convbuff;
+
+        delete job;
+    }
+}
+
+static void runJob( SRCNNJob job )
+{
+    int retval = -4;
+
+    if ( job->control.cancel.load() == false )
+    {
+        // loops stop at next index as cancelled.
+        libsrcnn::job_current = &job->control;
+        libsrcnn::parallelCancel( &job->control.cancel );
+
+        retval = ProcessSRCNN( job->refbuff, job->w, job->h, job->d,
+                               job->multiply,
+                               job->outbuff, job->outbuffsz,
+                               job->convout ? &job->convbuff : NULL,
+                               job->convout ? &job->convbuffsz : NULL );
+
+        libsrcnn::parallelCancel( NULL );
+        libsrcnn::job_current = NULL;
+    }
+
+    // source never read again.
+    delete[] job->refbuff;
+    job->refbuff = NULL;
+
+    {
+        std::lock_guard<std::mutex> guard( job->lock );
 
-				*convbuff   = buff;
-				*convbuffsz = bsz;
+        // a whole output stands against cancel came late, other results
+        // of a cancelled call are -4. CancelJobSRCNN() takes same lock.
+        if ( ( retval != 0 ) && ( job->control.cancel.load() == true ) )
+        {
+            retval = -4;
+        }
 
-                retval = 0;
-            }
-            else
+        if ( retval != 0 )
+        {
+            if ( job->outbuff != NULL )
             {
-                retval = -12;
+                delete[] job->outbuff;
+                job->outbuff   = NULL;
+                job->outbuffsz = 0;
             }
 
-            resetImgF32( imgConv3 );
+            if ( job->convbuff != NULL )
+            {
+                delete[] job->convbuff;
+                job->convbuff   = NULL;
+                job->convbuffsz = 0;
+            }
+        }
+        else
+        {
+            job->control.progress.store( 1000 );
         }
+
+        job->result   = retval;
+        job->finished = true;
     }
-    else
-    if ( imgConv3.buff != NULL )
+
+    job->cond.notify_all();
+
+    if ( job->done != NULL )
     {
-        resetImgF32( imgConv3 );
+        job->done( job, retval, job->user );
     }
 
-    return retval;
+    releaseJob( job );
 }
-////////////////////////////////////////////////////////////////////////////////
-
-}; /// of namespace libsrcnn
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -967,15 +4870,19 @@ int DLL_PUBLIC ProcessSRCNN( const unsigned char* refbuff,
 
     int retval = -100;
 
+    libsrcnn::PolicyScope scope( libsrcnn::call_policy );
+
+    memset( &libsrcnn::conv2_sparsity, 0, sizeof( SRCNNSparsity ) );
+
     if ( libsrcnn::intp_stepscale == false )
     {
-        retval = libsrcnn::doSRCNN( refbuff,
-                                    w, h, d,
-                                    multiply,
-                                    outbuff,
-                                    outbuffsz,
-                                    convbuff,
-                                    convbuffsz );
+        retval = libsrcnn::doProcess( refbuff,
+                                      w, h, d,
+                                      multiply,
+                                      outbuff,
+                                      outbuffsz,
+                                      convbuff,
+                                      convbuffsz );
     }
     else
     {
@@ -1028,17 +4935,31 @@ int DLL_PUBLIC ProcessSRCNN( const unsigned char* refbuff,
                 cbuffsz = convbuffsz;
             }
 
-            retval = libsrcnn::doSRCNN( rbuff,
-                                        sw, sh, d,
-                                        curmf,
-                                        obuff,
-                                        obuffsz,
-                                        cbuff,
-                                        cbuffsz );
+            // each step takes its share of progress.
+            unsigned outer[2] = {0,0};
+
+            libsrcnn::jobEnter( libsrcnn::job_current,
+                                cnt * 1000 / repeat, ( cnt + 1 ) * 1000 / repeat,
+                                outer );
+
+            retval = libsrcnn::doProcess( rbuff,
+                                          sw, sh, d,
+                                          curmf,
+                                          obuff,
+                                          obuffsz,
+                                          cbuff,
+                                          cbuffsz );
+
+            libsrcnn::jobLeave( libsrcnn::job_current, outer );
 
             if ( retval != 0 )
             {
-                delete[] rbuff;
+                // source of caller never be deleted.
+                if ( rbuff != refbuff )
+                {
+                    delete[] rbuff;
+                }
+
                 rbuff = NULL;
                 break;
             }
@@ -1062,3 +4983,459 @@ int DLL_PUBLIC ProcessSRCNN( const unsigned char* refbuff,
 
     return retval;
 }
+
+int DLL_PUBLIC ProcessBatchSRCNN( const unsigned char** refbuffs,
+                                  unsigned count,
+                                  unsigned w, unsigned h, unsigned d,
+                                  float multiply,
+                                  unsigned char** outbuffs,
+                                  unsigned* outbuffszs )
+{
+    if ( ( refbuffs == NULL ) || ( count == 0 )
+         || ( outbuffs == NULL ) || ( outbuffszs == NULL )
+         || ( w == 0 ) || ( h == 0 ) || ( d == 0 ) )
+        return -1;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        if ( refbuffs[cnt] == NULL )
+            return -1;
+
+        outbuffs[cnt]   = NULL;
+        outbuffszs[cnt] = 0;
+    }
+
+    if ( ( (float)w * multiply <= 0.f ) || ( (float)h * multiply <= 0.f ) )
+    {
+        return -2;
+    }
+
+    int retval = -100;
+
+    if ( libsrcnn::fanOutBatch( count ) == true )
+    {
+        retval = libsrcnn::doBatchFanOut( refbuffs, count, w, h, d, multiply,
+                                          outbuffs, outbuffszs );
+    }
+    else
+    if ( ( libsrcnn::intp_stepscale == true )
+         || ( libsrcnn::engine_type == SRCNNE_ESPCN ) )
+    {
+        libsrcnn::PolicyScope scope( libsrcnn::call_policy );
+
+        // steps and ESPCN go image by image.
+        for ( unsigned cnt=0; cnt<count; cnt++ )
+        {
+            retval = ProcessSRCNN( refbuffs[cnt], w, h, d, multiply,
+                                   outbuffs[cnt], outbuffszs[cnt],
+                                   NULL, NULL );
+
+            if ( retval != 0 )
+                break;
+        }
+    }
+    else
+    {
+        libsrcnn::PolicyScope scope( libsrcnn::call_policy );
+
+        libsrcnn::ModelScope selected( multiply );
+
+        memset( &libsrcnn::conv2_sparsity, 0, sizeof( SRCNNSparsity ) );
+
+        retval = libsrcnn::doSRCNNBatch( refbuffs, count, w, h, d, multiply,
+                                         selected.model,
+                                         outbuffs, outbuffszs );
+    }
+
+    // all or nothing.
+    if ( retval != 0 )
+    {
+        for ( unsigned cnt=0; cnt<count; cnt++ )
+        {
+            if ( outbuffs[cnt] != NULL )
+            {
+                delete[] outbuffs[cnt];
+                outbuffs[cnt] = NULL;
+            }
+
+            outbuffszs[cnt] = 0;
+        }
+    }
+
+    return retval;
+}
+
+int DLL_PUBLIC ProcessAtlasSRCNN( SRCNNAtlasImage* images, unsigned count,
+                                  unsigned d, float multiply )
+{
+    if ( ( images == NULL ) || ( count == 0 ) || ( d == 0 ) )
+        return -1;
+
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        if ( ( images[cnt].refbuff == NULL )
+             || ( images[cnt].w == 0 ) || ( images[cnt].h == 0 ) )
+            return -1;
+
+        if ( ( (unsigned)( images[cnt].w * multiply ) == 0 )
+             || ( (unsigned)( images[cnt].h * multiply ) == 0 ) )
+            return -2;
+
+        images[cnt].outbuff   = NULL;
+        images[cnt].outbuffsz = 0;
+    }
+
+    int retval = -100;
+
+    libsrcnn::PolicyScope scope( libsrcnn::call_policy );
+
+    if ( ( libsrcnn::intp_stepscale == true )
+         || ( libsrcnn::engine_type == SRCNNE_ESPCN ) )
+    {
+        // steps and ESPCN go image by image.
+        for ( unsigned cnt=0; cnt<count; cnt++ )
+        {
+            retval = ProcessSRCNN( images[cnt].refbuff,
+                                   images[cnt].w, images[cnt].h, d,
+                                   multiply,
+                                   images[cnt].outbuff, images[cnt].outbuffsz,
+                                   NULL, NULL );
+
+            if ( retval != 0 )
+                break;
+        }
+    }
+    else
+    {
+        libsrcnn::ModelScope selected( multiply );
+
+        memset( &libsrcnn::conv2_sparsity, 0, sizeof( SRCNNSparsity ) );
+
+        retval = libsrcnn::doSRCNNAtlas( images, count, d, multiply,
+                                         selected.model );
+    }
+
+    // all or nothing.
+    if ( retval != 0 )
+    {
+        for ( unsigned cnt=0; cnt<count; cnt++ )
+        {
+            if ( images[cnt].outbuff != NULL )
+            {
+                delete[] images[cnt].outbuff;
+                images[cnt].outbuff = NULL;
+            }
+
+            images[cnt].outbuffsz = 0;
+        }
+    }
+
+    return retval;
+}
+
+SRCNNJob DLL_PUBLIC ProcessAsyncSRCNN( const unsigned char* refbuff,
+                                       unsigned w, unsigned h, unsigned d,
+                                       float multiply,
+                                       bool convout,
+                                       SRCNNJobFunc done,
+                                       void* user )
+{
+    if ( ( refbuff == NULL ) || ( w == 0 ) || ( h == 0 ) || ( d == 0 )
+         || ( (float)w * multiply <= 0.f ) || ( (float)h * multiply <= 0.f ) )
+        return NULL;
+
+    SRCNNJob job = new SRCNNJobState;
+
+    job->control.cancel.store( false );
+    job->control.progress.store( 0 );
+    job->control.from = 0;
+    job->control.to   = 1000;
+    job->refbuff    = new unsigned char[ w * h * d ];
+    job->w          = w;
+    job->h          = h;
+    job->d          = d;
+    job->multiply   = multiply;
+    job->convout    = convout;
+    job->done       = done;
+    job->user       = user;
+    job->refs       = 2;
+    job->finished   = false;
+    job->result     = -100;
+    job->outbuff    = NULL;
+    job->outbuffsz  = 0;
+    job->convbuff   = NULL;
+    job->convbuffsz = 0;
+
+    memcpy( job->refbuff, refbuff, w * h * d );
+
+    try
+    {
+        std::thread( runJob, job ).detach();
+    }
+    catch( const std::system_error& )
+    {
+        delete[] job->refbuff;
+        delete job;
+
+        return NULL;
+    }
+
+    return job;
+}
+
+int DLL_PUBLIC WaitJobSRCNN( SRCNNJob job,
+                             unsigned char* &outbuff,
+                             unsigned &outbuffsz,
+                             unsigned char** convbuff,
+                             unsigned* convbuffsz )
+{
+    if ( job == NULL )
+        return -1;
+
+    int retval = -100;
+
+    {
+        std::unique_lock<std::mutex> guard( job->lock );
+
+        while( job->finished == false )
+        {
+            job->cond.wait( guard );
+        }
+
+        retval    = job->result;
+        outbuff   = job->outbuff;
+        outbuffsz = job->outbuffsz;
+
+        job->outbuff   = NULL;
+        job->outbuffsz = 0;
+
+        if ( convbuff != NULL )
+        {
+            *convbuff     = job->convbuff;
+            job->convbuff = NULL;
+        }
+
+        if ( convbuffsz != NULL )
+        {
+            *convbuffsz = job->convbuffsz;
+        }
+    }
+
+    releaseJob( job );
+
+    return retval;
+}
+
+unsigned DLL_PUBLIC GetJobProgressSRCNN( SRCNNJob job )
+{
+    if ( job == NULL )
+        return 0;
+
+    return job->control.progress.load();
+}
+
+void DLL_PUBLIC CancelJobSRCNN( SRCNNJob job )
+{
+    if ( job != NULL )
+    {
+        std::lock_guard<std::mutex> guard( job->lock );
+
+        // finished job keeps its result.
+        if ( job->finished == false )
+        {
+            job->control.cancel.store( true );
+        }
+    }
+}
+
+void DLL_PUBLIC ReleaseJobSRCNN( SRCNNJob job )
+{
+    if ( job != NULL )
+    {
+        job->control.cancel.store( true );
+        releaseJob( job );
+    }
+}
+
+int DLL_PUBLIC AnalyzeFiltersSRCNN( const unsigned char* refbuff,
+                                    unsigned w, unsigned h, unsigned d,
+                                    float multiply,
+                                    double* energy,
+                                    unsigned energysz )
+{
+    if ( ( refbuff == NULL ) || ( w == 0 ) || ( h == 0 ) || ( d < 3 ) )
+        return -1;
+
+    if ( ( (float)w * multiply <= 0.f ) || ( (float)h * multiply <= 0.f ) )
+        return -2;
+
+    // a call as others, mappings of its planes trimmed as it ends.
+    libsrcnn::PolicyScope       scope( libsrcnn::call_policy );
+    libsrcnn::ModelScope        selected( multiply );
+    const libsrcnn::SRCNNModel* model = selected.model;
+
+    if ( ( energy == NULL ) || ( energysz < model->n1 ) )
+        return -3;
+
+    int retval = libsrcnn::doAnalyzeSRCNN( refbuff,
+                                           w, h, d,
+                                           multiply,
+                                           model,
+                                           energy );
+    if ( retval == 0 )
+        return model->n1;
+
+    return retval;
+}
+
+unsigned DLL_PUBLIC ConfigurePruneSRCNN( const unsigned* filters, unsigned count )
+{
+    bool pruned[MODEL_MAX_FILTERS] = {false};
+    unsigned actsz = libsrcnn::maxFilters();
+
+    if ( filters != NULL )
+    {
+        for( unsigned cnt=0; cnt<count; cnt++ )
+        {
+            if ( ( filters[cnt] < libsrcnn::maxFilters() ) \
+                 && ( pruned[ filters[cnt] ] == false ) )
+            {
+                pruned[ filters[cnt] ] = true;
+                actsz--;
+            }
+        }
+    }
+
+    // at least one filter should be alive.
+    if ( actsz == 0 )
+        return 0;
+
+    memcpy( libsrcnn::conv1_pruned, pruned, sizeof( pruned ) );
+
+    return actsz;
+}
+
+void DLL_PUBLIC ConfigureSparseSRCNN( bool enabled )
+{
+    libsrcnn::conv2_sparse = enabled;
+}
+
+void DLL_PUBLIC GetSparsitySRCNN( SRCNNSparsity* sparsity )
+{
+    if ( sparsity != NULL )
+    {
+        memcpy( sparsity, &libsrcnn::conv2_sparsity, sizeof( SRCNNSparsity ) );
+    }
+}
+
+void DLL_PUBLIC ConfigureCompositeSRCNN( bool enabled )
+{
+    libsrcnn::conv1_composite = enabled;
+}
+
+int DLL_PUBLIC LoadModelSRCNN( const char* path )
+{
+    libsrcnn::SRCNNModel* model = NULL;
+
+    int retval = libsrcnn::loadModel( path, model );
+    if ( retval != 0 )
+        return retval;
+
+    retval = libsrcnn::registerModel( model );
+    if ( retval != 0 )
+    {
+        libsrcnn::unloadModel( model );
+    }
+
+    return retval;
+}
+
+void DLL_PUBLIC UnloadModelsSRCNN()
+{
+    libsrcnn::clearModels();
+}
+
+int DLL_PUBLIC ExportModelSRCNN( const char* path )
+{
+    return libsrcnn::saveModel( libsrcnn::builtinModel(), path );
+}
+
+void DLL_PUBLIC ConfigureEngineSRCNN( SRCNNEngineType etype )
+{
+    if ( etype < SRCNNE_MAX )
+    {
+        libsrcnn::engine_type = etype;
+    }
+}
+
+void DLL_PUBLIC ConfigureInterleaveSRCNN( bool enabled )
+{
+    libsrcnn::conv_interleave = enabled;
+}
+
+void DLL_PUBLIC ConfigureLayersSRCNN( SRCNNLayersType ltype )
+{
+    if ( ltype < SRCNNL_MAX )
+    {
+        libsrcnn::layers_type = ltype;
+    }
+}
+
+void DLL_PUBLIC ConfigureExecutorSRCNN( const SRCNNExecutor* executor )
+{
+    libsrcnn::parallelExecutor( executor );
+}
+
+void DLL_PUBLIC ConfigureThreadsSRCNN( unsigned maximum, bool callingthread )
+{
+    libsrcnn::parallelMaximum( maximum, callingthread );
+}
+
+void DLL_PUBLIC ConfigurePolicySRCNN( SRCNNPolicyType ptype )
+{
+    if ( ptype < SRCNNP_MAX )
+    {
+        libsrcnn::call_policy = ptype;
+    }
+}
+
+void DLL_PUBLIC ConfigureMemorySRCNN( unsigned long long ceiling )
+{
+    unsigned long long headroom = 0;
+
+    {
+        std::lock_guard<std::mutex> guard( libsrcnn::mem_lock );
+
+        libsrcnn::mem_ceiling = ceiling;
+
+        headroom = libsrcnn::memoryHeadroom();
+    }
+
+    // waiting calls look at new ceiling.
+    libsrcnn::mem_cond.notify_all();
+
+    libsrcnn::hugePagesLimit( headroom );
+}
+
+unsigned DLL_PUBLIC ConfigureNumaSRCNN( bool enabled )
+{
+    unsigned nodes = libsrcnn::parallelNuma( enabled );
+
+    // mappings kept have pages on nodes of their last planes.
+    if ( libsrcnn::parallelPlaced() == true )
+    {
+        libsrcnn::hugePagesTrim();
+    }
+
+    return nodes;
+}
+
+void DLL_PUBLIC ConfigureHugePagesSRCNN( SRCNNHugePagesType htype )
+{
+    libsrcnn::hugePagesType( htype );
+}
+
+void DLL_PUBLIC GetHugePagesSRCNN( SRCNNHugePages* stat, bool reset )
+{
+    libsrcnn::hugePagesStat( stat, reset );
+}
@@ -31,8 +31,8 @@
 #endif
 #endif /// of LIBSRCNNSTATIC
 
-// libsrcnn version means,  0.1.10.40
-#define LIBSRCNN_VERSION    0x00010A28
+// libsrcnn version means,  0.1.11.41
+#define LIBSRCNN_VERSION    0x00010B29
 
 typedef enum DLL_PUBLIC
 {
@@ -43,6 +43,82 @@ typedef enum DLL_PUBLIC
     SRCNNF_Bspline
 }SRCNNFilterType;
 
+typedef enum DLL_PUBLIC
+{
+    SRCNNE_SRCNN = 0,
+    SRCNNE_ESPCN,
+    SRCNNE_MAX
+}SRCNNEngineType;
+
+typedef enum DLL_PUBLIC
+{
+    SRCNNL_Auto = 0,
+    SRCNNL_Separated,
+    SRCNNL_Fused,
+    SRCNNL_MAX
+}SRCNNLayersType;
+
+typedef enum DLL_PUBLIC
+{
+    SRCNNP_Latency = 0,
+    SRCNNP_Throughput,
+    SRCNNP_Auto,
+    SRCNNP_MAX
+}SRCNNPolicyType;
+
+typedef enum DLL_PUBLIC
+{
+    SRCNNH_None = 0,
+    SRCNNH_Transparent,
+    SRCNNH_Explicit,
+    SRCNNH_MAX
+}SRCNNHugePagesType;
+
+typedef struct DLL_PUBLIC
+{
+    unsigned long long  activations;    /// layer I outputs fed to layer II.
+    unsigned long long  zeros;          /// zero outputs after ReLU.
+    unsigned long long  blocks;         /// channels of pixel blocks.
+    unsigned long long  skipped;        /// all zero channels of blocks.
+}SRCNNSparsity;
+
+typedef struct DLL_PUBLIC
+{
+    unsigned long long  planes;         /// bytes of large planes allocated.
+    unsigned long long  explicitpages;  /// of them by hugetlbfs pages.
+    unsigned long long  advised;        /// of them advised to be huge.
+    unsigned long long  transparent;    /// of advised, found huge by kernel.
+}SRCNNHugePages;
+
+typedef struct DLL_PUBLIC
+{
+    const unsigned char* refbuff;   /// w x h x depth of call.
+    unsigned             w;
+    unsigned             h;
+    unsigned char*       outbuff;   /// set by ProcessAtlasSRCNN().
+    unsigned             outbuffsz;
+}SRCNNAtlasImage;
+
+// A part of parallel work, submitted to executor of host.
+typedef void (*SRCNNTaskFunc)( void* task );
+
+typedef struct DLL_PUBLIC
+{
+    void*       host;       /// given back to each callback.
+    unsigned    workers;    /// threads of host sharing a loop.
+    void*       (*group)( void* host );
+    void        (*submit)( void* host, void* group,
+                           SRCNNTaskFunc func, void* task );
+    void        (*wait)( void* host, void* group ); /// releases group.
+}SRCNNExecutor;
+
+// Handle of an asynchronous ProcessSRCNN().
+typedef struct SRCNNJobState* SRCNNJob;
+
+// Called by thread of job as it finished, result as ProcessSRCNN() or
+// -4 as cancelled. WaitJobSRCNN() may take outputs in it.
+typedef void (*SRCNNJobFunc)( SRCNNJob job, int result, void* user );
+
 void DLL_PUBLIC ConfigureFilterSRCNN( SRCNNFilterType ftype,
                                       bool stepscale  = false );
 int  DLL_PUBLIC ProcessSRCNN( const unsigned char* refbuff,
@@ -53,4 +129,129 @@ int  DLL_PUBLIC ProcessSRCNN( const unsigned char* refbuff,
                               unsigned char** convbuff,
                               unsigned* convbuffsz);
 
+// Processes count images of same size and depth at once, layers run
+// once for stacked frames ( channels last ), so weights are reused and
+// threads have enough rows for small images.
+// outbuffs[] and outbuffszs[] take count outputs as ProcessSRCNN(),
+// returns 0 or negative error code, then no output remains.
+int  DLL_PUBLIC ProcessBatchSRCNN( const unsigned char** refbuffs,
+                                   unsigned count,
+                                   unsigned w, unsigned h, unsigned d,
+                                   float multiply,
+                                   unsigned char** outbuffs,
+                                   unsigned* outbuffszs );
+
+// Packs images of any size into atlases with gutters, runs layers
+// once for each atlas and scatters results back to outbuff of each
+// image. Gutters repeat edges of each image after every layer, so
+// outputs are same as ProcessSRCNN() for each.
+// returns 0 or negative error code, then no output remains.
+int  DLL_PUBLIC ProcessAtlasSRCNN( SRCNNAtlasImage* images,
+                                   unsigned count, unsigned d,
+                                   float multiply );
+
+// Starts ProcessSRCNN() in a thread of its own with a copy of refbuff,
+// returns NULL for invalid arguments or without a thread. done is
+// called as it finished. Each job goes to WaitJobSRCNN() or
+// ReleaseJobSRCNN() once.
+SRCNNJob DLL_PUBLIC ProcessAsyncSRCNN( const unsigned char* refbuff,
+                                       unsigned w, unsigned h, unsigned d,
+                                       float multiply,
+                                       bool convout = false,
+                                       SRCNNJobFunc done = NULL,
+                                       void* user = NULL );
+// Waits job, takes outputs as ProcessSRCNN() and releases job.
+int  DLL_PUBLIC WaitJobSRCNN( SRCNNJob job,
+                              unsigned char* &outbuff,
+                              unsigned &outbuffsz,
+                              unsigned char** convbuff,
+                              unsigned* convbuffsz );
+// Thousandths of job done, 1000 as finished.
+unsigned DLL_PUBLIC GetJobProgressSRCNN( SRCNNJob job );
+// Job stops at next tile or stage, releases its buffers and its
+// result is -4. Job with its output made already, or finished, keeps
+// its result.
+void DLL_PUBLIC CancelJobSRCNN( SRCNNJob job );
+// Releases job without waiting, cancels it if not finished yet.
+void DLL_PUBLIC ReleaseJobSRCNN( SRCNNJob job );
+
+// Adds per filter activation energy of first layer into energy[],
+// call it for each image of corpus, returns count of filters.
+int  DLL_PUBLIC AnalyzeFiltersSRCNN( const unsigned char* refbuff,
+                                     unsigned w, unsigned h, unsigned d,
+                                     float multiply,
+                                     double* energy,
+                                     unsigned energysz );
+// Skips listed first layer filters ( and its second layer columns ),
+// NULL to restore all, returns count of remained filters or 0 as error.
+unsigned DLL_PUBLIC ConfigurePruneSRCNN( const unsigned* filters,
+                                         unsigned count );
+// Skips zero activations of layer I in layer II, enabled as default.
+void DLL_PUBLIC ConfigureSparseSRCNN( bool enabled = true );
+// Gets observed sparsity of last ProcessSRCNN() of calling thread
+// with sparse layer II.
+void DLL_PUBLIC GetSparsitySRCNN( SRCNNSparsity* sparsity );
+// Layer I takes source Y with resizing filter composited kernels
+// for integer multiply, instead of resized Y.
+void DLL_PUBLIC ConfigureCompositeSRCNN( bool enabled = true );
+// Maps a SRCNN model file ( see srcnnmodel.h ), nearest trained scale
+// is chosen for each multiply, returns 0 or negative error code.
+// Model of same scale replaced while calls or jobs use it stays mapped
+// until they end.
+int  DLL_PUBLIC LoadModelSRCNN( const char* path );
+// Unmaps all loaded models, compiled in model remains, models of calls
+// or jobs running are unmapped as they end.
+void DLL_PUBLIC UnloadModelsSRCNN();
+// Writes compiled in 9-1-5 model as a model file.
+int  DLL_PUBLIC ExportModelSRCNN( const char* path );
+// Selects network, SRCNNE_ESPCN runs its layers at source size and
+// shuffles sub-pixels at last, with bundled x2, x3 and x4 weights.
+void DLL_PUBLIC ConfigureEngineSRCNN( SRCNNEngineType etype );
+// Activations of a pixel laid next to each other ( channels last ),
+// for compiled in model, enabled as default.
+void DLL_PUBLIC ConfigureInterleaveSRCNN( bool enabled = true );
+// Layer I and II run separated ( faster ) or fused ( less memory ),
+// SRCNNL_Auto chooses by size of image and available memory.
+void DLL_PUBLIC ConfigureLayersSRCNN( SRCNNLayersType ltype = SRCNNL_Auto );
+// Parallel loops ( and side lane of stages ) run as tasks of executor
+// of host application, instead of OpenMP or internal threads. group()
+// makes a wait group, wait() returns after all tasks submitted to it
+// finished, tasks never wait for others. Calling thread runs a share.
+// NULL restores internal threads, never changed while processing.
+void DLL_PUBLIC ConfigureExecutorSRCNN( const SRCNNExecutor* executor );
+// Limits threads of each parallel loop, 0 for default, CPUs of cpuset
+// and quota of cgroup ( or OMP_NUM_THREADS ). callingthread limits only
+// calls from this thread, over the limit of all.
+void DLL_PUBLIC ConfigureThreadsSRCNN( unsigned maximum,
+                                       bool callingthread = false );
+// SRCNNP_Latency gives all threads to each call ( default ).
+// SRCNNP_Throughput runs each call in its calling thread only, for
+// concurrent calls, and ProcessBatchSRCNN() runs an image per thread.
+// SRCNNP_Auto shares threads among concurrent calls, and a batch of
+// images enough for every thread goes an image per thread.
+void DLL_PUBLIC ConfigurePolicySRCNN( SRCNNPolicyType ptype );
+// Ceiling of bytes of working sets of all running calls, 0 for 3/4 of
+// available memory ( of memory cgroup too ) while nothing runs. A call
+// over what is left waits for others in order, or runs its layers by
+// bands of rows, and returns -5 if it never fits even alone.
+void DLL_PUBLIC ConfigureMemorySRCNN( unsigned long long ceiling = 0 );
+// Places threads of loops on NUMA nodes, pinned for each call, rows of
+// large planes first touched by threads of their node and kept there
+// by static loops through all layers. Returns count of nodes, 0 for a
+// single node ( SRCNN_NUMA_NODES=(count) emulates nodes ) or disabled.
+// Internal threads only, never changed while processing.
+unsigned DLL_PUBLIC ConfigureNumaSRCNN( bool enabled = true );
+// Large planes of layers mapped for huge pages, SRCNNH_Transparent
+// advises transparent huge pages ( default ), SRCNNH_Explicit takes
+// hugetlbfs pages ( vm.nr_hugepages ) first. Each falls back to next
+// one, and to normal pages at last. Freed ones are kept for next planes
+// while calls run, within memory left under ceiling of working sets,
+// and never while placed on NUMA nodes.
+void DLL_PUBLIC ConfigureHugePagesSRCNN( SRCNNHugePagesType htype );
+// Gets bytes of large planes by pages backing them, counted since
+// start or last reset. Transparent ones are read from /proc/self/smaps
+// as asked, and as calls end from first call of this on, so call this
+// once before calls to have them all.
+void DLL_PUBLIC GetHugePagesSRCNN( SRCNNHugePages* stat, bool reset = false );
+
 #endif /// of __SRCNN_H__
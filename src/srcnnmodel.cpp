@@ -0,0 +1,498 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <mutex>
+#include <map>
+#include <vector>
+
+#if defined(_WIN32) || defined(WIN32)
+    #include <windows.h>
+#else
+    #include <sys/types.h>
+    #include <sys/stat.h>
+    #include <sys/mman.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#include "srcnnmodel.h"
+#include "minmax.h"
+
+/* pre-calculated convolutional data */
+#include "convdata.h"
+#include "convpack.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace libsrcnn {
+
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    char        magic[4];
+    uint32_t    version;
+    uint32_t    scale;
+    uint32_t    f1;
+    uint32_t    n1;
+    uint32_t    f2;
+    uint32_t    n2;
+    uint32_t    f3;
+    uint32_t    reserved[8];
+}ModelFileHeader;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static SRCNNModel*                          loaded_models[MODEL_MAX_LOADED] = {NULL};
+static std::mutex                           models_lock;
+static std::map<const SRCNNModel*,unsigned> models_pins;
+static std::vector<SRCNNModel*>             models_retired;
+
+////////////////////////////////////////////////////////////////////////////////
+
+size_t modelFloats( unsigned f1, unsigned n1, unsigned f2, unsigned n2, unsigned f3 )
+{
+    return ( (size_t)n1 * f1 * f1 ) + n1
+           + ( (size_t)n2 * n1 * f2 * f2 ) + n2
+           + ( (size_t)n2 * f3 * f3 ) + 1;
+}
+
+bool validKernel( uint32_t ksz )
+{
+    return ( ksz > 0 ) && ( ksz <= MODEL_MAX_KERNEL ) && ( ( ksz & 1 ) == 1 );
+}
+
+bool validFilters( uint32_t cnt )
+{
+    return ( cnt > 0 ) && ( cnt <= MODEL_MAX_FILTERS );
+}
+
+void unmapFile( void* mapped, size_t mappedsz )
+{
+#if defined(_WIN32) || defined(WIN32)
+    UnmapViewOfFile( mapped );
+#else
+    munmap( mapped, mappedsz );
+#endif
+}
+
+// panels of compiled in model, made by compiler.
+static constexpr ConvPanel<CONV1_FILTERS,9> \
+    packed_conv1 = packFilterPanel( weights_conv1_data );
+static constexpr ConvMatrix<CONV1_FILTERS,CONV2_FILTERS> \
+    packed_conv2 = packTransposed( weights_conv2_data );
+// layer III of convdata.h is ordered [column][row].
+static constexpr ConvMatrix<CONV2_FILTERS,25> \
+    packed_conv3 = packKernelsRowMajor( weights_conv3_data );
+static constexpr ConvPanel<CONV2_FILTERS,5> \
+    panel_conv3 = packFilterPanelCM( weights_conv3_data );
+
+static const SRCNNModel builtin_model = \
+{
+    0, 9, 1, 5, CONV1_FILTERS, CONV2_FILTERS,
+    &weights_conv1_data[0][0][0], biases_conv1,
+    &weights_conv2_data[0][0], biases_conv2,
+    packed_conv3.data, &biases_conv3,
+    packed_conv1.data, packed_conv2.data, panel_conv3.data,
+    NULL, 0
+};
+
+const SRCNNModel* builtinModel()
+{
+    return &builtin_model;
+}
+
+int loadModel( const char* path, SRCNNModel* &model )
+{
+    model = NULL;
+
+    if ( path == NULL )
+        return -1;
+
+    // model file is little endian.
+    const uint32_t endian = 1;
+    if ( *(const uint8_t*)&endian != 1 )
+        return -2;
+
+    void*  mapped   = NULL;
+    size_t mappedsz = 0;
+
+#if defined(_WIN32) || defined(WIN32)
+    HANDLE hFile = CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+    if ( hFile == INVALID_HANDLE_VALUE )
+        return -3;
+
+    LARGE_INTEGER fsz;
+    if ( GetFileSizeEx( hFile, &fsz ) == FALSE )
+    {
+        CloseHandle( hFile );
+        return -3;
+    }
+
+    mappedsz = (size_t)fsz.QuadPart;
+
+    // too short for a header, same error on every platform.
+    if ( mappedsz < MODEL_FILE_HEADER_SIZE )
+    {
+        CloseHandle( hFile );
+        return -5;
+    }
+
+    HANDLE hMap = CreateFileMappingA( hFile, NULL, PAGE_READONLY, 0, 0, NULL );
+    if ( hMap != NULL )
+    {
+        mapped = MapViewOfFile( hMap, FILE_MAP_READ, 0, 0, 0 );
+        CloseHandle( hMap );
+    }
+
+    CloseHandle( hFile );
+#else
+    int fd = open( path, O_RDONLY );
+    if ( fd < 0 )
+        return -3;
+
+    struct stat st;
+    if ( fstat( fd, &st ) != 0 )
+    {
+        close( fd );
+        return -3;
+    }
+
+    mappedsz = (size_t)st.st_size;
+
+    // too short for a header, same error on every platform.
+    if ( mappedsz < MODEL_FILE_HEADER_SIZE )
+    {
+        close( fd );
+        return -5;
+    }
+
+    // shared read only pages, other processes use same pages.
+    mapped = mmap( NULL, mappedsz, PROT_READ, MAP_SHARED, fd, 0 );
+    if ( mapped == MAP_FAILED )
+    {
+        mapped = NULL;
+    }
+
+    close( fd );
+#endif
+
+    if ( mapped == NULL )
+        return -4;
+
+    SRCNNModel tmpmdl;
+    memset( &tmpmdl, 0, sizeof( SRCNNModel ) );
+
+    tmpmdl.mapped   = mapped;
+    tmpmdl.mappedsz = mappedsz;
+
+    const ModelFileHeader* hdr = (const ModelFileHeader*)mapped;
+
+    int retval = 0;
+
+    if ( memcmp( hdr->magic, MODEL_FILE_MAGIC, 4 ) != 0 )
+    {
+        retval = -5;
+    }
+    else
+    if ( hdr->version != MODEL_FILE_VERSION )
+    {
+        retval = -6;
+    }
+    else
+    if ( ( validKernel( hdr->f1 ) == false ) || ( validKernel( hdr->f2 ) == false )
+         || ( validKernel( hdr->f3 ) == false ) || ( validFilters( hdr->n1 ) == false )
+         || ( validFilters( hdr->n2 ) == false ) )
+    {
+        retval = -7;
+    }
+    else
+    {
+        size_t fcnt = modelFloats( hdr->f1, hdr->n1, hdr->f2, hdr->n2, hdr->f3 );
+
+        if ( mappedsz != MODEL_FILE_HEADER_SIZE + fcnt * sizeof( float ) )
+        {
+            retval = -8;
+        }
+        else
+        {
+            const float* fptr = (const float*)( (const uint8_t*)mapped
+                                                + MODEL_FILE_HEADER_SIZE );
+
+            for ( size_t cnt=0; cnt<fcnt; cnt++ )
+            {
+                if ( std::isfinite( fptr[cnt] ) == false )
+                {
+                    retval = -9;
+                    break;
+                }
+            }
+
+            tmpmdl.scale    = hdr->scale;
+            tmpmdl.f1       = hdr->f1;
+            tmpmdl.n1       = hdr->n1;
+            tmpmdl.f2       = hdr->f2;
+            tmpmdl.n2       = hdr->n2;
+            tmpmdl.f3       = hdr->f3;
+            tmpmdl.weights1 = fptr;
+            tmpmdl.biases1  = tmpmdl.weights1 + ( tmpmdl.n1 * tmpmdl.f1 * tmpmdl.f1 );
+            tmpmdl.weights2 = tmpmdl.biases1  + tmpmdl.n1;
+            tmpmdl.biases2  = tmpmdl.weights2 + ( tmpmdl.n2 * tmpmdl.n1 * tmpmdl.f2 * tmpmdl.f2 );
+            tmpmdl.weights3 = tmpmdl.biases2  + tmpmdl.n2;
+            tmpmdl.biases3  = tmpmdl.weights3 + ( tmpmdl.n2 * tmpmdl.f3 * tmpmdl.f3 );
+        }
+    }
+
+    if ( retval != 0 )
+    {
+        unmapFile( mapped, mappedsz );
+        return retval;
+    }
+
+    model = new SRCNNModel( tmpmdl );
+
+    return 0;
+}
+
+void unloadModel( SRCNNModel* &model )
+{
+    if ( model == NULL )
+        return;
+
+    if ( model->mapped != NULL )
+    {
+        unmapFile( model->mapped, model->mappedsz );
+    }
+
+    delete model;
+    model = NULL;
+}
+
+int saveModel( const SRCNNModel* model, const char* path )
+{
+    if ( ( model == NULL ) || ( path == NULL ) )
+        return -1;
+
+    ModelFileHeader hdr;
+    memset( &hdr, 0, sizeof( ModelFileHeader ) );
+
+    memcpy( hdr.magic, MODEL_FILE_MAGIC, 4 );
+    hdr.version = MODEL_FILE_VERSION;
+    hdr.scale   = model->scale;
+    hdr.f1      = model->f1;
+    hdr.n1      = model->n1;
+    hdr.f2      = model->f2;
+    hdr.n2      = model->n2;
+    hdr.f3      = model->f3;
+
+    FILE* fp = fopen( path, "wb" );
+    if ( fp == NULL )
+        return -3;
+
+    const float* arrays[6] = { model->weights1, model->biases1,
+                               model->weights2, model->biases2,
+                               model->weights3, model->biases3 };
+    size_t       counts[6] = { (size_t)model->n1 * model->f1 * model->f1,
+                               model->n1,
+                               (size_t)model->n2 * model->n1 * model->f2 * model->f2,
+                               model->n2,
+                               (size_t)model->n2 * model->f3 * model->f3,
+                               1 };
+
+    int retval = 0;
+
+    if ( fwrite( &hdr, sizeof( ModelFileHeader ), 1, fp ) != 1 )
+    {
+        retval = -4;
+    }
+
+    for ( unsigned cnt=0; ( cnt<6 ) && ( retval == 0 ); cnt++ )
+    {
+        if ( fwrite( arrays[cnt], sizeof( float ), counts[cnt], fp ) != counts[cnt] )
+        {
+            retval = -4;
+        }
+    }
+
+    fclose( fp );
+
+    return retval;
+}
+
+// unloads model out of registry, or keeps it for calls pinning it.
+// models_lock is held.
+static void retireModel( SRCNNModel* &model )
+{
+    if ( model == NULL )
+        return;
+
+    std::map<const SRCNNModel*,unsigned>::iterator it = models_pins.find( model );
+
+    if ( it != models_pins.end() )
+    {
+        models_retired.push_back( model );
+        model = NULL;
+        return;
+    }
+
+    unloadModel( model );
+}
+
+int registerModel( SRCNNModel* model )
+{
+    if ( model == NULL )
+        return -1;
+
+    std::lock_guard<std::mutex> guard( models_lock );
+
+    // a model for each scale, replaces same scale.
+    for ( unsigned cnt=0; cnt<MODEL_MAX_LOADED; cnt++ )
+    {
+        if ( ( loaded_models[cnt] != NULL )
+             && ( loaded_models[cnt]->scale == model->scale ) )
+        {
+            retireModel( loaded_models[cnt] );
+            loaded_models[cnt] = model;
+            return 0;
+        }
+    }
+
+    for ( unsigned cnt=0; cnt<MODEL_MAX_LOADED; cnt++ )
+    {
+        if ( loaded_models[cnt] == NULL )
+        {
+            loaded_models[cnt] = model;
+            return 0;
+        }
+    }
+
+    return -10;
+}
+
+void clearModels()
+{
+    std::lock_guard<std::mutex> guard( models_lock );
+
+    for ( unsigned cnt=0; cnt<MODEL_MAX_LOADED; cnt++ )
+    {
+        retireModel( loaded_models[cnt] );
+    }
+}
+
+// models_lock is held.
+static const SRCNNModel* selectModel( float multiply )
+{
+    const SRCNNModel* selected = NULL;
+    const SRCNNModel* anyscale = NULL;
+    float             mindiff  = 0.f;
+
+    // nearest trained scale wins, model for any scale comes next.
+    for ( unsigned cnt=0; cnt<MODEL_MAX_LOADED; cnt++ )
+    {
+        const SRCNNModel* model = loaded_models[cnt];
+
+        if ( model == NULL )
+            continue;
+
+        if ( model->scale == 0 )
+        {
+            anyscale = model;
+            continue;
+        }
+
+        float diff = fabsf( (float)model->scale - multiply );
+
+        if ( ( selected == NULL ) || ( diff < mindiff )
+             || ( ( diff == mindiff ) && ( model->scale > selected->scale ) ) )
+        {
+            selected = model;
+            mindiff  = diff;
+        }
+    }
+
+    if ( selected != NULL )
+        return selected;
+
+    if ( anyscale != NULL )
+        return anyscale;
+
+    return builtinModel();
+}
+
+const SRCNNModel* pinModel( float multiply )
+{
+    std::lock_guard<std::mutex> guard( models_lock );
+
+    const SRCNNModel* model = selectModel( multiply );
+
+    // compiled in model never goes.
+    if ( model != builtinModel() )
+    {
+        models_pins[ model ]++;
+    }
+
+    return model;
+}
+
+void unpinModel( const SRCNNModel* model )
+{
+    if ( ( model == NULL ) || ( model == builtinModel() ) )
+        return;
+
+    std::lock_guard<std::mutex> guard( models_lock );
+
+    std::map<const SRCNNModel*,unsigned>::iterator it = models_pins.find( model );
+
+    if ( it == models_pins.end() )
+        return;
+
+    if ( --it->second > 0 )
+        return;
+
+    models_pins.erase( it );
+
+    // replaced or cleared while in use, last call unloads it.
+    for ( size_t cnt=0; cnt<models_retired.size(); cnt++ )
+    {
+        if ( models_retired[cnt] == model )
+        {
+            unloadModel( models_retired[cnt] );
+            models_retired.erase( models_retired.begin() + cnt );
+            break;
+        }
+    }
+}
+
+ModelScope::ModelScope( float multiply )
+ :  model( pinModel( multiply ) )
+{
+}
+
+ModelScope::~ModelScope()
+{
+    unpinModel( model );
+}
+
+unsigned maxFilters()
+{
+    std::lock_guard<std::mutex> guard( models_lock );
+
+    unsigned maxn = builtinModel()->n1;
+
+    for ( unsigned cnt=0; cnt<MODEL_MAX_LOADED; cnt++ )
+    {
+        if ( loaded_models[cnt] != NULL )
+        {
+            maxn = MAX( maxn, loaded_models[cnt]->n1 );
+        }
+    }
+
+    return maxn;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}; /// of namespace libsrcnn
@@ -0,0 +1,93 @@
+#ifndef __SRCNNMODEL_H__
+#define __SRCNNMODEL_H__
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// SRCNN model weights, compiled in or memory mapped from model file.
+//
+// * Model file layout ( little endian ) *
+//
+//   offset  size   contents
+//   ------  -----  ---------------------------------------------------------
+//        0      4  magic "SRCN"
+//        4      4  version ( 1 )
+//        8      4  trained scale ( 2, 3, 4 ... or 0 for any )
+//       12     20  f1, n1, f2, n2, f3 ( kernel size and filters of layers )
+//       32     32  reserved, zero.
+//       64    ...  float32 arrays, in order of :
+//                    weights1 [n1][f1][f1]
+//                    biases1  [n1]
+//                    weights2 [n2][n1][f2][f2]
+//                    biases2  [n2]
+//                    weights3 [n2][f3][f3]
+//                    biases3  [1]
+//
+//  Kernels are ordered [row][column] of its window.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+
+#define MODEL_FILE_MAGIC        "SRCN"
+#define MODEL_FILE_VERSION      1
+#define MODEL_FILE_HEADER_SIZE  64
+
+// limits of shapes to be accepted.
+#define MODEL_MAX_FILTERS       256
+#define MODEL_MAX_KERNEL        13
+#define MODEL_MAX_LOADED        8
+
+namespace libsrcnn {
+
+typedef struct
+{
+    unsigned        scale;      /// trained scale, 0 for any.
+    unsigned        f1;         /// kernel size of layer I, II and III.
+    unsigned        f2;
+    unsigned        f3;
+    unsigned        n1;         /// filters of layer I and II.
+    unsigned        n2;
+    const float*    weights1;
+    const float*    biases1;
+    const float*    weights2;
+    const float*    biases2;
+    const float*    weights3;
+    const float*    biases3;
+    const float*    packed1;    /// [f1][f1][n1] panel of layer I, or NULL.
+    const float*    packed2;    /// [n1][n2] panel of 1x1 layer II, or NULL.
+    const float*    packed3;    /// [f3][f3][n2] panel of layer III, or NULL.
+    void*           mapped;     /// NULL for compiled in model.
+    size_t          mappedsz;
+}SRCNNModel;
+
+const SRCNNModel* builtinModel();
+
+// returns 0 or negative error code.
+int  loadModel( const char* path, SRCNNModel* &model );
+void unloadModel( SRCNNModel* &model );
+int  saveModel( const SRCNNModel* model, const char* path );
+
+// registry of loaded models by its scale, a model replaced or cleared
+// while pinned by a call is unloaded as last call unpins it.
+int  registerModel( SRCNNModel* model );
+void clearModels();
+// model for multiply, pinned until unpinModel().
+const SRCNNModel* pinModel( float multiply );
+void unpinModel( const SRCNNModel* model );
+// largest layer I filters of compiled in and loaded models.
+unsigned maxFilters();
+
+// model selected for a call, pinned while in scope.
+class ModelScope
+{
+    public:
+        ModelScope( float multiply );
+        ~ModelScope();
+
+    public:
+        const SRCNNModel*   model;
+};
+
+}; /// of namespace libsrcnn
+
+#endif /// of __SRCNNMODEL_H__
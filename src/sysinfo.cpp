@@ -0,0 +1,441 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(_WIN32) || defined(WIN32)
+    #include <windows.h>
+#else
+    #include <unistd.h>
+#endif
+
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+#include "sysinfo.h"
+#include "minmax.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace libsrcnn {
+
+////////////////////////////////////////////////////////////////////////////////
+
+#define SYSINFO_UNLIMITED       0xFFFFFFFFFFFFFFFFULL
+// v1 reports no limit as a huge page aligned number.
+#define SYSINFO_V1_UNLIMITED    ( 1ULL << 62 )
+
+typedef unsigned long long (*CgroupLimitFunc)( const std::string &dir, bool v2 );
+
+// prefix of /proc and /sys paths, empty for real ones.
+static std::string sys_root;
+
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__linux__)
+static bool readValueFile( const std::string &path, unsigned long long &value )
+{
+    FILE* fp = fopen( path.c_str(), "r" );
+
+    if ( fp == NULL )
+        return false;
+
+    char strtmp[64] = {0};
+    bool retval     = ( fgets( strtmp, 64, fp ) != NULL );
+
+    fclose( fp );
+
+    if ( retval == true )
+    {
+        if ( strncmp( strtmp, "max", 3 ) == 0 )
+        {
+            value = SYSINFO_UNLIMITED;
+        }
+        else
+        {
+            value = strtoull( strtmp, NULL, 10 );
+        }
+    }
+
+    return retval;
+}
+
+static unsigned long long headroomOf( const std::string &dir,
+                                      const char* limitnm, const char* usagenm )
+{
+    unsigned long long limit = 0;
+    unsigned long long usage = 0;
+
+    if ( ( readValueFile( dir + limitnm, limit ) == false )
+         || ( limit >= SYSINFO_V1_UNLIMITED ) )
+        return SYSINFO_UNLIMITED;
+
+    if ( readValueFile( dir + usagenm, usage ) == false )
+        usage = 0;
+
+    return ( limit > usage ) ? limit - usage : 0;
+}
+
+static unsigned long long memoryHeadroomOf( const std::string &dir, bool v2 )
+{
+    if ( v2 == true )
+        return headroomOf( dir, "/memory.max", "/memory.current" );
+
+    return headroomOf( dir, "/memory.limit_in_bytes", "/memory.usage_in_bytes" );
+}
+
+// thousandths of CPU by quota over period.
+static unsigned long long cpuQuotaOf( const std::string &dir, bool v2 )
+{
+    long long quota  = -1;
+    long long period = 0;
+
+    if ( v2 == true )
+    {
+        // "max 100000" or "400000 100000"
+        FILE* fp = fopen( ( dir + "/cpu.max" ).c_str(), "r" );
+
+        if ( fp == NULL )
+            return SYSINFO_UNLIMITED;
+
+        char strtmp[64] = {0};
+
+        if ( fscanf( fp, "%63s %lld", strtmp, &period ) == 2 )
+        {
+            if ( strcmp( strtmp, "max" ) != 0 )
+            {
+                quota = strtoll( strtmp, NULL, 10 );
+            }
+        }
+
+        fclose( fp );
+    }
+    else
+    {
+        unsigned long long value = 0;
+
+        // no quota as -1, read as huge number.
+        if ( readValueFile( dir + "/cpu.cfs_quota_us", value ) == true )
+            quota = (long long)value;
+
+        if ( readValueFile( dir + "/cpu.cfs_period_us", value ) == true )
+            period = (long long)value;
+    }
+
+    if ( ( quota <= 0 ) || ( period <= 0 ) )
+        return SYSINFO_UNLIMITED;
+
+    return (unsigned long long)quota * 1000ULL / (unsigned long long)period;
+}
+
+// smallest limit of cgroups of this process, v2 ancestors or v1 controller.
+static unsigned long long cgroupMinimum( const char* v1ctrl, const char* v1file,
+                                         CgroupLimitFunc limitof )
+{
+    FILE* fp = fopen( ( sys_root + "/proc/self/cgroup" ).c_str(), "r" );
+
+    if ( fp == NULL )
+        return SYSINFO_UNLIMITED;
+
+    unsigned long long minimum = SYSINFO_UNLIMITED;
+    char               line[1024] = {0};
+    std::string        v1name = std::string( "," ) + v1ctrl + ",";
+    std::string        v2root = sys_root + "/sys/fs/cgroup";
+
+    while( fgets( line, 1024, fp ) != NULL )
+    {
+        std::string strline = line;
+
+        while( ( strline.size() > 0 ) && ( strline[ strline.size() - 1 ] == '\n' ) )
+        {
+            strline.erase( strline.size() - 1 );
+        }
+
+        // hierarchy-id:controllers:path
+        size_t p1 = strline.find( ':' );
+        size_t p2 = ( p1 != std::string::npos ) ? strline.find( ':', p1 + 1 ) : p1;
+
+        if ( p2 == std::string::npos )
+            continue;
+
+        std::string ctrls = "," + strline.substr( p1 + 1, p2 - p1 - 1 ) + ",";
+        std::string path  = strline.substr( p2 + 1 );
+
+        if ( strline.find( "0::" ) == 0 )
+        {
+            // v2, limits of ancestors applied too.
+            while( ( path.size() > 1 ) && ( path != "/" ) )
+            {
+                minimum = MIN( minimum, limitof( v2root + path, true ) );
+
+                path.erase( path.rfind( '/' ) );
+            }
+
+            // root of cgroup namespace ( "0::/" in a container ) has
+            // limits of container, real root has no limit files.
+            minimum = MIN( minimum, limitof( v2root, true ) );
+        }
+        else
+        if ( ctrls.find( v1name ) != std::string::npos )
+        {
+            std::string root = sys_root + "/sys/fs/cgroup/" + v1ctrl;
+            std::string dir  = root + path;
+            unsigned long long value = 0;
+
+            // path of other namespace is not there, then our own root.
+            if ( readValueFile( dir + v1file, value ) == false )
+            {
+                dir = root;
+            }
+
+            minimum = MIN( minimum, limitof( dir, false ) );
+        }
+    }
+
+    fclose( fp );
+
+    return minimum;
+}
+
+unsigned long long cgroupHeadroom()
+{
+    return cgroupMinimum( "memory", "/memory.limit_in_bytes", memoryHeadroomOf );
+}
+
+unsigned long long cgroupCpuQuota()
+{
+    return cgroupMinimum( "cpu", "/cpu.cfs_quota_us", cpuQuotaOf );
+}
+
+static unsigned long long memInfoAvailable()
+{
+    FILE* fp = fopen( ( sys_root + "/proc/meminfo" ).c_str(), "r" );
+
+    if ( fp == NULL )
+        return 0;
+
+    unsigned long long memfree  = 0;
+    unsigned long long memavail = 0;
+    char               line[256] = {0};
+
+    while( fgets( line, 256, fp ) != NULL )
+    {
+        if ( strncmp( line, "MemAvailable:", 13 ) == 0 )
+        {
+            memavail = strtoull( &line[13], NULL, 10 ) * 1024ULL;
+        }
+        else
+        if ( strncmp( line, "MemFree:", 8 ) == 0 )
+        {
+            memfree = strtoull( &line[8], NULL, 10 ) * 1024ULL;
+        }
+    }
+
+    fclose( fp );
+
+    // old kernels have no MemAvailable.
+    return ( memavail > 0 ) ? memavail : memfree;
+}
+
+// "0-3,8-11" of cpulist marks node of each CPU listed.
+static void readNodeCpuList( const std::string &path, unsigned node,
+                             unsigned* cpunodes, unsigned size )
+{
+    FILE* fp = fopen( path.c_str(), "r" );
+
+    if ( fp == NULL )
+        return;
+
+    char line[1024] = {0};
+
+    if ( fgets( line, 1024, fp ) != NULL )
+    {
+        char* pos = line;
+
+        while( ( *pos >= '0' ) && ( *pos <= '9' ) )
+        {
+            unsigned first = strtoul( pos, &pos, 10 );
+            unsigned last  = first;
+
+            if ( *pos == '-' )
+            {
+                last = strtoul( pos + 1, &pos, 10 );
+            }
+
+            for ( unsigned cpu=first; ( cpu<=last ) && ( cpu<size ); cpu++ )
+            {
+                cpunodes[cpu] = node;
+            }
+
+            if ( *pos == ',' )
+                pos++;
+        }
+    }
+
+    fclose( fp );
+}
+#endif /// of __linux__
+
+void sysinfoRoot( const char* root )
+{
+    sys_root = ( root != NULL ) ? root : "";
+}
+
+unsigned long long availableMemorySize()
+{
+#if defined(_WIN32) || defined(WIN32)
+    MEMORYSTATUSEX mstat;
+    memset( &mstat, 0, sizeof( MEMORYSTATUSEX ) );
+    mstat.dwLength = sizeof( MEMORYSTATUSEX );
+
+    if ( GlobalMemoryStatusEx( &mstat ) == FALSE )
+        return 0;
+
+    return mstat.ullAvailPhys;
+#elif defined(__linux__)
+    unsigned long long avail    = memInfoAvailable();
+    unsigned long long headroom = cgroupHeadroom();
+
+    if ( avail == 0 )
+    {
+        return ( headroom != SYSINFO_UNLIMITED ) ? headroom : 0;
+    }
+
+    return MIN( avail, headroom );
+#elif defined(_SC_AVPHYS_PAGES)
+    long pages  = sysconf( _SC_AVPHYS_PAGES );
+    long pagesz = sysconf( _SC_PAGESIZE );
+
+    if ( ( pages <= 0 ) || ( pagesz <= 0 ) )
+        return 0;
+
+    return (unsigned long long)pages * pagesz;
+#else
+    return 0;
+#endif
+}
+
+unsigned availableCpuCount()
+{
+#if defined(_WIN32) || defined(WIN32)
+    SYSTEM_INFO sinfo;
+    memset( &sinfo, 0, sizeof( SYSTEM_INFO ) );
+    GetSystemInfo( &sinfo );
+
+    return sinfo.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long cpus = sysconf( _SC_NPROCESSORS_ONLN );
+
+    if ( cpus <= 0 )
+        return 0;
+
+    #if defined(__linux__)
+    // cpuset of cgroup reaches here as affinity.
+    cpu_set_t cpuset;
+    CPU_ZERO( &cpuset );
+
+    if ( sched_getaffinity( 0, sizeof( cpu_set_t ), &cpuset ) == 0 )
+    {
+        long allowed = CPU_COUNT( &cpuset );
+
+        if ( allowed > 0 )
+            cpus = MIN( cpus, allowed );
+    }
+
+    unsigned long long quota = cgroupCpuQuota();
+
+    if ( quota != SYSINFO_UNLIMITED )
+    {
+        // partial CPU still takes a thread.
+        long qcpus = (long)( ( quota + 999 ) / 1000 );
+
+        cpus = MIN( cpus, MAX( qcpus, 1L ) );
+    }
+    #endif /// of __linux__
+
+    return (unsigned)cpus;
+#else
+    return 0;
+#endif
+}
+
+unsigned numaCpuNodes( unsigned* cpus, unsigned* nodes, unsigned size )
+{
+#if defined(__linux__)
+    cpu_set_t cpuset;
+    CPU_ZERO( &cpuset );
+
+    if ( sched_getaffinity( 0, sizeof( cpu_set_t ), &cpuset ) != 0 )
+        return 0;
+
+    unsigned cpunodes[CPU_SETSIZE] = {0};
+
+    // node directories may skip numbers, offline nodes.
+    for ( unsigned node=0; node<CPU_SETSIZE; node++ )
+    {
+        char path[64] = {0};
+        snprintf( path, 64, "/sys/devices/system/node/node%u/cpulist", node );
+
+        readNodeCpuList( path, node, cpunodes, CPU_SETSIZE );
+    }
+
+    unsigned count = 0;
+
+    for ( unsigned cpu=0; ( cpu<CPU_SETSIZE ) && ( count<size ); cpu++ )
+    {
+        if ( CPU_ISSET( cpu, &cpuset ) == 0 )
+            continue;
+
+        cpus[count]  = cpu;
+        nodes[count] = cpunodes[cpu];
+        count++;
+    }
+
+    const char* env  = getenv( "SRCNN_NUMA_NODES" );
+    unsigned    fake = ( env != NULL ) ? strtoul( env, NULL, 10 ) : 0;
+
+    if ( ( fake > 0 ) && ( count > 0 ) )
+    {
+        // fewer CPUs than nodes, nodes share CPUs.
+        for ( unsigned cnt=count; ( cnt<fake ) && ( cnt<size ); cnt++ )
+        {
+            cpus[cnt] = cpus[ cnt % count ];
+        }
+
+        count = MAX( count, MIN( fake, size ) );
+        fake  = MIN( fake, count );
+
+        for ( unsigned cnt=0; cnt<count; cnt++ )
+        {
+            nodes[cnt] = cnt * fake / count;
+        }
+
+        return count;
+    }
+
+    // insertion sort by node, CPUs of a node stay in order.
+    for ( unsigned cnt=1; cnt<count; cnt++ )
+    {
+        unsigned cpu  = cpus[cnt];
+        unsigned node = nodes[cnt];
+        unsigned pos  = cnt;
+
+        while( ( pos > 0 ) && ( nodes[ pos - 1 ] > node ) )
+        {
+            cpus[pos]  = cpus[ pos - 1 ];
+            nodes[pos] = nodes[ pos - 1 ];
+            pos--;
+        }
+
+        cpus[pos]  = cpu;
+        nodes[pos] = node;
+    }
+
+    return count;
+#else
+    return 0;
+#endif /// of __linux__
+}
+
+}; /// of namespace libsrcnn
@@ -0,0 +1,41 @@
+#ifndef __SYSINFO_H__
+#define __SYSINFO_H__
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Resources of system seen by this process.
+//
+// Memory is the smaller of free memory of system and headroom of memory
+// cgroup ( v2 memory.max, or v1 memory.limit_in_bytes ) of this process,
+// so a container limit is honored as well as host memory.
+// CPUs are the fewer of affinity ( cpuset ) and quota of cpu cgroup
+// ( v2 cpu.max, or v1 cpu.cfs_quota_us ) of this process.
+// NUMA nodes of CPUs come from /sys/devices/system/node, and
+// SRCNN_NUMA_NODES=(count) splits CPUs into even nodes instead, so
+// placement may be tested on a single node machine.
+// sysinfoRoot() prefixes /proc and /sys paths of cgroups and memory, so
+// tests read a tree of files made up as a container would show.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+namespace libsrcnn {
+
+// prefix of /proc and /sys paths read, NULL for real ones.
+void     sysinfoRoot( const char* root );
+#if defined(__linux__)
+// headroom of memory cgroups in bytes, thousandths of CPU by quota of
+// cpu cgroups, 0xFFFFFFFFFFFFFFFF for no limit.
+unsigned long long cgroupHeadroom();
+unsigned long long cgroupCpuQuota();
+#endif /// of __linux__
+// bytes of memory available to this process, 0 if unknown.
+unsigned long long availableMemorySize();
+// CPUs this process may keep busy, 0 if unknown.
+unsigned availableCpuCount();
+// CPUs of affinity ordered by node, nodes[] takes node of each,
+// returns count of CPUs filled, 0 if unknown.
+unsigned numaCpuNodes( unsigned* cpus, unsigned* nodes, unsigned size );
+
+}; /// of namespace libsrcnn
+
+#endif /// of __SYSINFO_H__
@@ -0,0 +1,187 @@
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <system_error>
+
+#include "taskgraph.h"
+#include "threadpool.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace libsrcnn {
+
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    std::mutex              lock;
+    std::condition_variable cond;
+}TaskSync;
+
+////////////////////////////////////////////////////////////////////////////////
+
+TaskGraph::TaskGraph()
+ : sync( new TaskSync )
+{
+}
+
+TaskGraph::~TaskGraph()
+{
+    delete (TaskSync*)sync;
+}
+
+unsigned TaskGraph::add( TaskFunc func, void* param, TaskLane lane,
+                         const unsigned* deps, unsigned depsz )
+{
+    Task task;
+    task.func  = func;
+    task.param = param;
+    task.lane  = lane;
+
+    for ( unsigned cnt=0; cnt<depsz; cnt++ )
+    {
+        // only earlier tasks, no cycle.
+        if ( deps[cnt] < tasks.size() )
+        {
+            task.deps.push_back( deps[cnt] );
+        }
+    }
+
+    tasks.push_back( task );
+    done.push_back( false );
+
+    return tasks.size() - 1;
+}
+
+void TaskGraph::run()
+{
+    bool side     = false;
+    bool waitside = false;
+
+    for ( size_t cnt=0; cnt<tasks.size(); cnt++ )
+    {
+        if ( tasks[cnt].lane != TASK_Side )
+        {
+            for ( size_t n=0; n<tasks[cnt].deps.size(); n++ )
+            {
+                if ( tasks[ tasks[cnt].deps[n] ].lane == TASK_Side )
+                    waitside = true;
+            }
+
+            continue;
+        }
+
+        side = true;
+    }
+
+    if ( side == false )
+    {
+        runLane( TASK_Main );
+        return;
+    }
+
+    // host may start side task at its wait, main lane never waits it then.
+    void* group = NULL;
+
+    if ( waitside == false )
+    {
+        group = parallelBeside( sideLane, this );
+    }
+
+    if ( group != NULL )
+    {
+        runLane( TASK_Main );
+        parallelJoin( group );
+        return;
+    }
+
+    // no thread of own for host executor, or in a worker.
+    if ( parallelRanged() == true )
+    {
+        runInline();
+        return;
+    }
+
+    std::thread helper;
+    const std::atomic<bool>* stop = parallelCancelFlag();
+
+    try
+    {
+        helper = std::thread( [this, stop]()
+        {
+            // loops of side tasks never take threads of main lane.
+            parallelSerial();
+            parallelCancel( stop );
+            runLane( TASK_Side );
+        } );
+    }
+    catch( const std::system_error& )
+    {
+        runInline();
+        return;
+    }
+
+    runLane( TASK_Main );
+
+    helper.join();
+}
+
+void TaskGraph::sideLane( void* param )
+{
+    ((TaskGraph*)param)->runLane( TASK_Side );
+}
+
+void TaskGraph::runInline()
+{
+    // side lane goes along main lane in order of adding.
+    for ( size_t cnt=0; cnt<tasks.size(); cnt++ )
+    {
+        waitDeps( tasks[cnt] );
+        tasks[cnt].func( tasks[cnt].param );
+        finish( cnt );
+    }
+}
+
+void TaskGraph::runLane( TaskLane lane )
+{
+    // ids of dependencies are lower, order of adding is runnable order.
+    for ( size_t cnt=0; cnt<tasks.size(); cnt++ )
+    {
+        if ( tasks[cnt].lane != lane )
+            continue;
+
+        waitDeps( tasks[cnt] );
+        tasks[cnt].func( tasks[cnt].param );
+        finish( cnt );
+    }
+}
+
+void TaskGraph::waitDeps( const Task &task )
+{
+    TaskSync* ts = (TaskSync*)sync;
+    std::unique_lock<std::mutex> guard( ts->lock );
+
+    for ( size_t cnt=0; cnt<task.deps.size(); cnt++ )
+    {
+        while( done[ task.deps[cnt] ] == false )
+        {
+            ts->cond.wait( guard );
+        }
+    }
+}
+
+void TaskGraph::finish( unsigned id )
+{
+    TaskSync* ts = (TaskSync*)sync;
+
+    {
+        std::lock_guard<std::mutex> guard( ts->lock );
+        done[id] = true;
+    }
+
+    ts->cond.notify_all();
+}
+
+}; /// of namespace libsrcnn
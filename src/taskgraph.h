@@ -0,0 +1,64 @@
+#ifndef __TASKGRAPH_H__
+#define __TASKGRAPH_H__
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Dependency graph of stages in a call.
+//
+// Tasks of main lane run in calling thread, so OpenMP regions of them
+// take every thread. Tasks of side lane run in a helper thread with a
+// single OpenMP thread, they go along with main lane without nested
+// regions. A task starts after all of its dependencies finished.
+// Side lane is a task of host executor when configured.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+namespace libsrcnn {
+
+typedef void (*TaskFunc)( void* param );
+
+typedef enum
+{
+    TASK_Main = 0,
+    TASK_Side
+}TaskLane;
+
+class TaskGraph
+{
+    public:
+        TaskGraph();
+        ~TaskGraph();
+
+    public:
+        // returns id of task, dependencies are ids of tasks added before.
+        unsigned add( TaskFunc func, void* param, TaskLane lane,
+                      const unsigned* deps = NULL, unsigned depsz = 0 );
+        // runs all tasks, returns after every task finished.
+        void     run();
+
+    private:
+        typedef struct
+        {
+            TaskFunc                func;
+            void*                   param;
+            TaskLane                lane;
+            std::vector<unsigned>   deps;
+        }Task;
+
+        static void sideLane( void* param );
+        void     runLane( TaskLane lane );
+        void     runInline();
+        void     waitDeps( const Task &task );
+        void     finish( unsigned id );
+
+    private:
+        std::vector<Task>   tasks;
+        std::vector<bool>   done;
+        void*               sync;
+};
+
+}; /// of namespace libsrcnn
+
+#endif /// of __TASKGRAPH_H__
@@ -12,6 +12,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <cmath>
 
 #include <FL/Fl.H>
 #include <FL/Fl_Window.H>
@@ -29,6 +30,8 @@
 #endif
 
 #include <string>
+#include <vector>
+#include <algorithm>
 
 #include "libsrcnn.h"
 #include "fl_imgtk.h"
@@ -286,6 +289,15 @@ static string   file_src;
 static string   file_dst;
 static string   file_cov;
 static SRCNNFilterType filter_type = SRCNNF_Bicubic;
+static unsigned prune_count = 0;
+static unsigned batch_count = 0;
+static bool     sparseconv = true;
+static bool     compositeconv = false;
+static SRCNNEngineType engine_type = SRCNNE_SRCNN;
+static SRCNNLayersType layers_type = SRCNNL_Auto;
+static bool     numaplaced = false;
+static vector<string> file_corpus;
+static vector<string> file_models;
 
 bool parseArgs( int argc, char** argv )
 {
@@ -372,6 +384,72 @@ bool parseArgs( int argc, char** argv )
                 waitforakey = true;
             }
             else
+            if ( strtmp.find( "--composite" ) == 0 )
+            {
+                compositeconv = true;
+            }
+            else
+            if ( strtmp.find( "--dense" ) == 0 )
+            {
+                sparseconv = false;
+            }
+            else
+            if ( strtmp.find( "--espcn" ) == 0 )
+            {
+                engine_type = SRCNNE_ESPCN;
+            }
+            else
+            if ( strtmp.find( "--fused" ) == 0 )
+            {
+                layers_type = SRCNNL_Fused;
+            }
+            else
+            if ( strtmp.find( "--separated" ) == 0 )
+            {
+                layers_type = SRCNNL_Separated;
+            }
+            else
+            if ( strtmp.find( "--numa" ) == 0 )
+            {
+                numaplaced = true;
+            }
+            else
+            if ( strtmp.find( "--prune=" ) == 0 )
+            {
+                string strval = strtmp.substr( 8 );
+                if ( strval.size() > 0 )
+                {
+                    prune_count = atoi( strval.c_str() );
+                }
+            }
+            else
+            if ( strtmp.find( "--batch=" ) == 0 )
+            {
+                string strval = strtmp.substr( 8 );
+                if ( strval.size() > 0 )
+                {
+                    batch_count = atoi( strval.c_str() );
+                }
+            }
+            else
+            if ( strtmp.find( "--corpus=" ) == 0 )
+            {
+                string strval = strtmp.substr( 9 );
+                if ( strval.size() > 0 )
+                {
+                    file_corpus.push_back( strval );
+                }
+            }
+            else
+            if ( strtmp.find( "--model=" ) == 0 )
+            {
+                string strval = strtmp.substr( 8 );
+                if ( strval.size() > 0 )
+                {
+                    file_models.push_back( strval );
+                }
+            }
+            else
             if ( file_src.size() == 0 )
             {
                 file_src = strtmp;
@@ -447,6 +525,240 @@ bool parseArgs( int argc, char** argv )
     return false;
 }
 
+Fl_RGB_Image* loadCorpusImage( const char* fpath )
+{
+    Fl_RGB_Image* imgLoad = NULL;
+    Fl_RGB_Image* imgRGB  = NULL;
+    uchar* imgbuff = NULL;
+    size_t imgsz = 0;
+
+    int imgtype = testImageFile( fpath, &imgbuff, &imgsz );
+
+    switch( imgtype )
+    {
+        case 1: /// JPEG
+            imgLoad = new Fl_JPEG_Image( "JPGIMG", (const uchar*)imgbuff );
+            break;
+
+        case 2: /// PNG
+            imgLoad = new Fl_PNG_Image( "PNGIMAGE", (const uchar*)imgbuff, imgsz );
+            break;
+
+        case 3: /// BMP
+            imgLoad = fl_imgtk::createBMPmemory( (const char*)imgbuff, imgsz );
+            break;
+    }
+
+    if ( imgbuff != NULL )
+    {
+        delete[] imgbuff;
+    }
+
+    if ( imgLoad != NULL )
+    {
+        convImage( imgLoad, imgRGB );
+        delete imgLoad;
+    }
+
+    return imgRGB;
+}
+
+double calcPSNR( const uchar* ref, const uchar* cmp, unsigned sz )
+{
+    double mse = 0.0;
+
+    for( unsigned cnt=0; cnt<sz; cnt++ )
+    {
+        double diff = (double)ref[cnt] - (double)cmp[cnt];
+        mse += diff * diff;
+    }
+
+    mse /= (double)sz;
+
+    if ( mse == 0.0 )
+        return 99.99;
+
+    return 10.0 * log10( ( 255.0 * 255.0 ) / mse );
+}
+
+void reportPruning( const uchar* refbuff, unsigned w, unsigned h, unsigned d,
+                    const uchar* fullbuff, unsigned fullsz,
+                    const uchar* fullconv, unsigned fullconvsz,
+                    unsigned fulltick )
+{
+    double   energy[256] = {0.0};
+    int      filters = 0;
+    unsigned analyzed = 0;
+
+    printf( "- Analyzing filter energy ... " );
+    fflush( stdout );
+
+    if ( file_corpus.size() == 0 )
+    {
+        filters = AnalyzeFiltersSRCNN( refbuff, w, h, d, image_multiply,
+                                       energy, 256 );
+        if ( filters > 0 )
+            analyzed++;
+    }
+    else
+    {
+        for( size_t cnt=0; cnt<file_corpus.size(); cnt++ )
+        {
+            Fl_RGB_Image* imgCorpus = loadCorpusImage( file_corpus[cnt].c_str() );
+
+            if ( imgCorpus == NULL )
+            {
+                printf( "(%s failed) ", file_corpus[cnt].c_str() );
+                continue;
+            }
+
+            if ( imgCorpus->d() >= 3 )
+            {
+                int reti = AnalyzeFiltersSRCNN( (const uchar*)imgCorpus->data()[0],
+                                                imgCorpus->w(),
+                                                imgCorpus->h(),
+                                                imgCorpus->d(),
+                                                image_multiply,
+                                                energy, 256 );
+                if ( reti > 0 )
+                {
+                    filters = reti;
+                    analyzed++;
+                }
+            }
+
+            delete imgCorpus;
+        }
+    }
+
+    if ( ( analyzed == 0 ) || ( filters <= 0 ) )
+    {
+        printf( "Failed.\n" );
+        return;
+    }
+
+    printf( "%u image(s), %d filters.\n", analyzed, filters );
+
+    vector< pair< double, unsigned > > ranks;
+
+    for( int cnt=0; cnt<filters; cnt++ )
+    {
+        ranks.push_back( make_pair( energy[cnt] / (double)analyzed, (unsigned)cnt ) );
+    }
+
+    sort( ranks.begin(), ranks.end() );
+
+    unsigned pcnt = MIN( prune_count, (unsigned)filters - 1 );
+    vector< unsigned > pruned;
+
+    printf( "- Lowest energy filters :\n" );
+    for( unsigned cnt=0; cnt<pcnt; cnt++ )
+    {
+        printf( "    #%02u : %.6e\n", ranks[cnt].second, ranks[cnt].first );
+        pruned.push_back( ranks[cnt].second );
+    }
+
+    ConfigurePruneSRCNN( pruned.data(), pcnt );
+
+    uchar*   outbuff  = NULL;
+    unsigned outsz    = 0;
+    uchar*   convbuff = NULL;
+    unsigned convsz   = 0;
+
+    printf( "- Processing pruned SRCNN ( %u of %d filters ) ... ", 
+            filters - pcnt, filters );
+    fflush( stdout );
+
+    unsigned tick0 = tick::getTickCount();
+
+    int reti = ProcessSRCNN( refbuff, w, h, d,
+                             image_multiply,
+                             outbuff, outsz,
+                             &convbuff, &convsz );
+
+    unsigned tick1 = tick::getTickCount();
+
+    // restore full network.
+    ConfigurePruneSRCNN( NULL, 0 );
+
+    if ( ( reti != 0 ) || ( outsz != fullsz ) )
+    {
+        printf( "Failed, error code = %d\n", reti );
+    }
+    else
+    {
+        printf( "took %u ms ( full %u ms ).\n", tick1 - tick0, fulltick );
+        printf( "- Quality report :\n" );
+        printf( "    PSNR RGB : %.2f dB\n", calcPSNR( fullbuff, outbuff, outsz ) );
+
+        if ( ( convsz > 0 ) && ( convsz == fullconvsz ) )
+        {
+            printf( "    PSNR Y   : %.2f dB\n", 
+                    calcPSNR( fullconv, convbuff, convsz ) );
+        }
+    }
+
+    fflush( stdout );
+
+    if ( outbuff != NULL )
+        delete[] outbuff;
+
+    if ( convbuff != NULL )
+        delete[] convbuff;
+}
+
+void reportThroughput( const uchar* refbuff, unsigned w, unsigned h, unsigned d )
+{
+    static const SRCNNPolicyType policies[] = { SRCNNP_Latency, SRCNNP_Throughput };
+    static const char*           names[]    = { "latency", "throughput" };
+
+    vector<const uchar*> refs( batch_count, refbuff );
+    vector<uchar*>       outs( batch_count, (uchar*)NULL );
+    vector<unsigned>     outszs( batch_count, 0 );
+
+    for( unsigned cnt=0; cnt<2; cnt++ )
+    {
+        printf( "- Processing batch of %u images by %s policy ... ",
+                batch_count, names[cnt] );
+        fflush( stdout );
+
+        ConfigurePolicySRCNN( policies[cnt] );
+
+        unsigned tick0 = tick::getTickCount();
+
+        int reti = ProcessBatchSRCNN( refs.data(), batch_count,
+                                      w, h, d, image_multiply,
+                                      outs.data(), outszs.data() );
+
+        unsigned tick1 = tick::getTickCount();
+
+        if ( reti != 0 )
+        {
+            printf( "Failed, error code = %d\n", reti );
+        }
+        else
+        {
+            unsigned ms = MAX( tick1 - tick0, 1U );
+
+            printf( "took %u ms, %.2f images/s.\n", 
+                    ms, 1000.0 * (double)batch_count / (double)ms );
+        }
+
+        fflush( stdout );
+
+        for( unsigned n=0; n<batch_count; n++ )
+        {
+            if ( outs[n] != NULL )
+            {
+                delete[] outs[n];
+                outs[n] = NULL;
+            }
+        }
+    }
+
+    ConfigurePolicySRCNN( SRCNNP_Latency );
+}
+
 const char* getPlatform()
 {
     static char retstr[32] = {0};
@@ -521,6 +833,22 @@ void printUsage()
     printf( "      --step                       : scaling by fator 2 steps.\n" );
     printf( "                                     * step scaling takes a lot of times.\n" );
     printf( "      --waitakey                   : wait for ENTER for end of job.\n" );
+    printf( "      --composite                  : layer I takes source Y for integer scale.\n" );
+    printf( "      --dense                      : don't skip zero activations of layer I.\n" );
+    printf( "      --espcn                      : faster engine runs at source size.\n" );
+    printf( "      --fused                      : layer I+II at once, less memory.\n" );
+    printf( "      --separated                  : layer I and II separated, faster.\n" );
+    printf( "                                     * chosen by image and memory as default.\n" );
+    printf( "      --numa                       : places threads and planes on NUMA nodes.\n" );
+    printf( "      --prune=(count)              : prunes lowest energy filters of layer I,\n" );
+    printf( "                                     and reports quality against full network.\n" );
+    printf( "      --batch=(count)              : processes count copies of source image by\n" );
+    printf( "                                     latency and throughput policies,\n" );
+    printf( "                                     and reports images per second.\n" );
+    printf( "      --corpus=(image file)        : adds image to analyze filter energy,\n" );
+    printf( "                                     source image used if not specified.\n" );
+    printf( "      --model=(model file)         : loads trained model file for its scale,\n" );
+    printf( "                                     can be repeated for each scale.\n" );
     printf( "      --filter=(0...4)             : Changes interpolation filter as ...\n" );
     printf( "                   0 = Nearest filter\n" );
     printf( "                   1 = Bilinear filter\n" );
@@ -645,6 +973,30 @@ int main( int argc, char** argv )
             }
             
             ConfigureFilterSRCNN( filter_type, stepscale );
+            ConfigureSparseSRCNN( sparseconv );
+            ConfigureCompositeSRCNN( compositeconv );
+            ConfigureEngineSRCNN( engine_type );
+            ConfigureLayersSRCNN( layers_type );
+
+            if ( numaplaced == true )
+            {
+                printf( "- NUMA nodes placed : %u\n", ConfigureNumaSRCNN( true ) );
+            }
+
+            for( size_t cnt=0; cnt<file_models.size(); cnt++ )
+            {
+                printf( "- Loading model %s ... ", file_models[cnt].c_str() );
+
+                int retm = LoadModelSRCNN( file_models[cnt].c_str() );
+                if ( retm == 0 )
+                {
+                    printf( "Ok.\n" );
+                }
+                else
+                {
+                    printf( "Failure, %d.\n", retm );
+                }
+            }
             fflush( stdout );
             
             printf( "- Processing SRCNN ... " );
@@ -663,6 +1015,25 @@ int main( int argc, char** argv )
                                      &convsz );
             
             unsigned tick1 = tick::getTickCount();
+
+            if ( ( reti == 0 ) && ( prune_count > 0 ) )
+            {
+                printf( "Done.\n" );
+
+                reportPruning( refbuff, ref_w, ref_h, ref_d,
+                               outbuff, outsz, convbuff, convsz,
+                               tick1 - tick0 );
+            }
+
+            if ( ( reti == 0 ) && ( batch_count > 0 ) )
+            {
+                if ( prune_count == 0 )
+                {
+                    printf( "Done.\n" );
+                }
+
+                reportThroughput( refbuff, ref_w, ref_h, ref_d );
+            }
 			            
             if ( ( reti == 0 ) && ( outsz > 0 ) )
             {
@@ -670,6 +1041,16 @@ int main( int argc, char** argv )
                 unsigned new_h = ref_h * image_multiply;
                 
                 printf( "Test Ok, took %u ms.\n", tick1 - tick0 );
+
+                SRCNNSparsity sparsity = {0};
+                GetSparsitySRCNN( &sparsity );
+
+                if ( ( sparsity.activations > 0 ) && ( sparsity.blocks > 0 ) )
+                {
+                    printf( "- Sparsity of layer I : %.1f%% zeros, %.1f%% blocks skipped.\n",
+                            100.0 * (double)sparsity.zeros / (double)sparsity.activations,
+                            100.0 * (double)sparsity.skipped / (double)sparsity.blocks );
+                }
             
                 Fl_RGB_Image* imgDump = new Fl_RGB_Image( outbuff, new_w, new_h, ref_d );
                 if ( imgDump != NULL )
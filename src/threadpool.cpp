@@ -0,0 +1,676 @@
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <atomic>
+
+#ifdef USE_THREADPOOL
+    #include <thread>
+    #include <mutex>
+    #include <condition_variable>
+    #include <system_error>
+#endif
+
+#ifndef NO_OMP
+    #include <omp.h>
+#endif
+
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+#include "threadpool.h"
+#include "sysinfo.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace libsrcnn {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// workers, host tasks and side lane of a graph never start loops.
+static thread_local bool loop_serial = false;
+// cancel flag of loops, carried to workers running a part of them.
+static thread_local const std::atomic<bool>* loop_stop = NULL;
+
+static SRCNNExecutor     host_exec;
+static bool              host_on = false;
+
+// maximum threads of a loop, 0 for default.
+static unsigned              max_threads  = 0;
+static thread_local unsigned call_threads = 0;
+
+#define NUMA_MAX_CPUS       1024
+
+// CPUs of affinity ordered by node, while loops are placed on nodes.
+static bool                  numa_on    = false;
+static unsigned              numa_count = 0;
+static unsigned              numa_cpus[NUMA_MAX_CPUS];
+static unsigned              numa_nodes[NUMA_MAX_CPUS];
+static std::atomic<unsigned> numa_generation( 0 );
+// node a thread is pinned to, -1 for none.
+static thread_local int      pin_node       = -1;
+static thread_local unsigned pin_generation = 0;
+#if defined(__linux__)
+static thread_local bool      pin_call = false;
+static thread_local cpu_set_t pin_saved;
+#endif
+
+// a loop shared by tasks of host executor.
+typedef struct
+{
+    RangeFunc               func;
+    void*                   param;
+    unsigned                count;
+    unsigned                chunk;
+    std::atomic<unsigned>   next;
+    const std::atomic<bool>* stop;
+}HostLoop;
+
+// a task beside calling thread.
+typedef struct
+{
+    SRCNNTaskFunc           func;
+    void*                   param;
+    const std::atomic<bool>* stop;
+}HostBeside;
+
+////////////////////////////////////////////////////////////////////////////////
+
+// node of a slot of a loop of threads, slots spread over CPUs by node.
+static int slotNode( unsigned slot, unsigned threads )
+{
+    if ( ( numa_count == 0 ) || ( threads == 0 ) )
+        return -1;
+
+    return (int)numa_nodes[ (unsigned long long)slot * numa_count / threads ];
+}
+
+// pins calling thread to CPUs of node, -1 for all CPUs of nodes.
+static void pinNode( int node )
+{
+#if defined(__linux__)
+    unsigned generation = numa_generation.load();
+
+    if ( ( pin_node == node ) && ( pin_generation == generation ) )
+        return;
+
+    cpu_set_t cpuset;
+    CPU_ZERO( &cpuset );
+
+    for ( unsigned cnt=0; cnt<numa_count; cnt++ )
+    {
+        if ( ( node < 0 ) || ( numa_nodes[cnt] == (unsigned)node ) )
+        {
+            CPU_SET( numa_cpus[cnt], &cpuset );
+        }
+    }
+
+    if ( ( CPU_COUNT( &cpuset ) > 0 )
+         && ( sched_setaffinity( 0, sizeof( cpu_set_t ), &cpuset ) == 0 ) )
+    {
+        pin_node       = node;
+        pin_generation = generation;
+    }
+#endif /// of __linux__
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef USE_THREADPOOL
+
+// workers and loop runs now, a loop at a time.
+class ThreadPool
+{
+    public:
+        ThreadPool( unsigned threads );
+
+    public:
+        unsigned size() { return workers.size() + 1; }
+        bool     run( unsigned count, RangeFunc func, void* param,
+                      bool dynamic, unsigned threads );
+
+    private:
+        void     work( unsigned index );
+        void     chunks( unsigned slot );
+
+    private:
+        std::vector<std::thread>    workers;
+        std::mutex                  busy;
+        std::mutex                  lock;
+        std::condition_variable     wake;
+        std::condition_variable     idle;
+        unsigned long long          generation;
+        unsigned                    helpers;
+        unsigned                    running;
+
+        RangeFunc                   func;
+        void*                       param;
+        unsigned                    count;
+        unsigned                    chunk;
+        std::atomic<unsigned>       next;
+        const std::atomic<bool>*    stop;
+        unsigned                    threads;
+        bool                        placed;
+        bool                        bound;  /// chunk of slot only.
+};
+
+ThreadPool::ThreadPool( unsigned threads )
+ : generation( 0 ),
+   helpers( 0 ),
+   running( 0 ),
+   func( NULL ),
+   param( NULL ),
+   count( 0 ),
+   chunk( 1 ),
+   next( 0 ),
+   stop( NULL ),
+   threads( 1 ),
+   placed( false ),
+   bound( false )
+{
+    for ( unsigned cnt=1; cnt<threads; cnt++ )
+    {
+        try
+        {
+            workers.push_back( std::thread( &ThreadPool::work, this, cnt - 1 ) );
+        }
+        catch( const std::system_error& )
+        {
+            // less workers, calling thread still runs loops.
+            break;
+        }
+    }
+}
+
+bool ThreadPool::run( unsigned count, RangeFunc func, void* param,
+                      bool dynamic, unsigned threads )
+{
+    if ( busy.try_lock() == false )
+        return false;
+
+    // workers of index over limit sit out this loop.
+    threads = ( threads < size() ) ? threads : size();
+    threads = ( threads > 0 ) ? threads : 1;
+
+    {
+        std::lock_guard<std::mutex> guard( lock );
+
+        this->func  = func;
+        this->param = param;
+        this->count = count;
+        this->chunk = dynamic ? 1 : ( count + threads - 1 ) / threads;
+        this->stop  = loop_stop;
+        this->threads = threads;
+        this->placed  = parallelPlaced();
+        this->bound   = placed && ( dynamic == false );
+        next.store( 0 );
+        helpers = threads - 1;
+        running = helpers;
+        generation++;
+    }
+
+    wake.notify_all();
+
+    chunks( 0 );
+
+    {
+        std::unique_lock<std::mutex> guard( lock );
+
+        while( running > 0 )
+        {
+            idle.wait( guard );
+        }
+    }
+
+    busy.unlock();
+
+    return true;
+}
+
+void ThreadPool::work( unsigned index )
+{
+    unsigned long long seen = 0;
+
+    loop_serial = true;
+
+    while( true )
+    {
+        bool helper = false;
+
+        {
+            std::unique_lock<std::mutex> guard( lock );
+
+            while( generation == seen )
+            {
+                wake.wait( guard );
+            }
+
+            seen   = generation;
+            helper = ( index < helpers );
+        }
+
+        if ( helper == false )
+            continue;
+
+        if ( placed == true )
+        {
+            pinNode( slotNode( index + 1, threads ) );
+        }
+        else
+        if ( pin_node >= 0 )
+        {
+            pinNode( -1 );
+        }
+
+        loop_stop = stop;
+
+        chunks( index + 1 );
+
+        loop_stop = NULL;
+
+        {
+            std::lock_guard<std::mutex> guard( lock );
+
+            running--;
+
+            if ( running == 0 )
+                idle.notify_all();
+        }
+    }
+}
+
+void ThreadPool::chunks( unsigned slot )
+{
+    // placed static loop, a slot runs same indices each time.
+    if ( bound == true )
+    {
+        unsigned begin = slot * chunk;
+
+        if ( begin < count )
+        {
+            func( param, begin, ( count - begin > chunk ) ? begin + chunk : count );
+        }
+
+        return;
+    }
+
+    while( true )
+    {
+        unsigned begin = next.fetch_add( chunk );
+
+        if ( begin >= count )
+            break;
+
+        unsigned end = ( count - begin > chunk ) ? begin + chunk : count;
+
+        func( param, begin, end );
+    }
+}
+
+#endif /// of USE_THREADPOOL
+
+#if defined(USE_THREADPOOL) || !defined(NO_OMP)
+// OMP_NUM_THREADS if given, or CPUs of quota and cpuset of container.
+static unsigned initialThreads()
+{
+    const char* env = getenv( "OMP_NUM_THREADS" );
+
+    if ( ( env != NULL ) && ( atoi( env ) > 0 ) )
+    {
+#if !defined(USE_THREADPOOL) && !defined(NO_OMP)
+        return omp_get_max_threads();
+#else
+        return (unsigned)atoi( env );
+#endif
+    }
+
+    unsigned cpus = availableCpuCount();
+
+#if !defined(USE_THREADPOOL) && !defined(NO_OMP)
+    unsigned ompt = omp_get_max_threads();
+
+    if ( ( cpus == 0 ) || ( cpus > ompt ) )
+        cpus = ompt;
+#elif defined(USE_THREADPOOL)
+    if ( cpus == 0 )
+        cpus = std::thread::hardware_concurrency();
+#endif
+
+    return ( cpus > 0 ) ? cpus : 1;
+}
+
+static unsigned defaultThreads()
+{
+    static unsigned threads = initialThreads();
+
+    return threads;
+}
+#endif /// of USE_THREADPOOL || !NO_OMP
+
+#ifdef USE_THREADPOOL
+static ThreadPool* pool()
+{
+    // workers live until process exits.
+    static ThreadPool* inst = new ThreadPool( defaultThreads() );
+
+    return inst;
+}
+#endif /// of USE_THREADPOOL
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void hostChunks( void* task )
+{
+    HostLoop* loop   = (HostLoop*)task;
+    bool      serial = loop_serial;
+    const std::atomic<bool>* stop = loop_stop;
+
+    loop_serial = true;
+    loop_stop   = loop->stop;
+
+    while( true )
+    {
+        unsigned begin = loop->next.fetch_add( loop->chunk );
+
+        if ( begin >= loop->count )
+            break;
+
+        unsigned end = ( loop->count - begin > loop->chunk ) ?
+                       begin + loop->chunk : loop->count;
+
+        loop->func( loop->param, begin, end );
+    }
+
+    loop_serial = serial;
+    loop_stop   = stop;
+}
+
+static void hostBeside( void* task )
+{
+    HostBeside* side   = (HostBeside*)task;
+    bool        serial = loop_serial;
+    const std::atomic<bool>* stop = loop_stop;
+
+    loop_serial = true;
+    loop_stop   = side->stop;
+
+    side->func( side->param );
+
+    loop_serial = serial;
+    loop_stop   = stop;
+
+    delete side;
+}
+
+static bool hostRange( unsigned count, RangeFunc func, void* param,
+                       bool dynamic, unsigned threads )
+{
+    unsigned tasks = ( threads < count ) ? threads : count;
+
+    if ( tasks <= 1 )
+        return false;
+
+    void* group = host_exec.group( host_exec.host );
+
+    if ( group == NULL )
+        return false;
+
+    HostLoop loop;
+    loop.func  = func;
+    loop.param = param;
+    loop.count = count;
+    loop.chunk = dynamic ? 1 : ( count + tasks - 1 ) / tasks;
+    loop.stop  = loop_stop;
+    loop.next.store( 0 );
+
+    for ( unsigned cnt=1; cnt<tasks; cnt++ )
+    {
+        host_exec.submit( host_exec.host, group, hostChunks, &loop );
+    }
+
+    // calling thread takes chunks not yet taken.
+    hostChunks( &loop );
+
+    host_exec.wait( host_exec.host, group );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+unsigned parallelThreads()
+{
+    if ( loop_serial == true )
+        return 1;
+
+    unsigned threads = 1;
+
+    if ( host_on == true )
+    {
+        threads = ( host_exec.workers > 0 ) ? host_exec.workers : 1;
+    }
+    else
+    {
+#if defined(USE_THREADPOOL)
+        threads = pool()->size();
+#elif !defined(NO_OMP)
+        threads = defaultThreads();
+#endif
+    }
+
+    // limit of calling thread first, then of library.
+    unsigned limit = ( call_threads > 0 ) ? call_threads : max_threads;
+
+    if ( ( limit > 0 ) && ( limit < threads ) )
+        threads = limit;
+
+    return threads;
+}
+
+bool parallelSerial( bool serial )
+{
+    bool prev = loop_serial;
+
+    loop_serial = serial;
+
+    return prev;
+}
+
+unsigned parallelMaximum( unsigned threads, bool callingthread )
+{
+    unsigned prev = 0;
+
+    if ( callingthread == true )
+    {
+        prev         = call_threads;
+        call_threads = threads;
+    }
+    else
+    {
+        prev        = max_threads;
+        max_threads = threads;
+    }
+
+    return prev;
+}
+
+const std::atomic<bool>* parallelCancel( const std::atomic<bool>* stop )
+{
+    const std::atomic<bool>* prev = loop_stop;
+
+    loop_stop = stop;
+
+    return prev;
+}
+
+const std::atomic<bool>* parallelCancelFlag()
+{
+    return loop_stop;
+}
+
+bool parallelRanged()
+{
+    return ( host_on == true ) || ( loop_serial == true );
+}
+
+void parallelExecutor( const SRCNNExecutor* executor )
+{
+    if ( ( executor == NULL ) || ( executor->group == NULL )
+         || ( executor->submit == NULL ) || ( executor->wait == NULL ) )
+    {
+        host_on = false;
+        return;
+    }
+
+    host_exec = *executor;
+    host_on   = true;
+}
+
+void* parallelBeside( SRCNNTaskFunc func, void* param )
+{
+    if ( ( host_on == false ) || ( loop_serial == true ) )
+        return NULL;
+
+    void* group = host_exec.group( host_exec.host );
+
+    if ( group != NULL )
+    {
+        HostBeside* side = new HostBeside;
+        side->func  = func;
+        side->param = param;
+        side->stop  = loop_stop;
+
+        host_exec.submit( host_exec.host, group, hostBeside, side );
+    }
+
+    return group;
+}
+
+void parallelJoin( void* group )
+{
+    if ( group != NULL )
+    {
+        host_exec.wait( host_exec.host, group );
+    }
+}
+
+void parallelRange( unsigned count, RangeFunc func, void* param,
+                    bool dynamic )
+{
+    if ( count == 0 )
+        return;
+
+    if ( ( loop_serial == false ) && ( count > 1 ) )
+    {
+        unsigned threads = parallelThreads();
+
+        if ( host_on == true )
+        {
+            if ( hostRange( count, func, param, dynamic, threads ) == true )
+                return;
+        }
+#ifdef USE_THREADPOOL
+        else
+        if ( ( threads > 1 )
+             && ( pool()->run( count, func, param, dynamic, threads ) == true ) )
+            return;
+#endif /// of USE_THREADPOOL
+    }
+
+    // inside of other loop, workers busy, or serial.
+    func( param, 0, count );
+}
+
+unsigned parallelNuma( bool enabled )
+{
+    unsigned nodes = 0;
+
+    if ( enabled == true )
+    {
+        numa_count = numaCpuNodes( numa_cpus, numa_nodes, NUMA_MAX_CPUS );
+
+        // ordered by node, each change is a new node.
+        for ( unsigned cnt=0; cnt<numa_count; cnt++ )
+        {
+            if ( ( cnt == 0 ) || ( numa_nodes[cnt] != numa_nodes[ cnt - 1 ] ) )
+                nodes++;
+        }
+    }
+
+    numa_on = ( nodes > 1 );
+    numa_generation++;
+
+#if !defined(USE_THREADPOOL) && !defined(NO_OMP)
+    // workers of OpenMP go back to all CPUs, pool workers do by next loop.
+    if ( ( numa_on == false ) && ( loop_serial == false ) )
+    {
+        #pragma omp parallel num_threads( defaultThreads() )
+        {
+            if ( pin_node >= 0 )
+            {
+                pinNode( -1 );
+            }
+        }
+    }
+#endif
+
+    return numa_on ? nodes : 0;
+}
+
+bool parallelPlaced()
+{
+    return ( numa_on == true ) && ( host_on == false );
+}
+
+bool parallelPin( bool pin )
+{
+#if defined(__linux__)
+    if ( pin == false )
+    {
+        if ( pin_call == true )
+        {
+            sched_setaffinity( 0, sizeof( cpu_set_t ), &pin_saved );
+
+            pin_call = false;
+            pin_node = -1;
+        }
+
+        return false;
+    }
+
+    if ( ( parallelPlaced() == false ) || ( loop_serial == true )
+         || ( pin_call == true ) )
+        return false;
+
+    CPU_ZERO( &pin_saved );
+
+    if ( sched_getaffinity( 0, sizeof( cpu_set_t ), &pin_saved ) != 0 )
+        return false;
+
+    pin_call = true;
+
+    unsigned threads = parallelThreads();
+
+    pinNode( slotNode( 0, threads ) );
+
+    #if !defined(USE_THREADPOOL) && !defined(NO_OMP)
+    // a team of same threads runs loops of this thread after.
+    #pragma omp parallel num_threads( threads )
+    {
+        unsigned slot = omp_get_thread_num();
+
+        if ( slot > 0 )
+        {
+            pinNode( slotNode( slot, omp_get_num_threads() ) );
+        }
+    }
+    #endif
+
+    return true;
+#else
+    return false;
+#endif /// of __linux__
+}
+
+}; /// of namespace libsrcnn
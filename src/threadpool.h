@@ -0,0 +1,200 @@
+#ifndef __THREADPOOL_H__
+#define __THREADPOOL_H__
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Parallel loops of library.
+//
+// OpenMP runs them as default. Built with USE_THREADPOOL ( and NO_OMP ),
+// persistent std::thread workers run them instead, for systems without
+// OpenMP or applications never link libgomp. Calling thread takes a part
+// of each loop. A loop inside of another, or from other thread while
+// workers are busy, runs in its calling thread, never oversubscribed.
+// An executor of host application given by ConfigureExecutorSRCNN()
+// takes all of them instead, with side lane of task graph.
+// Placed on NUMA nodes, threads of a loop are pinned to nodes in order
+// of their slots, and static loops give a slot same indices each time,
+// so rows of images stay on a node from first touch to last layer.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+
+#include "libsrcnn.h"
+
+namespace libsrcnn {
+
+// runs indices of [begin,end) of a loop.
+typedef void (*RangeFunc)( void* param, unsigned begin, unsigned end );
+
+// threads a loop of calling thread runs on.
+unsigned parallelThreads();
+// loops of calling thread run only by itself from now ( eg. side lane ),
+// returns previous state.
+bool     parallelSerial( bool serial = true );
+// maximum threads of a loop, of calling thread or all, 0 for default,
+// returns previous maximum.
+unsigned parallelMaximum( unsigned threads, bool callingthread );
+// runs [0,count) by workers, dynamic hands out an index at a time.
+void     parallelRange( unsigned count, RangeFunc func, void* param,
+                        bool dynamic );
+// loops go by parallelRange(), not by OpenMP ( host executor or serial ).
+bool     parallelRanged();
+// loops of calling thread skip indices left after *stop goes true, and
+// so do loops inside of them, NULL for none. returns previous flag.
+const std::atomic<bool>* parallelCancel( const std::atomic<bool>* stop );
+const std::atomic<bool>* parallelCancelFlag();
+// places threads of loops on NUMA nodes, returns count of nodes or 0
+// for none ( single node, or disabled ).
+unsigned parallelNuma( bool enabled );
+// loops are placed on nodes now.
+bool     parallelPlaced();
+// pins calling thread and threads of its loops to nodes of their slots,
+// or restores affinity of calling thread, returns true if pinned.
+bool     parallelPin( bool pin );
+// host executor, copied, NULL for internal threads.
+void     parallelExecutor( const SRCNNExecutor* executor );
+// runs func( param ) by host executor beside calling thread, returns a
+// group for parallelJoin(), or NULL without host executor.
+void*    parallelBeside( SRCNNTaskFunc func, void* param );
+void     parallelJoin( void* group );
+
+template <typename Body>
+void parallelBody( void* param, unsigned begin, unsigned end )
+{
+    const Body               &body = *(const Body*)param;
+    const std::atomic<bool>*  stop = parallelCancelFlag();
+
+    for ( unsigned cnt=begin; cnt<end; cnt++ )
+    {
+        if ( ( stop != NULL ) && ( stop->load( std::memory_order_relaxed ) == true ) )
+            break;
+
+        body( cnt );
+    }
+}
+
+// body( index ) for each index of [0,count), static blocks of indices.
+template <typename Body>
+inline void parallelFor( unsigned count, const Body &body )
+{
+#ifdef USE_THREADPOOL
+    parallelRange( count, parallelBody<Body>, (void*)&body, false );
+#else
+    if ( parallelRanged() == true )
+    {
+        parallelRange( count, parallelBody<Body>, (void*)&body, false );
+        return;
+    }
+
+    const std::atomic<bool>* stop = parallelCancelFlag();
+
+#ifdef _OPENMP
+    unsigned threads = parallelThreads();
+
+    #pragma omp parallel for schedule(static) num_threads( threads )
+#endif
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        if ( ( stop != NULL ) && ( stop->load( std::memory_order_relaxed ) == true ) )
+            continue;
+
+        body( cnt );
+    }
+#endif /// of USE_THREADPOOL
+}
+
+// same as parallelFor(), for bodies of uneven cost.
+template <typename Body>
+inline void parallelForDynamic( unsigned count, const Body &body )
+{
+#ifdef USE_THREADPOOL
+    parallelRange( count, parallelBody<Body>, (void*)&body, true );
+#else
+    if ( parallelRanged() == true )
+    {
+        parallelRange( count, parallelBody<Body>, (void*)&body, true );
+        return;
+    }
+
+    const std::atomic<bool>* stop = parallelCancelFlag();
+
+#ifdef _OPENMP
+    unsigned threads = parallelThreads();
+
+    #pragma omp parallel for schedule(dynamic) num_threads( threads )
+#endif
+    for ( unsigned cnt=0; cnt<count; cnt++ )
+    {
+        if ( ( stop != NULL ) && ( stop->load( std::memory_order_relaxed ) == true ) )
+            continue;
+
+        body( cnt );
+    }
+#endif /// of USE_THREADPOOL
+}
+
+template <typename Body>
+struct ParallelSum
+{
+    const Body*                     body;
+    std::atomic<unsigned long long> sum;
+};
+
+template <typename Body>
+void parallelSumBody( void* param, unsigned begin, unsigned end )
+{
+    ParallelSum<Body>*       ps   = (ParallelSum<Body>*)param;
+    const std::atomic<bool>* stop = parallelCancelFlag();
+    unsigned long long       sum  = 0;
+
+    for ( unsigned cnt=begin; cnt<end; cnt++ )
+    {
+        if ( ( stop != NULL ) && ( stop->load( std::memory_order_relaxed ) == true ) )
+            break;
+
+        sum += (*ps->body)( cnt );
+    }
+
+    ps->sum += sum;
+}
+
+// sum of body( index ) for each index of [0,count).
+template <typename Body>
+inline unsigned long long parallelSum( unsigned count, const Body &body )
+{
+#ifndef USE_THREADPOOL
+    if ( parallelRanged() == false )
+    {
+        unsigned long long       sum  = 0;
+        const std::atomic<bool>* stop = parallelCancelFlag();
+
+#ifdef _OPENMP
+        unsigned threads = parallelThreads();
+
+        #pragma omp parallel for schedule(static) reduction(+:sum) num_threads( threads )
+#endif
+        for ( unsigned cnt=0; cnt<count; cnt++ )
+        {
+            if ( ( stop != NULL ) && ( stop->load( std::memory_order_relaxed ) == true ) )
+                continue;
+
+            sum += body( cnt );
+        }
+
+        return sum;
+    }
+#endif /// of USE_THREADPOOL
+
+    ParallelSum<Body> ps;
+    ps.body = &body;
+    ps.sum  = 0;
+
+    parallelRange( count, parallelSumBody<Body>, &ps, false );
+
+    return ps.sum;
+}
+
+}; /// of namespace libsrcnn
+
+#endif /// of __THREADPOOL_H__
@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Test of cgroup limits read by sysinfo, on trees of files made up as
+// /proc and /sys of a host or a container show them.
+//
+// build and run : make -f Makefiles/Makefile.testsysinfo
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "sysinfo.h"
+
+using namespace libsrcnn;
+
+////////////////////////////////////////////////////////////////////////////////
+
+#define UNLIMITED   0xFFFFFFFFFFFFFFFFULL
+
+static unsigned failures = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void makeDirs( const std::string &path )
+{
+    for ( size_t pos=1; pos<=path.size(); pos++ )
+    {
+        if ( ( pos == path.size() ) || ( path[pos] == '/' ) )
+        {
+            mkdir( path.substr( 0, pos ).c_str(), 0755 );
+        }
+    }
+}
+
+static void writeFile( const std::string &root, const char* path,
+                       const char* text )
+{
+    std::string full = root + path;
+
+    makeDirs( full.substr( 0, full.rfind( '/' ) ) );
+
+    FILE* fp = fopen( full.c_str(), "w" );
+
+    if ( fp != NULL )
+    {
+        fputs( text, fp );
+        fclose( fp );
+    }
+}
+
+static std::string makeRoot( const char* name )
+{
+    char tmpl[256] = {0};
+    snprintf( tmpl, 256, "/tmp/sysinfotest_%s_XXXXXX", name );
+
+    if ( mkdtemp( tmpl ) == NULL )
+    {
+        printf( "mkdtemp failed\n" );
+        exit( 2 );
+    }
+
+    writeFile( tmpl, "/proc/meminfo",
+               "MemTotal:       16777216 kB\n"
+               "MemFree:         4194304 kB\n"
+               "MemAvailable:    8388608 kB\n" );
+
+    return tmpl;
+}
+
+static void removeRoot( const std::string &root )
+{
+    std::string cmd = "rm -rf '" + root + "'";
+
+    if ( system( cmd.c_str() ) != 0 )
+    {
+        printf( "could not remove %s\n", root.c_str() );
+    }
+}
+
+static void expect( const char* test, const char* what,
+                    unsigned long long value, unsigned long long expected )
+{
+    if ( value != expected )
+    {
+        printf( "FAIL %s : %s = %llu, expected %llu\n",
+                test, what, value, expected );
+        failures++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+// container with own cgroup namespace, limits at root of namespace.
+static void testNamespaceRoot()
+{
+    std::string root = makeRoot( "nsroot" );
+
+    writeFile( root, "/proc/self/cgroup", "0::/\n" );
+    writeFile( root, "/sys/fs/cgroup/memory.max", "1073741824\n" );
+    writeFile( root, "/sys/fs/cgroup/memory.current", "268435456\n" );
+    writeFile( root, "/sys/fs/cgroup/cpu.max", "250000 100000\n" );
+
+    sysinfoRoot( root.c_str() );
+
+    expect( "namespace root", "headroom", cgroupHeadroom(), 805306368ULL );
+    expect( "namespace root", "cpu quota", cgroupCpuQuota(), 2500ULL );
+    expect( "namespace root", "memory", availableMemorySize(), 805306368ULL );
+
+    sysinfoRoot( NULL );
+    removeRoot( root );
+}
+
+// host, root of cgroup tree has no limit files.
+static void testHostRoot()
+{
+    std::string root = makeRoot( "host" );
+
+    writeFile( root, "/proc/self/cgroup", "0::/\n" );
+    writeFile( root, "/sys/fs/cgroup/cgroup.controllers", "cpu memory\n" );
+
+    sysinfoRoot( root.c_str() );
+
+    expect( "host root", "headroom", cgroupHeadroom(), UNLIMITED );
+    expect( "host root", "cpu quota", cgroupCpuQuota(), UNLIMITED );
+    expect( "host root", "memory", availableMemorySize(), 8589934592ULL );
+
+    sysinfoRoot( NULL );
+    removeRoot( root );
+}
+
+// no namespace, smallest limit of ancestors wins.
+static void testAncestors()
+{
+    std::string root = makeRoot( "nested" );
+
+    writeFile( root, "/proc/self/cgroup", "0::/pod/app\n" );
+    writeFile( root, "/sys/fs/cgroup/pod/memory.max", "536870912\n" );
+    writeFile( root, "/sys/fs/cgroup/pod/app/memory.max", "max\n" );
+    writeFile( root, "/sys/fs/cgroup/pod/app/memory.current", "134217728\n" );
+    writeFile( root, "/sys/fs/cgroup/pod/cpu.max", "max 100000\n" );
+    writeFile( root, "/sys/fs/cgroup/pod/app/cpu.max", "150000 100000\n" );
+
+    sysinfoRoot( root.c_str() );
+
+    expect( "ancestors", "headroom", cgroupHeadroom(), 536870912ULL );
+    expect( "ancestors", "cpu quota", cgroupCpuQuota(), 1500ULL );
+
+    sysinfoRoot( NULL );
+    removeRoot( root );
+}
+
+// v1 controllers, path of other namespace falls back to own root.
+static void testVersion1()
+{
+    std::string root = makeRoot( "v1" );
+
+    writeFile( root, "/proc/self/cgroup",
+               "5:cpu,cpuacct:/docker/abc\n"
+               "4:memory:/docker/abc\n" );
+    writeFile( root, "/sys/fs/cgroup/memory/memory.limit_in_bytes",
+               "2147483648\n" );
+    writeFile( root, "/sys/fs/cgroup/memory/memory.usage_in_bytes",
+               "1073741824\n" );
+    writeFile( root, "/sys/fs/cgroup/cpu/cpu.cfs_quota_us", "50000\n" );
+    writeFile( root, "/sys/fs/cgroup/cpu/cpu.cfs_period_us", "100000\n" );
+
+    sysinfoRoot( root.c_str() );
+
+    expect( "v1", "headroom", cgroupHeadroom(), 1073741824ULL );
+    expect( "v1", "cpu quota", cgroupCpuQuota(), 500ULL );
+
+    sysinfoRoot( NULL );
+    removeRoot( root );
+}
+
+int main( int argc, char** argv )
+{
+    testNamespaceRoot();
+    testHostRoot();
+    testAncestors();
+    testVersion1();
+
+    if ( failures > 0 )
+    {
+        printf( "%u failure(s).\n", failures );
+        return 1;
+    }
+
+    printf( "sysinfo tests passed.\n" );
+
+    return 0;
+}
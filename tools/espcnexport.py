@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+#
+# Writes src/espcndata.h from weights files of espcntrain, see there.
+#
+#   python3 tools/espcnexport.py w2.bin w3.bin w4.bin src/espcndata.h
+#
+# Training is in Y of 0 ~ 1, engine runs Y of 0 ~ 255, so the first layer
+# is divided and the sub-pixel layer multiplied by 255.
+
+import struct
+import sys
+
+N1, K1, N2, K2, K3 = 32, 5, 16, 3, 3
+
+HEADER = '''#ifndef __ESPCNDATA_H__
+#define __ESPCNDATA_H__
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Weights of LR space engine, ESPCN style 5-3-3 network.
+//
+// Layers run at source size, the last layer makes scale x scale phases
+// of residual to bicubic resized Y, shuffled into output pixels.
+// Trained with Y of Pictures/castle.jpg ( 8 flips and rotations ),
+// low resolution made by bicubic of frawscale, Adam for 40000 steps of
+// 16 x 16 patches, mean squared error.
+//
+// Demonstration weights : trained on one image only, they show the engine
+// rather than make a general model. Generated by tools/espcntrain.cpp and
+// tools/espcnexport.py, commands to reproduce are in espcntrain.cpp.
+//
+// Kernels are ordered [row][column], for Y in range of 0 ~ 255.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// the first convolutional layer size
+#define ESPCN_CONV1_FILTERS     32
+#define ESPCN_CONV1_SIZE        5
+
+// the second convolutional layer size
+#define ESPCN_CONV2_FILTERS     16
+#define ESPCN_CONV2_SIZE        3
+
+// the sub-pixel layer, scale x scale filters
+#define ESPCN_CONV3_SIZE        3
+
+typedef float ESPCNKernel1[ESPCN_CONV1_FILTERS][ESPCN_CONV1_SIZE][ESPCN_CONV1_SIZE];
+typedef float ESPCNKernel2[ESPCN_CONV2_FILTERS][ESPCN_CONV1_FILTERS][ESPCN_CONV2_SIZE][ESPCN_CONV2_SIZE];
+typedef float ESPCNBias1[ESPCN_CONV1_FILTERS];
+typedef float ESPCNBias2[ESPCN_CONV2_FILTERS];
+'''
+
+SCALE = '''
+/* --------------------------------- x%(r)d --------------------------------- */
+
+/* The %(n1)d cell bias in the first layer */
+const ESPCNBias1 espcn_x%(r)d_biases1 = \\
+{
+%(b1)s
+};
+
+/* The %(n1)d convolutional kernel(5*5) in the first layer */
+const ESPCNKernel1 espcn_x%(r)d_weights1 = \\
+{
+%(w1)s
+};
+
+/* The %(n2)d cell bias in the second layer */
+const ESPCNBias2 espcn_x%(r)d_biases2 = \\
+{
+%(b2)s
+};
+
+/* The %(n2)d x %(n1)d convolutional kernel(3*3) in the second layer */
+const ESPCNKernel2 espcn_x%(r)d_weights2 = \\
+{
+%(w2)s
+};
+
+/* The %(ro)d phases bias in the sub-pixel layer */
+const float espcn_x%(r)d_biases3[%(ro)d] = \\
+{
+%(b3)s
+};
+
+/* The %(ro)d phases x %(n2)d convolutional kernel(3*3) in the sub-pixel layer */
+const float espcn_x%(r)d_weights3[%(ro)d][ESPCN_CONV2_FILTERS][ESPCN_CONV3_SIZE][ESPCN_CONV3_SIZE] = \\
+{
+%(w3)s
+};
+'''
+
+FOOTER = '\n#endif /// of __ESPCNDATA_H__\n'
+
+
+# values in lines of per, with //NN label before each block of blk.
+def rows(vals, per, blk, label=True):
+    lines = []
+    for b in range(len(vals) // blk):
+        if label:
+            lines.append('    //%02d' % (b + 1))
+        chunk = vals[b * blk:(b + 1) * blk]
+        for i in range(0, len(chunk), per):
+            lines.append('    ' + ', '.join('%+.6e' % v for v in chunk[i:i + per]) + ',')
+    return '\n'.join(lines)
+
+
+def scale(r, fname):
+    data = open(fname, 'rb').read()
+    vals = list(struct.unpack('<%df' % (len(data) // 4), data))
+    ro = r * r
+    pos = [0]
+
+    def take(n):
+        v = vals[pos[0]:pos[0] + n]
+        pos[0] += n
+        return v
+
+    w1 = [v / 255. for v in take(N1 * K1 * K1)]
+    b1 = take(N1)
+    w2 = take(N2 * N1 * K2 * K2)
+    b2 = take(N2)
+    w3 = [v * 255. for v in take(ro * N2 * K3 * K3)]
+    b3 = [v * 255. for v in take(ro)]
+
+    if pos[0] != len(vals):
+        sys.exit('%s is not weights of x%d' % (fname, r))
+
+    return SCALE % {
+        'r': r, 'ro': ro, 'n1': N1, 'n2': N2,
+        'b1': rows(b1, 8, N1, False),
+        'w1': rows(w1, 5, K1 * K1),
+        'b2': rows(b2, 8, N2, False),
+        'w2': rows(w2, 9, N1 * K2 * K2),
+        'b3': rows(b3, r, ro, False),
+        'w3': rows(w3, 9, N2 * K3 * K3),
+    }
+
+
+def main():
+    if len(sys.argv) < 5:
+        sys.exit('usage: %s (x2 weights) (x3 weights) (x4 weights) (output header)' % sys.argv[0])
+
+    out = [HEADER]
+    for r, fname in zip((2, 3, 4), sys.argv[1:4]):
+        out.append(scale(r, fname))
+    out.append(FOOTER)
+
+    open(sys.argv[4], 'w').write(''.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,705 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Trainer of weights in src/espcndata.h, ESPCN style 5-3-3 network of LR
+// space engine.
+//
+// Network learns scale x scale phases of residual between a high
+// resolution image and its bicubic ( frawscale ) resized low resolution
+// one, on Y of a single image in 8 flips and rotations. Adam, batches of
+// 16 random 16 x 16 patches, mean squared error, learning rate 1e-3 then
+// 3e-4 after 60% and 1e-4 after 85% of steps. Random numbers are seeded
+// by scale, so same build makes same weights.
+//
+// Weights are written as float32 arrays in order of weights1, biases1,
+// weights2, biases2, weights3, biases3, for Y in range of 0 ~ 1, each
+// 1000 steps. espcnexport.py converts them to src/espcndata.h.
+//
+// Bundled weights were made by these, from top directory, with g++ 12.2
+// on x86-64 ( -Ofast and -march=native change last bits by compiler and
+// CPU, other builds train to near but not same weights ) :
+//
+//   g++ -Ofast -march=native -fopenmp -Isrc tools/espcntrain.cpp \
+//       src/frawscale.cpp src/threadpool.cpp src/sysinfo.cpp \
+//       -lpng -ljpeg -o espcntrain
+//   ./espcntrain 2 40000 w2.bin Pictures/castle.jpg Pictures/butterfly.png
+//   ./espcntrain 3 40000 w3.bin Pictures/castle.jpg Pictures/butterfly.png
+//   ./espcntrain 4 40000 w4.bin Pictures/castle.jpg Pictures/butterfly.png
+//   python3 tools/espcnexport.py w2.bin w3.bin w4.bin src/espcndata.h
+//
+// Trained on one image, they are a demonstration of engine rather than
+// a general model, train with own images for real use.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <random>
+
+#include <png.h>
+#include <jpeglib.h>
+
+#include "frawscale.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+#define N1      32      /// filters of layer I and II.
+#define K1      5       /// kernel size of layers.
+#define N2      16
+#define K2      3
+#define K3      3
+#define P       16      /// patch size at low resolution.
+#define BATCH   16
+
+typedef struct
+{
+    unsigned            w;
+    unsigned            h;
+    std::vector<float>  p;
+}Img;
+
+// low resolution, its bicubic resized, and high resolution image.
+typedef struct
+{
+    Img     lr;
+    Img     up;
+    Img     hr;
+}Set;
+
+typedef struct
+{
+    unsigned            r;
+    unsigned            ro;     /// phases of sub-pixel layer, r x r.
+    std::vector<float>  w1;
+    std::vector<float>  b1;
+    std::vector<float>  w2;
+    std::vector<float>  b2;
+    std::vector<float>  w3;
+    std::vector<float>  b3;
+}Net;
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool loadJPG( const char* fname, Img &y )
+{
+    FILE* fp = fopen( fname, "rb" );
+
+    if ( fp == NULL )
+        return false;
+
+    jpeg_decompress_struct c;
+    jpeg_error_mgr         e;
+
+    c.err = jpeg_std_error( &e );
+
+    jpeg_create_decompress( &c );
+    jpeg_stdio_src( &c, fp );
+    jpeg_read_header( &c, TRUE );
+
+    c.out_color_space = JCS_RGB;
+    jpeg_start_decompress( &c );
+
+    y.w = c.output_width;
+    y.h = c.output_height;
+    y.p.resize( y.w * y.h );
+
+    std::vector<unsigned char> row( y.w * 3 );
+
+    while( c.output_scanline < c.output_height )
+    {
+        unsigned       r  = c.output_scanline;
+        unsigned char* rp = row.data();
+
+        jpeg_read_scanlines( &c, &rp, 1 );
+
+        for ( unsigned x=0; x<y.w; x++ )
+        {
+            y.p[r*y.w+x] = 0.299f*row[x*3] + 0.587f*row[x*3+1] + 0.114f*row[x*3+2];
+        }
+    }
+
+    jpeg_finish_decompress( &c );
+    jpeg_destroy_decompress( &c );
+    fclose( fp );
+
+    return true;
+}
+
+bool loadPNG( const char* fname, Img &y )
+{
+    png_image im;
+    memset( &im, 0, sizeof( im ) );
+    im.version = PNG_IMAGE_VERSION;
+
+    if ( png_image_begin_read_from_file( &im, fname ) == 0 )
+        return false;
+
+    im.format = PNG_FORMAT_RGB;
+
+    std::vector<unsigned char> b( PNG_IMAGE_SIZE( im ) );
+
+    if ( png_image_finish_read( &im, NULL, b.data(), 0, NULL ) == 0 )
+        return false;
+
+    y.w = im.width;
+    y.h = im.height;
+    y.p.resize( y.w * y.h );
+
+    for ( unsigned i=0; i<y.w*y.h; i++ )
+    {
+        y.p[i] = 0.299f*b[i*3] + 0.587f*b[i*3+1] + 0.114f*b[i*3+2];
+    }
+
+    return true;
+}
+
+// Y of JPEG or PNG by extension.
+bool loadY( const char* fname, Img &y )
+{
+    const char* ext = strrchr( fname, '.' );
+
+    if ( ( ext != NULL ) && ( strcasecmp( ext, ".png" ) == 0 ) )
+        return loadPNG( fname, y );
+
+    return loadJPG( fname, y );
+}
+
+Img resize( const Img &s, unsigned w, unsigned h )
+{
+    FRAWBicubicFilter f;
+    FRAWResizeEngine  e( &f );
+    float*            o = NULL;
+
+    e.scale( s.p.data(), s.w, s.h, w, h, &o );
+
+    Img r;
+    r.w = w;
+    r.h = h;
+    r.p.assign( o, o + w * h );
+
+    delete[] o;
+
+    return r;
+}
+
+// one of 8 flips and rotations by bits of t.
+Img xform( const Img &s, int t )
+{
+    Img  r;
+    bool sw = t & 4;
+
+    r.w = sw ? s.h : s.w;
+    r.h = sw ? s.w : s.h;
+    r.p.resize( r.w * r.h );
+
+    for ( unsigned y=0; y<r.h; y++ )
+    {
+        for ( unsigned x=0; x<r.w; x++ )
+        {
+            unsigned sx = sw ? y : x;
+            unsigned sy = sw ? x : y;
+
+            if ( t & 1 )
+                sx = s.w - 1 - sx;
+
+            if ( t & 2 )
+                sy = s.h - 1 - sy;
+
+            r.p[y*r.w+x] = s.p[sy*s.w+sx];
+        }
+    }
+
+    return r;
+}
+
+// high resolution cropped to multiple of r.
+Set makeSetOf( const Img &h, unsigned r )
+{
+    unsigned lw = h.w / r;
+    unsigned lh = h.h / r;
+
+    Img hc;
+    hc.w = lw * r;
+    hc.h = lh * r;
+    hc.p.resize( hc.w * hc.h );
+
+    for ( unsigned y=0; y<hc.h; y++ )
+    {
+        memcpy( &hc.p[y*hc.w], &h.p[y*h.w], hc.w * 4 );
+    }
+
+    Set s;
+    s.hr = hc;
+    s.lr = resize( hc, lw, lh );
+    s.up = resize( s.lr, hc.w, hc.h );
+
+    return s;
+}
+
+void makeSet( const Img &hr0, unsigned r, std::vector<Set> &v )
+{
+    for ( int t=0; t<8; t++ )
+    {
+        v.push_back( makeSetOf( xform( hr0, t ), r ) );
+    }
+}
+
+/* --
+ * Forward and backward of a low resolution patch of ( P + 8 )^2 pixels,
+ * returns sum of squared errors and adds gradients to g. Forward only
+ * with pred, writes phases of P x P outputs to it.
+ */
+double fb( const Net &n, const float* x, const float* t, Net &g, float* pred )
+{
+    const unsigned S0 = P + 8;
+    const unsigned S1 = P + 4;
+    const unsigned S2 = P + 2;
+    const unsigned S3 = P;
+    unsigned       ro = n.ro;
+
+    static std::vector<float> h1, h2, o, d3, d2, d1;
+
+    h1.assign( N1*S1*S1, 0 );
+    h2.assign( N2*S2*S2, 0 );
+    o.assign( ro*S3*S3, 0 );
+
+    for ( unsigned k=0; k<N1; k++ )
+    {
+        float* hp = &h1[k*S1*S1];
+
+        for ( unsigned i=0; i<S1*S1; i++ )
+            hp[i] = n.b1[k];
+
+        for ( unsigned a=0; a<K1; a++ )
+        for ( unsigned b=0; b<K1; b++ )
+        {
+            float w = n.w1[(k*K1+a)*K1+b];
+
+            for ( unsigned y=0; y<S1; y++ )
+            {
+                const float* xp = &x[(y+a)*S0+b];
+                float*       q  = &hp[y*S1];
+
+                for ( unsigned xx=0; xx<S1; xx++ )
+                    q[xx] += w * xp[xx];
+            }
+        }
+
+        for ( unsigned i=0; i<S1*S1; i++ )
+            hp[i] = hp[i] > 0 ? hp[i] : 0;
+    }
+
+    for ( unsigned k=0; k<N2; k++ )
+    {
+        float* hp = &h2[k*S2*S2];
+
+        for ( unsigned i=0; i<S2*S2; i++ )
+            hp[i] = n.b2[k];
+
+        for ( unsigned c=0; c<N1; c++ )
+        for ( unsigned a=0; a<K2; a++ )
+        for ( unsigned b=0; b<K2; b++ )
+        {
+            float w = n.w2[((k*N1+c)*K2+a)*K2+b];
+
+            for ( unsigned y=0; y<S2; y++ )
+            {
+                const float* xp = &h1[c*S1*S1+(y+a)*S1+b];
+                float*       q  = &hp[y*S2];
+
+                for ( unsigned xx=0; xx<S2; xx++ )
+                    q[xx] += w * xp[xx];
+            }
+        }
+
+        for ( unsigned i=0; i<S2*S2; i++ )
+            hp[i] = hp[i] > 0 ? hp[i] : 0;
+    }
+
+    for ( unsigned k=0; k<ro; k++ )
+    {
+        float* hp = &o[k*S3*S3];
+
+        for ( unsigned i=0; i<S3*S3; i++ )
+            hp[i] = n.b3[k];
+
+        for ( unsigned c=0; c<N2; c++ )
+        for ( unsigned a=0; a<K3; a++ )
+        for ( unsigned b=0; b<K3; b++ )
+        {
+            float w = n.w3[((k*N2+c)*K3+a)*K3+b];
+
+            for ( unsigned y=0; y<S3; y++ )
+            {
+                const float* xp = &h2[c*S2*S2+(y+a)*S2+b];
+                float*       q  = &hp[y*S3];
+
+                for ( unsigned xx=0; xx<S3; xx++ )
+                    q[xx] += w * xp[xx];
+            }
+        }
+    }
+
+    if ( pred != NULL )
+    {
+        memcpy( pred, o.data(), o.size() * 4 );
+        return 0;
+    }
+
+    double loss = 0;
+
+    d3.assign( ro*S3*S3, 0 );
+
+    for ( unsigned i=0; i<ro*S3*S3; i++ )
+    {
+        float d = o[i] - t[i];
+
+        loss += d * d;
+        d3[i] = 2 * d;
+    }
+
+    d2.assign( N2*S2*S2, 0 );
+    d1.assign( N1*S1*S1, 0 );
+
+    for ( unsigned k=0; k<ro; k++ )
+    {
+        const float* dp = &d3[k*S3*S3];
+        double       bs = 0;
+
+        for ( unsigned i=0; i<S3*S3; i++ )
+            bs += dp[i];
+
+        g.b3[k] += bs;
+
+        for ( unsigned c=0; c<N2; c++ )
+        for ( unsigned a=0; a<K3; a++ )
+        for ( unsigned b=0; b<K3; b++ )
+        {
+            float w  = n.w3[((k*N2+c)*K3+a)*K3+b];
+            float gs = 0;
+
+            for ( unsigned y=0; y<S3; y++ )
+            {
+                const float* xp = &h2[c*S2*S2+(y+a)*S2+b];
+                float*       dq = &d2[c*S2*S2+(y+a)*S2+b];
+                const float* dd = &dp[y*S3];
+
+                for ( unsigned xx=0; xx<S3; xx++ )
+                {
+                    gs     += dd[xx] * xp[xx];
+                    dq[xx] += w * dd[xx];
+                }
+            }
+
+            g.w3[((k*N2+c)*K3+a)*K3+b] += gs;
+        }
+    }
+
+    for ( unsigned i=0; i<N2*S2*S2; i++ )
+    {
+        if ( h2[i] <= 0 )
+            d2[i] = 0;
+    }
+
+    for ( unsigned k=0; k<N2; k++ )
+    {
+        const float* dp = &d2[k*S2*S2];
+        double       bs = 0;
+
+        for ( unsigned i=0; i<S2*S2; i++ )
+            bs += dp[i];
+
+        g.b2[k] += bs;
+
+        for ( unsigned c=0; c<N1; c++ )
+        for ( unsigned a=0; a<K2; a++ )
+        for ( unsigned b=0; b<K2; b++ )
+        {
+            float w  = n.w2[((k*N1+c)*K2+a)*K2+b];
+            float gs = 0;
+
+            for ( unsigned y=0; y<S2; y++ )
+            {
+                const float* xp = &h1[c*S1*S1+(y+a)*S1+b];
+                float*       dq = &d1[c*S1*S1+(y+a)*S1+b];
+                const float* dd = &dp[y*S2];
+
+                for ( unsigned xx=0; xx<S2; xx++ )
+                {
+                    gs     += dd[xx] * xp[xx];
+                    dq[xx] += w * dd[xx];
+                }
+            }
+
+            g.w2[((k*N1+c)*K2+a)*K2+b] += gs;
+        }
+    }
+
+    for ( unsigned i=0; i<N1*S1*S1; i++ )
+    {
+        if ( h1[i] <= 0 )
+            d1[i] = 0;
+    }
+
+    for ( unsigned k=0; k<N1; k++ )
+    {
+        const float* dp = &d1[k*S1*S1];
+        double       bs = 0;
+
+        for ( unsigned i=0; i<S1*S1; i++ )
+            bs += dp[i];
+
+        g.b1[k] += bs;
+
+        for ( unsigned a=0; a<K1; a++ )
+        for ( unsigned b=0; b<K1; b++ )
+        {
+            float gs = 0;
+
+            for ( unsigned y=0; y<S1; y++ )
+            {
+                const float* xp = &x[(y+a)*S0+b];
+                const float* dd = &dp[y*S1];
+
+                for ( unsigned xx=0; xx<S1; xx++ )
+                    gs += dd[xx] * xp[xx];
+            }
+
+            g.w1[(k*K1+a)*K1+b] += gs;
+        }
+    }
+
+    return loss;
+}
+
+// input patch at ( px, py ) of low resolution, and residual of phases.
+void getPatch( const Set &s, unsigned r, unsigned px, unsigned py,
+               float* x, float* t )
+{
+    const unsigned S0 = P + 8;
+
+    for ( unsigned y=0; y<S0; y++ )
+    {
+        for ( unsigned xx=0; xx<S0; xx++ )
+            x[y*S0+xx] = s.lr.p[(py+y)*s.lr.w+px+xx] / 255.f;
+    }
+
+    if ( t == NULL )
+        return;
+
+    for ( unsigned i=0; i<P; i++ )
+    for ( unsigned j=0; j<P; j++ )
+    for ( unsigned a=0; a<r; a++ )
+    for ( unsigned b=0; b<r; b++ )
+    {
+        unsigned hy = (py+4+i)*r + a;
+        unsigned hx = (px+4+j)*r + b;
+
+        t[(a*r+b)*P*P+i*P+j] = ( s.hr.p[hy*s.hr.w+hx] - s.up.p[hy*s.hr.w+hx] ) / 255.f;
+    }
+}
+
+// PSNR of network and of bicubic on validation image.
+double evalPSNR( Net &n, const Img &hr0, unsigned r, double &base )
+{
+    Set s = makeSetOf( hr0, r );
+
+    unsigned lw = s.lr.w;
+    unsigned lh = s.lr.h;
+    double   se = 0;
+    double   sb = 0;
+    unsigned cnt = 0;
+
+    std::vector<float> x( (P+8)*(P+8) );
+    std::vector<float> o( n.ro*P*P );
+
+    for ( unsigned py=0; py+P+8<=lh; py+=P )
+    for ( unsigned px=0; px+P+8<=lw; px+=P )
+    {
+        getPatch( s, r, px, py, x.data(), NULL );
+        fb( n, x.data(), NULL, n, o.data() );
+
+        for ( unsigned i=0; i<P; i++ )
+        for ( unsigned j=0; j<P; j++ )
+        for ( unsigned a=0; a<r; a++ )
+        for ( unsigned b=0; b<r; b++ )
+        {
+            unsigned hy = (py+4+i)*r + a;
+            unsigned hx = (px+4+j)*r + b;
+            float    up = s.up.p[hy*s.hr.w+hx];
+            float    pr = up + 255.f * o[(a*r+b)*P*P+i*P+j];
+            float    u2 = up < 0 ? 0 : up > 255 ? 255 : up;
+            float    hv = s.hr.p[hy*s.hr.w+hx];
+
+            pr = pr < 0 ? 0 : pr > 255 ? 255 : pr;
+
+            se += ( pr - hv ) * ( pr - hv );
+            sb += ( u2 - hv ) * ( u2 - hv );
+            cnt++;
+        }
+    }
+
+    base = 10 * log10( 255. * 255. / ( sb / cnt ) );
+
+    return 10 * log10( 255. * 255. / ( se / cnt ) );
+}
+
+void zeroNet( Net &a )
+{
+    std::vector<float>* parts[6] = { &a.w1, &a.b1, &a.w2, &a.b2, &a.w3, &a.b3 };
+
+    for ( int cnt=0; cnt<6; cnt++ )
+    {
+        for ( size_t i=0; i<parts[cnt]->size(); i++ )
+            (*parts[cnt])[i] = 0;
+    }
+}
+
+void initWeights( std::mt19937 &rng, std::vector<float> &w, size_t count,
+                  size_t fan, float sc )
+{
+    std::normal_distribution<float> d( 0, sc * sqrtf( 2.f / fan ) );
+
+    w.resize( count );
+
+    for ( size_t i=0; i<count; i++ )
+        w[i] = d( rng );
+}
+
+bool saveNet( Net &n, const char* fname )
+{
+    FILE* fp = fopen( fname, "wb" );
+
+    if ( fp == NULL )
+        return false;
+
+    std::vector<float>* parts[6] = { &n.w1, &n.b1, &n.w2, &n.b2, &n.w3, &n.b3 };
+
+    for ( int cnt=0; cnt<6; cnt++ )
+        fwrite( parts[cnt]->data(), 4, parts[cnt]->size(), fp );
+
+    fclose( fp );
+
+    return true;
+}
+
+int main( int argc, char** argv )
+{
+    if ( argc < 5 )
+    {
+        printf( "usage: %s (scale) (steps) (weights file) (training image) [validation image]\n",
+                argv[0] );
+        return 1;
+    }
+
+    unsigned    r     = atoi( argv[1] );
+    unsigned    iters = atoi( argv[2] );
+    const char* out   = argv[3];
+
+    Img train;
+    Img valid;
+
+    if ( loadY( argv[4], train ) == false )
+    {
+        printf( "cannot read %s\n", argv[4] );
+        return 2;
+    }
+
+    // training image validates itself without other.
+    if ( ( argc < 6 ) || ( loadY( argv[5], valid ) == false ) )
+        valid = train;
+
+    std::vector<Set> sets;
+    makeSet( train, r, sets );
+
+    std::mt19937 rng( 1234 + r );
+
+    Net n;
+    n.r  = r;
+    n.ro = r * r;
+
+    initWeights( rng, n.w1, N1*K1*K1, K1*K1, 1 );
+    n.b1.assign( N1, 0.01f );
+    initWeights( rng, n.w2, N2*N1*K2*K2, N1*K2*K2, 1 );
+    n.b2.assign( N2, 0.01f );
+    initWeights( rng, n.w3, n.ro*N2*K3*K3, N2*K3*K3, 0.1f );
+    n.b3.assign( n.ro, 0 );
+
+    // gradients and moments of Adam.
+    Net g = n;
+    Net m = n;
+    Net v = n;
+
+    zeroNet( m );
+    zeroNet( v );
+
+    std::vector<float> x( (P+8)*(P+8) );
+    std::vector<float> t( n.ro*P*P );
+
+    double b0 = 0;
+    double p0 = evalPSNR( n, valid, r, b0 );
+
+    printf( "x%u start psnr %.3f bicubic %.3f\n", r, p0, b0 );
+    fflush( stdout );
+
+    double lacc = 0;
+
+    std::vector<float>* pn[6] = { &n.w1, &n.b1, &n.w2, &n.b2, &n.w3, &n.b3 };
+    std::vector<float>* pg[6] = { &g.w1, &g.b1, &g.w2, &g.b2, &g.w3, &g.b3 };
+    std::vector<float>* pm[6] = { &m.w1, &m.b1, &m.w2, &m.b2, &m.w3, &m.b3 };
+    std::vector<float>* pv[6] = { &v.w1, &v.b1, &v.w2, &v.b2, &v.w3, &v.b3 };
+
+    for ( unsigned it=1; it<=iters; it++ )
+    {
+        zeroNet( g );
+
+        for ( unsigned bi=0; bi<BATCH; bi++ )
+        {
+            const Set &s = sets[ rng() % sets.size() ];
+
+            unsigned px = rng() % ( s.lr.w - P - 8 );
+            unsigned py = rng() % ( s.lr.h - P - 8 );
+
+            getPatch( s, r, px, py, x.data(), t.data() );
+            lacc += fb( n, x.data(), t.data(), g, NULL );
+        }
+
+        float lr = 1e-3f * ( it < iters * 0.6 ? 1.f : it < iters * 0.85 ? 0.3f : 0.1f );
+        float sc = 1.f / ( BATCH * n.ro * P * P );
+        float c1 = 1 - powf( 0.9f, it );
+        float c2 = 1 - powf( 0.999f, it );
+
+        for ( int a=0; a<6; a++ )
+        {
+            for ( size_t i=0; i<pn[a]->size(); i++ )
+            {
+                float  gg = (*pg[a])[i] * sc;
+                float &mm = (*pm[a])[i];
+                float &vv = (*pv[a])[i];
+
+                mm = 0.9f * mm + 0.1f * gg;
+                vv = 0.999f * vv + 0.001f * gg * gg;
+
+                (*pn[a])[i] -= lr * ( mm / c1 ) / ( sqrtf( vv / c2 ) + 1e-8f );
+            }
+        }
+
+        if ( it % 1000 == 0 )
+        {
+            double b = 0;
+            double p = evalPSNR( n, valid, r, b );
+
+            printf( "it %u loss %.6g psnr %.3f (bicubic %.3f)\n",
+                    it, lacc / 1000 / BATCH / n.ro / P / P * 255 * 255, p, b );
+            fflush( stdout );
+
+            lacc = 0;
+
+            saveNet( n, out );
+        }
+    }
+
+    return 0;
+}